@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/length.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+#include <vector>
+
+using namespace bix;
+
+namespace {
+void BM_LengthParse(benchmark::State& state) {
+    const std::vector<std::string_view> inputs = {"12.5dp", "50%", "auto", "120px", "33.3vw", "stretch", "8", "100vh"};
+    for (auto _ : state) {
+        for (auto s : inputs) { benchmark::DoNotOptimize(Length::parse(s)); }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(inputs.size()));
+}
+} // namespace
+
+BENCHMARK(BM_LengthParse);
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/spatial_grid.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace bix;
+
+namespace {
+// A grid view with 50k cells of 40x20 in a 1920x1080 window, scrolled so that only the cells inside the window
+// have non-empty clipped bounds, like the Scene feeds them.
+SpatialGrid makeGridView(int cells) {
+    SpatialGrid grid;
+    grid.reset({0, 0, 1920, 1080});
+    constexpr int kColumns = 48;
+    grid.update(0, {0, 0, 1920, 1080});
+    for (int i = 0; i < cells; ++i) {
+        const float x = static_cast<float>(i % kColumns) * 40.f;
+        const float y = static_cast<float>(i / kColumns) * 20.f;
+        const Rect cell(x, y, x + 40.f, y + 20.f);
+        grid.update(static_cast<SpatialGrid::Id>(i + 1), cell.intersected({0, 0, 1920, 1080}));
+    }
+    return grid;
+}
+
+void BM_GridHover(benchmark::State& state) {
+    const auto grid = makeGridView(static_cast<int>(state.range(0)));
+    Point p{0, 0};
+    for (auto _ : state) {
+        p = {p.x >= 1900.f ? 0.f : p.x + 13.f, p.y >= 1060.f ? 0.f : p.y + 7.f};
+        benchmark::DoNotOptimize(grid.hitTest(p));
+    }
+}
+
+void BM_GridDirtyRect(benchmark::State& state) {
+    const auto grid = makeGridView(static_cast<int>(state.range(0)));
+    std::vector<SpatialGrid::Id> ids;
+    for (auto _ : state) {
+        grid.query({400, 300, 560, 380}, ids);
+        benchmark::DoNotOptimize(ids.data());
+    }
+}
+
+void BM_GridScroll(benchmark::State& state) {
+    auto grid = makeGridView(static_cast<int>(state.range(0)));
+    constexpr int kColumns = 48;
+    const auto cells = static_cast<int>(state.range(0));
+    float offset = 0;
+    for (auto _ : state) {
+        offset = offset >= 200.f ? 0.f : offset + 10.f;
+        // Only the rows near the top of the window are moved, the grid touches their cells alone.
+        for (int i = 0; i < kColumns * 4 && i < cells; ++i) {
+            const float x = static_cast<float>(i % kColumns) * 40.f;
+            const float y = static_cast<float>(i / kColumns) * 20.f + offset;
+            grid.update(static_cast<SpatialGrid::Id>(i + 1), {x, y, x + 40.f, y + 20.f});
+        }
+    }
+}
+} // namespace
+
+BENCHMARK(BM_GridHover)->Arg(1'000)->Arg(50'000);
+BENCHMARK(BM_GridDirtyRect)->Arg(1'000)->Arg(50'000);
+BENCHMARK(BM_GridScroll)->Arg(50'000);
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/scene.h>
+#include <bixlib/graphics/colors.h>
+#include <bixlib/widgets/container.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "null_canvas.h"
+
+using namespace bix;
+
+namespace {
+constexpr int kFanOut = 16;
+
+class BenchLeaf : public LeafWidget {
+public:
+    BIX_WIDGET_DECLARE(BenchLeaf)
+
+    void onPaint(Canvas& canvas) override { BIX_UNUSED(canvas) }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        BIX_UNUSED(canvas)
+        BIX_UNUSED(max)
+        setMeasuredSize({std::min(available.width, 120.f), 20.f});
+    }
+};
+
+/** Stacks its children vertically, enough to give the layout pass real work on every level. */
+class BenchColumn : public Container {
+public:
+    BIX_WIDGET_DECLARE(BenchColumn)
+
+    void onPaint(Canvas& canvas) override { BIX_UNUSED(canvas) }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        Size total{0, 0};
+        for (const auto& child : mChildren) {
+            child->measure(canvas, available, max);
+            const Size s = child->measuredSize();
+            total.width = std::max(total.width, s.width);
+            total.height += s.height;
+        }
+        setMeasuredSize(total);
+    }
+
+    void onLayout(const Rect& rect) override {
+        BIX_UNUSED(rect)
+        float y = 0;
+        for (const auto& child : mChildren) {
+            child->layout({0, y, child->measuredSize()});
+            y += child->measuredSize().height;
+        }
+    }
+};
+
+class NullHost : public WidgetHost {
+public:
+    void scheduleFrame(const Rect& dirtyRect) override { BIX_UNUSED(dirtyRect) }
+
+    void requestLayout() override {}
+
+    void captureFocus(Widget* widget) override { BIX_UNUSED(widget) }
+};
+
+/** Builds a tree of columns with kFanOut children each until it holds the requested number of nodes. */
+WidgetPtr buildTree(int64_t nodes) {
+    auto root = std::make_unique<BenchColumn>();
+    std::vector<BenchColumn*> level{root.get()};
+    int64_t count = 1;
+    while (count < nodes) {
+        std::vector<BenchColumn*> next;
+        for (auto* parent : level) {
+            for (int i = 0; i < kFanOut && count < nodes; ++i, ++count) {
+                if (count + kFanOut < nodes) {
+                    next.push_back(parent->addChild<BenchColumn>());
+                } else {
+                    parent->addChild<BenchLeaf>()->setBackground(i % 2 ? colors::White : colors::Gray);
+                }
+            }
+        }
+        level = std::move(next);
+        if (level.empty()) { break; }
+    }
+    return root;
+}
+
+struct TreeFixture {
+    explicit TreeFixture(int64_t nodes) : scene(&host) {
+        scene.setRoot(buildTree(nodes));
+        scene.resize({1920, 1080});
+    }
+
+    NullHost host;
+    Scene scene;
+    bench::NullCanvas canvas;
+};
+
+// Alternating between two window widths changes the root constraints, so every pass misses the measure cache and
+// visits the whole tree.
+void BM_TreeLayout(benchmark::State& state) {
+    TreeFixture f(state.range(0));
+    bool wide = false;
+    for (auto _ : state) {
+        wide = !wide;
+        f.scene.resize({wide ? 1920.f : 1280.f, 1080.f});
+        benchmark::DoNotOptimize(f.scene.performLayout(f.canvas));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Relayout after the root requested it without any constraint change, the measure cache skips clean subtrees.
+void BM_TreeRelayoutClean(benchmark::State& state) {
+    TreeFixture f(state.range(0));
+    f.scene.performLayout(f.canvas);
+    for (auto _ : state) {
+        f.scene.root()->requestLayout();
+        benchmark::DoNotOptimize(f.scene.performLayout(f.canvas));
+    }
+}
+
+void BM_TreePaint(benchmark::State& state) {
+    TreeFixture f(state.range(0));
+    f.scene.performLayout(f.canvas);
+    for (auto _ : state) {
+        f.canvas.beginDraw();
+        f.scene.invalidateAll();
+        f.scene.paint(f.canvas);
+        benchmark::DoNotOptimize(f.canvas.calls());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TreeHitTest(benchmark::State& state) {
+    TreeFixture f(state.range(0));
+    f.scene.performLayout(f.canvas);
+    float y = 0;
+    for (auto _ : state) {
+        y = y >= 1080.f ? 0.f : y + 7.f;
+        benchmark::DoNotOptimize(f.scene.hitTest({60.f, y}));
+    }
+}
+} // namespace
+
+BENCHMARK(BM_TreeLayout)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TreeRelayoutClean)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TreePaint)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TreeHitTest)->Arg(1'000)->Arg(10'000)->Arg(100'000);
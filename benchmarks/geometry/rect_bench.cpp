@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/geometry/rect.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace bix;
+
+namespace {
+template <typename T>
+std::vector<geom::RectT<T>> makeRects(size_t n) {
+    std::vector<geom::RectT<T>> rects;
+    rects.reserve(n);
+    uint32_t seed = 17;
+    auto next = [&seed](uint32_t range) {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<T>((seed >> 8) % range);
+    };
+    for (size_t i = 0; i < n; ++i) {
+        const T left = next(1000);
+        const T top = next(1000);
+        rects.emplace_back(left, top, left + next(200) + 1, top + next(200) + 1);
+    }
+    return rects;
+}
+
+template <typename T>
+void BM_RectIntersected(benchmark::State& state) {
+    const auto rects = makeRects<T>(1024);
+    for (auto _ : state) {
+        for (size_t i = 1; i < rects.size(); ++i) { benchmark::DoNotOptimize(rects[i - 1].intersected(rects[i])); }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rects.size() - 1));
+}
+
+template <typename T>
+void BM_RectUnited(benchmark::State& state) {
+    const auto rects = makeRects<T>(1024);
+    for (auto _ : state) {
+        geom::RectT<T> bounds = rects.front();
+        for (const auto& r : rects) { bounds = bounds.united(r); }
+        benchmark::DoNotOptimize(bounds);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rects.size()));
+}
+
+template <typename T>
+void BM_RectContainsPoint(benchmark::State& state) {
+    const auto rects = makeRects<T>(1024);
+    const geom::PointT<T> p(static_cast<T>(500), static_cast<T>(500));
+    for (auto _ : state) {
+        int hits = 0;
+        for (const auto& r : rects) { hits += r.contains(p) ? 1 : 0; }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rects.size()));
+}
+
+void BM_RectAligned(benchmark::State& state) {
+    auto rects = makeRects<float>(1024);
+    for (auto& r : rects) { r = r.translated(0.25f, 0.75f); }
+    for (auto _ : state) {
+        for (const auto& r : rects) { benchmark::DoNotOptimize(r.aligned()); }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(rects.size()));
+}
+} // namespace
+
+BENCHMARK(BM_RectIntersected<int>);
+BENCHMARK(BM_RectIntersected<float>);
+BENCHMARK(BM_RectUnited<int>);
+BENCHMARK(BM_RectUnited<float>);
+BENCHMARK(BM_RectContainsPoint<int>);
+BENCHMARK(BM_RectContainsPoint<float>);
+BENCHMARK(BM_RectAligned);
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/colors.h>
+
+#include <benchmark/benchmark.h>
+
+#include "graphics/software/soft_canvas.h"
+
+#include <vector>
+
+using namespace bix;
+
+namespace {
+// A table of 40 rows of 8 cells with fractional column widths, the cells share their edges.
+std::vector<Rect> tableCells() {
+    std::vector<Rect> cells;
+    for (int row = 0; row < 40; ++row) {
+        const float top = static_cast<float>(row) * 12.f;
+        for (int column = 0; column < 8; ++column) {
+            const float left = static_cast<float>(column) * 60.5f;
+            cells.emplace_back(left, top, left + 60.5f, top + 12.f);
+        }
+    }
+    return cells;
+}
+
+// Argument: 0 fills every cell with its own call, 1 submits the table as one batch.
+void BM_FillTableCells(benchmark::State& state) {
+    SoftwareCanvas canvas({484, 480});
+    canvas.beginDraw();
+    auto brush = canvas.createColorBrush(colors::Gray);
+    const std::vector<Rect> cells = tableCells();
+    const bool batched = state.range(0) != 0;
+    state.SetLabel(batched ? "batched" : "individual");
+    for (auto _ : state) {
+        if (batched) {
+            canvas.fillRects(cells, *brush);
+        } else {
+            for (const Rect& cell : cells) { canvas.fillRectangle(cell, *brush); }
+        }
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(cells.size()));
+}
+
+// Argument: 0 draws every grid line with its own call, 1 submits the grid as one batch.
+void BM_DrawGridLines(benchmark::State& state) {
+    SoftwareCanvas canvas({480, 480});
+    canvas.beginDraw();
+    std::vector<geom::Line> grid;
+    for (int i = 0; i <= 40; ++i) {
+        const float at = static_cast<float>(i) * 12.f;
+        grid.emplace_back(0.f, at, 480.f, at);
+        grid.emplace_back(at, 0.f, at, 480.f);
+    }
+    const Pen pen(colors::Black, 1.f);
+    const bool batched = state.range(0) != 0;
+    state.SetLabel(batched ? "batched" : "individual");
+    for (auto _ : state) {
+        if (batched) {
+            canvas.drawLines(grid, pen);
+        } else {
+            for (const auto& line : grid) { canvas.drawLine(line, pen); }
+        }
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(grid.size()));
+}
+} // namespace
+
+BENCHMARK(BM_FillTableCells)->Arg(0)->Arg(1);
+BENCHMARK(BM_DrawGridLines)->Arg(0)->Arg(1);
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/image_cache.h>
+
+#include <benchmark/benchmark.h>
+
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+Bitmap makeIcon(int size) {
+    Bitmap icon({size, size});
+    uint32_t seed = 1;
+    for (int y = 0; y < size; ++y) {
+        auto* row = reinterpret_cast<uint32_t*>(icon.row(y));
+        for (int x = 0; x < size; ++x) {
+            seed = seed * 1664525u + 1013904223u;
+            row[x] = seed | 0xFF000000u;
+        }
+    }
+    return icon;
+}
+
+// Draws a toolbar of 32 icons at 16x16 pixels from 256x256 sources.
+// Argument: 1 draws cached (immutable, mipmapped) icons, 0 resamples the full resolution.
+void BM_DrawIconToolbar(benchmark::State& state) {
+    SoftwareCanvas canvas({32 * 20, 20});
+    canvas.beginDraw();
+    Bitmap icon = makeIcon(256);
+    if (state.range(0) != 0) {
+        icon.setImmutable();
+        icon.mipLevel(icon.mipLevelCount() - 1);
+    }
+    state.SetLabel(state.range(0) != 0 ? "mipmapped" : "full");
+    for (auto _ : state) {
+        for (int i = 0; i < 32; ++i) {
+            const auto x = static_cast<float>(i * 20 + 2);
+            canvas.drawBitmap(icon, {0, 0, 256, 256}, {x, 2, x + 16, 18}, 1.f, BitmapSampling::Linear);
+        }
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * 32);
+}
+
+void BM_ImageCacheHit(benchmark::State& state) {
+    ImageCache cache;
+    for (int i = 0; i < 64; ++i) { cache.insert("icons/" + std::to_string(i), makeIcon(24)); }
+    const std::string key = "icons/42";
+    for (auto _ : state) { benchmark::DoNotOptimize(cache.find(key).data()); }
+}
+} // namespace
+
+BENCHMARK(BM_DrawIconToolbar)->Arg(0)->Arg(1);
+BENCHMARK(BM_ImageCacheHit);
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "graphics/software/blend-inl.h"
+#include "graphics/software/span_kernels.h"
+
+using namespace bix::pixel;
+
+namespace {
+// Arguments: the SimdLevel and the span length in pixels.
+constexpr int kLevels[] = {static_cast<int>(SimdLevel::Scalar), static_cast<int>(SimdLevel::SSE2),
+                           static_cast<int>(SimdLevel::AVX2)};
+
+const SpanKernels* kernelsFor(benchmark::State& state) {
+    const auto level = static_cast<SimdLevel>(state.range(0));
+    const SpanKernels* kernels = spanKernels(level);
+    if (!kernels) { state.SkipWithError("instruction set not available"); }
+    constexpr const char* names[] = {"scalar", "sse2", "avx2"};
+    state.SetLabel(names[state.range(0)]);
+    return kernels;
+}
+
+std::vector<uint32_t> makeRow(size_t n, uint32_t seed) {
+    std::vector<uint32_t> row(n);
+    for (size_t i = 0; i < n; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        row[i] = premultiplyPixel(seed);
+    }
+    return row;
+}
+
+std::vector<uint8_t> makeMask(size_t n) {
+    // Typical anti-aliased coverage: mostly solid with soft edges.
+    std::vector<uint8_t> mask(n, 255);
+    for (size_t i = 0; i < n; i += 16) { mask[i] = static_cast<uint8_t>(i * 7); }
+    return mask;
+}
+
+void setThroughput(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+    state.SetBytesProcessed(state.iterations() * state.range(1) * static_cast<int64_t>(sizeof(uint32_t)));
+}
+
+void BM_Fill(benchmark::State& state) {
+    const auto* kernels = kernelsFor(state);
+    if (!kernels) { return; }
+    auto dst = makeRow(static_cast<size_t>(state.range(1)), 1);
+    for (auto _ : state) {
+        kernels->fill(dst.data(), static_cast<int>(dst.size()), 0xFF336699u);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    setThroughput(state);
+}
+
+void BM_BlendSolid(benchmark::State& state) {
+    const auto* kernels = kernelsFor(state);
+    if (!kernels) { return; }
+    auto dst = makeRow(static_cast<size_t>(state.range(1)), 1);
+    for (auto _ : state) {
+        kernels->blendSolid(dst.data(), static_cast<int>(dst.size()), 0x80402010u, 200);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    setThroughput(state);
+}
+
+void BM_BlendMask(benchmark::State& state) {
+    const auto* kernels = kernelsFor(state);
+    if (!kernels) { return; }
+    auto dst = makeRow(static_cast<size_t>(state.range(1)), 1);
+    const auto mask = makeMask(dst.size());
+    for (auto _ : state) {
+        kernels->blendMask(dst.data(), mask.data(), static_cast<int>(dst.size()), 0xC0604020u);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    setThroughput(state);
+}
+
+void BM_BlendSpan(benchmark::State& state) {
+    const auto* kernels = kernelsFor(state);
+    if (!kernels) { return; }
+    auto dst = makeRow(static_cast<size_t>(state.range(1)), 1);
+    const auto src = makeRow(dst.size(), 2);
+    for (auto _ : state) {
+        kernels->blendSpan(dst.data(), src.data(), static_cast<int>(dst.size()), 180);
+        benchmark::DoNotOptimize(dst.data());
+    }
+    setThroughput(state);
+}
+
+void BM_MultiplyOpacity(benchmark::State& state) {
+    const auto* kernels = kernelsFor(state);
+    if (!kernels) { return; }
+    auto row = makeRow(static_cast<size_t>(state.range(1)), 1);
+    for (auto _ : state) {
+        kernels->multiplyOpacity(row.data(), static_cast<int>(row.size()), 254);
+        benchmark::DoNotOptimize(row.data());
+    }
+    setThroughput(state);
+}
+
+void BM_Premultiply(benchmark::State& state) {
+    const auto* kernels = kernelsFor(state);
+    if (!kernels) { return; }
+    auto row = makeRow(static_cast<size_t>(state.range(1)), 3);
+    for (auto _ : state) {
+        kernels->premultiply(row.data(), static_cast<int>(row.size()));
+        benchmark::DoNotOptimize(row.data());
+    }
+    setThroughput(state);
+}
+
+void BM_Unpremultiply(benchmark::State& state) {
+    const auto* kernels = kernelsFor(state);
+    if (!kernels) { return; }
+    // Repeated runs keep every alpha value, so each iteration takes the same path through the kernel.
+    auto row = makeRow(static_cast<size_t>(state.range(1)), 3);
+    for (auto _ : state) {
+        kernels->unpremultiply(row.data(), static_cast<int>(row.size()));
+        benchmark::DoNotOptimize(row.data());
+    }
+    setThroughput(state);
+}
+
+void spanArgs(benchmark::internal::Benchmark* b) {
+    for (int level : kLevels) {
+        for (int n : {16, 256, 1920}) { b->Args({level, n}); }
+    }
+}
+} // namespace
+
+BENCHMARK(BM_Fill)->Apply(spanArgs);
+BENCHMARK(BM_BlendSolid)->Apply(spanArgs);
+BENCHMARK(BM_BlendMask)->Apply(spanArgs);
+BENCHMARK(BM_BlendSpan)->Apply(spanArgs);
+BENCHMARK(BM_MultiplyOpacity)->Apply(spanArgs);
+BENCHMARK(BM_Premultiply)->Apply(spanArgs);
+BENCHMARK(BM_Unpremultiply)->Apply(spanArgs);
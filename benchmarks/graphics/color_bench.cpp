@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/color.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace bix;
+
+namespace {
+void BM_ColorFromHexString(benchmark::State& state) {
+    const std::vector<std::string> inputs = {"#FF0000", "00FF0080", "#F00", "#12345678", "abcdef", "#fff"};
+    for (auto _ : state) {
+        for (const auto& s : inputs) { benchmark::DoNotOptimize(Color::fromHexString(s)); }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(inputs.size()));
+}
+
+void BM_ColorFromHexStrings(benchmark::State& state) {
+    // A theme file sized batch, mostly in the full 6 and 8 digit forms.
+    const std::vector<std::string> storage = {"#FF0000", "00FF0080", "#F00", "#12345678", "abcdef", "#fff"};
+    std::vector<std::string_view> inputs;
+    for (int i = 0; i < 4096; ++i) { inputs.emplace_back(storage[static_cast<size_t>(i) % storage.size()]); }
+    std::vector<Color> out(inputs.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Color::fromHexStrings(inputs, out));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(inputs.size()));
+}
+
+void BM_ColorLerp(benchmark::State& state) {
+    const Color a(255, 0, 0, 255);
+    const Color b(0, 128, 255, 64);
+    constexpr int kSteps = 256;
+    for (auto _ : state) {
+        for (int i = 0; i < kSteps; ++i) {
+            benchmark::DoNotOptimize(Color::lerp(a, b, static_cast<float>(i) / static_cast<float>(kSteps)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kSteps);
+}
+
+// Animating a frame worth of colors towards their targets.
+void BM_ColorLerpBatch(benchmark::State& state) {
+    const auto mode = static_cast<ColorInterpolation>(state.range(0));
+    std::vector<Color> from;
+    std::vector<Color> to;
+    for (int i = 0; i < 512; ++i) {
+        from.emplace_back(i % 256, (i * 3) % 256, (i * 7) % 256, 255);
+        to.emplace_back((i * 5) % 256, 255 - i % 256, (i * 11) % 256, 128);
+    }
+    std::vector<Color> out(from.size());
+    float t = 0.f;
+    for (auto _ : state) {
+        Color::lerp(from, to, t, out, mode);
+        benchmark::ClobberMemory();
+        t = t >= 1.f ? 0.f : t + 1.f / 64.f;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(from.size()));
+}
+
+void BM_ColorToLinearBatch(benchmark::State& state) {
+    std::vector<Color> colors;
+    for (int i = 0; i < 1024; ++i) { colors.emplace_back(i % 256, (i * 3) % 256, (i * 7) % 256); }
+    std::vector<LinearColor> linear(colors.size());
+    for (auto _ : state) {
+        Color::toLinear(colors, linear);
+        Color::fromLinear(linear, colors);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(colors.size()));
+}
+} // namespace
+
+BENCHMARK(BM_ColorFromHexString);
+BENCHMARK(BM_ColorFromHexStrings);
+BENCHMARK(BM_ColorLerp);
+BENCHMARK(BM_ColorLerpBatch)
+    ->Arg(static_cast<int>(ColorInterpolation::SRGB))
+    ->Arg(static_cast<int>(ColorInterpolation::Linear))
+    ->Arg(static_cast<int>(ColorInterpolation::OkLab));
+BENCHMARK(BM_ColorToLinearBatch);
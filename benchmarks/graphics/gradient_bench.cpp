@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/colors.h>
+#include <bixlib/graphics/gradient.h>
+
+#include <benchmark/benchmark.h>
+
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+const Gradient& themeGradient() {
+    static const Gradient gradient(
+        {{0.f, colors::Red}, {0.3f, colors::Yellow}, {0.7f, colors::Green}, {1.f, colors::Blue}},
+        ColorInterpolation::OkLab
+    );
+    return gradient;
+}
+
+void BM_GradientRampBake(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        GradientRamp ramp(themeGradient(), size);
+        benchmark::DoNotOptimize(ramp.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Argument: the BrushStyle, fills a 512x512 canvas.
+void BM_GradientFill(benchmark::State& state) {
+    SoftwareCanvas canvas({512, 512});
+    canvas.beginDraw();
+    BrushPtr brush;
+    switch (static_cast<BrushStyle>(state.range(0))) {
+    case BrushStyle::LinearGradient:
+        brush = canvas.createLinearGradientBrush({0, 0}, {512, 512}, themeGradient());
+        state.SetLabel("linear");
+        break;
+    case BrushStyle::RadialGradient:
+        brush = canvas.createRadialGradientBrush(Ellipse({256, 256}, 256, 128), themeGradient());
+        state.SetLabel("radial");
+        break;
+    default:
+        brush = canvas.createConicGradientBrush({256, 256}, 90.f, themeGradient());
+        state.SetLabel("conic");
+        break;
+    }
+    for (auto _ : state) {
+        canvas.fillRectangle({0, 0, 512, 512}, *brush);
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * 512 * 512);
+}
+} // namespace
+
+BENCHMARK(BM_GradientRampBake)->Arg(GradientRamp::kDefaultSize)->Arg(GradientRamp::kDetailedSize);
+BENCHMARK(BM_GradientFill)
+    ->Arg(static_cast<int>(BrushStyle::LinearGradient))
+    ->Arg(static_cast<int>(BrushStyle::RadialGradient))
+    ->Arg(static_cast<int>(BrushStyle::ConicGradient));
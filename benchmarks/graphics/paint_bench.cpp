@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/colors.h>
+#include <bixlib/graphics/recording_canvas.h>
+
+#include <benchmark/benchmark.h>
+
+#include "null_canvas.h"
+
+using namespace bix;
+
+namespace {
+/** Paints a grid of cells similar to what a list of simple rows records: a background, a border and a label. */
+void paintCells(Canvas& canvas, TextPaint& text, int cells) {
+    auto brush = canvas.createColorBrush(colors::White);
+    const Pen border(colors::Gray, 1.f);
+    const Pen ink(colors::Black);
+    for (int i = 0; i < cells; ++i) {
+        const float y = static_cast<float>(i) * 20.f;
+        const Rect cell(0, y, 200, y + 20);
+        canvas.fillRectangle(cell, *brush);
+        canvas.drawRectangle(cell, border);
+        canvas.drawText({4, y + 2}, text, ink);
+    }
+}
+
+void BM_RecordDisplayList(benchmark::State& state) {
+    bench::NullCanvas target;
+    auto text = target.createTextPaint();
+    text->setText("row");
+    DisplayList list;
+    const auto cells = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        RecordingCanvas recorder(list, target);
+        paintCells(recorder, *text, cells);
+        benchmark::DoNotOptimize(list.commandCount());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ReplayDisplayList(benchmark::State& state) {
+    bench::NullCanvas target;
+    auto text = target.createTextPaint();
+    text->setText("row");
+    DisplayList list;
+    {
+        RecordingCanvas recorder(list, target);
+        paintCells(recorder, *text, static_cast<int>(state.range(0)));
+    }
+    const Transform base = Transform::fromTranslate(10, 10);
+    for (auto _ : state) {
+        target.beginDraw();
+        list.replay(target, base);
+        benchmark::DoNotOptimize(target.calls());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(BM_RecordDisplayList)->Arg(16)->Arg(256)->Arg(4096);
+BENCHMARK(BM_ReplayDisplayList)->Arg(16)->Arg(256)->Arg(4096);
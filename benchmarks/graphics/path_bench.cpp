@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/colors.h>
+
+#include <benchmark/benchmark.h>
+
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+// An icon sized shape mixing curves and lines: a rounded badge with a circular hole.
+Path badge() {
+    Path path(FillRule::EvenOdd);
+    path.moveTo({8, 0}).lineTo({40, 0}).quadTo({48, 0}, {48, 8}).lineTo({48, 40});
+    path.cubicTo({48, 46}, {44, 48}, {40, 48}).lineTo({8, 48}).quadTo({0, 48}, {0, 40}).lineTo({0, 8});
+    path.arcTo(Ellipse({8, 8}, 8, 8), 180, 90).close();
+    path.addEllipse(Ellipse({24, 24}, 10, 10));
+    return path;
+}
+
+// Argument: 0 rebuilds the path every frame, 1 draws the same path and reuses its flattened curves.
+void BM_FillPath(benchmark::State& state) {
+    SoftwareCanvas canvas({64, 64});
+    canvas.beginDraw();
+    canvas.setTransform(Transform::fromScale(1.25f, 1.25f));
+    auto brush = canvas.createColorBrush(colors::Blue);
+    const Path cached = badge();
+    const bool reuse = state.range(0) != 0;
+    state.SetLabel(reuse ? "cached" : "rebuilt");
+    for (auto _ : state) {
+        if (reuse) {
+            canvas.fillPath(cached, *brush);
+        } else {
+            canvas.fillPath(badge(), *brush);
+        }
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+}
+
+// Fills a large circle to measure the scan converter alone, the flattened curves are cached.
+void BM_FillLargeCircle(benchmark::State& state) {
+    SoftwareCanvas canvas({512, 512});
+    canvas.beginDraw();
+    auto brush = canvas.createColorBrush(colors::Blue);
+    Path circle;
+    circle.addEllipse(Ellipse({256, 256}, 250, 250));
+    for (auto _ : state) {
+        canvas.fillPath(circle, *brush);
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * 500);
+}
+} // namespace
+
+BENCHMARK(BM_FillPath)->Arg(0)->Arg(1);
+BENCHMARK(BM_FillLargeCircle);
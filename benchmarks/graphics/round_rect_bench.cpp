@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/colors.h>
+
+#include <benchmark/benchmark.h>
+
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+// A 6 x 8 grid of 120 x 72 cards with an 8 px radius, the cards start on half pixels as under a 1.5x scale.
+constexpr int kColumns = 6;
+constexpr int kRows = 8;
+
+Rect cardAt(int column, int row) {
+    const float x = static_cast<float>(column) * 130.5f + 4.5f;
+    const float y = static_cast<float>(row) * 80.5f + 4.5f;
+    return {x, y, x + 120, y + 72};
+}
+
+// Argument: 0 fills plain rectangles as the baseline, 1 fills the same cards with rounded corners.
+void BM_FillCards(benchmark::State& state) {
+    SoftwareCanvas canvas({800, 660});
+    canvas.beginDraw();
+    auto brush = canvas.createColorBrush(colors::Blue);
+    const bool rounded = state.range(0) != 0;
+    state.SetLabel(rounded ? "rounded" : "rects");
+    for (auto _ : state) {
+        for (int row = 0; row < kRows; ++row) {
+            for (int column = 0; column < kColumns; ++column) {
+                if (rounded) {
+                    canvas.fillRoundRect(RoundRect(cardAt(column, row), 8), *brush);
+                } else {
+                    canvas.fillRectangle(cardAt(column, row), *brush);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * kRows * kColumns);
+}
+
+// Argument: 0 outlines plain rectangles as the baseline, 1 outlines the same cards with rounded corners.
+void BM_StrokeCards(benchmark::State& state) {
+    SoftwareCanvas canvas({800, 660});
+    canvas.beginDraw();
+    const Pen pen(colors::Black, 1.f);
+    const bool rounded = state.range(0) != 0;
+    state.SetLabel(rounded ? "rounded" : "rects");
+    for (auto _ : state) {
+        for (int row = 0; row < kRows; ++row) {
+            for (int column = 0; column < kColumns; ++column) {
+                if (rounded) {
+                    canvas.drawRoundRect(RoundRect(cardAt(column, row), 8), pen);
+                } else {
+                    canvas.drawRectangle(cardAt(column, row), pen);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * kRows * kColumns);
+}
+
+// Fills avatar sized circles, every row of a circle crosses the corner masks.
+void BM_FillCircles(benchmark::State& state) {
+    SoftwareCanvas canvas({800, 660});
+    canvas.beginDraw();
+    auto brush = canvas.createColorBrush(colors::Blue);
+    for (auto _ : state) {
+        for (int row = 0; row < kRows; ++row) {
+            for (int column = 0; column < kColumns; ++column) {
+                const Rect card = cardAt(column, row);
+                canvas.fillEllipse(Ellipse({card.left + 24, card.top + 24}, 20), *brush);
+            }
+        }
+        benchmark::DoNotOptimize(canvas.pixels().data());
+    }
+    state.SetItemsProcessed(state.iterations() * kRows * kColumns);
+}
+} // namespace
+
+BENCHMARK(BM_FillCards)->Arg(0)->Arg(1);
+BENCHMARK(BM_StrokeCards)->Arg(0)->Arg(1);
+BENCHMARK(BM_FillCircles);
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/transform.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace bix;
+
+namespace {
+void BM_TransformTranslate(benchmark::State& state) {
+    for (auto _ : state) {
+        Transform t;
+        for (int i = 0; i < 64; ++i) { t.translate(1.5f, -0.5f); }
+        benchmark::DoNotOptimize(t);
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+void BM_TransformScale(benchmark::State& state) {
+    for (auto _ : state) {
+        Transform t = Transform::fromTranslate(10.f, 20.f);
+        for (int i = 0; i < 64; ++i) { t.scale(1.01f, 0.99f); }
+        benchmark::DoNotOptimize(t);
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+// type() is cached, every mutation marks it dirty so each call below classifies the matrix again.
+void BM_TransformType(benchmark::State& state) {
+    Transform t = Transform::fromScale(2.f, 2.f);
+    for (auto _ : state) {
+        t.translate(1.f, 1.f);
+        benchmark::DoNotOptimize(t.type());
+    }
+}
+
+void BM_TransformCompose(benchmark::State& state) {
+    const Transform a = Transform::fromTranslate(10.f, 20.f);
+    const Transform b = Transform::fromScale(2.f, 3.f);
+    for (auto _ : state) { benchmark::DoNotOptimize(a * b); }
+}
+} // namespace
+
+BENCHMARK(BM_TransformTranslate);
+BENCHMARK(BM_TransformScale);
+BENCHMARK(BM_TransformType);
+BENCHMARK(BM_TransformCompose);
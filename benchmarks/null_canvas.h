@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/graphics/canvas.h>
+
+#include <string>
+
+namespace bix::bench {
+
+constexpr static long NullObject_CAST_ID = 1767139200L;
+
+class NullColorBrush : public ColorBrush {
+public:
+    explicit NullColorBrush(const Color& color) : mColor(color) {}
+
+    void setOpacity(float opacity) override { mOpacity = opacity; }
+
+    float opacity() const noexcept override { return mOpacity; }
+
+    BrushStyle style() const noexcept override { return BrushStyle::SolidColor; }
+
+    bool testCast(uintptr_t scope, long castId) const noexcept override {
+        BIX_UNUSED(scope)
+        return castId == NullObject_CAST_ID;
+    }
+
+    void setColor(const Color& color) override { mColor = color; }
+
+    Color color() const noexcept override { return mColor; }
+
+private:
+    Color mColor;
+    float mOpacity = 1.f;
+};
+
+template <typename Base>
+class NullGradientBrush final : public Base {
+public:
+    template <typename... Args>
+    explicit NullGradientBrush(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+    bool testCast(uintptr_t scope, long castId) const noexcept override {
+        BIX_UNUSED(scope)
+        return castId == NullObject_CAST_ID;
+    }
+};
+
+/** Keeps the properties needed to answer measureText() with a fixed advance per byte. */
+class NullTextPaint : public TextPaint {
+public:
+    void setText(const std::string& text) override { mText = text; }
+
+    void setFontFamily(const std::string& name) override { BIX_UNUSED(name) }
+
+    void setMaxWidth(int w) override { mMaxWidth = w; }
+
+    void setMaxHeight(int h) override { BIX_UNUSED(h) }
+
+    void setTextSize(float size) override { mTextSize = size; }
+
+    void setFontWeight(int weight) override { BIX_UNUSED(weight) }
+
+    void setWordWrapping(WordWrapping wrap) override { BIX_UNUSED(wrap) }
+
+    void setFontStyle(FontStyle style) override { BIX_UNUSED(style) }
+
+    void setTrimming(TextTrimming trimming) override { BIX_UNUSED(trimming) }
+
+    bool testCast(uintptr_t scope, long castId) const noexcept override {
+        BIX_UNUSED(scope)
+        return castId == NullObject_CAST_ID;
+    }
+
+    const std::string& text() const noexcept { return mText; }
+
+    float textSize() const noexcept { return mTextSize; }
+
+    int maxWidth() const noexcept { return mMaxWidth; }
+
+private:
+    std::string mText;
+    float mTextSize = 12.f;
+    int mMaxWidth = 0;
+};
+
+/**
+ * @class NullCanvas
+ * @brief A canvas that draws nothing and only counts the calls it receives.
+ *
+ * Benchmarks paint into it to measure the cost of the widget and recording layers alone, without any
+ * rasterization or GPU submission.
+ */
+class NullCanvas : public Canvas {
+public:
+    explicit NullCanvas(const Size& size = {1920, 1080}) : mSize(size) {}
+
+    Size size() const noexcept override { return mSize; }
+
+    void beginDraw() override { mCalls = 0; }
+
+    DrawResult endDraw() override { return DrawResult::Success; }
+
+    void resize(const Size& size) override { mSize = size; }
+
+    void clear(const Color& c) override { record(c); }
+
+    void setTransform(const Transform& transform) override { record(transform); }
+
+    [[nodiscard]] ColorBrushPtr createColorBrush(const Color& color) override {
+        return std::make_unique<NullColorBrush>(color);
+    }
+
+    [[nodiscard]] LinearGradientBrushPtr createLinearGradientBrush(
+        const Point& start,
+        const Point& end,
+        const Gradient& gradient
+    ) override {
+        return std::make_unique<NullGradientBrush<LinearGradientBrush>>(start, end, gradient);
+    }
+
+    [[nodiscard]] RadialGradientBrushPtr createRadialGradientBrush(
+        const Ellipse& ellipse,
+        const Gradient& gradient
+    ) override {
+        return std::make_unique<NullGradientBrush<RadialGradientBrush>>(ellipse, gradient);
+    }
+
+    [[nodiscard]] ConicGradientBrushPtr createConicGradientBrush(
+        const Point& center,
+        float startAngle,
+        const Gradient& gradient
+    ) override {
+        return std::make_unique<NullGradientBrush<ConicGradientBrush>>(center, startAngle, gradient);
+    }
+
+    [[nodiscard]] TextPaintPtr createTextPaint() override { return std::make_unique<NullTextPaint>(); }
+
+    bool pushClip(const RoundRect& rect) override {
+        record(rect);
+        return true;
+    }
+
+    void popClip() override { ++mCalls; }
+
+    void fillRectangle(const Rect& rect, Brush& brush) override {
+        record(rect, brush);
+    }
+
+    void fillRects(std::span<const Rect> rects, Brush& brush) override {
+        record(rects, brush);
+    }
+
+    void fillPath(const Path& path, Brush& brush) override { record(path, brush); }
+
+    void fillRoundRect(const RoundRect& rect, Brush& brush) override { record(rect, brush); }
+
+    void fillEllipse(const Ellipse& ellipse, Brush& brush) override { record(ellipse, brush); }
+
+    void drawBitmap(
+        const Bitmap& bitmap,
+        const Rect& src,
+        const Rect& dst,
+        float opacity,
+        BitmapSampling sampling
+    ) override {
+        BIX_UNUSED(opacity)
+        BIX_UNUSED(sampling)
+        record(bitmap, src, dst);
+    }
+
+    void drawRectangle(const Rect& rect, const Pen& pen) override {
+        record(rect, pen);
+    }
+
+    void drawRects(std::span<const Rect> rects, const Pen& pen) override {
+        record(rects, pen);
+    }
+
+    void drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) override {
+        BIX_UNUSED(radiusX)
+        BIX_UNUSED(radiusY)
+        record(rect, pen);
+    }
+
+    void drawRoundRect(const RoundRect& rect, const Pen& pen) override { record(rect, pen); }
+
+    void drawEllipse(const Ellipse& ellipse, const Pen& pen) override {
+        record(ellipse, pen);
+    }
+
+    void measureText(TextPaint& format, TextMetrics& metrics) override {
+        const auto& paint = static_cast<NullTextPaint&>(format);
+        const int advance = static_cast<int>(paint.textSize() * 0.6f + 0.5f);
+        const int width = static_cast<int>(paint.text().size()) * advance;
+        const int lineHeight = static_cast<int>(paint.textSize() * 1.25f + 0.5f);
+        const int lines = paint.maxWidth() > 0 && width > paint.maxWidth() ? (width + paint.maxWidth() - 1) / paint.maxWidth() : 1;
+        metrics.minWidth = advance;
+        metrics.width = lines > 1 ? paint.maxWidth() : width;
+        metrics.height = lines * lineHeight;
+        metrics.lineCount = lines;
+    }
+
+    void drawText(const Point& origin, TextPaint& text, const Pen& pen) override {
+        record(origin, text, pen);
+    }
+
+    void drawLine(const geom::Line& line, const Pen& pen) override {
+        record(line, pen);
+    }
+
+    void drawLines(std::span<const geom::Line> lines, const Pen& pen) override {
+        record(lines, pen);
+    }
+
+    /** Returns the number of calls received since the last beginDraw(). */
+    size_t calls() const noexcept { return mCalls; }
+
+private:
+    template <typename... Args>
+    void record(const Args&... args) noexcept {
+        // Keep the arguments observable so the compiler cannot drop the work that produced them.
+        (sink(&args), ...);
+        ++mCalls;
+    }
+
+    void sink(const void* arg) noexcept { mSink = arg; }
+
+    Size mSize;
+    size_t mCalls = 0;
+    const void* volatile mSink = nullptr;
+};
+} // namespace bix::bench
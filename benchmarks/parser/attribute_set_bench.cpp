@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/parser/attribute_set.h>
+#include <bixlib/widgets/widget_defs.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace bix;
+
+namespace {
+AttributeSet makeWidgetAttributes() {
+    AttributeSet set;
+    set.set(attrs::Id, AttributeValue::fromString("title"));
+    set.set(attrs::Width, AttributeValue::fromLength(Length::stretch()));
+    set.set(attrs::Height, AttributeValue::fromLength(Length::dp(24)));
+    set.set(attrs::Background, AttributeValue::fromColor(Color(0x20, 0x40, 0x60)));
+    set.set(attrs::Visible, AttributeValue::fromEnum(Visibility::Visible));
+    set.set(attrs::Value, AttributeValue::fromString("Hello"));
+    return set;
+}
+
+void BM_AttributeSetBuild(benchmark::State& state) {
+    for (auto _ : state) { benchmark::DoNotOptimize(makeWidgetAttributes()); }
+}
+
+// The lookups made by Widget::applyAttributes() and Label::applyAttributes() for one widget.
+void BM_AttributeSetApply(benchmark::State& state) {
+    const auto set = makeWidgetAttributes();
+    for (auto _ : state) {
+        std::string_view text;
+        Length length;
+        float alpha = 1.f;
+        bool flag = true;
+        Color color;
+        auto visibility = Visibility::Visible;
+        set.getString(attrs::Id, text);
+        set.getLength(attrs::Width, length);
+        set.getLength(attrs::Height, length);
+        set.getLength(attrs::MinWidth, length);
+        set.getLength(attrs::MinHeight, length);
+        set.getLength(attrs::MaxWidth, length);
+        set.getLength(attrs::MaxHeight, length);
+        set.getFloat(attrs::Alpha, alpha);
+        set.getBool(attrs::Enable, flag);
+        set.getBool(attrs::Clickable, flag);
+        set.getBool(attrs::BoundsClip, flag);
+        set.getEnum(attrs::Visible, visibility);
+        set.getColor(attrs::Background, color);
+        set.getString(attrs::Value, text);
+        benchmark::DoNotOptimize(text);
+        benchmark::DoNotOptimize(length);
+        benchmark::DoNotOptimize(color);
+    }
+}
+} // namespace
+
+BENCHMARK(BM_AttributeSetBuild);
+BENCHMARK(BM_AttributeSetApply);
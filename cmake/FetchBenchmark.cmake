@@ -0,0 +1,13 @@
+include_guard()
+
+
+find_package(benchmark QUIET)
+
+if (NOT benchmark_FOUND)
+    add_ext_dependency(benchmark
+            GIT_REPO "https://github.com/google/benchmark.git"
+            GIT_TAG "v1.9.1"
+            CMAKE_ARGS "-DBENCHMARK_ENABLE_TESTING=OFF;-DBENCHMARK_ENABLE_GTEST_TESTS=OFF;-DBENCHMARK_ENABLE_INSTALL=ON"
+    )
+    find_package(benchmark CONFIG REQUIRED HINTS "${benchmark_INSTALL_DIR}")
+endif ()
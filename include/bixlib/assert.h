@@ -55,7 +55,7 @@ void handleAssertFailure(const char* f, int l, std::string_view msg, Args&&...)
     #define BIX_ASSERT(condition, ...)                                             \
         do {                                                                       \
             if (!(condition)) {                                                    \
-                bix::detail::handleAssertFailure(__FILE__, __LINE__, __VA_ARGS__); \
+                bix::internal::handleAssertFailure(__FILE__, __LINE__, __VA_ARGS__); \
                 BIX_BREAK();                                                       \
             }                                                                      \
         } while (false)
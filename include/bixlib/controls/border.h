@@ -15,9 +15,11 @@
  */
 
 #pragma once
+#include "../core/insets.h"
 #include "../core/length.h"
 #include "bixlib/geometry/shape.h"
 #include "bixlib/graphics/canvas.h"
+#include "bixlib/graphics/colors.h"
 #include "bixlib/utils/flags.h"
 
 namespace bix {
@@ -94,13 +96,13 @@ public:
      * If the border is drawn as an overlay, it does not occupy the content area.
      * Otherwise, returns the border stroke width.
      * The returned values are included in the control's actual padding.
-     * @return the UIPaddings object representing the padding
+     * @return the EdgeInsets object representing the padding
      */
-    virtual UIPaddings insets() const;
-    virtual UIFlexRoundedRect makeRect(const UIRect& rect) const noexcept;
+    virtual EdgeInsets insets() const;
+    virtual RoundRect makeRect(const Rect& rect) const noexcept;
 
     virtual void reset();
-    virtual void onDraw(const UIRect& rect, Canvas& canvas);
+    virtual void onDraw(const Rect& rect, Canvas& canvas);
     virtual void onDiscardCanvas();
 
 protected:
@@ -109,7 +111,7 @@ protected:
     BorderFlags mFlags{BorderFlag::Dirty};
     float mEllipseRadiusX = 0, mEllipseRadiusY = 0;
     ShapeType mShapeType = ShapeType::None;
-    PenPtr mLeftPen, mTopPen, mRightPen, mBottomPen;
+    Pen mLeftPen, mTopPen, mRightPen, mBottomPen;
 
 private:
     void update();
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "bixlib/graphics/canvas.h"
+#include "bixlib/graphics/nine_patch.h"
 
 namespace bix {
 class BIX_PUBLIC Drawable {
@@ -24,18 +25,29 @@ public:
     virtual ~Drawable() = default;
 
     void setVisible(bool visible);
-    void setBounds(const UIRect& bounds);
+    void setBounds(const Rect& bounds);
 
-    const UIRect& bounds() const;
+    const Rect& bounds() const;
 
     virtual void draw(Canvas* canvas) = 0;
-    virtual void setAlpha(int alpha) = 0;
+
+    /**
+     * Sets the alpha multiplied into everything the drawable draws.
+     * It is applied as an opacity when drawing, changing it does not re-create any canvas resources.
+     * @param alpha The alpha in range [0, 255], values outside are clamped.
+     */
+    virtual void setAlpha(int alpha);
+
+    int alpha() const noexcept { return mAlpha; }
 
     virtual void discardCanvas() = 0;
 
 protected:
+    float opacity() const noexcept { return static_cast<float>(mAlpha) / 255.f; }
+
     bool mVisible = true;
-    UIRect mBounds{0, 0, 0, 0};
+    int mAlpha = 255;
+    Rect mBounds{0, 0, 0, 0};
 };
 
 using DrawablePtr = std::unique_ptr<Drawable>;
@@ -54,4 +66,42 @@ protected:
     Color mColor{};
     ColorBrushPtr mBrush = nullptr;
 };
+
+/** Draws a bitmap stretched over the bounds. */
+class BIX_PUBLIC BitmapDrawable : public Drawable {
+public:
+    BitmapDrawable() = default;
+    explicit BitmapDrawable(Bitmap bitmap, BitmapSampling sampling = BitmapSampling::Linear);
+
+    void draw(Canvas* canvas) override;
+    void setBitmap(Bitmap bitmap);
+    void setSampling(BitmapSampling sampling);
+    void discardCanvas() override;
+
+    const Bitmap& bitmap() const noexcept { return mBitmap; }
+
+protected:
+    Bitmap mBitmap;
+    BitmapSampling mSampling = BitmapSampling::Linear;
+};
+
+/**
+ * Draws a NinePatch stretched over the bounds, the usual way to skin buttons and panels.
+ * The slices are cached for the current bounds size, so drawing costs a few drawBitmap() calls per frame.
+ */
+class BIX_PUBLIC NinePatchDrawable : public Drawable {
+public:
+    NinePatchDrawable() = default;
+    explicit NinePatchDrawable(NinePatch patch);
+    NinePatchDrawable(Bitmap bitmap, const RectI& center);
+
+    void draw(Canvas* canvas) override;
+    void setNinePatch(NinePatch patch);
+    void discardCanvas() override;
+
+    const NinePatch& ninePatch() const noexcept { return mPatch; }
+
+protected:
+    NinePatch mPatch;
+};
 } // namespace bix
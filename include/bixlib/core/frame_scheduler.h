@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/export_macro.h>
+#include <bixlib/utils/flags.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace bix {
+
+/**
+ * Source of time for the FrameScheduler, replaceable by a manually advanced clock in tests.
+ */
+class BIX_PUBLIC FrameClock {
+public:
+    using Duration = std::chrono::nanoseconds;
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock, Duration>;
+
+    virtual ~FrameClock() = default;
+
+    virtual TimePoint now() const noexcept = 0;
+
+    /** Returns a process wide clock backed by std::chrono::steady_clock. */
+    static const FrameClock& steady() noexcept;
+};
+
+/**
+ * @enum FramePhase
+ * The phases of a frame that can be requested from the FrameScheduler.
+ */
+enum class FramePhase : uint32_t {
+    Layout = 1 << 0, ///< Measure and layout the dirty parts of the tree.
+    Paint = 1 << 1,  ///< Repaint the damaged area.
+};
+BIX_DECLARE_ENUM_FLAGS(FramePhase)
+using FramePhases = Flags<FramePhase>;
+
+/**
+ * Durations of the phases of one produced frame.
+ */
+struct FrameTimings {
+    FrameClock::Duration layout{};
+    FrameClock::Duration paint{};
+    FrameClock::Duration total{};
+    uint64_t frame = 0; ///< The sequence number of the frame, starting at 1.
+};
+
+/**
+ * @class FrameScheduler
+ * @brief Coalesces layout and paint requests into at most one frame per refresh interval.
+ *
+ * Requests only mark phases as pending, the host calls tick() from its timer or message loop and the scheduler
+ * runs one layout pass followed by one paint pass once the next frame deadline is reached. Deadlines are spaced
+ * by the refresh interval of the screen. A frame that is late by more than a whole interval re-aligns the
+ * schedule to the current time instead of producing a burst of catch-up frames.
+ *
+ * A layout always implies a paint, as moved widgets have to be redrawn.
+ */
+class BIX_PUBLIC FrameScheduler {
+public:
+    using Duration = FrameClock::Duration;
+    using TimePoint = FrameClock::TimePoint;
+    using PhaseCallback = std::function<void()>;
+    /** Invoked when the scheduler leaves the idle state, the host should call tick() at the given time. */
+    using WakeupCallback = std::function<void(TimePoint)>;
+
+    /** The refresh rate used when the screen reports an unknown rate. */
+    static constexpr int kDefaultRefreshRate = 60;
+
+    explicit FrameScheduler(const FrameClock& clock = FrameClock::steady(), int refreshRate = kDefaultRefreshRate);
+
+    /**
+     * Sets the frame rate the scheduler paces to.
+     * @param hz The refresh rate in Hertz, values less than or equal to zero select kDefaultRefreshRate.
+     */
+    void setRefreshRate(int hz);
+
+    int refreshRate() const noexcept { return mRefreshRate; }
+
+    Duration frameInterval() const noexcept { return mInterval; }
+
+    void setLayoutCallback(PhaseCallback callback) { mLayout = std::move(callback); }
+
+    void setPaintCallback(PhaseCallback callback) { mPaint = std::move(callback); }
+
+    void setWakeupCallback(WakeupCallback callback) { mWakeup = std::move(callback); }
+
+    void requestLayout() { request(FramePhase::Layout); }
+
+    void requestPaint() { request(FramePhase::Paint); }
+
+    /**
+     * Marks phases as pending for the next frame.
+     * @param phases The requested phases, requests made before the frame runs are merged.
+     */
+    void request(FramePhases phases);
+
+    bool hasPendingFrame() const noexcept { return mPending.testAny(); }
+
+    FramePhases pendingPhases() const noexcept { return mPending; }
+
+    /**
+     * Returns the earliest time at which tick() produces the pending frame.
+     */
+    TimePoint nextFrameTime() const noexcept;
+
+    /**
+     * Produces a frame if one is pending and its deadline has been reached.
+     * @return True if a frame was produced.
+     */
+    bool tick();
+
+    /** Returns the timings of the last produced frame. */
+    const FrameTimings& lastTimings() const noexcept { return mTimings; }
+
+    uint64_t frameCount() const noexcept { return mTimings.frame; }
+
+private:
+    const FrameClock& mClock;
+    int mRefreshRate = kDefaultRefreshRate;
+    Duration mInterval{};
+
+    FramePhases mPending{};
+    bool mInFrame = false;
+    bool mHasFrame = false;
+    TimePoint mNextDeadline{};
+
+    PhaseCallback mLayout;
+    PhaseCallback mPaint;
+    WakeupCallback mWakeup;
+    FrameTimings mTimings{};
+};
+} // namespace bix
@@ -16,6 +16,7 @@
 
 #pragma once
 #include <bixlib/core/length.h>
+#include <bixlib/geometry/size.h>
 
 namespace bix {
 
@@ -39,4 +40,66 @@ struct BIX_PUBLIC BoxConstraints {
     Length maxHeight = Length::infinity();
 };
 
+/**
+ * Remembers the result of the last measure of a widget together with the constraints it was computed for.
+ *
+ * A widget whose layout is clean and that is measured again with the same constraints can reuse the stored
+ * size without visiting its subtree.
+ */
+struct BIX_PUBLIC MeasureCache {
+    Size available{};
+    Size max{};
+    Size result{};
+    bool valid = false;
+
+    /**
+     * Looks up the cached size.
+     * @param avail The available size passed to measure.
+     * @param limit The maximum size passed to measure.
+     * @return A pointer to the cached size, or null if the cache is invalid or was stored for other constraints.
+     */
+    const Size* find(const Size& avail, const Size& limit) const noexcept {
+        if (!valid || available != avail || max != limit) { return nullptr; }
+        return &result;
+    }
+
+    void store(const Size& avail, const Size& limit, const Size& size) noexcept {
+        available = avail;
+        max = limit;
+        result = size;
+        valid = true;
+    }
+
+    void invalidate() noexcept { valid = false; }
+};
+
+/**
+ * Counters collected during a single layout pass.
+ */
+struct BIX_PUBLIC LayoutStats {
+    int measured = 0; ///< Widgets whose onMeasure() ran.
+    int cached = 0;   ///< Widgets answered from their measure cache.
+    int laidOut = 0;  ///< Widgets whose onLayout() ran.
+};
+
+/**
+ * Installs the LayoutStats that widgets report to while a layout pass is running on the current thread.
+ *
+ * Passes may nest, the previous statistics are restored when the pass ends.
+ */
+class BIX_PUBLIC LayoutPass {
+public:
+    explicit LayoutPass(LayoutStats& stats) noexcept;
+    ~LayoutPass();
+
+    LayoutPass(const LayoutPass&) = delete;
+    LayoutPass& operator=(const LayoutPass&) = delete;
+
+    /** Returns the statistics of the running pass, or null outside of a layout pass. */
+    static LayoutStats* current() noexcept;
+
+private:
+    LayoutStats* mPrevious;
+};
+
 } // namespace bix
\ No newline at end of file
@@ -90,6 +90,12 @@ public:
 
     constexpr static Length infinity() noexcept { return {VAL_INFINITY, SPECIAL}; }
 
+    /**
+     * Restores a Length from its raw representation, as returned by #fixedValue() and #unit().
+     * Used by serialized formats, which store lengths without going through #parse().
+     */
+    constexpr static Length fromFixed(int fixedValue, Unit unit) noexcept { return {fixedValue, unit}; }
+
     ///@}
 
     /**
@@ -167,6 +173,9 @@ public:
     /** Returns the unit type. */
     Unit unit() const noexcept { return mUnit; }
 
+    /** Returns the raw value, scaled by #FLOAT_SCALE for fractional units. */
+    constexpr int fixedValue() const noexcept { return mFixedValue; }
+
     /** Checks if the unit is valid (not NONE). */
     bool isValid() const noexcept { return mUnit != NONE; }
 
@@ -174,7 +183,7 @@ public:
      * Compares two Length objects for equality.
      * @return True if both the unit and the underlying fixed-point value are identical.
      */
-    constexpr bool operator==(const Length& rhs) noexcept {
+    constexpr bool operator==(const Length& rhs) const noexcept {
         return mFixedValue == rhs.mFixedValue && mUnit == rhs.mUnit;
     }
 
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/export_macro.h>
+#include <bixlib/geometry/rect.h>
+#include <bixlib/utils/flags.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace bix {
+
+class Widget;
+class DamageRegion;
+
+/**
+ * @enum NodeFlag
+ * The state of a widget mirrored into the NodeStore.
+ */
+enum class NodeFlag : uint32_t {
+    Visible = 1 << 0,     ///< The widget paints and receives input, Invisible and Collapsed widgets lack it.
+    Enabled = 1 << 1,     ///< The widget is interactive.
+    Clickable = 1 << 2,   ///< The widget responds to mouse clicks.
+    BoundsClip = 1 << 3,  ///< Descendants are clipped to the bounds of the widget.
+    Container = 1 << 4,   ///< The widget may have children.
+    Transparent = 1 << 5, ///< The widget has zero opacity, neither it nor its subtree paints.
+    BorderClip = 1 << 6,  ///< The bounds clip follows the rounded shape of the border.
+};
+BIX_DECLARE_ENUM_FLAGS(NodeFlag)
+using NodeFlags = Flags<NodeFlag>;
+
+/**
+ * @class NodeStore
+ * @brief A structure-of-arrays mirror of the hot layout state of a widget tree.
+ *
+ * Nodes are stored in pre-order: a parent always precedes its descendants and the descendants of a node occupy
+ * the contiguous index range [index + 1, subtreeEnd(index)). Passes that only need positions, sizes and flags
+ * therefore walk a few dense arrays front to back instead of chasing the child pointers of the widgets.
+ *
+ * The Scene keeps the store in sync after each layout pass, rewriting only the subtrees that were laid out again.
+ * It never owns the widgets it refers to.
+ */
+class BIX_PUBLIC NodeStore {
+public:
+    using Index = uint32_t;
+
+    static constexpr Index kNone = std::numeric_limits<Index>::max();
+
+    void clear() noexcept;
+
+    void reserve(size_t count);
+
+    /**
+     * Appends a node as the last child of a parent, the parent must be the last appended node or one of its
+     * ancestors so that the pre-order is kept.
+     * @param widget The mirrored widget, may be null.
+     * @param parent The index of the parent node, kNone for a root.
+     * @param offset The layout position relative to the parent.
+     * @param size The measured size.
+     * @param flags The mirrored state.
+     * @return The index of the new node.
+     */
+    Index append(Widget* widget, Index parent, const Point& offset, const Size& size, NodeFlags flags);
+
+    /**
+     * Replaces the mirrored state of an existing node, the links of the tree are kept.
+     * @return True if anything changed, the bounds of the subtree of the node must then be updated.
+     */
+    bool update(Index i, const Point& offset, const Size& size, NodeFlags flags) noexcept;
+
+    /**
+     * Derives the window bounds and the clipped bounds of every node in one linear pass.
+     *
+     * Nodes that are not visible, or that have a hidden ancestor, get empty clipped bounds. Nodes flagged with
+     * BoundsClip clip all of their descendants, not only their direct children.
+     */
+    void updateBounds();
+
+    /**
+     * Derives the bounds of the nodes in [first, last) only.
+     *
+     * The range must consist of whole subtrees, e.g. [i, subtreeEnd(i)), whose ancestors already have up to date
+     * bounds.
+     */
+    void updateBounds(Index first, Index last);
+
+    /**
+     * Finds the topmost visible node containing a point.
+     * @param p The point in window coordinates.
+     * @return The index of the node painted last at that point, kNone if there is none.
+     */
+    Index hitTest(const Point& p) const noexcept;
+
+    /**
+     * Collects the visible nodes touched by a damage region, skipping whole subtrees whose clipped bounds miss it
+     * and transparent subtrees.
+     * @param damage The damaged area in window coordinates.
+     * @param out Receives the indices in paint order, it is cleared first.
+     */
+    void cull(const DamageRegion& damage, std::vector<Index>& out) const;
+
+    size_t size() const noexcept { return mWidgets.size(); }
+
+    bool isEmpty() const noexcept { return mWidgets.empty(); }
+
+    Widget* widget(Index i) const noexcept { return mWidgets[i]; }
+
+    Index parent(Index i) const noexcept { return mParents[i]; }
+
+    Index firstChild(Index i) const noexcept { return mFirstChildren[i]; }
+
+    Index nextSibling(Index i) const noexcept { return mNextSiblings[i]; }
+
+    /** Returns the index past the last descendant of a node. */
+    Index subtreeEnd(Index i) const noexcept { return mSubtreeEnds[i]; }
+
+    NodeFlags flags(Index i) const noexcept { return mFlags[i]; }
+
+    const Point& offset(Index i) const noexcept { return mOffsets[i]; }
+
+    const Size& measuredSize(Index i) const noexcept { return mSizes[i]; }
+
+    /** Returns the bounds in window coordinates, valid after updateBounds(). */
+    const Rect& bounds(Index i) const noexcept { return mBounds[i]; }
+
+    /** Returns the bounds clipped by the clipping ancestors, empty for hidden nodes. */
+    const Rect& clippedBounds(Index i) const noexcept { return mClipped[i]; }
+
+    /** Returns the clip applied to the content of a node and inherited by its children, empty for hidden nodes. */
+    const Rect& clip(Index i) const noexcept { return mChildClips[i]; }
+
+private:
+    std::vector<Widget*> mWidgets;
+    std::vector<Point> mOffsets;
+    std::vector<Size> mSizes;
+    std::vector<NodeFlags> mFlags;
+    std::vector<Index> mParents;
+    std::vector<Index> mFirstChildren;
+    std::vector<Index> mNextSiblings;
+    std::vector<Index> mLastChildren; // only used while appending
+    std::vector<Index> mSubtreeEnds;
+    std::vector<Rect> mBounds;
+    std::vector<Rect> mClipped;
+    std::vector<Rect> mChildClips; // the clip inherited by the children of a node
+};
+} // namespace bix
@@ -16,33 +16,135 @@
 
 #pragma once
 
+#include <bixlib/core/node_store.h>
+#include <bixlib/core/spatial_grid.h>
 #include <bixlib/core/widget_host.h>
+#include <bixlib/utils/arena.h>
 #include <bixlib/widgets/widget.h>
 
+#include <utility>
+#include <vector>
+
 namespace bix {
 
+/**
+ * @class Scene
+ * @brief The root of a widget tree, collecting its invalidations and driving partial repaints.
+ *
+ * Invalidations reported by the root widget are merged into a DamageRegion in window coordinates and the
+ * bounding rect of the pending damage is forwarded to WidgetHost::scheduleFrame(). The next paint() only
+ * repaints widgets intersecting the damage, clipped to its bounds.
+ */
 class BIX_PUBLIC Scene : public ViewParent {
 public:
     explicit Scene(WidgetHost* host);
 
+    /**
+     * Replaces the widget tree.
+     * @param root The new root. The previous tree is destroyed first, if it was the last user of the arena of the
+     * scene the arena is rewound, releasing its memory in one step.
+     */
+    void setRoot(WidgetPtr root);
+
+    /**
+     * Returns the arena of the scene, creating it on first use.
+     *
+     * Widget trees built with makeWidget(scene.arena()) and Container::addChild() are constructed in it, which
+     * replaces one heap allocation per widget by a pointer bump.
+     */
+    MonotonicArena* arena();
+
+    Widget* root() const noexcept { return mRoot.get(); }
+
+    /**
+     * Resizes the scene, the whole window is marked dirty.
+     * @param size The new client size of the window.
+     */
+    void resize(const Size& size);
+
+    /** Marks the whole window as dirty. */
+    void invalidateAll();
+
+    /**
+     * Measures and lays out the dirty parts of the tree.
+     *
+     * Clean subtrees measured with unchanged constraints are answered from their measure cache.
+     * @param canvas The canvas used to measure text.
+     * @return True if a layout pass was performed.
+     */
+    bool performLayout(Canvas& canvas);
+
+    /** Returns the statistics of the last layout pass. */
+    const LayoutStats& layoutStats() const noexcept { return mLayoutStats; }
+
+    /** Returns the damage accumulated since the last paint. */
+    const DamageRegion& damage() const noexcept { return mDamage; }
+
+    /**
+     * Repaints the dirty parts of the scene and clears the pending damage.
+     * @param canvas The window canvas, whose previous content is kept outside of the damage.
+     */
+    void paint(Canvas& canvas);
+
+    /**
+     * Returns the structure-of-arrays mirror of the tree, synced at the end of every layout pass.
+     */
+    const NodeStore& nodes() const noexcept { return mNodes; }
+
+    /**
+     * Finds the topmost visible widget at a point.
+     * @param p The point in window coordinates.
+     * @return The widget, or null if the point hits no widget or a layout is pending.
+     */
+    Widget* hitTest(const Point& p) const noexcept;
+
+    /**
+     * Collects the visible widgets intersecting a rectangle, in paint order.
+     * @param rect The rectangle in window coordinates, e.g. a dirty rect.
+     * @param out Receives the widgets, it is cleared first.
+     */
+    void query(const Rect& rect, std::vector<Widget*>& out) const;
+
+    /**
+     * Moves the hover state to the topmost widget at a point.
+     * @param p The mouse position in window coordinates.
+     * @return The hovered widget, null if there is none.
+     */
+    Widget* updateHover(const Point& p);
+
+    Widget* hoveredWidget() const noexcept { return mHovered; }
+
+    void requestLayoutFromChild(Widget* child) override;
+    void invalidateChild(Widget* child, const Rect& rect) override;
+    void invalidateWindowRect(const Rect& rect) override;
+    Transform childTransform() const noexcept override;
+
 private:
-    void performLayout() {
-        // if (!mRoot)
-        //     return;
-        // mRoot->onMeasure(Constraints::Loose(mWindowSize));
-        // mRoot->onLayout(Rect{0, 0, mWindowSize.w, mWindowSize.h});
-    }
-
-    void performPaint(Canvas& canvas) {
-        // if (mRoot)
-        //     mRoot->onPaint(canvas);
-    }
+    void addDamage(const Rect& rect);
+    void paintNodes(Canvas& canvas);
+    void syncNodes();
+    bool syncNode(Widget* widget, NodeStore::Index index);
+    void rebuildNodes();
+    void updateGrid(NodeStore::Index first, NodeStore::Index last);
+    void appendNode(Widget* widget, NodeStore::Index parent);
+    static NodeFlags nodeFlags(const Widget* widget) noexcept;
 
     WidgetHost* mHost;
+    std::unique_ptr<MonotonicArena> mArena; // declared before the root, which may live in it
     WidgetPtr mRoot;
     Size mWindowSize;
+    DamageRegion mDamage;
+    DamageRegion mPaintDamage; // the damage being painted, swapped with mDamage to keep both buffers
+    LayoutStats mLayoutStats{};
+    NodeStore mNodes;
+    std::vector<NodeStore::Index> mVisible;
+    std::vector<NodeStore::Index> mClipChain; // the border clipped ancestors of the node being painted
+    std::vector<std::pair<NodeStore::Index, NodeStore::Index>> mDirtyRanges; // subtrees changed by the last sync
+    SpatialGrid mGrid;
+    mutable std::vector<SpatialGrid::Id> mQueryIds;
+    Widget* mHovered = nullptr;
+    bool mHoveredFound = false;
     bool mDirtyLayout = true;
-    bool mDirtyPaint = true;
 };
 
 using ScenePtr = std::unique_ptr<Scene>;
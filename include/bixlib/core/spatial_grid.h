@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/export_macro.h>
+#include <bixlib/geometry/rect.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace bix {
+
+/**
+ * @class SpatialGrid
+ * @brief A uniform grid over rectangles in window coordinates, answering point and rectangle queries.
+ *
+ * Items are identified by small dense integers, the Scene uses the indices of its NodeStore, so that a higher id
+ * means an item painted later. Each item is referenced from every cell its rectangle overlaps. Rectangles
+ * reaching beyond the grid area are clamped to the border cells, so queries outside the area still find them.
+ *
+ * Updates are incremental: moving an item only touches the cells of its old and new rectangle, and setting an
+ * unchanged rectangle is a no-op.
+ */
+class BIX_PUBLIC SpatialGrid {
+public:
+    using Id = uint32_t;
+
+    static constexpr Id kNone = std::numeric_limits<Id>::max();
+    static constexpr float kDefaultCellSize = 64.f;
+
+    explicit SpatialGrid(float cellSize = kDefaultCellSize);
+
+    /**
+     * Removes all items and changes the area covered by the cells.
+     * @param area The covered area, usually the window bounds.
+     */
+    void reset(const Rect& area);
+
+    /** Removes all items, keeping the area. */
+    void clear();
+
+    /**
+     * Sets the rectangle of an item, inserting it if needed.
+     * @param id The item id.
+     * @param rect The new rectangle, an empty rectangle removes the item.
+     */
+    void update(Id id, const Rect& rect);
+
+    void remove(Id id) { update(id, {}); }
+
+    /** Removes all items with an id greater than or equal to count. */
+    void truncate(size_t count);
+
+    /**
+     * Finds the item with the highest id containing a point.
+     * @return The id, kNone if no item contains the point.
+     */
+    Id hitTest(const Point& p) const noexcept;
+
+    /**
+     * Collects the items intersecting a rectangle.
+     * @param rect The query rectangle.
+     * @param out Receives the ids in ascending order without duplicates, it is cleared first.
+     */
+    void query(const Rect& rect, std::vector<Id>& out) const;
+
+    /** Returns the rectangle of an item, empty if the item is not in the grid. */
+    Rect rectOf(Id id) const noexcept { return id < mRects.size() ? mRects[id] : Rect(); }
+
+    const Rect& area() const noexcept { return mArea; }
+
+    float cellSize() const noexcept { return mCellSize; }
+
+    /** Returns one past the highest id the grid has seen since the last truncate() or clear(). */
+    size_t idCount() const noexcept { return mRects.size(); }
+
+private:
+    struct CellRange {
+        int left, top, right, bottom; // inclusive
+    };
+
+    CellRange cellRange(const Rect& rect) const noexcept;
+    int cellIndex(int column, int row) const noexcept { return row * mColumns + column; }
+    void link(Id id, const CellRange& range);
+    void unlink(Id id, const CellRange& range);
+
+    float mCellSize;
+    Rect mArea;
+    int mColumns = 0;
+    int mRows = 0;
+    std::vector<std::vector<Id>> mCells;
+    std::vector<Rect> mRects;
+};
+} // namespace bix
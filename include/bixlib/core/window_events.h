@@ -36,9 +36,9 @@ enum class WindowEventType {
 class WindowEvent {
 public:
     union WindowEventData {
-        Point<int> point;
-        Size<float> size;
-        Rect<int> rect;
+        PointI point;
+        SizeF size;
+        RectI rect;
     };
 
     WindowEventType ttype = WindowEventType::NilEvent;
@@ -48,15 +48,15 @@ public:
 
 class MouseEvent {
 public:
-    MouseEvent(const Point<int>& pos, const Point<int>& lastPos) : mPosition(pos), mLastPosition(lastPos) {}
+    MouseEvent(const PointI& pos, const PointI& lastPos) : mPosition(pos), mLastPosition(lastPos) {}
 
-    const Point<int>& position() const { return mPosition; }
+    const PointI& position() const { return mPosition; }
 
     WindowEventType ttype = WindowEventType::NilEvent;
     int64_t timestamp = 0; // using std::chrono::steady_clock::now()
 
 private:
-    Point<int> mPosition;
-    Point<int> mLastPosition;
+    PointI mPosition;
+    PointI mLastPosition;
 };
 } // namespace bix
\ No newline at end of file
@@ -15,8 +15,11 @@
  */
 
 #pragma once
+#include <bixlib/utils/fmt_wrapper.h>
+
 #include <exception>
 #include <stdexcept>
+#include <string>
 
 namespace bix {
 class Error : public std::runtime_error {
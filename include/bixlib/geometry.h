@@ -27,6 +27,10 @@
  * Collection of classes for 2D geometric operations
  */
 
+#include <bixlib/geometry/corner_radii.h>
 #include <bixlib/geometry/ellipse.h>
+#include <bixlib/geometry/line.h>
 #include <bixlib/geometry/point.h>
-#include <bixlib/geometry/rect.h>
\ No newline at end of file
+#include <bixlib/geometry/rect.h>
+#include <bixlib/geometry/round_rect.h>
+#include <bixlib/geometry/size.h>
\ No newline at end of file
@@ -74,6 +74,11 @@ struct BIX_PUBLIC CornerRadiiT {
     /** * Creates corner radii for only the right edge.
      */
     static constexpr CornerRadiiT right(T radius) noexcept { return {0, radius, 0, radius}; }
+
+    /** Returns true if all corners have the same radius. */
+    constexpr bool isUniform() const noexcept {
+        return topLeft == topRight && topLeft == bottomLeft && topLeft == bottomRight;
+    }
 };
 } // namespace geom
 
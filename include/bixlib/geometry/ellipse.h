@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file ellipse.h
+ * @brief Axis-aligned ellipse (center and radii) type definitions.
+ */
+
+#pragma once
+
+#include <bixlib/geometry/rect.h>
+
+namespace bix {
+namespace geom {
+
+/**
+ * A template structure representing an axis-aligned ellipse.
+ *
+ * The ellipse is described by its center point and the two semi-axes. A circle
+ * is the special case where both radii are equal.
+ * @tparam T The numeric type for coordinates which must satisfy the Real concept.
+ */
+template <Real T>
+struct BIX_PUBLIC EllipseT {
+    PointT<T> center{}; ///< The center point of the ellipse.
+    T radiusX{0};       ///< The horizontal semi-axis.
+    T radiusY{0};       ///< The vertical semi-axis.
+
+    /** Default constructor creating a degenerate ellipse at the origin. */
+    constexpr EllipseT() noexcept = default;
+
+    /**
+     * Constructs an ellipse from its center and radii.
+     *
+     * @param c The center point.
+     * @param rx The horizontal semi-axis.
+     * @param ry The vertical semi-axis.
+     */
+    constexpr EllipseT(const PointT<T>& c, T rx, T ry) noexcept : center(c), radiusX(rx), radiusY(ry) {}
+
+    /**
+     * Constructs a circle from its center and radius.
+     *
+     * @param c The center point.
+     * @param radius The radius used for both semi-axes.
+     */
+    constexpr EllipseT(const PointT<T>& c, T radius) noexcept : EllipseT(c, radius, radius) {}
+
+    /**
+     * Constructs an EllipseT from another compatible numeric type.
+     *
+     * Only available if the source type From can be safely upcasted to T.
+     *
+     * @tparam From The source numeric type.
+     * @param other The source ellipse to convert from.
+     */
+    template <typename From>
+    requires Upcastable<T, From>
+    constexpr explicit EllipseT(const EllipseT<From>& other) noexcept
+        : center(PointT<T>(other.center))
+        , radiusX(static_cast<T>(other.radiusX))
+        , radiusY(static_cast<T>(other.radiusY)) {}
+
+    /**
+     * Creates the ellipse inscribed in the given rectangle.
+     *
+     * @param rect The bounding rectangle.
+     * @return An ellipse touching all four edges of \a rect.
+     */
+    static constexpr EllipseT fromRect(const RectT<T>& rect) noexcept {
+        if constexpr (std::is_floating_point_v<T>) {
+            return {rect.center(), rect.width() * static_cast<T>(0.5), rect.height() * static_cast<T>(0.5)};
+        } else {
+            return {rect.center(), rect.width() / 2, rect.height() / 2};
+        }
+    }
+
+    /**
+     * Returns the axis-aligned bounding rectangle of the ellipse.
+     * @return The rectangle spanning center ± radii.
+     */
+    constexpr RectT<T> bounds() const noexcept {
+        return {center.x - radiusX, center.y - radiusY, center.x + radiusX, center.y + radiusY};
+    }
+
+    /**
+     * Checks if the ellipse has no visible area.
+     * @return True if either radius is less than or equal to zero.
+     */
+    constexpr bool isEmpty() const noexcept { return radiusX <= static_cast<T>(0) || radiusY <= static_cast<T>(0); }
+
+    /**
+     * Checks whether the ellipse is a circle.
+     * @return True if both radii are exactly equal.
+     */
+    constexpr bool isCircle() const noexcept { return math::exactlyEqual(radiusX, radiusY); }
+
+    /**
+     * Strict equality operator.
+     *
+     * Performs a zero-tolerance comparison on the center and both radii.
+     */
+    constexpr bool operator==(const EllipseT& rhs) const noexcept {
+        return center == rhs.center && math::exactlyEqual(radiusX, rhs.radiusX)
+               && math::exactlyEqual(radiusY, rhs.radiusY);
+    }
+};
+} // namespace geom
+
+/** Type alias for a single-precision floating-point ellipse. */
+using EllipseF = geom::EllipseT<float>;
+
+/** Type alias for an integer ellipse. */
+using EllipseI = geom::EllipseT<int>;
+
+/** Default ellipse type alias using EllipseF. */
+using Ellipse = EllipseF;
+} // namespace bix
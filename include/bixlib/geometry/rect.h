@@ -244,7 +244,7 @@ public:
      * Returns the dimensions of the rectangle.
      * @return A SizeT instance containing width and height.
      */
-    constexpr SizeT<T> size() const { return Size(width(), height()); }
+    constexpr SizeT<T> size() const { return SizeT<T>(width(), height()); }
 
     /**
      * Resets all boundaries to zero.
@@ -255,6 +255,90 @@ public:
         return *this;
     }
 
+    /**
+     * Checks whether a point lies inside the rectangle.
+     *
+     * The left and top edges are inclusive while the right and bottom edges are
+     * exclusive, so adjacent rectangles never claim the same point.
+     * @param p The point to test.
+     * @return True if the point is inside the rectangle.
+     */
+    constexpr bool contains(const PointT<T>& p) const noexcept {
+        return p.x >= left && p.x < right && p.y >= top && p.y < bottom;
+    }
+
+    /**
+     * Checks whether another rectangle lies entirely inside this one.
+     * @param other The rectangle to test.
+     * @return True if \a other is non-empty and fully covered by this rectangle.
+     */
+    constexpr bool contains(const RectT& other) const noexcept {
+        return !other.isEmpty() && other.left >= left && other.top >= top && other.right <= right
+               && other.bottom <= bottom;
+    }
+
+    /**
+     * Checks whether two rectangles share a non-empty area.
+     * @param other The rectangle to test against.
+     * @return True if the intersection of both rectangles is not empty.
+     */
+    constexpr bool intersects(const RectT& other) const noexcept {
+        return std::max(left, other.left) < std::min(right, other.right)
+               && std::max(top, other.top) < std::min(bottom, other.bottom);
+    }
+
+    /**
+     * Returns the intersection of two rectangles.
+     *
+     * @note The result may be empty (see isEmpty()) if the rectangles do not overlap.
+     * @param other The rectangle to intersect with.
+     * @return The overlapping area of both rectangles.
+     */
+    constexpr RectT intersected(const RectT& other) const noexcept {
+        return {
+            std::max(left, other.left),
+            std::max(top, other.top),
+            std::min(right, other.right),
+            std::min(bottom, other.bottom)
+        };
+    }
+
+    /**
+     * Returns the smallest rectangle containing both rectangles.
+     *
+     * Empty rectangles are ignored, so uniting with an empty rectangle returns the other operand.
+     * @param other The rectangle to unite with.
+     * @return The bounding rectangle of both operands.
+     */
+    constexpr RectT united(const RectT& other) const noexcept {
+        if (other.isEmpty()) { return *this; }
+        if (isEmpty()) { return other; }
+        return {
+            std::min(left, other.left),
+            std::min(top, other.top),
+            std::max(right, other.right),
+            std::max(bottom, other.bottom)
+        };
+    }
+
+    /**
+     * Returns a copy of the rectangle moved by the given offsets.
+     * @param dx Horizontal offset.
+     * @param dy Vertical offset.
+     * @return The translated rectangle.
+     */
+    constexpr RectT translated(T dx, T dy) const noexcept { return {left + dx, top + dy, right + dx, bottom + dy}; }
+
+    /**
+     * Returns a copy of the rectangle grown on every side by the given amounts.
+     *
+     * Negative values shrink the rectangle.
+     * @param dx Amount added to both the left and right edges.
+     * @param dy Amount added to both the top and bottom edges.
+     * @return The inflated rectangle.
+     */
+    constexpr RectT inflated(T dx, T dy) const noexcept { return {left - dx, top - dy, right + dx, bottom + dy}; }
+
     /**
      * Returns an integer rectangle aligned to the pixel grid that fully encloses this rectangle.
      * @note The method ensures no content is clipped by flooring the top-left corner and
@@ -16,9 +16,149 @@
 
 #pragma once
 
+#include "bixlib/geometry/rect.h"
+#include "bixlib/geometry/size.h"
+#include "bixlib/graphics/color.h"
+
+#include <cstdint>
+#include <memory>
 
 namespace bix {
-class Bitmap {
+
+/** The memory layout of bitmap pixels, all formats use four bytes per pixel. */
+enum class PixelFormat : uint8_t {
+    RGBA8Premultiplied, ///< Bytes R, G, B, A with colors multiplied by alpha, the native format of the library.
+    RGBA8,              ///< Bytes R, G, B, A with straight alpha, the usual output of image decoders.
+    BGRA8Premultiplied, ///< Bytes B, G, R, A with colors multiplied by alpha, the native format of Windows surfaces.
+};
+
+/** How a bitmap is sampled when it is drawn at another size. */
+enum class BitmapSampling : uint8_t {
+    Nearest, ///< Take the closest pixel, keeps pixel art and upscaled icons sharp.
+    Linear,  ///< Interpolate between the four closest pixels.
+};
+
+/**
+ * @class Bitmap
+ * @brief A two-dimensional array of pixels in CPU memory.
+ *
+ * Bitmaps either own their pixels or borrow a buffer owned by someone else, see wrap(). Copies share the pixels,
+ * use copy() for a deep copy. Backends identify pixel contents by id() to reuse uploaded textures, so writers have
+ * to call notifyPixelsChanged() after modifying the pixels of a bitmap that was already drawn.
+ *
+ * Immutable bitmaps additionally provide mip levels, each half the size of the previous one. They are generated on
+ * first use and shared by all copies, so a large image drawn at icon size is resampled from a level close to the
+ * drawn size instead of the full resolution. Bitmaps are made immutable by setImmutable(), the ImageCache does so
+ * for every bitmap it stores.
+ *
+ * @note Bitmaps are not thread safe, mip levels are generated lazily by const methods.
+ */
+class BIX_PUBLIC Bitmap {
 public:
+    /** Creates an empty bitmap. */
+    Bitmap() = default;
+
+    /**
+     * Allocates a bitmap owning its pixels, all pixels are fully transparent.
+     * @param size The size in pixels, negative extents are treated as zero.
+     * @param format The pixel format.
+     */
+    explicit Bitmap(const SizeI& size, PixelFormat format = PixelFormat::RGBA8Premultiplied);
+
+    /**
+     * Creates a bitmap borrowing pixels, the buffer must outlive the bitmap and all of its copies.
+     * @param pixels The first byte of the top row.
+     * @param size The size in pixels.
+     * @param stride The distance between the first bytes of two rows, at least four bytes per pixel.
+     * @param format The pixel format.
+     * @return The bitmap, or an empty bitmap if the arguments do not describe a valid buffer.
+     */
+    static Bitmap wrap(uint8_t* pixels, const SizeI& size, size_t stride, PixelFormat format) noexcept;
+
+    int width() const noexcept { return mSize.width; }
+
+    int height() const noexcept { return mSize.height; }
+
+    const SizeI& size() const noexcept { return mSize; }
+
+    RectI bounds() const noexcept { return {0, 0, mSize.width, mSize.height}; }
+
+    size_t stride() const noexcept { return mStride; }
+
+    PixelFormat format() const noexcept { return mFormat; }
+
+    bool isEmpty() const noexcept { return mPixels == nullptr; }
+
+    /** Returns whether the pixels are owned by someone else, see wrap(). */
+    bool isBorrowed() const noexcept;
+
+    /** Returns the number of bytes covered by the rows of the bitmap. */
+    size_t byteSize() const noexcept { return mStride * static_cast<size_t>(mSize.height); }
+
+    uint8_t* data() noexcept { return mPixels; }
+
+    const uint8_t* data() const noexcept { return mPixels; }
+
+    uint8_t* row(int y) noexcept { return mPixels + static_cast<size_t>(y) * mStride; }
+
+    const uint8_t* row(int y) const noexcept { return mPixels + static_cast<size_t>(y) * mStride; }
+
+    /** Returns a pixel converted to premultiplied RGBA8, red in the lowest byte. */
+    uint32_t pixel(int x, int y) const noexcept;
+
+    /** Returns a pixel converted to a straight-alpha color. */
+    Color colorAt(int x, int y) const noexcept;
+
+    /**
+     * Converts a run of pixels to premultiplied RGBA8, red in the lowest byte.
+     * @param y The row.
+     * @param x The first column.
+     * @param count The number of pixels, the run must lie within the bitmap.
+     * @param out Receives \a count pixels.
+     */
+    void readPixels(int y, int x, int count, uint32_t* out) const noexcept;
+
+    /** Returns a deep copy owning its pixels, converted to another format. */
+    Bitmap copy(PixelFormat format) const;
+
+    /** Returns a deep copy owning its pixels in the same format. */
+    Bitmap copy() const { return copy(mFormat); }
+
+    /** Returns an identifier of the current pixel contents, unique within the process and shared by copies. */
+    uint64_t id() const noexcept;
+
+    /** Gives the pixels a new id() after they were modified, so backends drop what they derived from them. */
+    void notifyPixelsChanged() noexcept;
+
+    /** Promises that the pixels never change again, which enables mip levels. */
+    void setImmutable() noexcept;
+
+    bool isImmutable() const noexcept;
+
+    /** Returns the number of mip levels including the bitmap itself, mutable bitmaps have a single level. */
+    size_t mipLevelCount() const noexcept;
+
+    /**
+     * Returns a mip level, generating it and the levels above it on first use.
+     * @param level The level, 0 is the bitmap itself. Levels past the last one return the last level.
+     * @return The level in RGBA8Premultiplied format (the bitmap itself for level 0), valid as long as the bitmap
+     *         or one of its copies lives.
+     */
+    const Bitmap& mipLevel(size_t level) const;
+
+    /**
+     * Returns the smallest mip level that is still at least as large as the bitmap drawn at a scale.
+     * @param scale The ratio of drawn size to bitmap size, the smaller one of both axes.
+     */
+    size_t mipLevelFor(float scale) const noexcept;
+
+private:
+    struct Shared;
+
+    std::shared_ptr<Shared> mShared;
+    uint8_t* mPixels = nullptr;
+    SizeI mSize;
+    size_t mStride = 0;
+    PixelFormat mFormat = PixelFormat::RGBA8Premultiplied;
 };
-}
\ No newline at end of file
+} // namespace bix
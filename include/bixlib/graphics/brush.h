@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include "bixlib/geometry.h"
 #include "bixlib/graphics/color.h"
+#include "bixlib/graphics/gradient.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace bix {
@@ -25,6 +28,7 @@ enum class BrushStyle {
     SolidColor,
     LinearGradient,
     RadialGradient,
+    ConicGradient,
 };
 
 /**
@@ -68,7 +72,101 @@ public:
 
 using ColorBrushPtr = std::unique_ptr<ColorBrush>;
 
-class BIX_PUBLIC LinearGradientBrush : public Brush {
+/**
+ * Base class of brushes filling with a Gradient.
+ *
+ * Gradient brushes keep their parameters themselves, backends only override the setters they have to mirror into
+ * native objects. Positions are in the coordinate space of the canvas and follow its transform.
+ */
+class BIX_PUBLIC GradientBrush : public Brush {
+public:
+    ~GradientBrush() override;
+
+    void setOpacity(float opacity) override { mOpacity = std::clamp(opacity, 0.0f, 1.0f); }
+
+    float opacity() const noexcept override { return mOpacity; }
+
+    const Gradient& gradient() const noexcept { return mGradient; }
+
+    virtual void setGradient(Gradient gradient) { mGradient = std::move(gradient); }
+
+protected:
+    explicit GradientBrush(Gradient gradient) : mGradient(std::move(gradient)) {}
+
+private:
+    Gradient mGradient;
+    float mOpacity = 1.0f;
+};
+
+/** Fills with a gradient running along the line from a start to an end point. */
+class BIX_PUBLIC LinearGradientBrush : public GradientBrush {
+public:
+    BrushStyle style() const noexcept override;
+
+    virtual void setPoints(const Point& start, const Point& end) {
+        mStart = start;
+        mEnd = end;
+    }
+
+    const Point& startPoint() const noexcept { return mStart; }
+
+    const Point& endPoint() const noexcept { return mEnd; }
+
+protected:
+    LinearGradientBrush(const Point& start, const Point& end, Gradient gradient)
+        : GradientBrush(std::move(gradient))
+        , mStart(start)
+        , mEnd(end) {}
+
+private:
+    Point mStart;
+    Point mEnd;
+};
+
+/** Fills with a gradient running from the center of an ellipse to its outline. */
+class BIX_PUBLIC RadialGradientBrush : public GradientBrush {
 public:
+    BrushStyle style() const noexcept override;
+
+    virtual void setEllipse(const Ellipse& ellipse) { mEllipse = ellipse; }
+
+    const Ellipse& ellipse() const noexcept { return mEllipse; }
+
+protected:
+    RadialGradientBrush(const Ellipse& ellipse, Gradient gradient)
+        : GradientBrush(std::move(gradient))
+        , mEllipse(ellipse) {}
+
+private:
+    Ellipse mEllipse;
 };
+
+/** Fills with a gradient sweeping clockwise around a center point, like a progress ring. */
+class BIX_PUBLIC ConicGradientBrush : public GradientBrush {
+public:
+    BrushStyle style() const noexcept override;
+
+    virtual void setCenter(const Point& center) { mCenter = center; }
+
+    const Point& center() const noexcept { return mCenter; }
+
+    /** @param degrees The angle of the gradient start, clockwise from the positive x-axis. */
+    virtual void setStartAngle(float degrees) { mStartAngle = degrees; }
+
+    float startAngle() const noexcept { return mStartAngle; }
+
+protected:
+    ConicGradientBrush(const Point& center, float startAngle, Gradient gradient)
+        : GradientBrush(std::move(gradient))
+        , mCenter(center)
+        , mStartAngle(startAngle) {}
+
+private:
+    Point mCenter;
+    float mStartAngle = 0.f;
+};
+
+using LinearGradientBrushPtr = std::unique_ptr<LinearGradientBrush>;
+using RadialGradientBrushPtr = std::unique_ptr<RadialGradientBrush>;
+using ConicGradientBrushPtr = std::unique_ptr<ConicGradientBrush>;
 } // namespace bix
@@ -17,11 +17,15 @@
 #pragma once
 
 #include "bixlib/geometry.h"
+#include "bixlib/graphics/bitmap.h"
 #include "bixlib/graphics/brush.h"
+#include "bixlib/graphics/path.h"
 #include "bixlib/graphics/pen.h"
 #include "bixlib/graphics/text_format.h"
 #include "bixlib/graphics/transform.h"
 
+#include <span>
+
 namespace bix {
 
 struct TextMetrics {
@@ -48,7 +52,7 @@ enum class DrawResult {
  * Key Features:
  * - Supports basic drawing primitives: rectangles, ellipses, lines, and text.
  * - Manages drawing state through transformation matrices and clipping regions.
- * - Provides resource creation methods for brushes, pens, and text paints.
+ * - Provides resource creation methods for brushes and text paints, pens are plain values.
  * - Abstracts platform-specific rendering details, enabling cross-platform compatibility.
  *
  * Usage:
@@ -104,12 +108,39 @@ public:
     [[nodiscard]]
     virtual ColorBrushPtr createColorBrush(const Color& color) = 0;
     /**
-     * Creates a pen for drawing operations.
-     * @param[in] color The color of the pen.
-     * @return A unique pointer to the created Pen.
+     * Creates a brush filling with a gradient along a line.
+     * @param[in] start The point where the gradient starts.
+     * @param[in] end The point where the gradient ends.
+     * @param[in] gradient The color stops, the baked ramp is shared between brushes with equal gradients.
+     * @return A unique pointer to the created LinearGradientBrush.
      */
     [[nodiscard]]
-    virtual PenPtr createPen(const Color& color) = 0;
+    virtual LinearGradientBrushPtr createLinearGradientBrush(
+        const Point& start,
+        const Point& end,
+        const Gradient& gradient
+    ) = 0;
+    /**
+     * Creates a brush filling with a gradient from the center of an ellipse to its outline.
+     * @param[in] ellipse The ellipse the gradient spans.
+     * @param[in] gradient The color stops, the baked ramp is shared between brushes with equal gradients.
+     * @return A unique pointer to the created RadialGradientBrush.
+     */
+    [[nodiscard]]
+    virtual RadialGradientBrushPtr createRadialGradientBrush(const Ellipse& ellipse, const Gradient& gradient) = 0;
+    /**
+     * Creates a brush filling with a gradient sweeping around a center point.
+     * @param[in] center The center of the sweep.
+     * @param[in] startAngle The angle where the gradient starts in degrees, clockwise from the positive x-axis.
+     * @param[in] gradient The color stops, the baked ramp is shared between brushes with equal gradients.
+     * @return A unique pointer to the created ConicGradientBrush, or nullptr if the backend has no conic gradients.
+     */
+    [[nodiscard]]
+    virtual ConicGradientBrushPtr createConicGradientBrush(
+        const Point& center,
+        float startAngle,
+        const Gradient& gradient
+    ) = 0;
     /**
      * Creates a text paint object for text rendering.
      * @return A unique pointer to the created TextPaint.
@@ -119,10 +150,12 @@ public:
 
     /**
      * Pushes a clipping region onto the canvas.
-     * @param[in] rect The rectangular region to clip.
+     *
+     * The region is intersected with the current clip and mapped through the current transform.
+     * @param[in] rect The rectangular or rounded rectangular region to clip.
      * @return True if the clipping region was successfully pushed, false otherwise.
      */
-    virtual bool pushClip(const UIFlexRoundedRect& rect) = 0;
+    virtual bool pushClip(const RoundRect& rect) = 0;
     /**
      * Pops the top clipping region from the canvas.
      */
@@ -132,7 +165,57 @@ public:
      * @param[in] rect The rectangle to fill.
      * @param[in] brush The brush used for filling.
      */
-    virtual void fillRectangle(const UIRect& rect, Brush& brush) = 0;
+    virtual void fillRectangle(const Rect& rect, Brush& brush) = 0;
+    /**
+     * Fills a batch of rectangles with one brush, e.g. the cell backgrounds of a table.
+     *
+     * Backends fill the whole batch in one pass, the software backend merges consecutive rectangles that share an
+     * edge. The result matches filling each rectangle in order, except that shared edges are not blended twice.
+     * @param[in] rects The rectangles to fill.
+     * @param[in] brush The brush used for filling.
+     */
+    virtual void fillRects(std::span<const Rect> rects, Brush& brush) = 0;
+    /**
+     * Fills the area enclosed by a path with a brush, according to the fill rule of the path.
+     *
+     * Open contours are closed implicitly. The software backend reuses the flattened curves cached by the path.
+     * @param[in] path The path to fill.
+     * @param[in] brush The brush used for filling the path.
+     */
+    virtual void fillPath(const Path& path, Brush& brush) = 0;
+    /**
+     * Fills a rounded rectangle with per-corner radii.
+     *
+     * The software backend computes the coverage analytically from corner masks cached by radius, so rounded
+     * backgrounds fill at close to the speed of plain rectangles.
+     * @param[in] rect The rounded rectangle to fill.
+     * @param[in] brush The brush used for filling.
+     */
+    virtual void fillRoundRect(const RoundRect& rect, Brush& brush) = 0;
+    /**
+     * Fills an ellipse on the canvas.
+     * @param[in] ellipse The ellipse to fill.
+     * @param[in] brush The brush used for filling.
+     */
+    virtual void fillEllipse(const Ellipse& ellipse, Brush& brush) = 0;
+    /**
+     * Draws a region of a bitmap scaled into a rectangle.
+     *
+     * Immutable bitmaps are sampled from the mip level closest to the drawn size, so drawing a large image at icon
+     * size does not resample the full resolution.
+     * @param[in] bitmap The bitmap to draw.
+     * @param[in] src The region of the bitmap in its pixels, parts outside of the bitmap are not drawn.
+     * @param[in] dst The rectangle the region is scaled into.
+     * @param[in] opacity Opacity in range [0.0, 1.0] multiplied into the bitmap.
+     * @param[in] sampling How pixels are sampled when the region is scaled.
+     */
+    virtual void drawBitmap(
+        const Bitmap& bitmap,
+        const Rect& src,
+        const Rect& dst,
+        float opacity,
+        BitmapSampling sampling
+    ) = 0;
 
     /**
      * Draws a rectangle outline on the canvas using the specified pen.
@@ -144,7 +227,13 @@ public:
      * @param[in] pen The Pen object specifying the line style, color, and width of the outline.
      *
      */
-    virtual void drawRectangle(const UIRect& rect, Pen& pen) = 0;
+    virtual void drawRectangle(const Rect& rect, const Pen& pen) = 0;
+    /**
+     * Draws the outlines of a batch of rectangles with one pen.
+     * @param[in] rects The rectangles to outline.
+     * @param[in] pen The pen used for drawing the outlines.
+     */
+    virtual void drawRects(std::span<const Rect> rects, const Pen& pen) = 0;
     /**
      * Draws a rounded rectangle outline on the canvas.
      * @param[in] rect The rectangle to draw.
@@ -152,13 +241,19 @@ public:
      * @param[in] radiusY The vertical radius of the rounded corners.
      * @param[in] pen The pen used for drawing the outline.
      */
-    virtual void drawRoundRect(const UIRect& rect, int radiusX, int radiusY, Pen& pen) = 0;
+    virtual void drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) = 0;
+    /**
+     * Draws the outline of a rounded rectangle with per-corner radii, e.g. a card border.
+     * @param[in] rect The rounded rectangle to draw.
+     * @param[in] pen The pen used for drawing the outline.
+     */
+    virtual void drawRoundRect(const RoundRect& rect, const Pen& pen) = 0;
     /**
      * Draws an ellipse outline on the canvas.
      * @param[in] ellipse The ellipse to draw.
      * @param[in] pen The pen used for drawing the outline.
      */
-    virtual void drawEllipse(const UIEllipse& ellipse, Pen& pen) = 0;
+    virtual void drawEllipse(const Ellipse& ellipse, const Pen& pen) = 0;
     /**
      * Measures the metrics of a text string.
      * @param[in] format The text paint object.
@@ -167,21 +262,27 @@ public:
     virtual void measureText(TextPaint& format, TextMetrics& metrics) = 0;
     /**
      * Draws text on the canvas.
-     * @param[in] origin The starting point for the text.
+     * @param[in] origin The top-left corner of the text layout box.
      * @param[in] text The text paint object.
-     * @param[in] pen The pen used for text rendering.
+     * @param[in] pen The pen used for text rendering, only its color is used.
+     */
+    virtual void drawText(const Point& origin, TextPaint& text, const Pen& pen) = 0;
+    /**
+     * Draws a single line segment on the canvas.
+     * @param[in] line The line to draw.
+     * @param[in] pen The pen used for drawing the line.
      */
-    virtual void drawText(const UIPoint& origin, TextPaint& text, Pen& pen) = 0;
-    virtual void drawLine(const UILine& line, Pen& pen) = 0;
+    virtual void drawLine(const geom::Line& line, const Pen& pen) = 0;
     /**
-     * Draws multiple lines on the canvas.
-     * @param[in] lines The vector of lines to draw.
+     * Draws a batch of independent line segments with one pen, e.g. the lines of a grid.
+     *
+     * Backends stroke the whole batch in one pass. Dash patterns restart at the start of every segment.
+     * @param[in] lines The lines to draw.
      * @param[in] pen The pen used for drawing the lines.
      */
-    virtual void drawLines(const std::vector<UILine>& lines, Pen& pen) = 0;
+    virtual void drawLines(std::span<const geom::Line> lines, const Pen& pen) = 0;
 
     // void drawPolyline();
-    // void drawPolygon();
     // void drawConvexPolygon();
     // void drawArc();
     // void drawPie();
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/geometry.h"
+#include "bixlib/graphics/transform.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace bix {
+
+/** How a backend has to apply a clip pushed onto a ClipStack. */
+enum class ClipOp : uint8_t {
+    /** The clip contains the current clip, nothing has to be pushed or popped. */
+    Skip,
+    /** An axis-aligned rectangle, backends intersect their clip rectangle with it. */
+    Intersect,
+    /** A rounded or transformed clip, backends need a coverage mask or a layer. */
+    Mask,
+};
+
+/** Counters of the clips pushed onto a ClipStack. */
+struct ClipStackStats {
+    size_t skipped = 0;
+    size_t rects = 0;
+    size_t masks = 0;
+};
+
+/**
+ * @class ClipStack
+ * @brief Tracks the clip of a canvas in device space and decides how each pushed clip has to be applied.
+ *
+ * Widgets clip to their bounds on every level of the tree, while most of these clips are axis-aligned rectangles
+ * that contain the clip of their parent. The stack keeps the bounds of the current clip and reports such clips as
+ * ClipOp::Skip, plain rectangles as ClipOp::Intersect and only genuinely rounded clips as ClipOp::Mask, so backends
+ * neither allocate masks nor push layers for them.
+ *
+ * The bounds are conservative, a rounded or transformed clip is tracked by its bounding box.
+ */
+class BIX_PUBLIC ClipStack {
+public:
+    /** Removes all clips and starts over with the surface as the current clip. */
+    void reset(const Rect& surface);
+
+    /**
+     * Pushes a clip.
+     * @param clip The clip in local coordinates.
+     * @param transform The transform from local coordinates to device space.
+     * @return How the backend has to apply the clip.
+     */
+    ClipOp push(const RoundRect& clip, const Transform& transform);
+
+    /**
+     * Pops the top clip.
+     * @return How the popped clip was applied, so the backend can undo it.
+     * @throws std::runtime_error If no clip was pushed.
+     */
+    ClipOp pop();
+
+    /** Returns the bounds of the current clip in device space, empty if nothing can be drawn. */
+    const Rect& bounds() const noexcept { return mEntries.back().bounds; }
+
+    /** Returns true while every applied clip is an axis-aligned rectangle. */
+    bool isRect() const noexcept { return mEntries.back().isRect; }
+
+    /** Returns the number of pushed clips, including the skipped ones. */
+    size_t depth() const noexcept { return mEntries.size() - 1; }
+
+    const ClipStackStats& stats() const noexcept { return mStats; }
+
+private:
+    struct Entry {
+        Rect bounds;
+        ClipOp op = ClipOp::Skip;
+        bool isRect = true;
+    };
+
+    // The bottom entry is the surface and is never popped.
+    std::vector<Entry> mEntries{Entry{}};
+    ClipStackStats mStats;
+};
+} // namespace bix
@@ -19,10 +19,51 @@
 #include <bixlib/export_macro.h>
 #include <bixlib/utils/numeric.h>
 
+#include <algorithm>
+#include <span>
 #include <string>
 
 namespace bix {
 
+/** A color in the HSV (hue, saturation, value) space. */
+struct HsvColor {
+    float h = 0.f; ///< Hue in degrees [0, 360).
+    float s = 0.f; ///< Saturation [0, 1].
+    float v = 0.f; ///< Value [0, 1].
+    float a = 1.f; ///< Alpha [0, 1].
+};
+
+/** A color in the HSL (hue, saturation, lightness) space. */
+struct HslColor {
+    float h = 0.f; ///< Hue in degrees [0, 360).
+    float s = 0.f; ///< Saturation [0, 1].
+    float l = 0.f; ///< Lightness [0, 1].
+    float a = 1.f; ///< Alpha [0, 1].
+};
+
+/** A color with linear-light sRGB components, in which light adds up physically. */
+struct LinearColor {
+    float r = 0.f; ///< Red [0, 1].
+    float g = 0.f; ///< Green [0, 1].
+    float b = 0.f; ///< Blue [0, 1].
+    float a = 1.f; ///< Alpha [0, 1].
+};
+
+/** A color in the perceptually uniform OkLab space. */
+struct OkLabColor {
+    float l = 0.f;     ///< Perceived lightness [0, 1].
+    float a = 0.f;     ///< Green-red axis, roughly [-0.4, 0.4].
+    float b = 0.f;     ///< Blue-yellow axis, roughly [-0.4, 0.4].
+    float alpha = 1.f; ///< Alpha [0, 1].
+};
+
+/** The space two colors are blended in by Color::lerp(). */
+enum class ColorInterpolation : uint8_t {
+    SRGB,   ///< Blend the gamma encoded components, fastest but midpoints look dark and muddy.
+    Linear, ///< Blend in linear light, physically correct mixing of light.
+    OkLab,  ///< Blend in OkLab, perceptually even steps without hue shifts, best for gradients.
+};
+
 /**
  * Represents a color using various color spaces like RGB, HSV, and HSL.
  *
@@ -79,8 +120,46 @@ public:
      * @return A parsed Color object, or an invalid Color if parsing fails.
      * @note This method is case-insensitive (e.g., "#ff0000" and "#FF0000" are equal).
      * @note The '#' prefix is optional.
+     * @note The parser is constexpr, so constant inputs are parsed at compile time.
+     */
+    static constexpr Color fromHexString(std::string_view str) noexcept {
+        if (!str.empty() && str[0] == '#') { str.remove_prefix(1); }
+
+        const size_t len = str.length();
+        if (len != 3 && len != 6 && len != 8) { return {}; }
+
+        auto parsePair = [str](size_t pos) -> int {
+            const int h1 = hexDigit(str[pos]);
+            const int h2 = hexDigit(str[pos + 1]);
+            return (h1 < 0 || h2 < 0) ? -1 : (h1 << 4) | h2;
+        };
+
+        auto parseSingle = [str](size_t pos) -> int {
+            const int h = hexDigit(str[pos]);
+            return (h < 0) ? -1 : (h << 4) | h;
+        };
+
+        const int r = len == 3 ? parseSingle(0) : parsePair(0);
+        const int g = len == 3 ? parseSingle(1) : parsePair(2);
+        const int b = len == 3 ? parseSingle(2) : parsePair(4);
+        const int a = len == 8 ? parsePair(6) : 255;
+
+        if (r < 0 || g < 0 || b < 0 || a < 0) { return {}; }
+
+        return {r, g, b, a};
+    }
+
+    /**
+     * Parses a batch of hexadecimal strings, e.g. the entries of a theme file.
+     *
+     * Produces the same colors as calling fromHexString() for every entry. The common 6 and 8 digit forms are
+     * validated and decoded several at a time with SIMD instructions where the build target supports them.
+     * @param strs The hexadecimal strings.
+     * @param out Receives the parsed colors, invalid entries produce an invalid Color. Only the first
+     *            `min(strs.size(), out.size())` entries are parsed.
+     * @return The number of entries that were parsed successfully.
      */
-    static Color fromHexString(std::string_view str);
+    static size_t fromHexStrings(std::span<const std::string_view> strs, std::span<Color> out) noexcept;
 
     /**
      * Creates a Color object from floating-point RGB components.
@@ -89,15 +168,10 @@ public:
      * @param g Green [0.0, 1.0].
      * @param b Blue [0.0, 1.0].
      * @param a Alpha [0.0, 1.0].
-     * @return A Color object with mapped uint8 values.
+     * @return A Color object with mapped uint8 values, components outside of [0.0, 1.0] are clamped.
      */
     static constexpr Color fromRgbF(float r, float g, float b, float a = 1.0f) {
-        return {
-            math::round_cast<uint8_t>(r * 255.0f),
-            math::round_cast<uint8_t>(g * 255.0f),
-            math::round_cast<uint8_t>(b * 255.0f),
-            math::round_cast<uint8_t>(a * 255.0f)
-        };
+        return {toComponent(r), toComponent(g), toComponent(b), toComponent(a)};
     }
 
     /**
@@ -118,8 +192,10 @@ public:
     constexpr bool isValid() const noexcept { return mSpec != Spec::Invalid; }
 
     /**
-     * Linearly interpolates between two colors.
+     * Linearly interpolates the gamma encoded components of two colors.
      *
+     * The factor is quantized to steps of 1/256 so that the blend runs in integer math, components are within
+     * one unit of the exact blend.
      * @param a The start color.
      * @param b The end color.
      * @param t The interpolation factor [0.0, 1.0].
@@ -127,12 +203,99 @@ public:
      */
     static Color lerp(const Color& a, const Color& b, float t) noexcept;
 
+    /**
+     * Interpolates between two colors in the given color space.
+     *
+     * @param a The start color.
+     * @param b The end color.
+     * @param t The interpolation factor [0.0, 1.0].
+     * @param mode The color space the components are blended in.
+     * @return The resulting blended color.
+     */
+    static Color lerp(const Color& a, const Color& b, float t, ColorInterpolation mode) noexcept;
+
+    /**
+     * Interpolates pairs of colors with a shared factor, e.g. all animated colors of a frame.
+     *
+     * Produces the same colors as calling lerp() for every pair, sRGB blends are vectorized.
+     * @param from The start colors.
+     * @param to The end colors.
+     * @param t The interpolation factor [0.0, 1.0].
+     * @param out Receives the blended colors, only the first `min` of the three sizes are processed.
+     * @param mode The color space the components are blended in.
+     */
+    static void lerp(
+        std::span<const Color> from,
+        std::span<const Color> to,
+        float t,
+        std::span<Color> out,
+        ColorInterpolation mode = ColorInterpolation::SRGB
+    ) noexcept;
+
+    /**
+     * Creates a Color from HSV components, the hue wraps around and the other components are clamped.
+     *
+     * @param hsv The HSV color.
+     * @return An RGB Color object.
+     */
+    static Color fromHsv(const HsvColor& hsv) noexcept;
+
+    /**
+     * Creates a Color from HSL components, the hue wraps around and the other components are clamped.
+     *
+     * @param hsl The HSL color.
+     * @return An RGB Color object.
+     */
+    static Color fromHsl(const HslColor& hsl) noexcept;
+
+    /**
+     * Creates a Color from linear-light components, which are clamped and sRGB encoded.
+     *
+     * @param linear The linear color.
+     * @return An RGB Color object.
+     */
+    static Color fromLinear(const LinearColor& linear) noexcept;
+
+    /**
+     * Creates a Color from OkLab components, colors outside the sRGB gamut are clamped.
+     *
+     * @param lab The OkLab color.
+     * @return An RGB Color object.
+     */
+    static Color fromOkLab(const OkLabColor& lab) noexcept;
+
+    /** Converts the color into the HSV space, the hue of a gray color is 0. */
+    HsvColor toHsv() const noexcept;
+
+    /** Converts the color into the HSL space, the hue of a gray color is 0. */
+    HslColor toHsl() const noexcept;
+
+    /** Decodes the sRGB components into linear light. */
+    LinearColor toLinear() const noexcept;
+
+    /** Converts the color into the OkLab space. */
+    OkLabColor toOkLab() const noexcept;
+
+    /**
+     * Decodes a batch of colors into linear light using a lookup table.
+     * @param src The sRGB colors.
+     * @param dst Receives the linear colors, only the first `min(src.size(), dst.size())` entries are converted.
+     */
+    static void toLinear(std::span<const Color> src, std::span<LinearColor> dst) noexcept;
+
+    /**
+     * Encodes a batch of linear colors into sRGB using a lookup table.
+     * @param src The linear colors, components are clamped to [0, 1].
+     * @param dst Receives the sRGB colors, only the first `min(src.size(), dst.size())` entries are converted.
+     */
+    static void fromLinear(std::span<const LinearColor> src, std::span<Color> dst) noexcept;
+
     /**
      * Returns the red component value.
      *
      * @return Integer value in range [0, 255].
      */
-    int red() const noexcept { return mData[0]; }
+    constexpr int red() const noexcept { return mData[0]; }
 
     /**
      * Sets the red component and returns a reference.
@@ -150,7 +313,7 @@ public:
      *
      * @return Integer value in range [0, 255].
      */
-    int green() const noexcept { return mData[1]; }
+    constexpr int green() const noexcept { return mData[1]; }
 
     /**
      * Sets the green component and returns a reference.
@@ -168,7 +331,7 @@ public:
      *
      * @return Integer value in range [0, 255].
      */
-    int blue() const noexcept { return mData[2]; }
+    constexpr int blue() const noexcept { return mData[2]; }
 
     /**
      * Sets the blue component and returns a reference.
@@ -186,7 +349,7 @@ public:
      *
      * @return Integer value in range [0, 255].
      */
-    int alpha() const noexcept { return mData[3]; }
+    constexpr int alpha() const noexcept { return mData[3]; }
 
     /**
      * Sets the alpha component and returns a reference.
@@ -230,12 +393,24 @@ public:
      *
      * @return True if both colors have the same spec and components.
      */
-    bool operator==(const Color& rhs) const noexcept {
+    constexpr bool operator==(const Color& rhs) const noexcept {
         return mSpec == rhs.mSpec && red() == rhs.red() && green() == rhs.green() && blue() == rhs.blue()
                && alpha() == rhs.alpha();
     }
 
 protected:
+    static constexpr int hexDigit(char c) noexcept {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    /** Maps a normalized component to [0, 255], rounding half up like std::lround while staying constexpr. */
+    static constexpr uint8_t toComponent(float v) noexcept {
+        return static_cast<uint8_t>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+
     Spec mSpec = Spec::Invalid;
     // r g b a
     uint8_t mData[4]{0, 0, 0, 0};
@@ -20,23 +20,32 @@
 
 namespace bix {
 
+namespace detail {
+// Deliberately not constexpr, reaching it during constant evaluation makes the literal ill-formed.
+inline void invalidHexColorLiteral() noexcept {}
+} // namespace detail
+
 namespace literals {
 
 /**
  * Literal operator for creating a Color from a hexadecimal string.
  *
- * Supports formats like `#RRGGBB` or `#RRGGBBAA`.
+ * Supports the same formats as Color::fromHexString(), like `#RGB`, `#RRGGBB` or `#RRGGBBAA`. The literal is
+ * evaluated at compile time and a malformed string is a compile error rather than an invalid color.
  * @code
  * using namespace bix::literals;
- * auto c = "#FF0000"_rgba;
+ * constexpr auto c = "#FF0000"_rgba;
+ * auto bad = "#FF00"_rgba; // error: not a constant expression
  * @endcode
  *
  * @param hex The hexadecimal string literal.
  * @param len The length of the string.
  * @return A Color object parsed from the hex string.
  */
-inline Color operator""_rgba(const char* hex, std::size_t len) {
-    return Color::fromHexString(std::string_view(hex, len));
+consteval Color operator""_rgba(const char* hex, std::size_t len) {
+    const Color c = Color::fromHexString(std::string_view(hex, len));
+    if (!c.isValid()) { detail::invalidHexColorLiteral(); }
+    return c;
 }
 
 /**
@@ -47,7 +56,7 @@ inline Color operator""_rgba(const char* hex, std::size_t len) {
  * @param val The color value in 0xRRGGBB format.
  * @return A Color object with alpha set to 255.
  */
-inline Color operator""_rgb(unsigned long long val) {
+constexpr Color operator""_rgb(unsigned long long val) {
     return {
         static_cast<uint8_t>((val >> 16) & 0xFF),
         static_cast<uint8_t>((val >> 8) & 0xFF),
@@ -66,7 +75,7 @@ inline Color operator""_rgb(unsigned long long val) {
  * @param val The 32-bit color value.
  * @return A Color object.
  */
-inline Color operator""_rgba(unsigned long long val) {
+constexpr Color operator""_rgba(unsigned long long val) {
     return {
         static_cast<uint8_t>((val >> 24) & 0xFF),
         static_cast<uint8_t>((val >> 16) & 0xFF),
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/geometry/rect.h"
+
+#include <vector>
+
+namespace bix {
+
+/**
+ * @class DamageRegion
+ * @brief A small set of dirty rectangles accumulated between two frames.
+ *
+ * Rectangles are snapped outwards to whole pixels so anti-aliased edges are repainted completely. Overlapping
+ * rectangles are merged when their union covers no more area than the two rectangles on their own, and once
+ * the set grows beyond its capacity the pair wasting the least area is merged. The region therefore stays a
+ * handful of rectangles even with many small invalidations, while distant updates are not merged into one large
+ * repaint.
+ */
+class BIX_PUBLIC DamageRegion {
+public:
+    /** The default maximum number of rectangles kept before merging. */
+    static constexpr size_t kDefaultCapacity = 8;
+
+    explicit DamageRegion(size_t capacity = kDefaultCapacity);
+
+    /**
+     * Adds a dirty rectangle to the region.
+     * @param rect The rectangle in device pixels, empty rectangles are ignored.
+     */
+    void add(const Rect& rect);
+
+    /** Adds all rectangles of another region. */
+    void add(const DamageRegion& other);
+
+    /** Removes all rectangles. */
+    void clear() noexcept { mRects.clear(); }
+
+    bool isEmpty() const noexcept { return mRects.empty(); }
+
+    /**
+     * Checks whether a rectangle touches any dirty area.
+     * @param rect The rectangle to test in device pixels.
+     * @return True if \a rect intersects at least one dirty rectangle.
+     */
+    bool intersects(const Rect& rect) const noexcept;
+
+    /**
+     * Returns the bounding rectangle of all dirty rectangles.
+     * @return The union of the region, or an empty rectangle if the region is empty.
+     */
+    Rect bounds() const noexcept;
+
+    /** Returns the disjoint or merged dirty rectangles. */
+    const std::vector<Rect>& rects() const noexcept { return mRects; }
+
+    size_t capacity() const noexcept { return mCapacity; }
+
+private:
+    void mergeCheapestPair();
+
+    std::vector<Rect> mRects;
+    size_t mCapacity;
+};
+} // namespace bix
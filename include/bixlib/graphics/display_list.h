@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/graphics/canvas.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace bix {
+
+/**
+ * @class DisplayList
+ * @brief A flat, replayable recording of Canvas drawing commands.
+ *
+ * Commands are stored as a stream of trivially copyable records, each one a small header followed by its payload.
+ * Data that does not fit a fixed size record (line and rect batches, pens) lives in side tables that
+ * the records refer to by index, so replaying a list is a linear walk over contiguous memory.
+ *
+ * Transforms are recorded relative to the transform active when recording started, replay() composes them with
+ * a base transform so a list recorded once can be drawn at any position.
+ *
+ * Brushes are captured by value (color or gradient, geometry and opacity), bitmaps share their pixels with the
+ * recorded bitmap and paths share their geometry and flattened curves with the recorded path. Text paints are
+ * captured by reference and must outlive the list, they have to be created by the canvas the list is replayed on.
+ *
+ * @note A list lazily creates brushes on the replay target, call releaseResources() when that canvas is discarded.
+ */
+class BIX_PUBLIC DisplayList {
+public:
+    enum class Op : uint8_t {
+        Clear,
+        SetTransform,
+        PushClip,
+        PopClip,
+        FillRect,
+        FillRectGradient,
+        FillRects,
+        FillRectsGradient,
+        FillPath,
+        FillPathGradient,
+        FillRoundRect,
+        FillRoundRectGradient,
+        FillEllipse,
+        FillEllipseGradient,
+        DrawBitmap,
+        DrawRect,
+        DrawRects,
+        DrawRoundRect,
+        DrawRoundRectRadii,
+        DrawEllipse,
+        DrawText,
+        DrawLine,
+        DrawLines,
+    };
+
+    DisplayList() = default;
+    DisplayList(const DisplayList&) = delete;
+    DisplayList& operator=(const DisplayList&) = delete;
+    DisplayList(DisplayList&&) noexcept = default;
+    DisplayList& operator=(DisplayList&&) noexcept = default;
+
+    /**
+     * Removes all commands while keeping the allocated storage for the next recording.
+     */
+    void reset();
+
+    /**
+     * Replays all recorded commands onto a canvas.
+     * @param target The canvas to draw on.
+     * @param base The transform that recorded transforms are relative to.
+     */
+    void replay(Canvas& target, const Transform& base = {});
+
+    /**
+     * Releases the device resources created on the last replay target.
+     */
+    void releaseResources() noexcept;
+
+    bool isEmpty() const noexcept { return mCommandCount == 0; }
+
+    /** Returns the number of recorded commands. */
+    size_t commandCount() const noexcept { return mCommandCount; }
+
+    /** Returns the size of the command stream in bytes, excluding side tables. */
+    size_t byteSize() const noexcept { return mStream.size(); }
+
+    //******************recording********************//
+
+    void clear(const Color& c);
+    void setTransform(const Transform& transform);
+    void pushClip(const RoundRect& rect);
+    void popClip();
+    void fillRectangle(const Rect& rect, const Color& color, float opacity);
+    void fillRectangle(const Rect& rect, const GradientBrush& brush);
+    void fillRects(std::span<const Rect> rects, const Color& color, float opacity);
+    void fillRects(std::span<const Rect> rects, const GradientBrush& brush);
+    void fillPath(const Path& path, const Color& color, float opacity);
+    void fillPath(const Path& path, const GradientBrush& brush);
+    void fillRoundRect(const RoundRect& rect, const Color& color, float opacity);
+    void fillRoundRect(const RoundRect& rect, const GradientBrush& brush);
+    void fillEllipse(const Ellipse& ellipse, const Color& color, float opacity);
+    void fillEllipse(const Ellipse& ellipse, const GradientBrush& brush);
+    void drawBitmap(const Bitmap& bitmap, const Rect& src, const Rect& dst, float opacity, BitmapSampling sampling);
+    void drawRectangle(const Rect& rect, const Pen& pen);
+    void drawRects(std::span<const Rect> rects, const Pen& pen);
+    void drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen);
+    void drawRoundRect(const RoundRect& rect, const Pen& pen);
+    void drawEllipse(const Ellipse& ellipse, const Pen& pen);
+    void drawText(const Point& origin, TextPaint& text, const Pen& pen);
+    void drawLine(const geom::Line& line, const Pen& pen);
+    void drawLines(std::span<const geom::Line> lines, const Pen& pen);
+
+private:
+    struct Header {
+        Op op;
+        uint8_t reserved;
+        uint16_t size;
+    };
+
+    // The state of a gradient brush, the geometry fields used depend on the style.
+    struct GradientFill {
+        BrushStyle style;
+        Gradient gradient;
+        float opacity;
+        Point origin; ///< Start point of linear gradients, center of radial and conic gradients.
+        Point extent; ///< End point of linear gradients, radii of radial gradients.
+        float angle;  ///< Start angle of conic gradients.
+
+        bool operator==(const GradientFill& rhs) const noexcept;
+    };
+
+    template <typename T>
+    void append(Op op, const T& payload);
+    uint32_t penIndex(const Pen& pen);
+    template <typename T>
+    static uint32_t appendBatch(std::vector<T>& table, std::span<const T> items);
+    uint32_t gradientIndex(const GradientBrush& brush);
+    uint32_t pathIndex(const Path& path);
+    Brush& colorBrush(Canvas& target, const Color& color, float opacity);
+    Brush* gradientBrush(Canvas& target, uint32_t index);
+
+    std::vector<std::byte> mStream;
+    std::vector<Pen> mPens;
+    // Batches of all batched commands are stored back to back, records refer to them by offset and count.
+    std::vector<geom::Line> mLines;
+    std::vector<Rect> mRects;
+    std::vector<TextPaint*> mTexts;
+    std::vector<GradientFill> mGradients;
+    std::vector<Bitmap> mBitmaps;
+    std::vector<Path> mPaths;
+    size_t mCommandCount = 0;
+
+    ColorBrushPtr mBrush = nullptr;
+    // Brushes of mGradients created on the replay target, same indices.
+    std::vector<BrushPtr> mGradientBrushes;
+    const Canvas* mBrushOwner = nullptr;
+};
+} // namespace bix
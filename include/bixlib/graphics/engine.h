@@ -28,6 +28,7 @@ public:
         Direct2D,
         GdiPlus,
         X11,
+        Software,
 
         UserCustom = 100
     };
@@ -39,5 +40,17 @@ public:
     virtual Type type() const noexcept = 0;
 
     virtual CanvasPtr createCanvas(const Window& w) = 0;
+
+    /**
+     * Creates a canvas that renders into an off-screen surface instead of a window.
+     *
+     * Off-screen canvases are used for headless rendering, snapshots and benchmarks.
+     * @param size The pixel size of the surface.
+     * @return The created canvas, or nullptr if the engine does not support off-screen rendering.
+     */
+    virtual CanvasPtr createOffscreenCanvas(const SizeI& size) {
+        BIX_UNUSED(size)
+        return nullptr;
+    }
 };
 } // namespace bix
\ No newline at end of file
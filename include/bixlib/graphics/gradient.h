@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/graphics/color.h"
+#include "bixlib/utils/lru_cache.h"
+
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace bix {
+
+/** A color at a position along a gradient. */
+struct GradientStop {
+    float offset = 0.f; ///< Position along the gradient [0, 1].
+    Color color;
+
+    bool operator==(const GradientStop& rhs) const noexcept {
+        return math::exactlyEqual(offset, rhs.offset) && color == rhs.color;
+    }
+};
+
+/** How a gradient continues outside of its [0, 1] range. */
+enum class GradientSpread : uint8_t {
+    Pad,     ///< Extend the first and last stop.
+    Repeat,  ///< Repeat the gradient.
+    Reflect, ///< Repeat the gradient, mirroring every other repetition.
+};
+
+/**
+ * @class Gradient
+ * @brief An immutable list of color stops together with the way they are interpolated and extended.
+ *
+ * Gradients are plain values that are cheap to compare and hash, backends use them as the key under which the
+ * baked GradientRamp of a gradient is shared.
+ */
+class BIX_PUBLIC Gradient {
+public:
+    Gradient() = default;
+
+    /**
+     * @param stops The color stops, offsets are clamped to [0, 1] and stops are ordered by offset. Stops sharing
+     *              an offset form a hard edge.
+     * @param interpolation The color space neighbouring stops are blended in.
+     * @param spread How the gradient continues outside of its range.
+     */
+    explicit Gradient(
+        std::vector<GradientStop> stops,
+        ColorInterpolation interpolation = ColorInterpolation::SRGB,
+        GradientSpread spread = GradientSpread::Pad
+    );
+
+    Gradient(
+        std::initializer_list<GradientStop> stops,
+        ColorInterpolation interpolation = ColorInterpolation::SRGB,
+        GradientSpread spread = GradientSpread::Pad
+    )
+        : Gradient(std::vector<GradientStop>(stops), interpolation, spread) {}
+
+    const std::vector<GradientStop>& stops() const noexcept { return mStops; }
+
+    ColorInterpolation interpolation() const noexcept { return mInterpolation; }
+
+    GradientSpread spread() const noexcept { return mSpread; }
+
+    /** Returns whether the gradient has no stops, an empty gradient paints nothing. */
+    bool isEmpty() const noexcept { return mStops.empty(); }
+
+    /**
+     * Evaluates the gradient exactly, without a ramp.
+     * @param t The position along the gradient, positions outside of [0, 1] are mapped by the spread mode.
+     */
+    Color colorAt(float t) const noexcept;
+
+    /** Maps a position along a gradient into [0, 1] according to a spread mode. */
+    static float applySpread(float t, GradientSpread spread) noexcept;
+
+    size_t hash() const noexcept;
+
+    bool operator==(const Gradient& rhs) const noexcept;
+
+private:
+    std::vector<GradientStop> mStops;
+    ColorInterpolation mInterpolation = ColorInterpolation::SRGB;
+    GradientSpread mSpread = GradientSpread::Pad;
+};
+
+struct GradientHash {
+    size_t operator()(const Gradient& gradient) const noexcept { return gradient.hash(); }
+};
+
+/**
+ * @class GradientRamp
+ * @brief A gradient baked into a lookup table of premultiplied pixels.
+ *
+ * Evaluating a gradient per pixel reduces to a table lookup. Pixels are premultiplied RGBA8 with red in the lowest
+ * byte, the format the software backend renders into and GPU backends upload as a one dimensional texture.
+ */
+class BIX_PUBLIC GradientRamp {
+public:
+    /** The size of most ramps. */
+    static constexpr size_t kDefaultSize = 256;
+    /** The size of ramps whose stops are too close together for the default size. */
+    static constexpr size_t kDetailedSize = 1024;
+
+    /** Bakes a gradient into a ramp of its preferred size. */
+    explicit GradientRamp(const Gradient& gradient);
+
+    /**
+     * Bakes a gradient into a ramp.
+     * @param size The number of entries, at least 2.
+     */
+    GradientRamp(const Gradient& gradient, size_t size);
+
+    /** Returns the ramp size that resolves every stop of a gradient. */
+    static size_t preferredSize(const Gradient& gradient) noexcept;
+
+    size_t size() const noexcept { return mPixels.size(); }
+
+    GradientSpread spread() const noexcept { return mSpread; }
+
+    /** Returns whether every entry is fully opaque. */
+    bool isOpaque() const noexcept { return mOpaque; }
+
+    std::span<const uint32_t> pixels() const noexcept { return mPixels; }
+
+    /** Returns the entry for a position along the gradient, applying the spread mode. */
+    size_t index(float t) const noexcept {
+        const float scaled = Gradient::applySpread(t, mSpread) * static_cast<float>(mPixels.size() - 1);
+        return static_cast<size_t>(scaled + 0.5f);
+    }
+
+    uint32_t lookup(float t) const noexcept { return mPixels[index(t)]; }
+
+private:
+    std::vector<uint32_t> mPixels;
+    GradientSpread mSpread = GradientSpread::Pad;
+    bool mOpaque = true;
+};
+
+using GradientRampPtr = std::shared_ptr<const GradientRamp>;
+
+/** Hit and miss counters of a GradientRampCache. */
+struct GradientCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+};
+
+/**
+ * @class GradientRampCache
+ * @brief An LRU cache of baked ramps shared by all gradient brushes of a backend.
+ *
+ * Themes reuse a handful of gradients across many widgets, so brushes with equal gradients share one ramp and a
+ * gradient is only baked again after it was evicted. Ramps are immutable, a brush keeps its ramp alive even after
+ * the cache evicted it.
+ */
+class BIX_PUBLIC GradientRampCache {
+public:
+    /** The default maximum number of cached ramps. */
+    static constexpr size_t kDefaultCapacity = 256;
+
+    explicit GradientRampCache(size_t capacity = kDefaultCapacity) : mRamps(capacity) {}
+
+    /** Returns the cached ramp of a gradient, baking and caching it on a miss. */
+    GradientRampPtr obtain(const Gradient& gradient);
+
+    void clear() noexcept { mRamps.clear(); }
+
+    size_t size() const noexcept { return mRamps.size(); }
+
+    size_t capacity() const noexcept { return mRamps.capacity(); }
+
+    const GradientCacheStats& stats() const noexcept { return mStats; }
+
+private:
+    LruCache<Gradient, GradientRampPtr, GradientHash> mRamps;
+    GradientCacheStats mStats;
+};
+
+using GradientRampCachePtr = std::shared_ptr<GradientRampCache>;
+} // namespace bix
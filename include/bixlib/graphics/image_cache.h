@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/graphics/bitmap.h"
+#include "bixlib/utils/lru_cache.h"
+
+#include <concepts>
+#include <string>
+
+namespace bix {
+
+/** Hit and miss counters of an ImageCache. */
+struct ImageCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+};
+
+/**
+ * @class ImageCache
+ * @brief A cache of decoded images bounded by a memory budget, evicting the least recently used images.
+ *
+ * Images are stored under a key chosen by the caller, usually the resource path, and are decoded at most once while
+ * they stay cached. Stored bitmaps are immutable and own their pixels in RGBA8Premultiplied format, so they are
+ * drawn without conversion and get mip levels for drawing at reduced sizes.
+ *
+ * Bitmaps share their pixels, a bitmap returned by the cache stays valid after it was evicted.
+ *
+ * @note The cache is not thread safe, it is meant to be used from the UI thread.
+ */
+class BIX_PUBLIC ImageCache {
+public:
+    /** The default budget in bytes. */
+    static constexpr size_t kDefaultBudget = size_t{64} << 20;
+
+    /** @param budget The maximum number of bytes of all cached images, mip levels included. */
+    explicit ImageCache(size_t budget = kDefaultBudget);
+
+    /** Returns the cache shared by the whole process. */
+    static ImageCache& shared();
+
+    /**
+     * Looks up an image and marks it as most recently used.
+     * @return The image, or an empty bitmap if the key is not cached.
+     */
+    Bitmap find(const std::string& key);
+
+    /**
+     * Stores an image, replacing an image cached under the same key.
+     *
+     * Borrowed or non-premultiplied bitmaps are copied, the stored bitmap is made immutable. Images larger than the
+     * whole budget are returned without being cached.
+     * @return The stored bitmap, empty if \a bitmap is empty.
+     */
+    Bitmap insert(const std::string& key, Bitmap bitmap);
+
+    /**
+     * Returns a cached image, decoding and caching it on a miss.
+     * @param key The key of the image.
+     * @param decode Called without arguments on a miss, returns the decoded Bitmap or an empty bitmap on failure.
+     *               Failures are not cached.
+     */
+    template <std::invocable Decoder>
+    Bitmap obtain(const std::string& key, Decoder&& decode) {
+        if (Bitmap cached = find(key); !cached.isEmpty()) { return cached; }
+        return insert(key, std::forward<Decoder>(decode)());
+    }
+
+    /** Removes an image, returns false if the key was not cached. */
+    bool erase(const std::string& key);
+
+    void clear() noexcept;
+
+    /** Changes the budget, evicting the least recently used images that no longer fit. */
+    void setBudget(size_t budget);
+
+    size_t budget() const noexcept { return mBudget; }
+
+    /** Returns the number of bytes charged for the cached images. */
+    size_t bytes() const noexcept { return mBytes; }
+
+    size_t size() const noexcept { return mImages.size(); }
+
+    const ImageCacheStats& stats() const noexcept { return mStats; }
+
+    /** Returns the bytes charged for a bitmap, its pixels and all of its mip levels. */
+    static size_t cost(const Bitmap& bitmap) noexcept;
+
+private:
+    void trim(size_t budget);
+
+    LruCache<std::string, Bitmap> mImages;
+    size_t mBudget;
+    size_t mBytes = 0;
+    ImageCacheStats mStats;
+};
+} // namespace bix
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/graphics/canvas.h"
+
+#include <array>
+#include <span>
+
+namespace bix {
+
+/**
+ * @class NinePatch
+ * @brief A bitmap split into a 3x3 grid that is stretched without distorting its borders.
+ *
+ * The center rect divides the bitmap into four corners that keep their size, four edges that stretch along one axis
+ * and a center that stretches along both axes. When the target is smaller than the borders, they shrink
+ * proportionally.
+ *
+ * The slices for a target size are computed once and reused while the size stays the same, so drawing a nine-patch
+ * costs at most nine drawBitmap() calls and no allocation. Slices with an empty source or destination are skipped.
+ */
+class BIX_PUBLIC NinePatch {
+public:
+    /** A part of the bitmap and where it is drawn, relative to the top left corner of the target. */
+    struct Slice {
+        Rect src;
+        Rect dst;
+    };
+
+    NinePatch() = default;
+
+    /**
+     * @param bitmap The bitmap, usually an immutable one obtained from the ImageCache.
+     * @param center The stretchable region in bitmap pixels, clamped to the bitmap. An axis along which the center
+     * is empty stretches the whole bitmap.
+     */
+    NinePatch(Bitmap bitmap, const RectI& center);
+
+    const Bitmap& bitmap() const noexcept { return mBitmap; }
+
+    const RectI& center() const noexcept { return mCenter; }
+
+    bool isEmpty() const noexcept { return mBitmap.isEmpty(); }
+
+    /**
+     * Returns the slices that cover a target of the given size.
+     * @note The returned span is invalidated by the next call with a different size.
+     */
+    std::span<const Slice> slices(const Size& size);
+
+    /**
+     * Draws the nine-patch stretched over a rect.
+     * @param canvas The canvas to draw on.
+     * @param dst The target rect.
+     * @param opacity The opacity in range [0, 1].
+     * @param sampling How the stretched slices are sampled.
+     */
+    void draw(Canvas& canvas, const Rect& dst, float opacity, BitmapSampling sampling = BitmapSampling::Linear);
+
+private:
+    Bitmap mBitmap;
+    RectI mCenter;
+
+    Size mCachedSize{-1.f, -1.f};
+    std::array<Slice, 9> mSlices{};
+    size_t mSliceCount = 0;
+};
+} // namespace bix
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/geometry.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace bix {
+
+/** Decides which areas enclosed by the contours of a path are inside. */
+enum class FillRule : uint8_t {
+    NonZero, ///< A point is inside when the contours wind around it a non-zero number of times.
+    EvenOdd, ///< A point is inside when a ray from it crosses the contours an odd number of times.
+};
+
+enum class PathVerb : uint8_t {
+    Move,  ///< Starts a contour, uses one point.
+    Line,  ///< Uses one point.
+    Quad,  ///< Uses a control point and an end point.
+    Cubic, ///< Uses two control points and an end point.
+    Close, ///< Closes the contour, uses no point.
+};
+
+/**
+ * The polygons approximating the curves of a path for a transform scale.
+ *
+ * All contours are stored back to back, each one is implicitly closed when filled.
+ */
+struct FlattenedPath {
+    std::vector<Point> points;
+    std::vector<uint32_t> contourEnds; ///< One past the last point of each contour.
+    float scale = 0;                   ///< The scale the curves were flattened for.
+    Rect bounds;
+
+    /** Returns the points of a contour. */
+    std::span<const Point> contour(size_t index) const noexcept {
+        const uint32_t first = index == 0 ? 0 : contourEnds[index - 1];
+        return {points.data() + first, contourEnds[index] - first};
+    }
+};
+
+using FlattenedPathPtr = std::shared_ptr<const FlattenedPath>;
+
+/**
+ * @class Path
+ * @brief A shape made of contours of lines and Bézier curves.
+ *
+ * Paths are values that share their geometry between copies until one of them is modified, so recording a path into
+ * a display list does not copy its points.
+ *
+ * Curves are flattened into polygons before they are rasterized. The number of segments depends on the curvature
+ * and the device scale, see flatten(), and the last result is cached with the geometry, so a static shape drawn
+ * every frame is flattened once.
+ *
+ * @note Paths and their copies must only be drawn from one thread at a time.
+ */
+class BIX_PUBLIC Path {
+public:
+    /** The maximum distance between a curve and its flattened polygon, unit device px. */
+    static constexpr float kTolerance = 0.25f;
+
+    Path() = default;
+
+    explicit Path(FillRule rule) : mFillRule(rule) {}
+
+    FillRule fillRule() const noexcept { return mFillRule; }
+
+    void setFillRule(FillRule rule) noexcept { mFillRule = rule; }
+
+    /** Starts a new contour. */
+    Path& moveTo(const Point& p);
+    /** Adds a line from the current point, a path without a current point starts at the last moveTo() or origin. */
+    Path& lineTo(const Point& p);
+    /** Adds a quadratic Bézier curve from the current point. */
+    Path& quadTo(const Point& control, const Point& end);
+    /** Adds a cubic Bézier curve from the current point. */
+    Path& cubicTo(const Point& control1, const Point& control2, const Point& end);
+    /**
+     * Adds an elliptical arc, connected to the current contour by a line, or starting a new contour when there is
+     * no open one.
+     * @param ellipse The ellipse the arc lies on.
+     * @param startAngle The angle where the arc starts in degrees, clockwise from the positive x-axis.
+     * @param sweepAngle The angle the arc spans in degrees, negative values sweep counterclockwise. Clamped to
+     * a full turn.
+     */
+    Path& arcTo(const Ellipse& ellipse, float startAngle, float sweepAngle);
+    /** Closes the current contour, the next segment starts a new contour at the same start point. */
+    Path& close();
+
+    /** Adds a closed rectangle contour, clockwise from the top left corner. */
+    Path& addRect(const Rect& rect);
+    /**
+     * Adds a closed rounded rectangle contour, clockwise from the end of the top-left corner. Radii are clamped to
+     * half of the shorter side.
+     */
+    Path& addRoundRect(const RoundRect& rect);
+    /** Adds a closed ellipse contour, clockwise from the rightmost point. */
+    Path& addEllipse(const Ellipse& ellipse);
+    /** Adds a contour through the points, closed or left open. */
+    Path& addPolygon(std::span<const Point> points, bool closed);
+
+    /** Removes all contours, keeping the fill rule. */
+    void reset();
+
+    bool isEmpty() const noexcept { return !mData || mData->verbs.empty(); }
+
+    std::span<const PathVerb> verbs() const noexcept;
+
+    std::span<const Point> points() const noexcept;
+
+    /** Returns the bounds of all points including curve control points. */
+    Rect bounds() const noexcept { return mData ? mData->bounds : Rect{}; }
+
+    /**
+     * Flattens the curves for drawing at a transform scale, the points stay in path coordinates.
+     *
+     * The scale is rounded up to a quarter octave so small animations of the scale reuse the cached result, the
+     * polygon stays within kTolerance device pixels of the curves.
+     * @param scale The largest axis scale of the transform the path is drawn with.
+     * @return The flattened path, empty when the path has no contour.
+     */
+    FlattenedPathPtr flatten(float scale) const;
+
+private:
+    struct Data {
+        std::vector<PathVerb> verbs;
+        std::vector<Point> points;
+        Rect bounds;
+        FlattenedPathPtr flattened;
+    };
+
+    // Returns geometry owned by this path only, dropping the flattened cache.
+    Data& mutate();
+    void addVerb(PathVerb verb, std::initializer_list<Point> points);
+    void ensureContour();
+
+    std::shared_ptr<Data> mData;
+    FillRule mFillRule = FillRule::NonZero;
+    bool mContourOpen = false;
+    Point mContourStart;
+};
+} // namespace bix
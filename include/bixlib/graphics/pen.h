@@ -17,76 +17,115 @@
 #pragma once
 
 #include "bixlib/graphics/color.h"
-
-#include <vector>
+#include "bixlib/graphics/stroke_style.h"
 
 namespace bix {
-enum class LineStyle {
-    Solid,
-    Dash,
-    Dot,
-    DashDot,
-    DashDotDot,
-    CustomDash
-};
 
-enum class CapStyle {
-    Flat,
-    Square,
-    Round,
-    Triangle,
-};
-
-enum class LineJoinStyle {
-    Miter,
-    Bevel,
-    Round,
-    MiterOrBevel,
-};
-
-class Pen {
+/**
+ * Describes how the outline of a shape is stroked.
+ *
+ * Pen is a cheap value handle: a color and a reference to an interned StrokeStyle. Copying a pen copies a shared
+ * reference, and pens with equal strokes share one style object, so they compare by reference and backends reuse
+ * one native stroke object for all of them. The setters of stroke properties intern the modified style, configure
+ * pens once rather than per frame.
+ */
+class BIX_PUBLIC Pen {
 public:
-    Pen() = default;
+    Pen();
     explicit Pen(Color color, float width = 1.0f);
+    Pen(Color color, const StrokeStyle& stroke);
+
+    const Color& color() const noexcept { return mColor; }
+
+    void setColor(const Color& c) { mColor = c; }
+
+    const StrokeStyle& strokeStyle() const noexcept { return *mStroke; }
+
+    /** Returns the interned stroke style, equal strokes return the same reference. */
+    const StrokeStyleRef& strokeStyleRef() const noexcept { return mStroke; }
+
+    void setStrokeStyle(const StrokeStyle& stroke);
+
+    /**
+     * get the stroke width of the pen.
+     *
+     * @return The stroke width of the pen, unit px.
+     */
+    float strokeWidth() const noexcept { return mStroke->width(); }
+
+    /**
+     * Sets the stroke width, negative values are clamped to zero.
+     * @param w The stroke width, unit px.
+     */
+    void setStrokeWidth(float w);
+
+    LineStyle lineStyle() const noexcept { return mStroke->lineStyle(); }
+
+    void setLineStyle(LineStyle style);
+
+    LineJoinStyle lineJoin() const noexcept { return mStroke->lineJoin(); }
+
+    void setLineJoin(LineJoinStyle lineJoin);
+
+    CapStyle startCap() const noexcept { return mStroke->startCap(); }
+
+    CapStyle endCap() const noexcept { return mStroke->endCap(); }
+
+    CapStyle dashCap() const noexcept { return mStroke->dashCap(); }
+
+    void setLineCap(CapStyle start, CapStyle end, CapStyle dash);
+
+    void setStartCap(CapStyle start);
+
+    void setEndCap(CapStyle end);
+
+    void setDashCap(CapStyle dash);
+
+    float miterLimit() const noexcept { return mStroke->miterLimit(); }
+
+    /**
+     * Sets the miter limit, values below 1 are ignored.
+     * @param limit The ratio of miter length to half the stroke width.
+     */
+    void setMiterLimit(float limit);
+
+    float dashOffset() const noexcept { return mStroke->dashOffset(); }
+
+    /**
+     * Sets the offset into the dash sequence, negative values are ignored.
+     * @param dashOffset The offset in multiples of the stroke width.
+     */
+    void setDashOffset(float dashOffset);
+
+    const std::vector<float>& customDash() const noexcept { return mStroke->customDash(); }
+
+    /**
+     * Set the floating point array of custom dash. Using this method, LineStyle will be automatically set to
+     * CustomDash.
+     * @param dashes The alternating dash and gap lengths, in multiples of the stroke width.
+     */
+    void setCustomDash(const std::vector<float>& dashes);
+
+    /**
+     * Checks whether the pen only uses the default stroke attributes.
+     *
+     * A simple pen is solid with flat caps and miter joins, which lets backends skip creating
+     * any stroke style object.
+     * @return True if only color and width differ from the defaults.
+     */
+    bool isSimpleStroke() const noexcept { return mStroke->isSimple(); }
+
+    bool operator==(const Pen& rhs) const noexcept { return mColor == rhs.mColor && mStroke == rhs.mStroke; }
 
 private:
+    template<typename Fn>
+    void modifyStroke(Fn&& fn) {
+        StrokeStyle stroke = *mStroke;
+        fn(stroke);
+        setStrokeStyle(stroke);
+    }
+
     Color mColor;
+    StrokeStyleRef mStroke;
 };
-
-// class BIX_PUBLIC Pen {
-// public:
-//     virtual ~Pen() = default;
-//     virtual void setColor(const Color& c) = 0;
-//     virtual void setStrokeWidth(int w) = 0; // unit px
-//     virtual void setLineStyle(LineStyle style) = 0;
-//     virtual void setLineJoin(LineJoinStyle lineJoin) = 0;
-//     virtual void setLineCap(CapStyle start, CapStyle end, CapStyle dash) = 0;
-//     virtual void setStartCap(CapStyle start) = 0;
-//     virtual void setEndCap(CapStyle end) = 0;
-//     virtual void setDashCap(CapStyle dash) = 0;
-//     virtual void setMiterLimit(float limit) = 0;
-//     virtual void setDashOffset(float dashOffset) = 0;
-//     /**
-//      * Set the floating point array of custom dash. Using this method, LineStyle will be automatically set to
-//      * CustomDash.
-//      * @param dashes
-//      */
-//     virtual void setCustomDash(const std::vector<float>& dashes) = 0;
-//
-//     virtual const Color& color() const noexcept = 0;
-//
-//     /**
-//      * get the stroke width of the pen.
-//      *
-//      * @return The stroke width of the pen.
-//      */
-//     virtual int strokeWidth() const noexcept = 0;
-//
-//     virtual bool testCast(uintptr_t scope, long castId) const noexcept = 0;
-// };
-//
-// /**
-//  * std::unique_ptr<Pen> alias for Pen objects
-//  */
-// using PenPtr = std::unique_ptr<Pen>;
 } // namespace bix
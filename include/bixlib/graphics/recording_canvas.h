@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/graphics/display_list.h"
+
+namespace bix {
+
+/**
+ * @class RecordingCanvas
+ * @brief A Canvas that captures drawing calls into a DisplayList instead of rasterizing them.
+ *
+ * Resource creation and text measuring are forwarded to a real canvas, which is also the canvas the recorded
+ * list is expected to be replayed on. Transforms set on the recorder are recorded relative to the base transform
+ * passed to DisplayList::replay().
+ */
+class BIX_PUBLIC RecordingCanvas : public Canvas {
+public:
+    /**
+     * Creates a recorder writing into a display list.
+     * @param list The list receiving the commands, it is reset first.
+     * @param resources The canvas used to create brushes and text paints and to measure text.
+     */
+    RecordingCanvas(DisplayList& list, Canvas& resources);
+
+    [[nodiscard]] ColorBrushPtr createColorBrush(const Color& color) override;
+    [[nodiscard]] LinearGradientBrushPtr createLinearGradientBrush(
+        const Point& start,
+        const Point& end,
+        const Gradient& gradient
+    ) override;
+    [[nodiscard]] RadialGradientBrushPtr createRadialGradientBrush(
+        const Ellipse& ellipse,
+        const Gradient& gradient
+    ) override;
+    [[nodiscard]] ConicGradientBrushPtr createConicGradientBrush(
+        const Point& center,
+        float startAngle,
+        const Gradient& gradient
+    ) override;
+    [[nodiscard]] TextPaintPtr createTextPaint() override;
+
+    void beginDraw() override;
+    DrawResult endDraw() override;
+    void setTransform(const Transform& transform) override;
+    void resize(const Size& size) override;
+    void clear(const Color& c) override;
+    bool pushClip(const RoundRect& rect) override;
+    void popClip() override;
+    Size size() const noexcept override;
+    void fillRectangle(const Rect& rect, Brush& brush) override;
+    void fillRects(std::span<const Rect> rects, Brush& brush) override;
+    void fillPath(const Path& path, Brush& brush) override;
+    void fillRoundRect(const RoundRect& rect, Brush& brush) override;
+    void fillEllipse(const Ellipse& ellipse, Brush& brush) override;
+    void drawBitmap(
+        const Bitmap& bitmap,
+        const Rect& src,
+        const Rect& dst,
+        float opacity,
+        BitmapSampling sampling
+    ) override;
+    void drawRectangle(const Rect& rect, const Pen& pen) override;
+    void drawRects(std::span<const Rect> rects, const Pen& pen) override;
+    void drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) override;
+    void drawRoundRect(const RoundRect& rect, const Pen& pen) override;
+    void drawEllipse(const Ellipse& ellipse, const Pen& pen) override;
+    void measureText(TextPaint& format, TextMetrics& metrics) override;
+    void drawText(const Point& origin, TextPaint& text, const Pen& pen) override;
+    void drawLine(const geom::Line& line, const Pen& pen) override;
+    void drawLines(std::span<const geom::Line> lines, const Pen& pen) override;
+
+private:
+    DisplayList& mList;
+    Canvas& mResources;
+    int mClipDepth = 0;
+};
+} // namespace bix
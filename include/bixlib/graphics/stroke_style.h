@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/export_macro.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace bix {
+enum class LineStyle {
+    Solid,
+    Dash,
+    Dot,
+    DashDot,
+    DashDotDot,
+    CustomDash
+};
+
+enum class CapStyle {
+    Flat,
+    Square,
+    Round,
+    Triangle,
+};
+
+enum class LineJoinStyle {
+    Miter,
+    Bevel,
+    Round,
+    MiterOrBevel,
+};
+
+/**
+ * @class StrokeStyle
+ * @brief The geometry of a stroke: width, caps, joins and dash pattern, everything of a Pen except its color.
+ *
+ * Stroke styles are plain values that are cheap to compare and hash. Pens refer to interned styles, see
+ * StrokeStyleCache, and backends use them as the key under which native stroke objects are shared.
+ */
+class BIX_PUBLIC StrokeStyle {
+public:
+    StrokeStyle() = default;
+
+    /** @param width The stroke width, unit px, negative values are clamped to zero. */
+    explicit StrokeStyle(float width);
+
+    float width() const noexcept { return mWidth; }
+
+    /**
+     * Sets the stroke width, negative values are clamped to zero.
+     * @param w The stroke width, unit px.
+     */
+    void setWidth(float w);
+
+    LineStyle lineStyle() const noexcept { return mLineStyle; }
+
+    void setLineStyle(LineStyle style) { mLineStyle = style; }
+
+    LineJoinStyle lineJoin() const noexcept { return mJoinStyle; }
+
+    void setLineJoin(LineJoinStyle lineJoin) { mJoinStyle = lineJoin; }
+
+    CapStyle startCap() const noexcept { return mStartCap; }
+
+    CapStyle endCap() const noexcept { return mEndCap; }
+
+    CapStyle dashCap() const noexcept { return mDashCap; }
+
+    void setLineCap(CapStyle start, CapStyle end, CapStyle dash);
+
+    void setStartCap(CapStyle start) { mStartCap = start; }
+
+    void setEndCap(CapStyle end) { mEndCap = end; }
+
+    void setDashCap(CapStyle dash) { mDashCap = dash; }
+
+    float miterLimit() const noexcept { return mMiterLimit; }
+
+    /**
+     * Sets the miter limit, values below 1 are ignored.
+     * @param limit The ratio of miter length to half the stroke width.
+     */
+    void setMiterLimit(float limit);
+
+    float dashOffset() const noexcept { return mDashOffset; }
+
+    /**
+     * Sets the offset into the dash sequence, negative values are ignored.
+     * @param dashOffset The offset in multiples of the stroke width.
+     */
+    void setDashOffset(float dashOffset);
+
+    const std::vector<float>& customDash() const noexcept { return mDashes; }
+
+    /**
+     * Sets the custom dash pattern and switches the line style to CustomDash.
+     * @param dashes The alternating dash and gap lengths, in multiples of the stroke width.
+     */
+    void setCustomDash(const std::vector<float>& dashes);
+
+    /**
+     * Checks whether only the width differs from the defaults.
+     * A simple stroke is solid with flat caps and miter joins, which lets backends skip creating any stroke object.
+     */
+    bool isSimple() const noexcept;
+
+    /** Returns a copy with another width, backends whose native strokes do not include the width key on it. */
+    StrokeStyle withWidth(float width) const;
+
+    size_t hash() const noexcept;
+
+    bool operator==(const StrokeStyle& rhs) const noexcept;
+
+private:
+    float mWidth = 1.0f;
+    LineStyle mLineStyle{LineStyle::Solid};
+    CapStyle mStartCap{CapStyle::Flat};
+    CapStyle mEndCap{CapStyle::Flat};
+    CapStyle mDashCap{CapStyle::Flat};
+    LineJoinStyle mJoinStyle{LineJoinStyle::Miter};
+    float mMiterLimit = 10.0f;
+    float mDashOffset = 0.0f;
+    std::vector<float> mDashes;
+};
+
+struct StrokeStyleHash {
+    size_t operator()(const StrokeStyle& style) const noexcept { return style.hash(); }
+};
+
+/** An interned stroke style, equal styles obtained from the same cache are the same object. */
+using StrokeStyleRef = std::shared_ptr<const StrokeStyle>;
+
+/**
+ * @class StrokeStyleCache
+ * @brief Interns stroke styles so that equal styles share one immutable instance.
+ *
+ * Thousands of widgets drawing identical borders hold references to a single style, pens compare by reference and
+ * backends create one native stroke object per distinct style. The cache only holds weak references, a style is
+ * released with the last pen using it and expired entries are dropped as the table grows.
+ *
+ * Interning is thread safe, pens are usually created while inflating layouts off the UI thread.
+ */
+class BIX_PUBLIC StrokeStyleCache {
+public:
+    /** Returns the cache used by all pens of the process. */
+    static StrokeStyleCache& shared();
+
+    /** Returns the interned instance of a style, creating it on a miss. */
+    StrokeStyleRef intern(const StrokeStyle& style);
+
+    /** Returns the number of entries including expired ones not dropped yet. */
+    size_t size() const;
+
+    /** Drops entries whose style is no longer referenced. */
+    void purge();
+
+private:
+    void purgeLocked();
+
+    mutable std::mutex mMutex;
+    std::unordered_multimap<size_t, std::weak_ptr<const StrokeStyle>> mStyles;
+    size_t mPurgeThreshold = 64;
+};
+} // namespace bix
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/graphics/text_format.h>
+#include <bixlib/utils/lru_cache.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bix {
+
+/** Hit and miss counters of a text cache. */
+struct TextCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+};
+
+/**
+ * Identifies a shaped text layout: the text together with every paint property that affects shaping and line
+ * breaking. A backend leaves the properties it does not honor at their default value so that paints differing
+ * only in those share one layout.
+ */
+struct BIX_PUBLIC TextLayoutKey {
+    std::string text;
+    std::string fontFamily;
+    float textSize = 0.f;
+    int fontWeight = 400;
+    FontStyle fontStyle = FontStyle::Normal;
+    WordWrapping wordWrapping = WordWrapping::Wrap;
+    TextTrimming trimming = TextTrimming::None;
+    int maxWidth = 0;
+    int maxHeight = 0;
+
+    size_t hash() const noexcept;
+
+    bool operator==(const TextLayoutKey& rhs) const noexcept;
+};
+
+struct TextLayoutKeyHash {
+    size_t operator()(const TextLayoutKey& key) const noexcept { return key.hash(); }
+};
+
+/**
+ * @class TextLayoutCache
+ * @brief An LRU cache of shaped text layouts shared by all text paints of a backend.
+ *
+ * Interfaces repeat the same short strings over and over (table cells, labels, list items), so text paints look up
+ * their layout here instead of shaping it again whenever a paint is recreated or its text changes back. Layouts are
+ * immutable once cached and handed out as shared pointers, a paint keeps its layout alive even after the cache
+ * evicted it.
+ *
+ * @tparam Layout The backend specific layout result.
+ */
+template <typename Layout>
+class TextLayoutCache {
+public:
+    using LayoutPtr = std::shared_ptr<const Layout>;
+
+    /** The default maximum number of cached layouts. */
+    static constexpr size_t kDefaultCapacity = 4096;
+
+    explicit TextLayoutCache(size_t capacity = kDefaultCapacity) : mLayouts(capacity) {}
+
+    /**
+     * Looks up a layout and marks it as most recently used.
+     * @return The cached layout, or nullptr on a miss.
+     */
+    LayoutPtr find(const TextLayoutKey& key) {
+        if (auto* layout = mLayouts.find(key)) {
+            ++mStats.hits;
+            return *layout;
+        }
+        ++mStats.misses;
+        return nullptr;
+    }
+
+    /** Stores a layout, evicting the least recently used one when the cache is full. */
+    void insert(const TextLayoutKey& key, LayoutPtr layout) {
+        mLayouts.insert(key, std::move(layout));
+        mStats.evictions = mLayouts.evictions();
+    }
+
+    /**
+     * Returns the cached layout for \a key, creating and caching it on a miss.
+     * @param create Called as `LayoutPtr create()` on a miss.
+     */
+    template <typename Factory>
+    LayoutPtr obtain(const TextLayoutKey& key, Factory&& create) {
+        if (auto layout = find(key)) { return layout; }
+        LayoutPtr layout = create();
+        insert(key, layout);
+        return layout;
+    }
+
+    void clear() noexcept { mLayouts.clear(); }
+
+    void setCapacity(size_t capacity) { mLayouts.setCapacity(capacity); }
+
+    size_t size() const noexcept { return mLayouts.size(); }
+
+    size_t capacity() const noexcept { return mLayouts.capacity(); }
+
+    const TextCacheStats& stats() const noexcept { return mStats; }
+
+private:
+    LruCache<TextLayoutKey, LayoutPtr, TextLayoutKeyHash> mLayouts;
+    TextCacheStats mStats;
+};
+
+/**
+ * @class GlyphAtlas
+ * @brief Rasterized glyph coverage masks packed into a few fixed size 8-bit pages.
+ *
+ * Glyphs are packed into shelves, rows of the height of the first glyph placed in them, with a one pixel gutter
+ * so that filtered sampling never bleeds into a neighbor. When every page is full the least recently used page is
+ * emptied and its glyphs are rasterized again on their next use, which keeps eviction cheap and the page
+ * contents compact. GPU backends upload a page whenever its version() changed.
+ */
+class BIX_PUBLIC GlyphAtlas {
+public:
+    static constexpr int kDefaultPageSize = 512;
+    static constexpr int kDefaultMaxPages = 4;
+
+    /** Style bits of a GlyphKey. */
+    enum StyleBits : uint8_t {
+        Bold = 1 << 0,
+        Italic = 1 << 1,
+    };
+
+    /**
+     * Identifies one rasterized glyph.
+     * Sizes are in 1/64 device pixels so that equal sizes hash equal regardless of how they were computed.
+     */
+    struct Key {
+        uint32_t glyph = 0; ///< Code point or backend glyph index.
+        uint32_t face = 0;  ///< Backend defined font face id.
+        uint32_t sizeX = 0;
+        uint32_t sizeY = 0;
+        uint8_t style = 0;
+
+        bool operator==(const Key& rhs) const noexcept = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    /** Location of a cached glyph mask inside a page. */
+    struct Entry {
+        int page = 0;
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    /** Converts a size in device pixels to the fixed point unit of Key. */
+    static uint32_t quantize(float px) noexcept;
+
+    /** Converts a quantized size back to device pixels. */
+    static float dequantize(uint32_t size) noexcept { return static_cast<float>(size) / 64.f; }
+
+    explicit GlyphAtlas(int pageSize = kDefaultPageSize, int maxPages = kDefaultMaxPages);
+
+    /**
+     * Looks up a glyph and marks its page as recently used.
+     * @return The entry, or nullptr if the glyph is not cached.
+     */
+    const Entry* find(const Key& key);
+
+    /**
+     * Copies a coverage mask into the atlas.
+     * @param key The glyph identity.
+     * @param width Mask width in pixels.
+     * @param height Mask height in pixels.
+     * @param coverage Tightly packed rows of the mask.
+     * @return The new entry, or nullptr if the mask is larger than a page.
+     * @note Entries returned earlier may be invalidated because inserting can evict a page.
+     */
+    const Entry* insert(const Key& key, int width, int height, const uint8_t* coverage);
+
+    /** Returns row \a y of a cached glyph mask. */
+    const uint8_t* row(const Entry& entry, int y) const noexcept {
+        const auto& page = mPages[static_cast<size_t>(entry.page)];
+        return page.pixels.data() + static_cast<size_t>(entry.y + y) * static_cast<size_t>(mPageSize)
+               + static_cast<size_t>(entry.x);
+    }
+
+    /** Drops all glyphs and pages. */
+    void clear();
+
+    int pageSize() const noexcept { return mPageSize; }
+
+    int pageCount() const noexcept { return static_cast<int>(mPages.size()); }
+
+    /** Returns the pixels of a page, pageSize() bytes per row. */
+    const uint8_t* pageData(int page) const noexcept { return mPages[static_cast<size_t>(page)].pixels.data(); }
+
+    /** Returns a counter that changes whenever the content of a page changed. */
+    uint64_t pageVersion(int page) const noexcept { return mPages[static_cast<size_t>(page)].version; }
+
+    size_t size() const noexcept { return mEntries.size(); }
+
+    const TextCacheStats& stats() const noexcept { return mStats; }
+
+private:
+    struct Shelf {
+        int y = 0;
+        int height = 0;
+        int x = 0;
+    };
+
+    struct Page {
+        std::vector<uint8_t> pixels;
+        std::vector<Shelf> shelves;
+        int shelfBottom = 0;
+        uint64_t lastUse = 0;
+        uint64_t version = 0;
+    };
+
+    bool allocate(Page& page, int width, int height, int& x, int& y) const;
+    void resetPage(int index);
+
+    int mPageSize;
+    int mMaxPages;
+    uint64_t mTick = 0;
+    std::vector<Page> mPages;
+    std::unordered_map<Key, Entry, KeyHash> mEntries;
+    TextCacheStats mStats;
+};
+} // namespace bix
@@ -54,6 +54,13 @@ public:
     Transform& shear(float sh, float sv);
     void reset();
 
+    /**
+     * Combines two transforms.
+     * @param rhs The transform applied after this one.
+     * @return A transform that maps points through this transform first and then through \a rhs.
+     */
+    Transform operator*(const Transform& rhs) const;
+
     const float* data() const;
 
 private:
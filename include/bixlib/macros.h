@@ -36,6 +36,8 @@
     ClassName(ClassName&&) = delete;                 \
     ClassName& operator=(ClassName&&) = delete;
 
+// The deleted copy constructor suppresses the implicit default constructor, implementations still need one.
 #define BIX_INTERFACE(ClassName)         \
+    ClassName() = default;               \
     virtual ~ClassName();                \
-    BIX_DISABLE_COPY_AND_MOVE(ClassName)
\ No newline at end of file
+    BIX_DISABLE_COPY_AND_MOVE(ClassName)
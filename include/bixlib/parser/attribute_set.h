@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/export_macro.h>
+#include <bixlib/parser/compiled_layout.h>
+#include <bixlib/utils/small_vector.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace bix {
+
+/**
+ * @class AttrId
+ * @brief An attribute name interned as its 32-bit FNV-1a hash.
+ *
+ * String literals are hashed at compile time, so @c attrs.getString("id", out) compares integers only. Names only
+ * known at runtime, e.g. read from a layout, go through fromName().
+ */
+class AttrId {
+public:
+    constexpr AttrId() noexcept = default;
+
+    template <size_t N>
+    consteval AttrId(const char (&name)[N]) noexcept : mValue(hash({name, N - 1})) {}
+
+    static constexpr AttrId fromName(std::string_view name) noexcept { return AttrId(hash(name)); }
+
+    constexpr uint32_t value() const noexcept { return mValue; }
+
+    constexpr bool operator==(const AttrId&) const noexcept = default;
+
+    constexpr auto operator<=>(const AttrId&) const noexcept = default;
+
+private:
+    uint32_t mValue = 0;
+
+    constexpr explicit AttrId(uint32_t value) noexcept : mValue(value) {}
+
+    static constexpr uint32_t hash(std::string_view name) noexcept {
+        uint32_t h = 2166136261u;
+        for (const char c : name) {
+            h ^= static_cast<uint8_t>(c);
+            h *= 16777619u;
+        }
+        return h;
+    }
+};
+
+/** The ids of the attributes known to the built-in widgets. */
+namespace attrs {
+inline constexpr AttrId Id = "id";
+inline constexpr AttrId Width = "width";
+inline constexpr AttrId Height = "height";
+inline constexpr AttrId MinWidth = "minWidth";
+inline constexpr AttrId MinHeight = "minHeight";
+inline constexpr AttrId MaxWidth = "maxWidth";
+inline constexpr AttrId MaxHeight = "maxHeight";
+inline constexpr AttrId Alpha = "alpha";
+inline constexpr AttrId Enable = "enable";
+inline constexpr AttrId Visible = "visible";
+inline constexpr AttrId Lazy = "lazy";
+inline constexpr AttrId Background = "background";
+inline constexpr AttrId Clickable = "clickable";
+inline constexpr AttrId BoundsClip = "boundsClip";
+inline constexpr AttrId Horizontal = "horizontal";
+inline constexpr AttrId Value = "value";
+} // namespace attrs
+
+/**
+ * A typed attribute value, the same types as the values of compiled layouts.
+ */
+struct AttributeValue {
+    std::string_view text{}; ///< The value of String attributes, a view of a buffer shared by many sets.
+    uint32_t bits = 0;       ///< The value of other types, encoded like LayoutAttribute::value.
+    LayoutValueType type = LayoutValueType::String;
+    uint8_t unit = 0; ///< The Length::Unit of Length values.
+
+    static AttributeValue fromLayout(const LayoutAttribute& attr, std::string_view text) noexcept {
+        return {text, attr.value, attr.type, attr.unit};
+    }
+
+    static AttributeValue fromString(std::string_view text) noexcept { return {text, 0, LayoutValueType::String, 0}; }
+
+    static AttributeValue fromLength(Length length) noexcept {
+        return {{}, static_cast<uint32_t>(length.fixedValue()), LayoutValueType::Length, length.unit()};
+    }
+
+    static AttributeValue fromColor(const Color& color) noexcept;
+
+    static AttributeValue fromBool(bool value) noexcept { return {{}, value ? 1u : 0u, LayoutValueType::Bool, 0}; }
+
+    static AttributeValue fromFloat(float value) noexcept;
+
+    template <typename E>
+        requires std::is_enum_v<E>
+    static AttributeValue fromEnum(E value) noexcept {
+        return {{}, static_cast<uint32_t>(value), LayoutValueType::Enum, 0};
+    }
+
+    /** Returns the value as the record of a compiled layout, to reuse its conversions. */
+    LayoutAttribute record() const noexcept { return {0, type, unit, 0, bits}; }
+};
+
+/**
+ * @class AttributeSet
+ * @brief A flat set of typed attributes keyed by interned ids.
+ *
+ * Entries are kept sorted by id in a small vector, lookups are binary searches that never allocate and sets of up
+ * to kInlineCount attributes don't allocate at all. String values are views, the buffer they refer to, e.g. the
+ * string table of a compiled layout or the source of an XML layout, must outlive the set.
+ *
+ * The getters leave the output unchanged and return false when the attribute is missing or has another type, so
+ * that defaults can be written as the initial value of the output.
+ */
+class BIX_PUBLIC AttributeSet {
+public:
+    static constexpr size_t kInlineCount = 8;
+
+    struct Entry {
+        AttrId id;
+        AttributeValue value;
+    };
+
+    /** Adds an attribute or replaces the value of an attribute with the same id. */
+    void set(AttrId id, const AttributeValue& value);
+
+    /** @return True if the attribute was present. */
+    bool remove(AttrId id) noexcept;
+
+    void clear() noexcept { mEntries.clear(); }
+
+    /** @return The value, null if the set doesn't contain the attribute. */
+    const AttributeValue* find(AttrId id) const noexcept;
+
+    bool contains(AttrId id) const noexcept { return find(id) != nullptr; }
+
+    bool getString(AttrId id, std::string& out) const;
+    bool getString(AttrId id, std::string_view& out) const noexcept;
+    bool getLength(AttrId id, Length& out) const noexcept;
+    bool getColor(AttrId id, Color& out) const noexcept;
+    bool getBool(AttrId id, bool& out) const noexcept;
+    bool getFloat(AttrId id, float& out) const noexcept;
+
+    template <typename E>
+        requires std::is_enum_v<E>
+    bool getEnum(AttrId id, E& out) const noexcept {
+        const auto* value = find(id);
+        if (!value || value->type != LayoutValueType::Enum) { return false; }
+        out = static_cast<E>(value->bits);
+        return true;
+    }
+
+    size_t size() const noexcept { return mEntries.size(); }
+
+    bool empty() const noexcept { return mEntries.empty(); }
+
+    /** Iterates the entries in id order, which is unrelated to the order of the names. */
+    const Entry* begin() const noexcept { return mEntries.begin(); }
+
+    const Entry* end() const noexcept { return mEntries.end(); }
+
+private:
+    SmallVector<Entry, kInlineCount> mEntries{};
+
+    const Entry* lowerBound(AttrId id) const noexcept;
+};
+} // namespace bix
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/core/length.h>
+#include <bixlib/export_macro.h>
+#include <bixlib/graphics/color.h>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace bix {
+
+/**
+ * @enum LayoutValueType
+ * The type of an attribute value stored in a compiled layout.
+ */
+enum class LayoutValueType : uint8_t {
+    String, ///< An index into the string table.
+    Length, ///< The fixed-point value of a Length, the unit is stored separately.
+    Color,  ///< An RGBA color packed with red in the lowest byte.
+    Bool,   ///< 0 or 1.
+    Float,  ///< The bits of a 32-bit float.
+    Enum,   ///< The underlying value of an enumeration, e.g. Visibility.
+};
+
+/**
+ * The header at the start of a compiled layout.
+ *
+ * All offsets are in bytes from the start of the data and all integers are little-endian. Every table is 4-byte
+ * aligned, so the records can be read in place from a memory-mapped file.
+ */
+struct LayoutFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t fileSize;
+    uint32_t nodeCount;
+    uint32_t nodeOffset;
+    uint32_t attrCount;
+    uint32_t attrOffset;
+    uint32_t stringCount;
+    uint32_t stringOffset;
+    uint32_t charsOffset;
+    uint32_t charsSize;
+};
+
+/**
+ * An element of a compiled layout.
+ *
+ * Nodes are stored in pre-order: the descendants of a node occupy the index range [index + 1, subtreeEnd).
+ */
+struct LayoutNode {
+    uint32_t type;       ///< The string index of the element name, e.g. "Label".
+    uint32_t parent;     ///< The index of the parent node, CompiledLayout::kNone for the root.
+    uint32_t subtreeEnd; ///< One past the index of the last descendant.
+    uint32_t firstAttr;  ///< The index of the first attribute of the node.
+    uint32_t attrCount;  ///< The number of consecutive attributes of the node.
+};
+
+/**
+ * An attribute of a compiled layout, its value was parsed by the compiler.
+ */
+struct LayoutAttribute {
+    uint32_t name; ///< The string index of the attribute name.
+    LayoutValueType type;
+    uint8_t unit; ///< The Length::Unit of Length values, 0 otherwise.
+    uint16_t reserved;
+    uint32_t value;
+
+    Length toLength() const noexcept {
+        return Length::fromFixed(std::bit_cast<int32_t>(value), static_cast<Length::Unit>(unit));
+    }
+
+    Color toColor() const noexcept {
+        return {static_cast<int>(value & 0xFF), static_cast<int>((value >> 8) & 0xFF),
+                static_cast<int>((value >> 16) & 0xFF), static_cast<int>(value >> 24)};
+    }
+
+    bool toBool() const noexcept { return value != 0; }
+
+    float toFloat() const noexcept { return std::bit_cast<float>(value); }
+
+    template <typename E>
+    E toEnum() const noexcept {
+        return static_cast<E>(value);
+    }
+};
+
+/** An entry of the string table, the characters are not null terminated. */
+struct LayoutString {
+    uint32_t offset; ///< The offset of the first character in the character block.
+    uint32_t length;
+};
+
+/**
+ * @class CompiledLayout
+ * @brief A read-only view of a layout compiled by the bix_layout_compiler tool.
+ *
+ * The binary form replaces the inflation of XML layouts at runtime: values are parsed when the layout is compiled
+ * and names are interned into a sorted string table, so that loading only reads fixed-size records. The data is
+ * validated once on construction, the accessors don't check their arguments afterward.
+ *
+ * A layout either owns its data or refers to memory kept alive by the caller, such as a memory-mapped file.
+ */
+class BIX_PUBLIC CompiledLayout {
+public:
+    using Index = uint32_t;
+
+    static constexpr Index kNone = std::numeric_limits<Index>::max();
+    static constexpr uint32_t kMagic = 0x4C584942; // "BIXL"
+    static constexpr uint16_t kVersion = 1;
+
+    /**
+     * Creates a view of data owned by the caller.
+     * @param data The compiled layout, 4-byte aligned. It must outlive the view.
+     * @throw RuntimeError If the data is not a valid compiled layout of a supported version.
+     */
+    explicit CompiledLayout(std::span<const std::byte> data);
+
+    /**
+     * Creates a layout owning its data.
+     * @throw RuntimeError If the data is not a valid compiled layout of a supported version.
+     */
+    explicit CompiledLayout(std::vector<std::byte> data);
+
+    // The views into an owned buffer stay valid when the buffer is moved, but not when it is copied.
+    CompiledLayout(const CompiledLayout&) = delete;
+    CompiledLayout& operator=(const CompiledLayout&) = delete;
+    CompiledLayout(CompiledLayout&&) noexcept = default;
+    CompiledLayout& operator=(CompiledLayout&&) noexcept = default;
+
+    /**
+     * Reads a compiled layout from a file.
+     * @throw RuntimeError If the file can't be read or is not a valid compiled layout.
+     */
+    static CompiledLayout fromFile(const std::filesystem::path& path);
+
+    uint32_t nodeCount() const noexcept { return mHeader->nodeCount; }
+
+    const LayoutNode& node(Index index) const noexcept { return mNodes[index]; }
+
+    std::span<const LayoutAttribute> attributes(Index node) const noexcept {
+        return {mAttributes + mNodes[node].firstAttr, mNodes[node].attrCount};
+    }
+
+    std::string_view typeName(Index node) const noexcept { return string(mNodes[node].type); }
+
+    uint32_t stringCount() const noexcept { return mHeader->stringCount; }
+
+    std::string_view string(uint32_t index) const noexcept {
+        return {mChars + mStrings[index].offset, mStrings[index].length};
+    }
+
+    /**
+     * Finds an interned string with a binary search of the sorted string table.
+     *
+     * Loaders resolve the names they know once per layout and then compare the name indices of the attributes.
+     * @return The string index, kNone if the layout doesn't contain the string.
+     */
+    uint32_t findString(std::string_view str) const noexcept;
+
+    std::span<const std::byte> data() const noexcept { return mData; }
+
+private:
+    std::vector<std::byte> mOwned{};
+    std::span<const std::byte> mData{};
+    const LayoutFileHeader* mHeader = nullptr;
+    const LayoutNode* mNodes = nullptr;
+    const LayoutAttribute* mAttributes = nullptr;
+    const LayoutString* mStrings = nullptr;
+    const char* mChars = nullptr;
+
+    void validate();
+};
+} // namespace bix
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/export_macro.h>
+#include <bixlib/parser/compiled_layout.h>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace bix {
+
+/**
+ * Parses an attribute value the way the layout compiler does, see LayoutWriter for the known attributes.
+ * @return The typed attribute, the name and the value of String attributes are left to the caller.
+ * @throw RuntimeError If the value is not valid for the type of the attribute.
+ */
+BIX_PUBLIC LayoutAttribute parseLayoutAttribute(std::string_view name, std::string_view value);
+
+/**
+ * @class LayoutWriter
+ * @brief Builds a compiled layout from a stream of elements and attributes.
+ *
+ * The writer is fed by an XML parser in document order and parses every attribute value it knows the type of:
+ * - Lengths: width, height, minWidth, minHeight, maxWidth and maxHeight.
+ * - Colors: color, background and every name ending with "Color".
+ * - Booleans: enable, horizontal, clickable, boundsClip and lazy.
+ * - Floats: alpha.
+ * - Visibility: visible, one of "true", "false" or "gone".
+ *
+ * Other attributes are stored as interned strings.
+ * @code
+ * LayoutWriter writer;
+ * writer.beginElement("LinearLayout");
+ * writer.attribute("width", "stretch");
+ * writer.beginElement("Label");
+ * writer.attribute("value", "Hello");
+ * writer.endElement();
+ * writer.endElement();
+ * CompiledLayout layout(writer.finish());
+ * @endcode
+ */
+class BIX_PUBLIC LayoutWriter {
+public:
+    /**
+     * Opens an element as the last child of the current element.
+     * @throw LogicError If a root element was already closed, a layout has a single root.
+     */
+    void beginElement(std::string_view type);
+
+    /**
+     * Adds an attribute to the current element, before any of its children.
+     * @throw LogicError If there is no open element or it already has children.
+     * @throw RuntimeError If the value is not valid for the type of the attribute.
+     */
+    void attribute(std::string_view name, std::string_view value);
+
+    /**
+     * Closes the current element.
+     * @throw LogicError If there is no open element.
+     */
+    void endElement();
+
+    /**
+     * Serializes the layout and resets the writer.
+     * @throw LogicError If the layout is empty or an element is still open.
+     */
+    std::vector<std::byte> finish();
+
+private:
+    std::vector<LayoutNode> mNodes{};
+    std::vector<LayoutAttribute> mAttributes{};
+    std::vector<CompiledLayout::Index> mOpen{};
+    std::vector<std::string> mStrings{};
+    std::unordered_map<std::string, uint32_t> mStringIds{};
+
+    uint32_t intern(std::string_view str);
+};
+} // namespace bix
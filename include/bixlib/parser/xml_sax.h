@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/export_macro.h>
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bix {
+
+struct XmlAttribute {
+    std::string_view name;
+    std::string_view value; ///< The value with entities and character references replaced.
+};
+
+/**
+ * @class XmlHandler
+ * @brief Receives the events of an XmlSaxParser in document order.
+ *
+ * The views passed to the handler are only valid during the call.
+ */
+class BIX_PUBLIC XmlHandler {
+public:
+    virtual ~XmlHandler() = default;
+
+    /**
+     * Called for the start tag of an element.
+     * @return False to skip the content of the element, its children are scanned but not reported.
+     */
+    virtual bool startElement(std::string_view name, std::span<const XmlAttribute> attributes) = 0;
+
+    /**
+     * Called for the end tag of an element, right after startElement() for empty element tags.
+     * @param name The element name.
+     * @param source The source text of the whole element, from the start tag to the end tag.
+     */
+    virtual void endElement(std::string_view name, std::string_view source) = 0;
+
+    /** Called for text and CDATA sections inside the root element, including whitespace. */
+    virtual void characters(std::string_view text) { BIX_UNUSED(text) }
+};
+
+/**
+ * @class XmlSaxParser
+ * @brief A streaming, non-validating XML parser.
+ *
+ * The parser reports elements while it scans the document instead of building a tree, so memory use only depends
+ * on the nesting depth. Comments, processing instructions and a DOCTYPE without internal subset are skipped.
+ * Attribute values without references are passed as views of the source, the parser doesn't allocate per element
+ * once its buffers have grown to the largest element.
+ */
+class BIX_PUBLIC XmlSaxParser {
+public:
+    /**
+     * @param source The document, it must outlive the parser.
+     */
+    explicit XmlSaxParser(std::string_view source) noexcept : mSource(source) {}
+
+    /**
+     * Parses the whole document.
+     * @throw RuntimeError If the document is not well-formed, with the line of the error in the message.
+     */
+    void parse(XmlHandler& handler);
+
+private:
+    struct OpenElement {
+        std::string_view name;
+        size_t start;
+    };
+
+    struct RawAttribute {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    std::string_view mSource;
+    size_t mPos = 0;
+    std::vector<OpenElement> mOpen{};
+    std::vector<RawAttribute> mRawAttributes{};
+    std::vector<XmlAttribute> mAttributes{};
+    std::string mValues{};
+    std::string mText{};
+
+    [[noreturn]] void fail(const char* what) const;
+
+    bool consume(std::string_view token) noexcept;
+    void skipWhitespace() noexcept;
+    void skipPast(std::string_view terminator);
+    std::string_view readName();
+    void decode(std::string_view raw, std::string& out) const;
+    void decodeAttributes();
+    void parseText(XmlHandler& handler, bool report);
+};
+} // namespace bix
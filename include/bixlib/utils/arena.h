@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/export_macro.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace bix {
+
+/**
+ * A monotonic arena handing out memory from large blocks.
+ *
+ * Allocation bumps a pointer inside the current block and only falls back to the heap when the block is
+ * exhausted, block sizes double up to a limit. Individual deallocations release nothing, they only track the
+ * number of live objects. Once that number drops to zero, reset() hands all blocks but the first back to the heap
+ * in one go and the first block is reused.
+ *
+ * @note Not thread-safe. Objects constructed in the arena must be destroyed before the arena.
+ */
+class BIX_PUBLIC MonotonicArena {
+public:
+    static constexpr size_t kDefaultBlockSize = 16 * 1024;
+    static constexpr size_t kMaxBlockSize = 1024 * 1024;
+
+    /** @param blockSize The size of the first block, later blocks grow geometrically. */
+    explicit MonotonicArena(size_t blockSize = kDefaultBlockSize) noexcept;
+    ~MonotonicArena();
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /**
+     * Allocates uninitialized memory.
+     * @param size The size in bytes.
+     * @param alignment The alignment, a power of two.
+     * @throws std::bad_alloc If the heap is exhausted.
+     */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * Marks memory from allocate() as unused. The memory is reclaimed by the next reset() only.
+     */
+    void deallocate(void* p) noexcept;
+
+    /**
+     * Constructs an object in the arena.
+     * @note The object must be destroyed with destroy(), or by calling its destructor followed by deallocate().
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        void* p = allocate(sizeof(T), alignof(T));
+        try {
+            return ::new (p) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(p);
+            throw;
+        }
+    }
+
+    template <typename T>
+    void destroy(T* object) noexcept {
+        if (!object) { return; }
+        object->~T();
+        deallocate(object);
+    }
+
+    /**
+     * Releases all blocks except the first one and rewinds the arena.
+     * @note Must only be called when no object allocated from the arena is alive anymore.
+     */
+    void reset() noexcept;
+
+    /** Returns the number of allocations not deallocated yet. */
+    size_t liveCount() const noexcept { return mLive; }
+
+    /** Returns the number of bytes handed out since the last reset(), including alignment padding. */
+    size_t bytesUsed() const noexcept { return mUsed; }
+
+    /** Returns the number of blocks currently held. */
+    size_t blockCount() const noexcept { return mBlockCount; }
+
+private:
+    struct Block {
+        Block* next;
+        size_t size; // usable bytes following the header
+    };
+
+    void addBlock(size_t minSize);
+    static void freeBlocks(Block* block) noexcept;
+
+    Block* mHead = nullptr; // the current block, older blocks follow through next
+    std::byte* mCursor = nullptr;
+    std::byte* mEnd = nullptr;
+    size_t mNextBlockSize;
+    size_t mBlockCount = 0;
+    size_t mUsed = 0;
+    size_t mLive = 0;
+};
+
+/**
+ * A standard allocator drawing from a MonotonicArena, or from the heap when it has none.
+ *
+ * Lets containers owned by arena constructed objects keep their storage in the same arena, so building a tree in
+ * the arena does not touch the heap. Memory released by a container is only reclaimed by the next reset().
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    constexpr ArenaAllocator() noexcept = default;
+
+    constexpr explicit ArenaAllocator(MonotonicArena* arena) noexcept : mArena(arena) {}
+
+    template <typename U>
+    constexpr ArenaAllocator(const ArenaAllocator<U>& other) noexcept // NOLINT(*-explicit-constructor)
+        : mArena(other.arena()) {}
+
+    T* allocate(size_t n) {
+        if (mArena) { return static_cast<T*>(mArena->allocate(n * sizeof(T), alignof(T))); }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (mArena) {
+            mArena->deallocate(p);
+            return;
+        }
+        ::operator delete(p, n * sizeof(T), std::align_val_t{alignof(T)});
+    }
+
+    MonotonicArena* arena() const noexcept { return mArena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return mArena == other.arena();
+    }
+
+private:
+    MonotonicArena* mArena = nullptr;
+};
+} // namespace bix
@@ -66,8 +66,8 @@ namespace traits {
 template <typename T>
 struct IsUniquePtr : std::false_type {};
 
-template <typename T>
-struct IsUniquePtr<std::unique_ptr<T>> : std::true_type {};
+template <typename T, typename D>
+struct IsUniquePtr<std::unique_ptr<T, D>> : std::true_type {};
 
 template <typename T>
 concept UniquePtrType = IsUniquePtr<std::remove_cvref_t<T>>::value;
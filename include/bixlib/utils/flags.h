@@ -291,13 +291,13 @@ public:
      */
     constexpr void clear() noexcept { mValue = ZERO; }
 
-    constexpr Flags operator&(Flags flags) const noexcept { return Flags(mValue & flags.mValue); }
+    constexpr Flags operator&(Flags flags) const noexcept { return Flags(ValueType(mValue & flags.mValue)); }
 
-    constexpr Flags operator|(Flags flags) const noexcept { return Flags(mValue | flags.mValue); }
+    constexpr Flags operator|(Flags flags) const noexcept { return Flags(ValueType(mValue | flags.mValue)); }
 
-    constexpr Flags operator~() const noexcept { return Flags(~mValue); }
+    constexpr Flags operator~() const noexcept { return Flags(ValueType(~mValue)); }
 
-    constexpr Flags operator^(Flags flags) const noexcept { return Flags(mValue ^ flags.mValue); }
+    constexpr Flags operator^(Flags flags) const noexcept { return Flags(ValueType(mValue ^ flags.mValue)); }
 
     constexpr Flags& operator&=(Flags flags) noexcept {
         mValue &= flags.mValue;
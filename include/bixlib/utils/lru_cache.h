@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace bix {
+
+/**
+ * A bounded key-value map evicting the least recently used entry.
+ *
+ * Lookups and insertions run in constant time on average. Every successful find() or insert() marks the entry as
+ * most recently used, and inserting beyond the capacity drops the entry that was used the longest time ago.
+ *
+ * @tparam Key The key type, must be copy constructible.
+ * @tparam Value The mapped type.
+ * @tparam Hash The hash function object for \a Key.
+ * @tparam KeyEqual The equality function object for \a Key.
+ *
+ * @note Pointers returned by find() and insert() stay valid until the entry is evicted or erased.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class LruCache {
+public:
+    /** @param capacity The maximum number of entries, zero is treated as one. */
+    explicit LruCache(size_t capacity) : mCapacity(capacity > 0 ? capacity : 1) {}
+
+    /**
+     * Looks up an entry and marks it as most recently used.
+     * @return The mapped value, or nullptr if the key is not cached.
+     */
+    Value* find(const Key& key) {
+        auto it = mIndex.find(key);
+        if (it == mIndex.end()) { return nullptr; }
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        return &it->second->second;
+    }
+
+    /** Returns whether the key is cached without changing the usage order. */
+    bool contains(const Key& key) const { return mIndex.find(key) != mIndex.end(); }
+
+    /**
+     * Inserts or replaces an entry and marks it as most recently used.
+     * The least recently used entry is evicted when the cache is full.
+     * @return The stored value.
+     */
+    Value& insert(const Key& key, Value value) {
+        if (auto it = mIndex.find(key); it != mIndex.end()) {
+            it->second->second = std::move(value);
+            mEntries.splice(mEntries.begin(), mEntries, it->second);
+            return it->second->second;
+        }
+        if (mEntries.size() >= mCapacity) { evictOne(); }
+        mEntries.emplace_front(key, std::move(value));
+        mIndex.emplace(key, mEntries.begin());
+        return mEntries.front().second;
+    }
+
+    /** Removes an entry, returns false if the key was not cached. */
+    bool erase(const Key& key) {
+        auto it = mIndex.find(key);
+        if (it == mIndex.end()) { return false; }
+        mEntries.erase(it->second);
+        mIndex.erase(it);
+        return true;
+    }
+
+    /** Returns the least recently used value without changing the usage order, or nullptr if the cache is empty. */
+    const Value* leastRecent() const noexcept { return mEntries.empty() ? nullptr : &mEntries.back().second; }
+
+    /**
+     * Evicts the least recently used entry, for owners that bound the cache by another measure than the entry count.
+     * @return False if the cache is empty.
+     */
+    bool evictLeastRecent() {
+        if (mEntries.empty()) { return false; }
+        evictOne();
+        return true;
+    }
+
+    void clear() noexcept {
+        mIndex.clear();
+        mEntries.clear();
+    }
+
+    /** Changes the capacity, evicting the least recently used entries that no longer fit. */
+    void setCapacity(size_t capacity) {
+        mCapacity = capacity > 0 ? capacity : 1;
+        while (mEntries.size() > mCapacity) { evictOne(); }
+    }
+
+    size_t size() const noexcept { return mEntries.size(); }
+
+    size_t capacity() const noexcept { return mCapacity; }
+
+    bool isEmpty() const noexcept { return mEntries.empty(); }
+
+    /** Returns the number of entries dropped because the cache was full. */
+    size_t evictions() const noexcept { return mEvictions; }
+
+private:
+    using Entry = std::pair<Key, Value>;
+    using EntryList = std::list<Entry>;
+
+    void evictOne() {
+        mIndex.erase(mEntries.back().first);
+        mEntries.pop_back();
+        ++mEvictions;
+    }
+
+    size_t mCapacity;
+    size_t mEvictions = 0;
+    EntryList mEntries;
+    std::unordered_map<Key, typename EntryList::iterator, Hash, KeyEqual> mIndex;
+};
+} // namespace bix
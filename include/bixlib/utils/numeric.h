@@ -23,7 +23,12 @@
 
 #include <bixlib/utils/concepts.h>
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <sstream>
+#include <typeinfo>
+#include <utility>
 
 /**
  * Fundamental mathematical utilities for the bixlib.
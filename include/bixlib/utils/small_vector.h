@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace bix {
+
+/**
+ * A vector of trivially copyable elements storing up to N elements inline.
+ *
+ * Short vectors don't allocate, longer ones move to the heap and stay there, clear() keeps the capacity. Elements
+ * are moved with memcpy, so only trivially copyable types are allowed.
+ */
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable_v<T>, "SmallVector only supports trivially copyable types");
+    static_assert(N > 0, "SmallVector needs inline storage");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() noexcept = default;
+
+    ~SmallVector() { release(); }
+
+    SmallVector(const SmallVector& other) { assign(other); }
+
+    SmallVector(SmallVector&& other) noexcept { take(other); }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            mSize = 0;
+            assign(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this != &other) {
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    size_t size() const noexcept { return mSize; }
+
+    size_t capacity() const noexcept { return mCapacity; }
+
+    bool empty() const noexcept { return mSize == 0; }
+
+    /** Returns true while the elements are stored inline. */
+    bool isInline() const noexcept { return mData == inlineData(); }
+
+    T* data() noexcept { return mData; }
+
+    const T* data() const noexcept { return mData; }
+
+    iterator begin() noexcept { return mData; }
+
+    iterator end() noexcept { return mData + mSize; }
+
+    const_iterator begin() const noexcept { return mData; }
+
+    const_iterator end() const noexcept { return mData + mSize; }
+
+    T& operator[](size_t index) noexcept { return mData[index]; }
+
+    const T& operator[](size_t index) const noexcept { return mData[index]; }
+
+    void clear() noexcept { mSize = 0; }
+
+    void reserve(size_t capacity) {
+        if (capacity <= mCapacity) { return; }
+        T* data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+        if (mSize) { std::memcpy(data, mData, mSize * sizeof(T)); }
+        if (!isInline()) { ::operator delete(mData); }
+        mData = data;
+        mCapacity = capacity;
+    }
+
+    void push_back(const T& value) {
+        if (mSize == mCapacity) {
+            const T copy = value; // the value may live in the current storage
+            grow();
+            mData[mSize++] = copy;
+            return;
+        }
+        mData[mSize++] = value;
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        const auto index = static_cast<size_t>(pos - mData);
+        const T copy = value;
+        if (mSize == mCapacity) { grow(); }
+        std::memmove(mData + index + 1, mData + index, (mSize - index) * sizeof(T));
+        mData[index] = copy;
+        ++mSize;
+        return mData + index;
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        const auto index = static_cast<size_t>(pos - mData);
+        std::memmove(mData + index, mData + index + 1, (mSize - index - 1) * sizeof(T));
+        --mSize;
+        return mData + index;
+    }
+
+private:
+    alignas(T) std::byte mInline[N * sizeof(T)];
+    T* mData = inlineData();
+    size_t mSize = 0;
+    size_t mCapacity = N;
+
+    T* inlineData() noexcept { return reinterpret_cast<T*>(mInline); }
+
+    const T* inlineData() const noexcept { return reinterpret_cast<const T*>(mInline); }
+
+    void grow() { reserve(mCapacity * 2); }
+
+    void release() noexcept {
+        if (!isInline()) { ::operator delete(mData); }
+        mData = inlineData();
+        mCapacity = N;
+        mSize = 0;
+    }
+
+    void assign(const SmallVector& other) {
+        reserve(other.mSize);
+        if (other.mSize) { std::memcpy(mData, other.mData, other.mSize * sizeof(T)); }
+        mSize = other.mSize;
+    }
+
+    void take(SmallVector& other) noexcept {
+        if (other.isInline()) {
+            if (other.mSize) { std::memcpy(mInline, other.mInline, other.mSize * sizeof(T)); }
+            mSize = other.mSize;
+        } else {
+            mData = other.mData;
+            mSize = other.mSize;
+            mCapacity = other.mCapacity;
+            other.mData = other.inlineData();
+            other.mCapacity = N;
+        }
+        other.mSize = 0;
+    }
+};
+} // namespace bix
@@ -16,6 +16,7 @@
 
 #pragma once
 #include <bixlib/assert.h>
+#include <bixlib/utils/arena.h>
 #include <bixlib/widgets/widget.h>
 #include <bixlib/widgets/widget_macros.h>
 
@@ -23,36 +24,52 @@
 
 namespace bix {
 
+template <DerivedFrom<Widget> T, typename... Args>
+std::unique_ptr<T, WidgetDeleter> makeWidget(MonotonicArena* arena, Args&&... args);
+
 class BIX_PUBLIC Container : public Widget, public ViewParent {
 
 public:
     BIX_WIDGET_DECLARE(Container)
 
-    using ChildList = std::vector<WidgetPtr>;
+    using ChildList = std::vector<WidgetPtr, ArenaAllocator<WidgetPtr>>;
     using ChildIterator = ChildList::iterator;
 
     bool isContainer() const noexcept override { return true; }
 
     Widget* addChild(WidgetPtr child, int index = -1) { return addChildImpl(std::move(child), index); }
 
-    template <DerivedFrom<Widget> T>
-    T* addChild(std::unique_ptr<T> child, int index = -1) {
+    template <DerivedFrom<Widget> T, typename D>
+    T* addChild(std::unique_ptr<T, D> child, int index = -1) {
         T* ptr = child.get();
-        addChildImpl(std::move(child), index);
+        addChildImpl(WidgetPtr(std::move(child)), index);
         return ptr;
     }
 
+    /**
+     * Constructs a child in place, in the arena of the container if it has one.
+     */
     template <DerivedFrom<Widget> T, typename... Args>
     requires(!traits::UniquePtrType<traits::FirstArgT<Args...>>)
     T* addChild(Args&&... args) {
-        return addChild(std::make_unique<T>(std::forward<Args>(args)...));
+        return addChild(makeWidget<T>(mArena, std::forward<Args>(args)...));
     }
 
     template <DerivedFrom<Widget> T, typename... Args>
     T* insertChild(int index, Args&&... args) {
-        return addChild(std::make_unique<T>(std::forward<Args>(args)...), index);
+        return addChild(makeWidget<T>(mArena, std::forward<Args>(args)...), index);
     }
 
+    /**
+     * Makes children added through addChild<T>(args...) be constructed in an arena.
+     * @param arena The arena, it must outlive all widgets constructed in it. Null allocates from the heap.
+     * @note Container children constructed that way inherit the arena, so a whole subtree shares it. The child list
+     * is kept in the arena as well, it only switches arenas while it is empty.
+     */
+    void setArena(MonotonicArena* arena) noexcept;
+
+    MonotonicArena* arena() const noexcept { return mArena; }
+
     template <typename T = Widget>
     [[nodiscard]] T* findById(std::string_view id) const {
         Widget* raw = findByIdImpl(id);
@@ -74,22 +91,42 @@ public:
 
     Widget* childAt(int index) const;
 
+    void requestLayoutFromChild(Widget* child) override;
+    void invalidateChild(Widget* child, const Rect& rect) override;
+    void invalidateWindowRect(const Rect& rect) override;
+    Transform childTransform() const noexcept override;
+
     // bool dispatchMouseEvent(const MouseEvent& event) override;
     // bool dispatchMouseMoveEvent(const MouseEvent& event) override;
 
 protected:
     ChildList mChildren;
+    MonotonicArena* mArena = nullptr;
 
     Widget* addChildImpl(WidgetPtr child, int index);
-    WidgetPtr removeChildImpl(std::vector<WidgetPtr>::iterator it);
+    WidgetPtr removeChildImpl(ChildIterator it);
     Widget* findByIdImpl(std::string_view id) const;
 
     bool isValidIndex(int index) const noexcept { return index >= 0 && index < static_cast<int>(mChildren.size()); }
 
+    void dispatchPaint(Canvas& canvas, const DamageRegion* damage) override;
+
     // void onLayout(const UIRect& pos) override;
     // void onMeasure(Canvas& canvas, const UISize& available, const UISize& max) override;
     // void dispatchDraw(Canvas& renderer) override;
     // void dispatchRemoved(Widget* removed);
 };
 
+/**
+ * Constructs a widget on the heap or in an arena.
+ * @param arena The arena to construct the widget in, null for the heap.
+ * @return The widget owned by a pointer that releases it to where it was allocated from. Containers inherit the
+ * arena, see Container::setArena().
+ */
+template <DerivedFrom<Widget> T, typename... Args>
+std::unique_ptr<T, WidgetDeleter> makeWidget(MonotonicArena* arena, Args&&... args) {
+    T* widget = arena ? arena->create<T>(std::forward<Args>(args)...) : new T(std::forward<Args>(args)...);
+    if constexpr (std::derived_from<T, Container>) { widget->setArena(arena); }
+    return std::unique_ptr<T, WidgetDeleter>(widget, WidgetDeleter(arena));
+}
 } // namespace bix
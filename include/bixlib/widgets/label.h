@@ -15,6 +15,8 @@
  */
 
 #pragma once
+#include "bixlib/graphics/colors.h"
+#include "bixlib/graphics/pen.h"
 #include "widget.h"
 
 namespace bix {
@@ -28,6 +30,8 @@ public:
 
     void setTextLines(int maxLines);
 
+    void applyAttributes(const AttributeSet& attributes) override;
+
 protected:
     void onLayout(const UIRect& rect) override;
 
@@ -36,9 +40,8 @@ public:
     void discardCanvas() override;
 
 protected:
-    PenPtr mTextPen = nullptr;
+    Pen mTextPen{colors::Black}; // a value, it holds the text color and survives discardCanvas()
     TextPaintPtr mTextPaint = nullptr;
-    Color mTextColor = colors::Black;
 
     UIRect mTextBox{0, 0, 0, 0}; // text layout bounds box
     std::string mText{};
@@ -49,6 +52,6 @@ protected:
 
     void setupTextPaint(Canvas& canvas);
 
-    void onMeasure(Canvas& canvas, const UISize& available, const UISize& max) override;
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override;
 };
 } // namespace bix
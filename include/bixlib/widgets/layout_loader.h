@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/parser/compiled_layout.h>
+#include <bixlib/widgets/container.h>
+
+#include <map>
+#include <string>
+
+namespace bix {
+
+/**
+ * @class LayoutLoader
+ * @brief Builds widget trees from compiled or XML layouts.
+ *
+ * Element names are mapped to widget factories and the attributes of each element are passed to
+ * Widget::applyAttributes() as an AttributeSet. The values of compiled layouts were parsed by the layout compiler,
+ * so no string is parsed while loading and attribute names are hashed once per layout.
+ * @code
+ * LayoutLoader loader;
+ * loader.registerType<MyWidget>("MyWidget");
+ * auto layout = CompiledLayout::fromFile("main.bxl");
+ * scene.setRoot(loader.inflate(layout, &scene.arena()));
+ * @endcode
+ */
+class BIX_PUBLIC LayoutLoader {
+public:
+    using Factory = WidgetPtr (*)(MonotonicArena* arena);
+
+    /** Creates a loader knowing the built-in widgets. */
+    LayoutLoader();
+
+    void registerType(std::string name, Factory factory);
+
+    template <typename T>
+        requires std::derived_from<T, Widget>
+    void registerType(std::string name) {
+        registerType(std::move(name), [](MonotonicArena* arena) -> WidgetPtr { return makeWidget<T>(arena); });
+    }
+
+    /**
+     * Creates the widget tree of a layout.
+     * @param layout The compiled layout.
+     * @param arena The arena the widgets are constructed in, null to allocate them on the heap.
+     * @return The root widget.
+     * @throw RuntimeError If an element has no registered type, or a widget that is not a container has children.
+     */
+    WidgetPtr inflate(const CompiledLayout& layout, MonotonicArena* arena = nullptr) const;
+
+    /**
+     * Creates the widget tree of an XML layout while streaming the document, without building a DOM first.
+     *
+     * Elements other than the root marked with lazy="true" and visible="gone" are replaced by a ViewStub, their
+     * subtree is only scanned and is created the first time the stub becomes visible. The loader must outlive the
+     * stubs.
+     * @param xml The layout document.
+     * @param arena The arena the widgets are constructed in, null to allocate them on the heap.
+     * @return The root widget.
+     * @throw RuntimeError If the document is malformed, an element has no registered type, an attribute value is
+     * invalid, or a widget that is not a container has children.
+     */
+    WidgetPtr inflateXml(std::string_view xml, MonotonicArena* arena = nullptr) const;
+
+private:
+    class XmlInflater;
+
+    std::map<std::string, Factory, std::less<>> mFactories{};
+
+    Factory factory(std::string_view name) const;
+};
+} // namespace bix
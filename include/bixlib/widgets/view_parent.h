@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <bixlib/graphics/transform.h>
 
 namespace bix {
 
@@ -26,5 +27,9 @@ public:
 
     virtual void requestLayoutFromChild(Widget* child) = 0;
     virtual void invalidateChild(Widget* child, const Rect& rect) = 0;
+    /** Reports a dirty rect given in window coordinates, e.g. the old and new bounds of a moved widget. */
+    virtual void invalidateWindowRect(const Rect& rect) = 0;
+    /** Returns the transform from the coordinates children are laid out in to window coordinates. */
+    virtual Transform childTransform() const noexcept = 0;
 };
 } // namespace bix
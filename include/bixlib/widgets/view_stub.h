@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <bixlib/widgets/widget.h>
+#include <bixlib/widgets/widget_macros.h>
+
+#include <string>
+
+namespace bix {
+
+class LayoutLoader;
+
+/**
+ * @class ViewStub
+ * @brief A placeholder for a collapsed subtree of an XML layout that is inflated on demand.
+ *
+ * LayoutLoader::inflateXml() creates a stub for every element marked with lazy="true" and visible="gone" instead
+ * of its subtree. The stub keeps the id of the element and only the source text of the subtree. The first time it
+ * is made visible or invisible, or when inflate() is called, the subtree is created and replaces the stub in its
+ * parent with the visibility of the stub.
+ * @warning Inflating destroys the stub, use the returned widget or look the id up again afterward.
+ */
+class BIX_PUBLIC ViewStub : public LeafWidget {
+public:
+    BIX_WIDGET_DECLARE(ViewStub)
+
+    /**
+     * @param loader The loader creating the subtree, it must outlive the stub.
+     * @param source The XML source of the deferred element.
+     */
+    ViewStub(const LayoutLoader& loader, std::string source);
+
+    /**
+     * Creates the subtree and replaces the stub with it.
+     * @return The root of the inflated subtree.
+     * @throw LogicError If the stub is not a child of a container.
+     */
+    Widget* inflate();
+
+protected:
+    void onPaint(Canvas& canvas) override { BIX_UNUSED(canvas) }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override;
+
+    void onVisibilityChanged(Visibility visibility) override;
+
+private:
+    const LayoutLoader* mLoader;
+    std::string mSource;
+};
+} // namespace bix
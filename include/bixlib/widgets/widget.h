@@ -19,7 +19,10 @@
 #include <bixlib/controls/border.h>
 #include <bixlib/controls/drawable.h>
 #include <bixlib/core/insets.h>
+#include <bixlib/core/layout_types.h>
 #include <bixlib/core/window_events.h>
+#include <bixlib/graphics/damage_region.h>
+#include <bixlib/graphics/display_list.h>
 #include <bixlib/parser/attribute_set.h>
 #include <bixlib/utils/flags.h>
 #include <bixlib/widgets/view_parent.h>
@@ -62,6 +65,26 @@ enum class gravity {
 };
 
 class Widget;
+class MonotonicArena;
+
+/**
+ * Deletes widgets either from the heap or from the arena they were constructed in.
+ *
+ * Converts implicitly from std::default_delete, so a std::unique_ptr created by std::make_unique still converts
+ * into a WidgetPtr.
+ */
+struct BIX_PUBLIC WidgetDeleter {
+    MonotonicArena* arena = nullptr; ///< The arena owning the memory, null for heap allocated widgets.
+
+    constexpr WidgetDeleter() noexcept = default;
+
+    constexpr explicit WidgetDeleter(MonotonicArena* owner) noexcept : arena(owner) {}
+
+    template <typename T>
+    constexpr WidgetDeleter(const std::default_delete<T>&) noexcept {} // NOLINT(*-explicit-constructor)
+
+    void operator()(Widget* widget) const noexcept;
+};
 
 /**
  * A type alias for a unique pointer to a Widget.
@@ -69,7 +92,7 @@ class Widget;
  * This represents unique ownership of a Widget instance. Use this when
  * passing widgets into containers or transferring ownership between objects.
  */
-using WidgetPtr = std::unique_ptr<Widget>;
+using WidgetPtr = std::unique_ptr<Widget, WidgetDeleter>;
 
 using ClickCallback = std::function<void(Widget& target)>;
 
@@ -99,8 +122,14 @@ public:
     void show();
 
     void hide();
-    void layout(const UIRect& pos);
-    void paint(Canvas& canvas);
+    void layout(const Rect& pos);
+    /**
+     * Paints the widget and its children.
+     * @param canvas The target canvas.
+     * @param damage The dirty area in window coordinates, subtrees outside of it are skipped.
+     * A null pointer repaints everything.
+     */
+    void paint(Canvas& canvas, const DamageRegion* damage = nullptr);
     void requestLayout();
 
     Length width() const noexcept { return mWidth; }
@@ -132,16 +161,30 @@ public:
     bool isEnabled() const noexcept;
     bool isHovered() const noexcept;
     bool isClickable() const noexcept;
-    const UIRect& position() const noexcept;
+    const Rect& position() const noexcept;
 
     Border* border() const noexcept;
 
+    /**
+     * Marks the content of the widget as changed and reports its bounds as dirty to the parent.
+     *
+     * Until then paint() replays the display list recorded by the last onPaint() call instead of painting again.
+     */
     void invalidate();
 
+    /**
+     * Returns the widget bounds in window coordinates, derived from the layout position transform.
+     */
+    Rect windowBounds() const noexcept;
+
+    /** Returns the transform from local to window coordinates, computed by the last layout. */
+    const Transform& positionTransform() const noexcept { return mPosTransform; }
+
     void setParent(ViewParent* parent);
 
     //******************set attrs********************//
 
+    void setId(std::string id);
     void setWidth(Length width);
     void setHeight(Length height);
     void setMargins(const EdgeInsets& margin);
@@ -160,9 +203,12 @@ public:
      * @param value The target opacity (0.0 to 1.0).
      */
     void setOpacity(float value);
-    // TODO
-    //  Length maxWidth() const { return mConstraints.maxWidth; }
-    //  Length minWidth() const { return mConstraints.minWidth; }
+
+    /**
+     * Returns the size limits set by setMinimumSize() and setMaximumSize().
+     * measure() clamps the measured size to them, relative lengths are resolved against the available size.
+     */
+    const BoxConstraints& constraints() const noexcept { return mConstraints; }
 
     void setEnable(bool enabled);
     // void setVisible(VisibleFlag flag);
@@ -188,17 +234,23 @@ public:
     virtual void discardCanvas();
     /**
      * Apply styles or attributes to control
-     * @param attrs
+     *
+     * Attributes missing from the set keep their current value, so a set holding a few values, e.g. the colors of
+     * a theme, can be applied to many widgets. Subclasses override it to read their own attributes.
+     * @param attributes The parsed attributes, see attrs for the ids of the common ones.
      */
-    virtual void applyAttributes(const AttributeSet& attrs);
+    virtual void applyAttributes(const AttributeSet& attributes);
 
     /**
      * measure the actual size of the control
+     *
+     * The result is cached against the constraints, measuring a widget with a clean layout again with the same
+     * constraints returns immediately without visiting its subtree.
      * @param canvas
      * @param available available size of parent container
      * @param max the maximum size allowed by the parent container. A value less than 0 means there is no limit.
      */
-    // void measure(Canvas& canvas, const UISize& available, const UISize& max);
+    void measure(Canvas& canvas, const Size& available, const Size& max);
 
     void bindOnClick(const ClickCallback& callback);
 
@@ -212,22 +264,34 @@ protected:
 
     // VisibleFlag mVisible = VisibleFlag::Visible;
 
-    // void setMeasuredSize(const UISize& size);
+    void setMeasuredSize(const Size& size);
 
-    // virtual UIRect calculateContentRect(const UIRect& pos) const noexcept;
+    // virtual Rect calculateContentRect(const Rect& pos) const noexcept;
 
-    virtual void dispatchPaint(Canvas& canvas) { BIX_UNUSED(canvas) }
+    virtual void dispatchPaint(Canvas& canvas, const DamageRegion* damage) {
+        BIX_UNUSED(canvas)
+        BIX_UNUSED(damage)
+    }
+
+    /**
+     * Reports a dirty area to the parent without invalidating the recorded content of this widget.
+     * @param rect The dirty area in local coordinates, clipped to the widget bounds if bounds clipping is enabled.
+     */
+    void invalidateRect(const Rect& rect);
 
     virtual void onPaint(Canvas& canvas) = 0;
     virtual void paintBackground(Canvas& canvas);
     virtual void paintForeground(Canvas& canvas);
 
-    virtual void onLayout(const UIRect& rect) { BIX_UNUSED(rect) }
+    virtual void onLayout(const Rect& rect) { BIX_UNUSED(rect) }
 
-    // virtual void onMeasure(Canvas& canvas, const UISize& available, const UISize& max);
+    virtual void onMeasure(Canvas& canvas, const Size& available, const Size& max);
 
     virtual void onRemoved() {}
 
+    /** Called by setVisibility() after the visibility changed. */
+    virtual void onVisibilityChanged(Visibility visibility) { BIX_UNUSED(visibility) }
+
     virtual bool dispatchHoverEvent(const MouseEvent& event);
 
     virtual bool onMouseHover(const MouseEvent& event);
@@ -237,6 +301,14 @@ protected:
 
     // Discard DeviceResources
 private:
+    friend class Scene; // mirrors the layout state into its NodeStore and paints the culled nodes
+
+    /** Records the own content if it is dirty and replays it, without the children. */
+    void paintContent(Canvas& canvas);
+
+    /** Clips to the bounds, following the shape of the border if there is one. */
+    bool pushBoundsClip(Canvas& canvas) const;
+
     std::string mId{};
     Length mWidth{Length::autoSize()};
     Length mHeight{Length::autoSize()};
@@ -248,14 +320,17 @@ private:
 
     Rect mBounds;
 
-    UIRect mPosition{}; // layout position
+    Rect mPosition{}; // layout position
+    Rect mLaidOutBounds; // window bounds of the last layout, damaged when the widget moves or resizes
     Size mMeasuredSize{-1, -1};
     BorderPtr mBorder = nullptr;
     Transform mPosTransform{};
     DrawablePtr mBackground = nullptr;
+    std::unique_ptr<DisplayList> mDisplayList = nullptr;
+    MeasureCache mMeasureCache{};
     float mOpacity = 1.0;
     Visibility mVisibility = Visibility::Visible;
-    WidgetFlags mFlags{};
+    WidgetFlags mFlags{WidgetFlag::DirtyPaint | WidgetFlag::DirtyNode};
     // ControlFlags mFlags;
     ViewParent* mParent = nullptr;
     std::vector<ClickCallback> mClickCallbacks;
@@ -266,7 +341,10 @@ public:
     bool isContainer() const noexcept final { return false; }
 
 protected:
-    void dispatchPaint(Canvas& canvas) final { BIX_UNUSED(canvas) }
+    void dispatchPaint(Canvas& canvas, const DamageRegion* damage) final {
+        BIX_UNUSED(canvas)
+        BIX_UNUSED(damage)
+    }
 };
 
 // --- Second layer: CRTP middleware (processing chain calls) ---
@@ -39,6 +39,7 @@ enum class WidgetFlag : uint32_t {
     Focusable = 1 << 5,   ///<
     InLayout = 1 << 11,   ///<
     InMeasure = 1 << 12,  ///<
+    DirtyNode = 1 << 13,  ///< Its mirror in the NodeStore of the scene is stale.
     WillNotDraw = 1 << 8, ///<
     Opaque = 1 << 9,      ///<
 };
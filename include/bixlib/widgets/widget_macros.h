@@ -18,4 +18,4 @@
 
 #define BIX_WIDGET_DECLARE(type)                                            \
     static constexpr const char* StaticType() { return #type; }             \
-    const char* typeName() const noexcept override { return StaticType(); }
\ No newline at end of file
+    const char* typeName() const noexcept override { return StaticType(); }
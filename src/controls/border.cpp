@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025 Lynn <lynnplus90@gmail.com>.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/controls/border.h"
+
+#include <algorithm>
+
+namespace bix {
+
+namespace {
+// Border widths are whole pixels, radii resolve relative units against the shorter side of the bounds.
+float resolveRadius(const Length& length, float relative) noexcept {
+    if (!length.isValid() || length.isAuto() || length.isInfinity() || length.isStretch()) { return 0.f; }
+    switch (length.unit()) {
+    case Length::PX:
+        return static_cast<float>(length.fixedValue());
+    case Length::PERCENT:
+    case Length::VW:
+    case Length::VH:
+        return relative * static_cast<float>(length.fixedValue()) / (Length::FLOAT_SCALE * 100.f);
+    default:
+        return static_cast<float>(length.fixedValue()) / Length::FLOAT_SCALE;
+    }
+}
+
+Pen makePen(const BorderStroke& stroke) {
+    Pen pen(stroke.color, static_cast<float>(stroke.width));
+    pen.setLineStyle(stroke.lineStyle);
+    return pen;
+}
+
+Length insetOf(const BorderStroke& stroke) noexcept {
+    return Length::px(stroke.overlay ? 0 : stroke.width);
+}
+} // namespace
+
+Border& Border::setStroke(const BorderStroke& stroke) {
+    mLeft = mTop = mRight = mBottom = stroke;
+    mFlags.setFlag(BorderFlag::HasAll, stroke.width > 0);
+    mFlags.on(BorderFlag::Dirty);
+    return *this;
+}
+
+Border& Border::setLeft(const BorderStroke& stroke) {
+    mLeft = stroke;
+    mFlags.setFlag(BorderFlag::HasLeft, stroke.width > 0);
+    mFlags.on(BorderFlag::Dirty);
+    return *this;
+}
+
+Border& Border::setTop(const BorderStroke& stroke) {
+    mTop = stroke;
+    mFlags.setFlag(BorderFlag::HasTop, stroke.width > 0);
+    mFlags.on(BorderFlag::Dirty);
+    return *this;
+}
+
+Border& Border::setRight(const BorderStroke& stroke) {
+    mRight = stroke;
+    mFlags.setFlag(BorderFlag::HasRight, stroke.width > 0);
+    mFlags.on(BorderFlag::Dirty);
+    return *this;
+}
+
+Border& Border::setBottom(const BorderStroke& stroke) {
+    mBottom = stroke;
+    mFlags.setFlag(BorderFlag::HasBottom, stroke.width > 0);
+    mFlags.on(BorderFlag::Dirty);
+    return *this;
+}
+
+Border& Border::setRadius(const Length& radius) {
+    return setRadius(radius, radius);
+}
+
+Border& Border::setRadius(const Length& rx, const Length& ry) {
+    mTopLeftRadius = mTopRightRadius = mBottomLeftRadius = mBottomRightRadius = {rx, ry};
+    mShapeType = ShapeType::RoundedRectangle;
+    mFlags.on(BorderFlag::Dirty);
+    return *this;
+}
+
+EdgeInsets Border::insets() const {
+    return {insetOf(mLeft), insetOf(mTop), insetOf(mRight), insetOf(mBottom)};
+}
+
+RoundRect Border::makeRect(const Rect& rect) const noexcept {
+    if (mShapeType != ShapeType::RoundedRectangle) { return {rect, 0.f}; }
+    // Corners take the smaller of both radii, a round rect has a single radius per corner.
+    const float side = std::min(rect.width(), rect.height());
+    const auto corner = [side](const BorderRadius& r) {
+        return std::max(std::min(resolveRadius(r.radiusX, side), resolveRadius(r.radiusY, side)), 0.f);
+    };
+    return {rect, CornerRadius(corner(mTopLeftRadius), corner(mTopRightRadius), corner(mBottomLeftRadius),
+                               corner(mBottomRightRadius))};
+}
+
+void Border::reset() {
+    mTopLeftRadius = mTopRightRadius = mBottomLeftRadius = mBottomRightRadius = {};
+    mLeft = mTop = mRight = mBottom = {};
+    mFlags = BorderFlags(BorderFlag::Dirty);
+    mEllipseRadiusX = mEllipseRadiusY = 0;
+    mShapeType = ShapeType::None;
+}
+
+void Border::onDraw(const Rect& rect, Canvas& canvas) {
+    if (!mFlags.testAnyFlags(BorderFlag::HasAll)) { return; }
+    if (mFlags.testFlag(BorderFlag::Dirty)) { update(); }
+
+    // Strokes are centered on their outline, which is moved inwards by half of the width to stay in the bounds.
+    const bool uniform = mFlags.testFlag(BorderFlag::HasAll) && mLeft == mTop && mLeft == mRight && mLeft == mBottom;
+    if (uniform) {
+        const float half = static_cast<float>(mLeft.width) / 2;
+        RoundRect shape = makeRect(rect);
+        shape.rect = Rect(rect.left + half, rect.top + half, rect.right - half, rect.bottom - half);
+        canvas.drawRoundRect(shape, mLeftPen);
+        return;
+    }
+    // Differing sides are drawn as separate straight edges.
+    if (mFlags.testFlag(BorderFlag::HasLeft)) {
+        const float x = rect.left + static_cast<float>(mLeft.width) / 2;
+        canvas.drawLine({x, rect.top, x, rect.bottom}, mLeftPen);
+    }
+    if (mFlags.testFlag(BorderFlag::HasTop)) {
+        const float y = rect.top + static_cast<float>(mTop.width) / 2;
+        canvas.drawLine({rect.left, y, rect.right, y}, mTopPen);
+    }
+    if (mFlags.testFlag(BorderFlag::HasRight)) {
+        const float x = rect.right - static_cast<float>(mRight.width) / 2;
+        canvas.drawLine({x, rect.top, x, rect.bottom}, mRightPen);
+    }
+    if (mFlags.testFlag(BorderFlag::HasBottom)) {
+        const float y = rect.bottom - static_cast<float>(mBottom.width) / 2;
+        canvas.drawLine({rect.left, y, rect.right, y}, mBottomPen);
+    }
+}
+
+void Border::onDiscardCanvas() {
+    // Pens are values without device resources, there is nothing to release.
+}
+
+void Border::update() {
+    mLeftPen = makePen(mLeft);
+    mTopPen = makePen(mTop);
+    mRightPen = makePen(mRight);
+    mBottomPen = makePen(mBottom);
+    mFlags.off(BorderFlag::Dirty);
+}
+} // namespace bix
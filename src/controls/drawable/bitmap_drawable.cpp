@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/controls/drawable.h"
+
+namespace bix {
+
+BitmapDrawable::BitmapDrawable(Bitmap bitmap, BitmapSampling sampling)
+    : mBitmap(std::move(bitmap))
+    , mSampling(sampling) {}
+
+void BitmapDrawable::draw(Canvas* canvas) {
+    if (!mVisible || !mBounds.isValid() || mBitmap.isEmpty() || mAlpha == 0) {
+        return;
+    }
+    canvas->drawBitmap(mBitmap, Rect(mBitmap.bounds()), mBounds, opacity(), mSampling);
+}
+
+void BitmapDrawable::setBitmap(Bitmap bitmap) { mBitmap = std::move(bitmap); }
+
+void BitmapDrawable::setSampling(BitmapSampling sampling) { mSampling = sampling; }
+
+void BitmapDrawable::discardCanvas() {
+    // Backends key their uploaded copies by the bitmap id, there is nothing owned by the drawable to release.
+}
+} // namespace bix
@@ -21,8 +21,8 @@ namespace bix {
 ColorDrawable::ColorDrawable(const Color& color) : mColor(color) {}
 
 void ColorDrawable::setAlpha(int alpha) {
-    // TODO not implemented
-    BIX_UNUSED(alpha)
+    Drawable::setAlpha(alpha);
+    if (mBrush) { mBrush->setOpacity(opacity()); }
 }
 
 void ColorDrawable::draw(Canvas* canvas) {
@@ -31,11 +31,15 @@ void ColorDrawable::draw(Canvas* canvas) {
     }
     if (!mBrush) {
         mBrush = canvas->createColorBrush(mColor);
+        mBrush->setOpacity(opacity());
     }
     canvas->fillRectangle(mBounds, *mBrush);
 }
 
-void ColorDrawable::setColor(const Color& color) { mColor = color; }
+void ColorDrawable::setColor(const Color& color) {
+    mColor = color;
+    if (mBrush) { mBrush->setColor(color); }
+}
 
 void ColorDrawable::discardCanvas() { mBrush = nullptr; }
 } // namespace bix
\ No newline at end of file
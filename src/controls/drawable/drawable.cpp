@@ -16,10 +16,14 @@
 
 #include "bixlib/controls/drawable.h"
 
+#include <algorithm>
+
 namespace bix {
 void Drawable::setVisible(bool visible) { mVisible = visible; }
 
-void Drawable::setBounds(const UIRect& bounds) { mBounds = bounds; }
+void Drawable::setAlpha(int alpha) { mAlpha = std::clamp(alpha, 0, 255); }
+
+void Drawable::setBounds(const Rect& bounds) { mBounds = bounds; }
 
-const UIRect& Drawable::bounds() const { return mBounds; }
+const Rect& Drawable::bounds() const { return mBounds; }
 } // namespace bix
\ No newline at end of file
@@ -27,11 +27,26 @@ const std::string& Label::className() const noexcept {
 }
 
 void Label::setText(const std::string& str) {
+    if (mText == str) { return; }
     mText = str;
+    // The text paint is only created once, it must follow the text to measure and paint it.
+    if (mTextPaint) { mTextPaint->setText(mText); }
+    invalidate();
+    requestLayout();
+}
+
+void Label::applyAttributes(const AttributeSet& attributes) {
+    Widget::applyAttributes(attributes);
+    std::string_view text;
+    if (attributes.getString(attrs::Value, text)) { setText(std::string(text)); }
 }
 
 void Label::setTextSize(int size) {
+    if (mTextSize == size) { return; }
     mTextSize = size;
+    if (mTextPaint) { mTextPaint->setTextSize(numeric_cast<float>(mTextSize)); }
+    invalidate();
+    requestLayout();
 }
 
 void Label::setTextLines(int maxLines) {
@@ -46,14 +61,12 @@ void Label::onLayout(const UIRect& rect) {
 void Label::onPaint(Canvas& canvas) {
     Widget::onPaint(canvas);
 
-    if (!mTextPen) { mTextPen = canvas.createPen(mTextColor); }
     if (!mTextPaint) { setupTextPaint(canvas); }
-    canvas.drawText(mTextBox.lt(), *mTextPaint, *mTextPen);
+    canvas.drawText(mTextBox.lt(), *mTextPaint, mTextPen);
 }
 
 void Label::discardCanvas() {
     Widget::discardCanvas();
-    mTextPen = nullptr;
     mTextPaint = nullptr;
 }
 
@@ -66,7 +79,7 @@ void Label::setupTextPaint(Canvas& canvas) {
     mTextPaint->setMaxSize(mTextBox.size());
 }
 
-void Label::onMeasure(Canvas& canvas, const UISize& available, const UISize& max) {
+void Label::onMeasure(Canvas& canvas, const Size& available, const Size& max) {
 
     if (mText.empty()) {
         // TODO measure background-image
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/frame_scheduler.h>
+
+namespace bix {
+
+namespace {
+class SteadyFrameClock final : public FrameClock {
+public:
+    TimePoint now() const noexcept override {
+        return std::chrono::time_point_cast<Duration>(std::chrono::steady_clock::now());
+    }
+};
+} // namespace
+
+const FrameClock& FrameClock::steady() noexcept {
+    static const SteadyFrameClock clock;
+    return clock;
+}
+
+FrameScheduler::FrameScheduler(const FrameClock& clock, int refreshRate) : mClock(clock) {
+    setRefreshRate(refreshRate);
+}
+
+void FrameScheduler::setRefreshRate(int hz) {
+    mRefreshRate = hz > 0 ? hz : kDefaultRefreshRate;
+    mInterval = std::chrono::duration_cast<Duration>(std::chrono::seconds(1)) / mRefreshRate;
+}
+
+void FrameScheduler::request(FramePhases phases) {
+    if (phases.testFlag(FramePhase::Layout)) { phases.on(FramePhase::Paint); }
+    const bool wasIdle = !mPending.testAny();
+    mPending |= phases;
+    // Requests made while a frame runs are picked up by the next frame, the host is already awake then.
+    if (wasIdle && mPending.testAny() && !mInFrame && mWakeup) { mWakeup(nextFrameTime()); }
+}
+
+FrameScheduler::TimePoint FrameScheduler::nextFrameTime() const noexcept {
+    if (!mHasFrame) { return mClock.now(); }
+    return mNextDeadline;
+}
+
+bool FrameScheduler::tick() {
+    if (!mPending.testAny() || mInFrame) { return false; }
+    const TimePoint start = mClock.now();
+    if (mHasFrame && start < mNextDeadline) { return false; }
+
+    mInFrame = true;
+    const FramePhases phases = mPending;
+    mPending.clear();
+
+    TimePoint phaseStart = start;
+    FrameTimings timings{};
+    if (phases.testFlag(FramePhase::Layout) && mLayout) {
+        mLayout();
+        const TimePoint now = mClock.now();
+        timings.layout = now - phaseStart;
+        phaseStart = now;
+    }
+    if (phases.testFlag(FramePhase::Paint) && mPaint) {
+        mPaint();
+        timings.paint = mClock.now() - phaseStart;
+    }
+    timings.total = mClock.now() - start;
+    timings.frame = mTimings.frame + 1;
+    mTimings = timings;
+
+    // Keep deadlines on the refresh grid unless the frame was late by more than a whole interval.
+    if (!mHasFrame || start - mNextDeadline >= mInterval) {
+        mNextDeadline = start + mInterval;
+    } else {
+        mNextDeadline += mInterval;
+    }
+    mHasFrame = true;
+    mInFrame = false;
+
+    // Work requested by the phases themselves is scheduled for the next deadline.
+    if (mPending.testAny() && mWakeup) { mWakeup(mNextDeadline); }
+    return true;
+}
+} // namespace bix
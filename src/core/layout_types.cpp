@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/layout_types.h>
+
+namespace bix {
+
+namespace {
+thread_local LayoutStats* gCurrentStats = nullptr;
+}
+
+LayoutPass::LayoutPass(LayoutStats& stats) noexcept : mPrevious(gCurrentStats) {
+    gCurrentStats = &stats;
+}
+
+LayoutPass::~LayoutPass() {
+    gCurrentStats = mPrevious;
+}
+
+LayoutStats* LayoutPass::current() noexcept {
+    return gCurrentStats;
+}
+} // namespace bix
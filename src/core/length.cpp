@@ -31,6 +31,13 @@ Length Length::parse(std::string_view str) noexcept {
         return stretch();
     }
 
+    // Lengths start with a number, other input is rejected before from_chars, whose libstdc++ fallback for
+    // "nan" and "inf" allocates.
+    const char first = str.front();
+    if (!((first >= '0' && first <= '9') || first == '-' || first == '+' || first == '.')) {
+        return px(0);
+    }
+
     float val = 0.0f;
     // Fast, zero-allocation, locale-independent float parsing
     auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), val);
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/node_store.h>
+#include <bixlib/graphics/damage_region.h>
+
+#include <limits>
+
+namespace bix {
+
+void NodeStore::clear() noexcept {
+    mWidgets.clear();
+    mOffsets.clear();
+    mSizes.clear();
+    mFlags.clear();
+    mParents.clear();
+    mFirstChildren.clear();
+    mNextSiblings.clear();
+    mLastChildren.clear();
+    mSubtreeEnds.clear();
+    mBounds.clear();
+    mClipped.clear();
+    mChildClips.clear();
+}
+
+void NodeStore::reserve(size_t count) {
+    mWidgets.reserve(count);
+    mOffsets.reserve(count);
+    mSizes.reserve(count);
+    mFlags.reserve(count);
+    mParents.reserve(count);
+    mFirstChildren.reserve(count);
+    mNextSiblings.reserve(count);
+    mLastChildren.reserve(count);
+    mSubtreeEnds.reserve(count);
+    mBounds.reserve(count);
+    mClipped.reserve(count);
+    mChildClips.reserve(count);
+}
+
+NodeStore::Index NodeStore::append(Widget* widget, Index parent, const Point& offset, const Size& size, NodeFlags flags) {
+    const auto index = static_cast<Index>(mWidgets.size());
+    mWidgets.push_back(widget);
+    mOffsets.push_back(offset);
+    mSizes.push_back(size);
+    mFlags.push_back(flags);
+    mParents.push_back(parent);
+    mFirstChildren.push_back(kNone);
+    mNextSiblings.push_back(kNone);
+    mLastChildren.push_back(kNone);
+    mSubtreeEnds.push_back(index + 1);
+
+    if (parent != kNone) {
+        if (mLastChildren[parent] == kNone) {
+            mFirstChildren[parent] = index;
+        } else {
+            mNextSiblings[mLastChildren[parent]] = index;
+        }
+        mLastChildren[parent] = index;
+        // Every ancestor's subtree grows by the new node, which is the last one in pre-order.
+        for (Index p = parent; p != kNone; p = mParents[p]) { mSubtreeEnds[p] = index + 1; }
+    }
+    return index;
+}
+
+bool NodeStore::update(Index i, const Point& offset, const Size& size, NodeFlags flags) noexcept {
+    if (mOffsets[i] == offset && mSizes[i] == size && mFlags[i] == flags) { return false; }
+    mOffsets[i] = offset;
+    mSizes[i] = size;
+    mFlags[i] = flags;
+    return true;
+}
+
+void NodeStore::updateBounds() {
+    const size_t count = mWidgets.size();
+    mBounds.resize(count);
+    mClipped.resize(count);
+    mChildClips.resize(count);
+    updateBounds(0, static_cast<Index>(count));
+}
+
+void NodeStore::updateBounds(Index first, Index last) {
+    constexpr float kMax = std::numeric_limits<float>::max();
+    const Rect unclipped(-kMax, -kMax, kMax, kMax);
+    for (Index i = first; i < last; ++i) {
+        const Index p = mParents[i];
+        const Point& o = mOffsets[i];
+        const Point origin = p == kNone ? o : Point(o.x + mBounds[p].left, o.y + mBounds[p].top);
+        mBounds[i] = Rect(origin.x, origin.y, origin.x + mSizes[i].width, origin.y + mSizes[i].height);
+
+        // A hidden node hides its subtree, which is expressed as an empty clip for the children.
+        const Rect& clip = p == kNone ? unclipped : mChildClips[p];
+        if (!mFlags[i].testFlag(NodeFlag::Visible) || clip.isEmpty()) {
+            mClipped[i] = {};
+            mChildClips[i] = {};
+            continue;
+        }
+        mClipped[i] = mBounds[i].intersected(clip);
+        mChildClips[i] = mFlags[i].testFlag(NodeFlag::BoundsClip) ? mClipped[i] : clip;
+    }
+}
+
+NodeStore::Index NodeStore::hitTest(const Point& p) const noexcept {
+    // Later nodes in pre-order are painted on top of earlier ones, the first hit from the back is the topmost.
+    for (size_t i = mClipped.size(); i-- > 0;) {
+        if (mClipped[i].contains(p)) { return static_cast<Index>(i); }
+    }
+    return kNone;
+}
+
+void NodeStore::cull(const DamageRegion& damage, std::vector<Index>& out) const {
+    out.clear();
+    if (damage.isEmpty()) { return; }
+    const Rect area = damage.bounds();
+    const auto count = static_cast<Index>(mClipped.size());
+    for (Index i = 0; i < count;) {
+        if (mFlags[i].testFlag(NodeFlag::Transparent)) {
+            i = mSubtreeEnds[i];
+            continue;
+        }
+        const Rect& r = mClipped[i];
+        if (!r.isEmpty() && area.intersects(r) && damage.intersects(r)) { out.push_back(i); }
+        // Descendants lie within the clip inherited from their parent, a clip missing the damage rules out the
+        // whole subtree.
+        const Rect& clip = mChildClips[i];
+        i = clip.isEmpty() || !area.intersects(clip) ? mSubtreeEnds[i] : i + 1;
+    }
+}
+} // namespace bix
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/scene.h>
+#include <bixlib/widgets/container.h>
+
+#include <utility>
+
+namespace bix {
+
+Scene::Scene(WidgetHost* host) : mHost(host) {}
+
+void Scene::setRoot(WidgetPtr root) {
+    if (mRoot) { mRoot->setParent(nullptr); }
+    mHovered = nullptr;
+    mRoot = nullptr;
+    if (mArena && mArena->liveCount() == 0) { mArena->reset(); }
+    mRoot = std::move(root);
+    if (mRoot) { mRoot->setParent(this); }
+    mDirtyLayout = true;
+    invalidateAll();
+}
+
+MonotonicArena* Scene::arena() {
+    if (!mArena) { mArena = std::make_unique<MonotonicArena>(); }
+    return mArena.get();
+}
+
+void Scene::resize(const Size& size) {
+    if (mWindowSize == size) { return; }
+    mWindowSize = size;
+    mDirtyLayout = true;
+    invalidateAll();
+}
+
+void Scene::invalidateAll() {
+    addDamage(Rect(mWindowSize));
+}
+
+bool Scene::performLayout(Canvas& canvas) {
+    if (!mRoot || !mDirtyLayout) { return false; }
+
+    mLayoutStats = {};
+    LayoutPass pass(mLayoutStats);
+    mRoot->measure(canvas, mWindowSize, mWindowSize);
+    mRoot->layout({0, 0, mRoot->measuredSize()});
+    mDirtyLayout = false;
+    syncNodes();
+    return true;
+}
+
+void Scene::paint(Canvas& canvas) {
+    if (mDamage.isEmpty()) { return; }
+    if (!mRoot) {
+        mDamage.clear();
+        return;
+    }
+
+    // With a layout pending the node store is stale and the tree is walked instead. Otherwise only the culled nodes
+    // are painted, skipping the tree walk entirely if the damage misses every visible widget.
+    if (!mDirtyLayout) {
+        mNodes.cull(mDamage, mVisible);
+        if (mVisible.empty()) {
+            mDamage.clear();
+            return;
+        }
+    }
+
+    // Widgets invalidated while painting add to the emptied region and are repainted by the next frame.
+    std::swap(mDamage, mPaintDamage);
+    canvas.setTransform({});
+    const bool clipped = canvas.pushClip(RoundRect(mPaintDamage.bounds(), 0));
+    if (mDirtyLayout) {
+        mRoot->paint(canvas, &mPaintDamage);
+    } else {
+        paintNodes(canvas);
+    }
+    if (clipped) { canvas.popClip(); }
+    mPaintDamage.clear();
+}
+
+Widget* Scene::hitTest(const Point& p) const noexcept {
+    if (mDirtyLayout) { return nullptr; }
+    const auto id = mGrid.hitTest(p);
+    return id == SpatialGrid::kNone ? nullptr : mNodes.widget(id);
+}
+
+void Scene::query(const Rect& rect, std::vector<Widget*>& out) const {
+    out.clear();
+    if (mDirtyLayout) { return; }
+    mGrid.query(rect, mQueryIds);
+    out.reserve(mQueryIds.size());
+    for (auto id : mQueryIds) { out.push_back(mNodes.widget(id)); }
+}
+
+Widget* Scene::updateHover(const Point& p) {
+    Widget* target = hitTest(p);
+    if (target == mHovered) { return target; }
+    if (mHovered) { mHovered->setHovered(false); }
+    mHovered = target;
+    if (mHovered) { mHovered->setHovered(true); }
+    return target;
+}
+
+void Scene::requestLayoutFromChild(Widget* child) {
+    BIX_UNUSED(child)
+    mDirtyLayout = true;
+    if (mHost) { mHost->requestLayout(); }
+}
+
+void Scene::invalidateChild(Widget* child, const Rect& rect) {
+    const auto& pos = child->position();
+    addDamage(rect.translated(pos.left, pos.top));
+}
+
+void Scene::invalidateWindowRect(const Rect& rect) {
+    addDamage(rect);
+}
+
+Transform Scene::childTransform() const noexcept {
+    // The root is laid out in window coordinates.
+    return {};
+}
+
+void Scene::addDamage(const Rect& rect) {
+    const Rect dirty = rect.intersected(Rect(mWindowSize));
+    if (dirty.isEmpty()) { return; }
+    mDamage.add(dirty);
+    if (mHost) { mHost->scheduleFrame(mDamage.bounds()); }
+}
+void Scene::paintNodes(Canvas& canvas) {
+    const Rect area = mPaintDamage.bounds();
+    for (const auto index : mVisible) {
+        // The clips of all ancestors are folded into one rect, only the rounded clips of borders are pushed one by
+        // one, from the root down.
+        mClipChain.clear();
+        for (auto i = index; i != NodeStore::kNone; i = mNodes.parent(i)) {
+            if (mNodes.flags(i).testFlag(NodeFlag::BorderClip)) { mClipChain.push_back(i); }
+        }
+        int clips = 0;
+        const Rect& clip = mNodes.clip(index);
+        if (!clip.contains(area)) {
+            canvas.setTransform({});
+            if (canvas.pushClip(RoundRect(clip, 0))) { ++clips; }
+        }
+        for (auto it = mClipChain.rbegin(); it != mClipChain.rend(); ++it) {
+            if (mNodes.widget(*it)->pushBoundsClip(canvas)) { ++clips; }
+        }
+        mNodes.widget(index)->paintContent(canvas);
+        for (; clips > 0; --clips) { canvas.popClip(); }
+    }
+}
+
+void Scene::syncNodes() {
+    const Rect window(mWindowSize);
+    const bool resized = mGrid.area() != window;
+    if (resized) { mGrid.reset(window); }
+
+    // An unchanged structure is patched in place, visiting only the subtrees that were laid out again.
+    mDirtyRanges.clear();
+    if (!mRoot || mNodes.isEmpty() || !syncNode(mRoot.get(), 0)) {
+        rebuildNodes();
+        return;
+    }
+    for (const auto& [first, last] : mDirtyRanges) { mNodes.updateBounds(first, last); }
+    if (resized) {
+        updateGrid(0, static_cast<NodeStore::Index>(mNodes.size()));
+        return;
+    }
+    for (const auto& [first, last] : mDirtyRanges) { updateGrid(first, last); }
+}
+
+bool Scene::syncNode(Widget* widget, NodeStore::Index index) {
+    // Widgets are only compared by address, a stale entry may refer to a destroyed widget.
+    if (mNodes.widget(index) != widget) { return false; }
+    // Changes below a widget mark it dirty too, a clean widget has a clean subtree.
+    if (!widget->mFlags.testFlag(WidgetFlag::DirtyNode)) { return true; }
+    widget->mFlags.off(WidgetFlag::DirtyNode);
+
+    const auto& pos = widget->position();
+    if (mNodes.update(index, Point(pos.left, pos.top), widget->measuredSize(), nodeFlags(widget))) {
+        // Ranges are found in pre-order, a node inside the last range is already covered by it.
+        if (mDirtyRanges.empty() || index >= mDirtyRanges.back().second) {
+            mDirtyRanges.emplace_back(index, mNodes.subtreeEnd(index));
+        }
+    }
+
+    auto next = mNodes.firstChild(index);
+    if (widget->isContainer()) {
+        auto* container = static_cast<Container*>(widget);
+        const auto count = static_cast<int>(container->childCount());
+        for (int i = 0; i < count; ++i) {
+            auto* child = container->childAt(i);
+            if (!child) { continue; }
+            if (next == NodeStore::kNone || !syncNode(child, next)) { return false; }
+            next = mNodes.nextSibling(next);
+        }
+    }
+    return next == NodeStore::kNone;
+}
+
+void Scene::rebuildNodes() {
+    const size_t previous = mNodes.size();
+    mNodes.clear();
+    mNodes.reserve(previous);
+    mHoveredFound = false;
+    if (mRoot) { appendNode(mRoot.get(), NodeStore::kNone); }
+    mNodes.updateBounds();
+    // Widgets removed from the tree must not stay referenced.
+    if (!mHoveredFound) { mHovered = nullptr; }
+
+    // Node ids are stable for an unchanged prefix of the tree, the grid skips nodes whose bounds did not change.
+    mGrid.truncate(mNodes.size());
+    updateGrid(0, static_cast<NodeStore::Index>(mNodes.size()));
+}
+
+void Scene::updateGrid(NodeStore::Index first, NodeStore::Index last) {
+    for (auto i = first; i < last; ++i) { mGrid.update(i, mNodes.clippedBounds(i)); }
+}
+
+NodeFlags Scene::nodeFlags(const Widget* widget) noexcept {
+    NodeFlags flags;
+    if (widget->visibility() == Visibility::Visible) { flags.on(NodeFlag::Visible); }
+    if (widget->isEnabled()) { flags.on(NodeFlag::Enabled); }
+    if (widget->isClickable()) { flags.on(NodeFlag::Clickable); }
+    if (widget->mEnableBoundsClip) { flags.on(NodeFlag::BoundsClip); }
+    if (widget->mEnableBoundsClip && widget->mBorder) { flags.on(NodeFlag::BorderClip); }
+    if (widget->isContainer()) { flags.on(NodeFlag::Container); }
+    if (widget->opacity() <= 0.f) { flags.on(NodeFlag::Transparent); }
+    return flags;
+}
+
+void Scene::appendNode(Widget* widget, NodeStore::Index parent) {
+    if (widget == mHovered) { mHoveredFound = true; }
+    widget->mFlags.off(WidgetFlag::DirtyNode);
+
+    const auto& pos = widget->position();
+    const Point offset(pos.left, pos.top);
+    const auto index = mNodes.append(widget, parent, offset, widget->measuredSize(), nodeFlags(widget));
+
+    if (!widget->isContainer()) { return; }
+    auto* container = static_cast<Container*>(widget);
+    const auto count = static_cast<int>(container->childCount());
+    for (int i = 0; i < count; ++i) {
+        if (auto* child = container->childAt(i)) { appendNode(child, index); }
+    }
+}
+} // namespace bix
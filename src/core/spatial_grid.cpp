@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/spatial_grid.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace bix {
+
+SpatialGrid::SpatialGrid(float cellSize) : mCellSize(cellSize > 0.f ? cellSize : kDefaultCellSize) {}
+
+void SpatialGrid::reset(const Rect& area) {
+    mArea = area;
+    mColumns = std::max(1, static_cast<int>(std::ceil(area.width() / mCellSize)));
+    mRows = std::max(1, static_cast<int>(std::ceil(area.height() / mCellSize)));
+    mCells.assign(static_cast<size_t>(mColumns) * static_cast<size_t>(mRows), {});
+    mRects.clear();
+}
+
+void SpatialGrid::clear() {
+    for (auto& cell : mCells) { cell.clear(); }
+    mRects.clear();
+}
+
+SpatialGrid::CellRange SpatialGrid::cellRange(const Rect& rect) const noexcept {
+    auto column = [this](float x) {
+        const float c = std::floor((x - mArea.left) / mCellSize);
+        return static_cast<int>(std::clamp(c, 0.f, static_cast<float>(mColumns - 1)));
+    };
+    auto row = [this](float y) {
+        const float r = std::floor((y - mArea.top) / mCellSize);
+        return static_cast<int>(std::clamp(r, 0.f, static_cast<float>(mRows - 1)));
+    };
+    return {column(rect.left), row(rect.top), column(rect.right), row(rect.bottom)};
+}
+
+void SpatialGrid::link(Id id, const CellRange& range) {
+    for (int y = range.top; y <= range.bottom; ++y) {
+        for (int x = range.left; x <= range.right; ++x) { mCells[static_cast<size_t>(cellIndex(x, y))].push_back(id); }
+    }
+}
+
+void SpatialGrid::unlink(Id id, const CellRange& range) {
+    for (int y = range.top; y <= range.bottom; ++y) {
+        for (int x = range.left; x <= range.right; ++x) {
+            auto& cell = mCells[static_cast<size_t>(cellIndex(x, y))];
+            const auto it = std::find(cell.begin(), cell.end(), id);
+            if (it == cell.end()) { continue; }
+            // The order within a cell does not matter, queries compare ids.
+            *it = cell.back();
+            cell.pop_back();
+        }
+    }
+}
+
+void SpatialGrid::update(Id id, const Rect& rect) {
+    if (mCells.empty()) { return; }
+    const Rect next = rect.isEmpty() ? Rect() : rect;
+    if (id >= mRects.size()) {
+        if (next.isEmpty()) { return; }
+        mRects.resize(static_cast<size_t>(id) + 1);
+    }
+    Rect& current = mRects[id];
+    if (current == next) { return; }
+    if (!current.isEmpty()) { unlink(id, cellRange(current)); }
+    if (!next.isEmpty()) { link(id, cellRange(next)); }
+    current = next;
+}
+
+void SpatialGrid::truncate(size_t count) {
+    if (count >= mRects.size()) { return; }
+    for (size_t id = count; id < mRects.size(); ++id) {
+        if (!mRects[id].isEmpty()) { unlink(static_cast<Id>(id), cellRange(mRects[id])); }
+    }
+    mRects.resize(count);
+}
+
+SpatialGrid::Id SpatialGrid::hitTest(const Point& p) const noexcept {
+    if (mCells.empty()) { return kNone; }
+    const auto range = cellRange({p.x, p.y, p.x, p.y});
+    Id best = kNone;
+    for (Id id : mCells[static_cast<size_t>(cellIndex(range.left, range.top))]) {
+        if ((best == kNone || id > best) && mRects[id].contains(p)) { best = id; }
+    }
+    return best;
+}
+
+void SpatialGrid::query(const Rect& rect, std::vector<Id>& out) const {
+    out.clear();
+    if (mCells.empty() || rect.isEmpty()) { return; }
+    const auto range = cellRange(rect);
+    for (int y = range.top; y <= range.bottom; ++y) {
+        for (int x = range.left; x <= range.right; ++x) {
+            for (Id id : mCells[static_cast<size_t>(cellIndex(x, y))]) {
+                if (mRects[id].intersects(rect)) { out.push_back(id); }
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+} // namespace bix
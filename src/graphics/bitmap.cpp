@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/graphics/bitmap.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+namespace bix {
+
+struct Bitmap::Shared {
+    vector<uint8_t> storage; // Empty for borrowed pixels.
+    uint64_t id = 0;
+    bool immutable = false;
+    // Levels 1 and up, the capacity is reserved up front so references to generated levels stay valid.
+    vector<Bitmap> mips;
+};
+
+namespace {
+constexpr uint32_t kRedBlueMask = 0x00FF00FFu;
+
+// Bitmaps may be decoded on worker threads, ids are unique within the process.
+atomic<uint64_t> s_nextId{1};
+
+uint64_t nextId() noexcept {
+    return s_nextId.fetch_add(1, memory_order_relaxed);
+}
+
+// Pixels are read as little-endian words, so RGBA bytes put red into the lowest byte.
+uint32_t load(const uint8_t* p) noexcept {
+    uint32_t v = 0;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+constexpr uint32_t swapRedBlue(uint32_t p) noexcept {
+    return (p & 0xFF00FF00u) | ((p >> 16) & 0xFFu) | ((p & 0xFFu) << 16);
+}
+
+// Same rounding as the software backend, see blend-inl.h.
+constexpr uint32_t premultiply(uint32_t p) noexcept {
+    const uint32_t a = p >> 24;
+    uint32_t rb = (p & kRedBlueMask) * a + 0x00800080u;
+    rb = ((rb + ((rb >> 8) & kRedBlueMask)) >> 8) & kRedBlueMask;
+    uint32_t g = ((p >> 8) & 0xFFu) * a + 0x80u;
+    g = ((g + (g >> 8)) >> 8) & 0xFFu;
+    return rb | (g << 8) | (a << 24);
+}
+
+constexpr uint32_t unpremultiply(uint32_t p) noexcept {
+    const uint32_t a = p >> 24;
+    if (a == 255 || a == 0) { return a == 0 ? 0 : p; }
+    auto channel = [a](uint32_t v) { return std::min<uint32_t>((v * 255 + a / 2) / a, 255); };
+    return channel(p & 0xFFu) | channel((p >> 8) & 0xFFu) << 8 | channel((p >> 16) & 0xFFu) << 16 | a << 24;
+}
+
+// Averages four premultiplied pixels, each channel sum stays below 16 bits.
+constexpr uint32_t average(uint32_t a, uint32_t b, uint32_t c, uint32_t d) noexcept {
+    const uint32_t rb = (a & kRedBlueMask) + (b & kRedBlueMask) + (c & kRedBlueMask) + (d & kRedBlueMask);
+    const uint32_t ag = ((a >> 8) & kRedBlueMask) + ((b >> 8) & kRedBlueMask) + ((c >> 8) & kRedBlueMask)
+                        + ((d >> 8) & kRedBlueMask);
+    return (((rb + 0x00020002u) >> 2) & kRedBlueMask) | ((((ag + 0x00020002u) >> 2) & kRedBlueMask) << 8);
+}
+
+// Box filters a bitmap down to half its size, odd trailing rows and columns are folded into the last pixel.
+Bitmap downsample(const Bitmap& src) {
+    Bitmap dst({std::max(src.width() / 2, 1), std::max(src.height() / 2, 1)});
+    vector<uint32_t> top(static_cast<size_t>(src.width()));
+    vector<uint32_t> bottom(top.size());
+    const int lastX = src.width() - 1;
+    for (int y = 0; y < dst.height(); ++y) {
+        src.readPixels(std::min(y * 2, src.height() - 1), 0, src.width(), top.data());
+        src.readPixels(std::min(y * 2 + 1, src.height() - 1), 0, src.width(), bottom.data());
+        auto* out = reinterpret_cast<uint32_t*>(dst.row(y));
+        for (int x = 0; x < dst.width(); ++x) {
+            const auto x0 = static_cast<size_t>(std::min(x * 2, lastX));
+            const auto x1 = static_cast<size_t>(std::min(x * 2 + 1, lastX));
+            out[x] = average(top[x0], top[x1], bottom[x0], bottom[x1]);
+        }
+    }
+    return dst;
+}
+} // namespace
+
+Bitmap::Bitmap(const SizeI& size, PixelFormat format) : mFormat(format) {
+    if (size.width <= 0 || size.height <= 0) { return; }
+    mShared = make_shared<Shared>();
+    mSize = size;
+    mStride = static_cast<size_t>(size.width) * 4;
+    mShared->storage.assign(mStride * static_cast<size_t>(size.height), 0);
+    mShared->id = nextId();
+    mPixels = mShared->storage.data();
+}
+
+Bitmap Bitmap::wrap(uint8_t* pixels, const SizeI& size, size_t stride, PixelFormat format) noexcept {
+    Bitmap bitmap;
+    if (!pixels || size.width <= 0 || size.height <= 0 || stride < static_cast<size_t>(size.width) * 4) {
+        return bitmap;
+    }
+    bitmap.mShared = make_shared<Shared>();
+    bitmap.mShared->id = nextId();
+    bitmap.mPixels = pixels;
+    bitmap.mSize = size;
+    bitmap.mStride = stride;
+    bitmap.mFormat = format;
+    return bitmap;
+}
+
+bool Bitmap::isBorrowed() const noexcept {
+    return mShared && mShared->storage.empty();
+}
+
+uint32_t Bitmap::pixel(int x, int y) const noexcept {
+    uint32_t p = 0;
+    readPixels(y, x, 1, &p);
+    return p;
+}
+
+Color Bitmap::colorAt(int x, int y) const noexcept {
+    const uint32_t p = unpremultiply(pixel(x, y));
+    auto channel = [p](int shift) { return static_cast<int>((p >> shift) & 0xFFu); };
+    return {channel(0), channel(8), channel(16), channel(24)};
+}
+
+void Bitmap::readPixels(int y, int x, int count, uint32_t* out) const noexcept {
+    const uint8_t* src = row(y) + static_cast<size_t>(x) * 4;
+    switch (mFormat) {
+    case PixelFormat::RGBA8Premultiplied: memcpy(out, src, static_cast<size_t>(count) * 4); break;
+    case PixelFormat::RGBA8:
+        for (int i = 0; i < count; ++i, src += 4) { out[i] = premultiply(load(src)); }
+        break;
+    case PixelFormat::BGRA8Premultiplied:
+        for (int i = 0; i < count; ++i, src += 4) { out[i] = swapRedBlue(load(src)); }
+        break;
+    }
+}
+
+Bitmap Bitmap::copy(PixelFormat format) const {
+    Bitmap result(mSize, format);
+    if (result.isEmpty() || isEmpty()) { return result; }
+    for (int y = 0; y < mSize.height; ++y) {
+        auto* out = reinterpret_cast<uint32_t*>(result.row(y));
+        if (format == mFormat) {
+            memcpy(out, row(y), result.mStride);
+            continue;
+        }
+        readPixels(y, 0, mSize.width, out);
+        if (format == PixelFormat::RGBA8) {
+            for (int x = 0; x < mSize.width; ++x) { out[x] = unpremultiply(out[x]); }
+        } else if (format == PixelFormat::BGRA8Premultiplied) {
+            for (int x = 0; x < mSize.width; ++x) { out[x] = swapRedBlue(out[x]); }
+        }
+    }
+    return result;
+}
+
+uint64_t Bitmap::id() const noexcept {
+    return mShared ? mShared->id : 0;
+}
+
+void Bitmap::notifyPixelsChanged() noexcept {
+    if (mShared) { mShared->id = nextId(); }
+}
+
+void Bitmap::setImmutable() noexcept {
+    if (mShared) { mShared->immutable = true; }
+}
+
+bool Bitmap::isImmutable() const noexcept {
+    return mShared && mShared->immutable;
+}
+
+size_t Bitmap::mipLevelCount() const noexcept {
+    if (!isImmutable()) { return 1; }
+    return static_cast<size_t>(std::bit_width(static_cast<unsigned>(std::max(mSize.width, mSize.height))));
+}
+
+const Bitmap& Bitmap::mipLevel(size_t level) const {
+    const size_t count = mipLevelCount();
+    level = std::min(level, count - 1);
+    if (level == 0) { return *this; }
+
+    auto& mips = mShared->mips;
+    if (mips.capacity() < count - 1) { mips.reserve(count - 1); }
+    while (mips.size() < level) { mips.push_back(downsample(mips.empty() ? *this : mips.back())); }
+    return mips[level - 1];
+}
+
+size_t Bitmap::mipLevelFor(float scale) const noexcept {
+    if (!(scale < 1.f)) { return 0; }
+    const size_t last = mipLevelCount() - 1;
+    if (scale <= 0.f) { return last; }
+    // Halving while the level stays at least as large as the drawn size, the sampler covers the remaining ratio.
+    return std::min(static_cast<size_t>(std::floor(std::log2(1.f / scale))), last);
+}
+} // namespace bix
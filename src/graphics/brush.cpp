@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/graphics/brush.h"
+
+namespace bix {
+
+GradientBrush::~GradientBrush() = default;
+
+BrushStyle LinearGradientBrush::style() const noexcept {
+    return BrushStyle::LinearGradient;
+}
+
+BrushStyle RadialGradientBrush::style() const noexcept {
+    return BrushStyle::RadialGradient;
+}
+
+BrushStyle ConicGradientBrush::style() const noexcept {
+    return BrushStyle::ConicGradient;
+}
+} // namespace bix
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/graphics/clip_stack.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+
+Point mapPoint(const float* m, float x, float y) noexcept {
+    return {x * m[0] + y * m[3] + m[6], x * m[1] + y * m[4] + m[7]};
+}
+
+// An empty intersection is normalized so that later intersections and containment checks stay empty.
+Rect intersect(const Rect& a, const Rect& b) noexcept {
+    const Rect r = a.intersected(b);
+    return r.isEmpty() ? Rect{} : r;
+}
+
+// Checks whether a rectangle lies inside a rounded rectangle, it must not reach into the box of a rounded corner.
+bool containsRect(const Rect& shape, const float (&rx)[4], const float (&ry)[4], const Rect& r) noexcept {
+    if (!(r.left >= shape.left && r.top >= shape.top && r.right <= shape.right && r.bottom <= shape.bottom)) {
+        return false;
+    }
+    const bool clearsLeft[2]{r.left >= shape.left + rx[0], r.left >= shape.left + rx[2]};
+    const bool clearsRight[2]{r.right <= shape.right - rx[1], r.right <= shape.right - rx[3]};
+    return (clearsLeft[0] || r.top >= shape.top + ry[0]) && (clearsRight[0] || r.top >= shape.top + ry[1])
+           && (clearsLeft[1] || r.bottom <= shape.bottom - ry[2])
+           && (clearsRight[1] || r.bottom <= shape.bottom - ry[3]);
+}
+} // namespace
+
+void ClipStack::reset(const Rect& surface) {
+    mEntries.resize(1);
+    mEntries[0] = {surface, ClipOp::Skip, true};
+}
+
+ClipOp ClipStack::push(const RoundRect& clip, const Transform& transform) {
+    const Entry parent = mEntries.back();
+    const float* m = transform.data();
+    const Rect& r = clip.rect;
+
+    Entry entry{parent.bounds, ClipOp::Skip, parent.isRect};
+    if (transform.type() > Transform::Scale) {
+        // Rotated or sheared clips are tracked by the bounding box of their corners.
+        const Point corners[4]{mapPoint(m, r.left, r.top), mapPoint(m, r.right, r.top),
+                               mapPoint(m, r.left, r.bottom), mapPoint(m, r.right, r.bottom)};
+        Rect box(corners[0].x, corners[0].y, corners[0].x, corners[0].y);
+        for (const Point& p : corners) {
+            box = {min(box.left, p.x), min(box.top, p.y), max(box.right, p.x), max(box.bottom, p.y)};
+        }
+        entry = {intersect(box, parent.bounds), ClipOp::Mask, false};
+    } else {
+        const Point a = mapPoint(m, r.left, r.top);
+        const Point b = mapPoint(m, r.right, r.bottom);
+        const Rect device(min(a.x, b.x), min(a.y, b.y), max(a.x, b.x), max(a.y, b.y));
+        const float sx = abs(m[0]);
+        const float sy = abs(m[4]);
+        const float radii[4]{clip.radii.topLeft, clip.radii.topRight, clip.radii.bottomLeft, clip.radii.bottomRight};
+        float rx[4];
+        float ry[4];
+        bool sharp = true;
+        for (int i = 0; i < 4; ++i) {
+            rx[i] = max(radii[i], 0.f) * sx;
+            ry[i] = max(radii[i], 0.f) * sy;
+            sharp = sharp && (rx[i] <= 0.f || ry[i] <= 0.f);
+        }
+
+        // Nothing is drawn into an empty clip, and a clip containing the current one changes nothing.
+        if (parent.bounds.isEmpty() || containsRect(device, rx, ry, parent.bounds)) {
+            entry.op = ClipOp::Skip;
+        } else if (sharp) {
+            entry = {intersect(device, parent.bounds), ClipOp::Intersect, parent.isRect};
+        } else {
+            entry = {intersect(device, parent.bounds), ClipOp::Mask, false};
+        }
+    }
+
+    switch (entry.op) {
+    case ClipOp::Skip: ++mStats.skipped; break;
+    case ClipOp::Intersect: ++mStats.rects; break;
+    case ClipOp::Mask: ++mStats.masks; break;
+    }
+    mEntries.push_back(entry);
+    return entry.op;
+}
+
+ClipOp ClipStack::pop() {
+    if (mEntries.size() <= 1) { throw runtime_error("pop clip fail,clip stack empty"); }
+    const ClipOp op = mEntries.back().op;
+    mEntries.pop_back();
+    return op;
+}
+} // namespace bix
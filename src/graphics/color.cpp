@@ -17,62 +17,112 @@
 #include "bixlib/graphics/color.h"
 
 #include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BIX_HEX_PARSE_SSE2
+#include <emmintrin.h>
+#endif
 
 using namespace std;
 
 namespace bix {
 
 namespace {
-constexpr int hexCharToInt(char c) noexcept {
-    if (c >= '0' && c <= '9') return c - '0';
-    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
-    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
-    return -1;
-}
-} // namespace
-
-Color Color::fromHexString(string_view str) {
+#ifdef BIX_HEX_PARSE_SSE2
+// Strips the '#' prefix and returns the digits if the string uses the 6 or 8 digit form.
+bool fullFormDigits(string_view& str) noexcept {
     if (!str.empty() && str[0] == '#') { str.remove_prefix(1); }
-
-    size_t len = str.length();
-    if (len != 3 && len != 6 && len != 8) { return {}; }
-
-    auto parsePair = [&](size_t pos) -> int {
-        int h1 = hexCharToInt(str[pos]);
-        int h2 = hexCharToInt(str[pos + 1]);
-        return (h1 < 0 || h2 < 0) ? -1 : (h1 << 4) | h2;
-    };
-
-    auto parseSingle = [&](size_t pos) -> int {
-        int h = hexCharToInt(str[pos]);
-        return (h < 0) ? -1 : (h << 4) | h;
-    };
-
-    const int r = len == 3 ? parseSingle(0) : parsePair(0);
-    const int g = len == 3 ? parseSingle(1) : parsePair(2);
-    const int b = len == 3 ? parseSingle(2) : parsePair(4);
-    const int a = len == 8 ? parsePair(6) : 255;
-
-    if (r < 0 || g < 0 || b < 0 || a < 0) { return {}; }
-
-    return {r, g, b, a};
+    return str.length() == 6 || str.length() == 8;
 }
 
-Color Color::lerp(const Color& a, const Color& b, float t) noexcept {
-    t = std::clamp(t, 0.0f, 1.0f);
+// Loads 8 hex digits, a 6 digit string is padded with an opaque alpha.
+uint64_t loadDigits(string_view digits) noexcept {
+    char buf[8] = {'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f'};
+    memcpy(buf, digits.data(), digits.length());
+    uint64_t v = 0;
+    memcpy(&v, buf, sizeof(v));
+    return v;
+}
 
-    auto lerpChannel = [t](int start, int end) -> int {
-        auto f_start = static_cast<float>(start);
-        auto f_end = static_cast<float>(end);
-        return math::round_cast<int>(f_start + (f_end - f_start) * t);
-    };
+/**
+ * Decodes two strings of 8 hex digits at once.
+ * @param out Receives the two decoded colors as bytes in R, G, B, A order.
+ * @return A two bit mask with the bit of each string set if all of its digits are valid.
+ */
+int decodeHexPair(uint64_t lo, uint64_t hi, uint32_t out[2]) noexcept {
+    const __m128i c = _mm_set_epi64x(static_cast<int64_t>(hi), static_cast<int64_t>(lo));
+    const __m128i minusOne = _mm_set1_epi8(-1);
+
+    // Signed byte compares are exact here, only the bytes of the valid ranges end up in [0, 9] or [0, 5].
+    const __m128i d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(d, minusOne), _mm_cmplt_epi8(d, _mm_set1_epi8(10)));
+    const __m128i l = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(l, minusOne), _mm_cmplt_epi8(l, _mm_set1_epi8(6)));
+
+    const __m128i nibbles = _mm_or_si128(
+        _mm_and_si128(isDigit, d), _mm_and_si128(isLetter, _mm_add_epi8(l, _mm_set1_epi8(10)))
+    );
+    // Each 16-bit lane holds the high nibble in its low byte and the low nibble in its high byte.
+    const __m128i bytes = _mm_or_si128(
+        _mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0xF0)), _mm_srli_epi16(nibbles, 8)
+    );
+    const __m128i packed = _mm_packus_epi16(bytes, bytes);
+    out[0] = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+    out[1] = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(packed, 4)));
+
+    const int valid = _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter));
+    return ((valid & 0xFF) == 0xFF ? 1 : 0) | ((valid & 0xFF00) == 0xFF00 ? 2 : 0);
+}
 
+Color colorFromBytes(uint32_t v) noexcept {
     return {
-        lerpChannel(a.red(), b.red()),
-        lerpChannel(a.green(), b.green()),
-        lerpChannel(a.blue(), b.blue()),
-        lerpChannel(a.alpha(), b.alpha())
+        static_cast<int>(v & 0xFF),
+        static_cast<int>((v >> 8) & 0xFF),
+        static_cast<int>((v >> 16) & 0xFF),
+        static_cast<int>(v >> 24)
     };
 }
+#endif
+} // namespace
 
+size_t Color::fromHexStrings(span<const string_view> strs, span<Color> out) noexcept {
+    const size_t count = std::min(strs.size(), out.size());
+    size_t parsed = 0;
+    size_t i = 0;
+#ifdef BIX_HEX_PARSE_SSE2
+    // Pairs of full form strings go through the vector decoder, anything else falls back to the scalar parser.
+    size_t pending = count;
+    string_view first;
+    for (; i < count; ++i) {
+        string_view digits = strs[i];
+        if (!fullFormDigits(digits)) {
+            out[i] = fromHexString(strs[i]);
+            parsed += out[i].isValid() ? 1u : 0u;
+            continue;
+        }
+        if (pending == count) {
+            pending = i;
+            first = digits;
+            continue;
+        }
+        uint32_t decoded[2];
+        const int valid = decodeHexPair(loadDigits(first), loadDigits(digits), decoded);
+        out[pending] = (valid & 1) != 0 ? colorFromBytes(decoded[0]) : Color();
+        out[i] = (valid & 2) != 0 ? colorFromBytes(decoded[1]) : Color();
+        parsed += static_cast<size_t>((valid & 1) + (valid >> 1));
+        pending = count;
+    }
+    if (pending != count) {
+        out[pending] = fromHexString(first);
+        parsed += out[pending].isValid() ? 1u : 0u;
+    }
+#else
+    for (; i < count; ++i) {
+        out[i] = fromHexString(strs[i]);
+        parsed += out[i].isValid() ? 1u : 0u;
+    }
+#endif
+    return parsed;
+}
 } // namespace bix
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/graphics/color.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BIX_COLOR_LERP_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+// Linear values are quantized to this many steps when encoding, fine enough to round trip every 8-bit value.
+constexpr int kLinearSteps = 4096;
+
+float decodeSrgb(float c) noexcept {
+    return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+float encodeSrgb(float c) noexcept {
+    return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+}
+
+struct SrgbTables {
+    float toLinear[256];
+    uint8_t fromLinear[kLinearSteps + 1];
+
+    SrgbTables() noexcept {
+        for (int i = 0; i < 256; ++i) { toLinear[i] = decodeSrgb(static_cast<float>(i) / 255.f); }
+        for (int i = 0; i <= kLinearSteps; ++i) {
+            const float encoded = encodeSrgb(static_cast<float>(i) / static_cast<float>(kLinearSteps));
+            fromLinear[i] = static_cast<uint8_t>(std::lround(std::clamp(encoded, 0.f, 1.f) * 255.f));
+        }
+    }
+};
+
+const SrgbTables& srgbTables() noexcept {
+    static const SrgbTables tables;
+    return tables;
+}
+
+int encodeChannel(const SrgbTables& tables, float linear) noexcept {
+    const float scaled = std::clamp(linear, 0.f, 1.f) * static_cast<float>(kLinearSteps);
+    return tables.fromLinear[static_cast<size_t>(scaled + 0.5f)];
+}
+
+// Maps a normalized component to [0, 255].
+int unitChannel(float v) noexcept {
+    return static_cast<int>(std::clamp(v, 0.f, 1.f) * 255.f + 0.5f);
+}
+
+float mix(float a, float b, float t) noexcept {
+    return a + (b - a) * t;
+}
+
+// Maps a factor to the [0, 256] weight of the integer blend.
+uint32_t blendWeight(float t) noexcept {
+    return static_cast<uint32_t>(std::clamp(t, 0.f, 1.f) * 256.f + 0.5f);
+}
+
+uint32_t pack(const Color& c) noexcept {
+    return static_cast<uint32_t>(c.red()) | static_cast<uint32_t>(c.green()) << 8
+           | static_cast<uint32_t>(c.blue()) << 16 | static_cast<uint32_t>(c.alpha()) << 24;
+}
+
+Color unpack(uint32_t v) noexcept {
+    return {
+        static_cast<int>(v & 0xFF),
+        static_cast<int>((v >> 8) & 0xFF),
+        static_cast<int>((v >> 16) & 0xFF),
+        static_cast<int>(v >> 24)
+    };
+}
+
+// Blends all four 8-bit channels, the sum of both products never exceeds 255 * 256 and fits 16-bit lanes.
+uint32_t blendPacked(uint32_t a, uint32_t b, uint32_t w) noexcept {
+    uint32_t out = 0;
+    for (uint32_t shift = 0; shift < 32; shift += 8) {
+        const uint32_t ca = (a >> shift) & 0xFF;
+        const uint32_t cb = (b >> shift) & 0xFF;
+        out |= ((ca * (256 - w) + cb * w + 128) >> 8) << shift;
+    }
+    return out;
+}
+
+#ifdef BIX_COLOR_LERP_SSE2
+// Same arithmetic as blendPacked() for four colors at once.
+void blendPacked4(const uint32_t* a, const uint32_t* b, uint32_t w, uint32_t* out) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i wb = _mm_set1_epi16(static_cast<short>(w));
+    const __m128i wa = _mm_set1_epi16(static_cast<short>(256 - w));
+    const __m128i half = _mm_set1_epi16(128);
+    const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+    const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+
+    auto blend = [&](__m128i ca, __m128i cb) {
+        const __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(ca, wa), _mm_mullo_epi16(cb, wb)), half);
+        return _mm_srli_epi16(sum, 8);
+    };
+    const __m128i lo = blend(_mm_unpacklo_epi8(va, zero), _mm_unpacklo_epi8(vb, zero));
+    const __m128i hi = blend(_mm_unpackhi_epi8(va, zero), _mm_unpackhi_epi8(vb, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(lo, hi));
+}
+#endif
+
+float hueOf(int r, int g, int b, int max, int delta) noexcept {
+    if (delta == 0) { return 0.f; }
+    const auto d = static_cast<float>(delta);
+    float h = 0.f;
+    if (max == r) {
+        h = static_cast<float>(g - b) / d;
+    } else if (max == g) {
+        h = static_cast<float>(b - r) / d + 2.f;
+    } else {
+        h = static_cast<float>(r - g) / d + 4.f;
+    }
+    h *= 60.f;
+    return h < 0.f ? h + 360.f : h;
+}
+
+// Builds a color from a hue, the chroma and the amount added to every component.
+Color fromHueChroma(float hue, float chroma, float m, float alpha) noexcept {
+    hue = std::fmod(hue, 360.f);
+    if (hue < 0.f) { hue += 360.f; }
+    const float sector = hue / 60.f;
+    const float x = chroma * (1.f - std::fabs(std::fmod(sector, 2.f) - 1.f));
+
+    float r = 0.f;
+    float g = 0.f;
+    float b = 0.f;
+    switch (std::min(static_cast<int>(sector), 5)) {
+    case 0: r = chroma; g = x; break;
+    case 1: r = x; g = chroma; break;
+    case 2: g = chroma; b = x; break;
+    case 3: g = x; b = chroma; break;
+    case 4: r = x; b = chroma; break;
+    default: r = chroma; b = x; break;
+    }
+    auto channel = [m](float v) { return unitChannel(v + m); };
+    return {channel(r), channel(g), channel(b), unitChannel(alpha)};
+}
+} // namespace
+
+Color Color::lerp(const Color& a, const Color& b, float t) noexcept {
+    return unpack(blendPacked(pack(a), pack(b), blendWeight(t)));
+}
+
+Color Color::lerp(const Color& a, const Color& b, float t, ColorInterpolation mode) noexcept {
+    t = std::clamp(t, 0.0f, 1.0f);
+    switch (mode) {
+    case ColorInterpolation::Linear: {
+        const LinearColor la = a.toLinear();
+        const LinearColor lb = b.toLinear();
+        return fromLinear({mix(la.r, lb.r, t), mix(la.g, lb.g, t), mix(la.b, lb.b, t), mix(la.a, lb.a, t)});
+    }
+    case ColorInterpolation::OkLab: {
+        const OkLabColor la = a.toOkLab();
+        const OkLabColor lb = b.toOkLab();
+        return fromOkLab({mix(la.l, lb.l, t), mix(la.a, lb.a, t), mix(la.b, lb.b, t), mix(la.alpha, lb.alpha, t)});
+    }
+    default: return lerp(a, b, t);
+    }
+}
+
+void Color::lerp(
+    span<const Color> from,
+    span<const Color> to,
+    float t,
+    span<Color> out,
+    ColorInterpolation mode
+) noexcept {
+    const size_t count = std::min({from.size(), to.size(), out.size()});
+    if (mode != ColorInterpolation::SRGB) {
+        for (size_t i = 0; i < count; ++i) { out[i] = lerp(from[i], to[i], t, mode); }
+        return;
+    }
+
+    const uint32_t w = blendWeight(t);
+    size_t i = 0;
+#ifdef BIX_COLOR_LERP_SSE2
+    for (; i + 4 <= count; i += 4) {
+        uint32_t a[4];
+        uint32_t b[4];
+        uint32_t blended[4];
+        for (size_t k = 0; k < 4; ++k) {
+            a[k] = pack(from[i + k]);
+            b[k] = pack(to[i + k]);
+        }
+        blendPacked4(a, b, w, blended);
+        for (size_t k = 0; k < 4; ++k) { out[i + k] = unpack(blended[k]); }
+    }
+#endif
+    for (; i < count; ++i) { out[i] = unpack(blendPacked(pack(from[i]), pack(to[i]), w)); }
+}
+
+Color Color::fromHsv(const HsvColor& hsv) noexcept {
+    const float v = std::clamp(hsv.v, 0.f, 1.f);
+    const float chroma = v * std::clamp(hsv.s, 0.f, 1.f);
+    return fromHueChroma(hsv.h, chroma, v - chroma, hsv.a);
+}
+
+Color Color::fromHsl(const HslColor& hsl) noexcept {
+    const float l = std::clamp(hsl.l, 0.f, 1.f);
+    const float chroma = (1.f - std::fabs(2.f * l - 1.f)) * std::clamp(hsl.s, 0.f, 1.f);
+    return fromHueChroma(hsl.h, chroma, l - chroma / 2.f, hsl.a);
+}
+
+Color Color::fromLinear(const LinearColor& linear) noexcept {
+    const SrgbTables& tables = srgbTables();
+    return {
+        encodeChannel(tables, linear.r),
+        encodeChannel(tables, linear.g),
+        encodeChannel(tables, linear.b),
+        unitChannel(linear.a)
+    };
+}
+
+Color Color::fromOkLab(const OkLabColor& lab) noexcept {
+    const float l = lab.l + 0.3963377774f * lab.a + 0.2158037573f * lab.b;
+    const float m = lab.l - 0.1055613458f * lab.a - 0.0638541728f * lab.b;
+    const float s = lab.l - 0.0894841775f * lab.a - 1.2914855480f * lab.b;
+    const float l3 = l * l * l;
+    const float m3 = m * m * m;
+    const float s3 = s * s * s;
+    return fromLinear({
+        4.0767416621f * l3 - 3.3077115913f * m3 + 0.2309699292f * s3,
+        -1.2684380046f * l3 + 2.6097574011f * m3 - 0.3413193965f * s3,
+        -0.0041960863f * l3 - 0.7034186147f * m3 + 1.7076147010f * s3,
+        lab.alpha
+    });
+}
+
+HsvColor Color::toHsv() const noexcept {
+    const int max = std::max({red(), green(), blue()});
+    const int delta = max - std::min({red(), green(), blue()});
+    return {
+        hueOf(red(), green(), blue(), max, delta),
+        max == 0 ? 0.f : static_cast<float>(delta) / static_cast<float>(max),
+        static_cast<float>(max) / 255.f,
+        alphaF()
+    };
+}
+
+HslColor Color::toHsl() const noexcept {
+    const int max = std::max({red(), green(), blue()});
+    const int min = std::min({red(), green(), blue()});
+    const int delta = max - min;
+    // With components in [0, 255] the saturation denominator 1 - |2l - 1| becomes 255 - |max + min - 255|.
+    const int denominator = 255 - std::abs(max + min - 255);
+    return {
+        hueOf(red(), green(), blue(), max, delta),
+        delta == 0 ? 0.f : static_cast<float>(delta) / static_cast<float>(denominator),
+        static_cast<float>(max + min) / 510.f,
+        alphaF()
+    };
+}
+
+LinearColor Color::toLinear() const noexcept {
+    const SrgbTables& tables = srgbTables();
+    return {tables.toLinear[mData[0]], tables.toLinear[mData[1]], tables.toLinear[mData[2]], alphaF()};
+}
+
+OkLabColor Color::toOkLab() const noexcept {
+    const LinearColor c = toLinear();
+    const float l = std::cbrt(0.4122214708f * c.r + 0.5363325363f * c.g + 0.0514459929f * c.b);
+    const float m = std::cbrt(0.2119034982f * c.r + 0.6806995451f * c.g + 0.1073969566f * c.b);
+    const float s = std::cbrt(0.0883024619f * c.r + 0.2817188376f * c.g + 0.6299787005f * c.b);
+    return {
+        0.2104542553f * l + 0.7936177850f * m - 0.0040720468f * s,
+        1.9779984951f * l - 2.4285922050f * m + 0.4505937099f * s,
+        0.0259040371f * l + 0.7827717662f * m - 0.8086757660f * s,
+        alphaF()
+    };
+}
+
+void Color::toLinear(span<const Color> src, span<LinearColor> dst) noexcept {
+    const SrgbTables& tables = srgbTables();
+    const size_t count = std::min(src.size(), dst.size());
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* c = src[i].mData;
+        dst[i] = {tables.toLinear[c[0]], tables.toLinear[c[1]], tables.toLinear[c[2]], src[i].alphaF()};
+    }
+}
+
+void Color::fromLinear(span<const LinearColor> src, span<Color> dst) noexcept {
+    const SrgbTables& tables = srgbTables();
+    const size_t count = std::min(src.size(), dst.size());
+    for (size_t i = 0; i < count; ++i) {
+        const LinearColor& c = src[i];
+        dst[i] = {
+            encodeChannel(tables, c.r),
+            encodeChannel(tables, c.g),
+            encodeChannel(tables, c.b),
+            unitChannel(c.a)
+        };
+    }
+}
+} // namespace bix
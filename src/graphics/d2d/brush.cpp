@@ -16,10 +16,60 @@
 
 #include "brush.h"
 
+#include "bixlib/utils/fmt_bix.h"
+
 #include "convert-inl.h"
 
+#include <vector>
+
 namespace bix {
 
+using namespace std;
+
+namespace {
+void throwIfD2DFailed(HRESULT hr, const string& msg) {
+    if (hr != S_OK) { throw runtime_error(fmt::format("D2D:{}, HRESULT:{}", msg, hr)); }
+}
+
+// Number of stops used to approximate an OkLab interpolated gradient, D2D only interpolates in sRGB or linear space.
+constexpr int kOkLabSamples = 32;
+
+D2D1_EXTEND_MODE convert_to_DExtendMode(GradientSpread spread) {
+    switch (spread) {
+    case GradientSpread::Repeat: return D2D1_EXTEND_MODE_WRAP;
+    case GradientSpread::Reflect: return D2D1_EXTEND_MODE_MIRROR;
+    default: return D2D1_EXTEND_MODE_CLAMP;
+    }
+}
+
+DGradientStopsPtr createStops(ID2D1RenderTarget* target, const Gradient& gradient) {
+    vector<D2D1_GRADIENT_STOP> stops;
+    if (gradient.interpolation() == ColorInterpolation::OkLab) {
+        stops.reserve(kOkLabSamples + 1);
+        for (int i = 0; i <= kOkLabSamples; ++i) {
+            const float offset = static_cast<float>(i) / kOkLabSamples;
+            stops.push_back({offset, convert_to_DColorF(gradient.colorAt(offset))});
+        }
+    } else {
+        stops.reserve(gradient.stops().size());
+        for (const auto& stop : gradient.stops()) { stops.push_back({stop.offset, convert_to_DColorF(stop.color)}); }
+    }
+    if (stops.empty()) { stops.push_back({0.f, {0.f, 0.f, 0.f, 0.f}}); }
+
+    const auto gamma = gradient.interpolation() == ColorInterpolation::SRGB ? D2D1_GAMMA_2_2 : D2D1_GAMMA_1_0;
+    ID2D1GradientStopCollection* collection = nullptr;
+    auto hr = target->CreateGradientStopCollection(
+        stops.data(),
+        static_cast<UINT32>(stops.size()),
+        gamma,
+        convert_to_DExtendMode(gradient.spread()),
+        &collection
+    );
+    throwIfD2DFailed(hr, "create gradient stops fail");
+    return DGradientStopsPtr(collection);
+}
+} // namespace
+
 void D2DSolidColorBrush::setColor(const Color& color) { mBrushImpl->SetColor(convert_to_DColorF(color)); }
 
 Color D2DSolidColorBrush::color() const noexcept {
@@ -28,4 +78,54 @@ Color D2DSolidColorBrush::color() const noexcept {
     return convert_from_DColor(color);
 }
 
+void D2DLinearGradientBrush::setPoints(const Point& start, const Point& end) {
+    LinearGradientBrush::setPoints(start, end);
+    if (mBrushImpl) {
+        mBrushImpl->SetStartPoint(convert_to_DPointF(start));
+        mBrushImpl->SetEndPoint(convert_to_DPointF(end));
+    }
+}
+
+ID2D1Brush* D2DLinearGradientBrush::prepare() {
+    if (!mBrushImpl) {
+        auto stops = createStops(mRenderTarget, gradient());
+        ID2D1LinearGradientBrush* brushPtr = nullptr;
+        auto hr = mRenderTarget->CreateLinearGradientBrush(
+            D2D1::LinearGradientBrushProperties(convert_to_DPointF(startPoint()), convert_to_DPointF(endPoint())),
+            stops.get(),
+            &brushPtr
+        );
+        throwIfD2DFailed(hr, "create linear gradient brush fail");
+        mBrushImpl.reset(brushPtr);
+    }
+    mBrushImpl->SetOpacity(opacity());
+    return mBrushImpl.get();
+}
+
+void D2DRadialGradientBrush::setEllipse(const Ellipse& ellipse) {
+    RadialGradientBrush::setEllipse(ellipse);
+    if (mBrushImpl) {
+        mBrushImpl->SetCenter(convert_to_DPointF(ellipse.center));
+        mBrushImpl->SetRadiusX(ellipse.radiusX);
+        mBrushImpl->SetRadiusY(ellipse.radiusY);
+    }
+}
+
+ID2D1Brush* D2DRadialGradientBrush::prepare() {
+    if (!mBrushImpl) {
+        auto stops = createStops(mRenderTarget, gradient());
+        const Ellipse& e = ellipse();
+        ID2D1RadialGradientBrush* brushPtr = nullptr;
+        auto hr = mRenderTarget->CreateRadialGradientBrush(
+            D2D1::RadialGradientBrushProperties(convert_to_DPointF(e.center), {0.f, 0.f}, e.radiusX, e.radiusY),
+            stops.get(),
+            &brushPtr
+        );
+        throwIfD2DFailed(hr, "create radial gradient brush fail");
+        mBrushImpl.reset(brushPtr);
+    }
+    mBrushImpl->SetOpacity(opacity());
+    return mBrushImpl.get();
+}
+
 } // namespace bix
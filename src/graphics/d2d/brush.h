@@ -63,12 +63,83 @@ protected:
     DSolidColorBrushPtr mBrushImpl = nullptr;
 };
 
-class D2DLinearGradientBrush {
+constexpr static long D2DGradientBrush_CAST_ID = 1766498213L;
+
+/**
+ * Gradient brush base keeping the parameters on the CPU and creating the native brush on first use.
+ *
+ * Changing the gradient drops the native brush since stop collections are immutable, geometry changes are applied
+ * to an existing native brush directly.
+ */
+template <DerivedFrom<GradientBrush> Base>
+class D2DGradientBrush : public Base {
 public:
+    bool testCast(uintptr_t scope, long castId) const noexcept override {
+        return scope == mScopeId && castId == D2DGradientBrush_CAST_ID;
+    }
+
+    void setGradient(Gradient gradient) override {
+        Base::setGradient(std::move(gradient));
+        dropNative();
+    }
+
+    /** Returns the native brush, creating it on first use. */
+    virtual ID2D1Brush* prepare() = 0;
+
+protected:
+    template <typename... Args>
+    D2DGradientBrush(ID2D1RenderTarget* renderTarget, uintptr_t scopeId, Args&&... args)
+        : Base(std::forward<Args>(args)...)
+        , mRenderTarget(renderTarget)
+        , mScopeId(scopeId) {}
+
+    virtual void dropNative() noexcept = 0;
+
+    ID2D1RenderTarget* mRenderTarget = nullptr;
+
+private:
+    const uintptr_t mScopeId;
+};
+
+class D2DLinearGradientBrush final : public D2DGradientBrush<LinearGradientBrush> {
+public:
+    D2DLinearGradientBrush(
+        ID2D1RenderTarget* renderTarget,
+        uintptr_t scopeId,
+        const Point& start,
+        const Point& end,
+        const Gradient& gradient
+    )
+        : D2DGradientBrush(renderTarget, scopeId, start, end, gradient) {}
+
+    void setPoints(const Point& start, const Point& end) override;
+    ID2D1Brush* prepare() override;
+
+protected:
+    void dropNative() noexcept override { mBrushImpl = nullptr; }
+
+private:
+    DLinearGradientBrushPtr mBrushImpl = nullptr;
 };
 
-class D2DRadialGradientBrush {
+class D2DRadialGradientBrush final : public D2DGradientBrush<RadialGradientBrush> {
 public:
+    D2DRadialGradientBrush(
+        ID2D1RenderTarget* renderTarget,
+        uintptr_t scopeId,
+        const Ellipse& ellipse,
+        const Gradient& gradient
+    )
+        : D2DGradientBrush(renderTarget, scopeId, ellipse, gradient) {}
+
+    void setEllipse(const Ellipse& ellipse) override;
+    ID2D1Brush* prepare() override;
+
+protected:
+    void dropNative() noexcept override { mBrushImpl = nullptr; }
+
+private:
+    DRadialGradientBrushPtr mBrushImpl = nullptr;
 };
 
 class D2DBitmapBrush {
@@ -26,29 +26,29 @@
 
 namespace bix {
 
-inline D2D1_POINT_2F convert_to_DPointF(const UIPoint& src) {
-    return {numeric_cast<float>(src.x), numeric_cast<float>(src.y)};
+inline D2D1_POINT_2F convert_to_DPointF(const Point& src) {
+    return {src.x, src.y};
 }
 
-inline D2D1_RECT_F convert_to_DRectF(const Rect<int>& src) {
+inline D2D1_RECT_F convert_to_DRectF(const RectI& src) {
     return {
-        numeric_cast<float>(src.x1),
-        numeric_cast<float>(src.y1),
-        numeric_cast<float>(src.x2),
-        numeric_cast<float>(src.y2)
+        static_cast<float>(src.left),
+        static_cast<float>(src.top),
+        static_cast<float>(src.right),
+        static_cast<float>(src.bottom)
     };
 }
 
-inline D2D1_RECT_F convert_to_DRectF(const Rect<float>& src) {
-    return {src.x1, src.y1, src.x2, src.y2};
+inline D2D1_RECT_F convert_to_DRectF(const Rect& src) {
+    return {src.left, src.top, src.right, src.bottom};
 }
 
-inline D2D1_ROUNDED_RECT convert_to_DRoundRect(const Rect<int>& src, int radiusX, int radiusY) {
-    return {convert_to_DRectF(src), numeric_cast<float>(radiusX), numeric_cast<float>(radiusY)};
+inline D2D1_ROUNDED_RECT convert_to_DRoundRect(const Rect& src, float radiusX, float radiusY) {
+    return {convert_to_DRectF(src), radiusX, radiusY};
 }
 
-inline D2D1_ELLIPSE convert_to_Ellipse(const Ellipse<int>& src) {
-    return {convert_to_DPointF(src.point), numeric_cast<float>(src.radiusX), numeric_cast<float>(src.radiusY)};
+inline D2D1_ELLIPSE convert_to_Ellipse(const Ellipse& src) {
+    return {convert_to_DPointF(src.center), src.radiusX, src.radiusY};
 }
 
 inline D2D1_COLOR_F convert_to_DColorF(const Color& src) {
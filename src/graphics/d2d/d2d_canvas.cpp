@@ -22,6 +22,10 @@
 #include "pen.h"
 #include "text_format.h"
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
 namespace bix {
 
 using namespace std;
@@ -30,15 +34,43 @@ inline void throwIfD2DFailed(HRESULT hr, const string& msg) {
     if (hr != S_OK) { throw runtime_error(fmt::format("D2D:{}, HRESULT:{}", msg, hr)); }
 }
 
+inline void hashCombine(size_t& seed, size_t value) noexcept {
+    seed ^= value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2);
+}
+
+bool ClipGeometryKey::operator==(const ClipGeometryKey& other) const noexcept {
+    return size == other.size && math::exactlyEqual(radii.topLeft, other.radii.topLeft)
+           && math::exactlyEqual(radii.topRight, other.radii.topRight)
+           && math::exactlyEqual(radii.bottomLeft, other.radii.bottomLeft)
+           && math::exactlyEqual(radii.bottomRight, other.radii.bottomRight);
+}
+
+size_t ClipGeometryKeyHash::operator()(const ClipGeometryKey& key) const noexcept {
+    size_t seed = 0;
+    for (const float v : {key.size.width, key.size.height, key.radii.topLeft, key.radii.topRight,
+                          key.radii.bottomLeft, key.radii.bottomRight}) {
+        hashCombine(seed, bit_cast<uint32_t>(v));
+    }
+    return seed;
+}
+
 D2DWindowTarget::D2DWindowTarget(DHwndRenderTargetPtr renderTarget, Direct2DEngine* engine)
     : mTarget(std::move(renderTarget))
     , mSafeScopeId(reinterpret_cast<uintptr_t>(mTarget.get())) {
 
     mWriteFactory = engine->writeFactory();
+    mTextCache = engine->textCache();
+
+    ID2D1SolidColorBrush* brushPtr = nullptr;
+    auto hr = mTarget->CreateSolidColorBrush(convert_to_DColorF(colors::Black), &brushPtr);
+    throwIfD2DFailed(hr, "create pen brush fail");
+    mPen = make_unique<D2DPen>(DSolidColorBrushPtr(brushPtr), engine);
 }
 
 void D2DWindowTarget::beginDraw() {
     mTarget->BeginDraw();
+    const auto [width, height] = mTarget->GetSize();
+    mClips.reset({0, 0, width, height});
 }
 
 DrawResult D2DWindowTarget::endDraw() {
@@ -53,9 +85,9 @@ void D2DWindowTarget::setTransform(const Transform& transform) {
     mTarget->SetTransform(convert_to_DMatrix(transform));
 }
 
-void D2DWindowTarget::resize(const UISize& size) {
+void D2DWindowTarget::resize(const Size& size) {
     // Changes the size of the render target to the specified pixel size.
-    auto hr = mTarget->Resize({numeric_cast<UINT32>(size.width), numeric_cast<UINT32>(size.height)});
+    auto hr = mTarget->Resize({math::round_cast<UINT32>(size.width), math::round_cast<UINT32>(size.height)});
     throwIfD2DFailed(hr, "resize error");
 }
 
@@ -63,61 +95,60 @@ void D2DWindowTarget::clear(const Color& c) {
     mTarget->Clear(convert_to_DColorF(c));
 }
 
-bool D2DWindowTarget::pushClip(const UIFlexRoundedRect& rect) {
-    assert(rect.isValid());
-
-    ClipHolder holder{false};
+bool D2DWindowTarget::pushClip(const RoundRect& rect) {
+    if (!rect.rect.isValid()) { return false; }
 
-    auto shape = rect.shape();
-    if (shape == ShapeType::Rectangle) {
-        mTarget->PushAxisAlignedClip(convert_to_DRectF(rect), D2D1_ANTIALIAS_MODE_PER_PRIMITIVE);
-        mClipStack.push(holder);
+    D2D1_MATRIX_3X2_F m{};
+    mTarget->GetTransform(&m);
+    const Transform transform(m._11, m._12, 0, m._21, m._22, 0, m._31, m._32, 1);
+    switch (mClips.push(rect, transform)) {
+    case ClipOp::Skip: return true;
+    case ClipOp::Intersect:
+        mTarget->PushAxisAlignedClip(convert_to_DRectF(rect.rect), D2D1_ANTIALIAS_MODE_PER_PRIMITIVE);
         return true;
+    case ClipOp::Mask: break;
     }
 
-    holder.isLayerClip = true;
-    ID2D1Geometry* geometricMask = nullptr;
-    ID2D1Factory* factoryPtr = nullptr;
-    mTarget->GetFactory(&factoryPtr);
-
-    if (shape == ShapeType::RoundedRectangle || shape == ShapeType::Ellipse) {
-
-        D2D1_ROUNDED_RECT tmp(
-            convert_to_DRectF(rect),
-            static_cast<float>(rect.tl.radiusX),
-            static_cast<float>(rect.tl.radiusY)
-        );
-        ID2D1RoundedRectangleGeometry* geometry = nullptr;
-        auto hr = factoryPtr->CreateRoundedRectangleGeometry(tmp, &geometry);
-        throwIfD2DFailed(hr, "create geometry error");
-        geometricMask = geometry;
-    }
-
-    if (geometricMask == nullptr) { return false; }
-
+    // The cached geometry sits at the origin, the mask transform moves it into place.
     mTarget->PushLayer(
         D2D1_LAYER_PARAMETERS(
             D2D1::InfiniteRect(),
-            geometricMask,
+            clipGeometry(rect),
             D2D1_ANTIALIAS_MODE_PER_PRIMITIVE,
-            D2D1::IdentityMatrix(),
+            D2D1::Matrix3x2F::Translation(rect.rect.left, rect.rect.top),
             1.0
         ),
         nullptr
     );
-    mClipStack.push(holder);
-    geometricMask->Release();
     return true;
 }
 
-void D2DWindowTarget::popClip() {
-    if (mClipStack.empty()) { throw std::runtime_error("pop clip fail,clip stack empty"); }
-    auto [isLayerClip] = mClipStack.top();
-    mClipStack.pop();
-    if (isLayerClip) {
-        mTarget->PopLayer();
+ID2D1Geometry* D2DWindowTarget::clipGeometry(const RoundRect& clip) {
+    const ClipGeometryKey key{clip.rect.size(), clip.radii};
+    if (DGeometryPtr* cached = mClipGeometries.find(key)) { return cached->get(); }
+
+    const RoundRect local(Rect(0, 0, key.size.width, key.size.height), clip.radii);
+    ID2D1Geometry* geometry = nullptr;
+    if (clip.radii.isUniform()) {
+        ID2D1Factory* factoryPtr = nullptr;
+        mTarget->GetFactory(&factoryPtr);
+        const DFactorPtr factory(factoryPtr);
+        ID2D1RoundedRectangleGeometry* rounded = nullptr;
+        const D2D1_ROUNDED_RECT shape = convert_to_DRoundRect(local.rect, clip.radii.topLeft, clip.radii.topLeft);
+        throwIfD2DFailed(factory->CreateRoundedRectangleGeometry(shape, &rounded), "create geometry error");
+        geometry = rounded;
     } else {
-        mTarget->PopAxisAlignedClip();
+        // D2D rounded rectangles only support a single radius, mixed corners need a path geometry.
+        geometry = pathGeometry(Path().addRoundRect(local)).release();
+    }
+    return mClipGeometries.insert(key, DGeometryPtr(geometry)).get();
+}
+
+void D2DWindowTarget::popClip() {
+    switch (mClips.pop()) {
+    case ClipOp::Skip: break;
+    case ClipOp::Intersect: mTarget->PopAxisAlignedClip(); break;
+    case ClipOp::Mask: mTarget->PopLayer(); break;
     }
 }
 
@@ -126,37 +157,210 @@ SizeF D2DWindowTarget::size() const noexcept {
     return {width, height};
 }
 
-void D2DWindowTarget::fillRectangle(const UIRect& rect, Brush& brush) {
-    assert(brush.testCast(mSafeScopeId, D2DBasicBrush_CAST_ID));
-    auto brushPtr = static_cast<D2DBasicBrush<>*>(&brush)->native();
+ID2D1Brush* D2DWindowTarget::nativeBrush(Brush& brush) {
+    switch (brush.style()) {
+    case BrushStyle::SolidColor:
+        assert(brush.testCast(mSafeScopeId, D2DBasicBrush_CAST_ID));
+        return static_cast<D2DBasicBrush<>*>(&brush)->native();
+    case BrushStyle::LinearGradient:
+        assert(brush.testCast(mSafeScopeId, D2DGradientBrush_CAST_ID));
+        return static_cast<D2DLinearGradientBrush*>(&brush)->prepare();
+    case BrushStyle::RadialGradient:
+        assert(brush.testCast(mSafeScopeId, D2DGradientBrush_CAST_ID));
+        return static_cast<D2DRadialGradientBrush*>(&brush)->prepare();
+    default: return nullptr;
+    }
+}
+
+void D2DWindowTarget::fillRectangle(const Rect& rect, Brush& brush) {
+    if (ID2D1Brush* brushPtr = nativeBrush(brush)) { mTarget->FillRectangle(convert_to_DRectF(rect), brushPtr); }
+}
+
+void D2DWindowTarget::fillRects(span<const Rect> rects, Brush& brush) {
+    // The render target has no batched fill, the brush is resolved once and D2D batches the primitives itself.
+    ID2D1Brush* brushPtr = nativeBrush(brush);
+    if (!brushPtr) { return; }
+    for (const Rect& rect : rects) { mTarget->FillRectangle(convert_to_DRectF(rect), brushPtr); }
+}
+
+DPathGeometryPtr D2DWindowTarget::pathGeometry(const Path& path) {
+    ID2D1Factory* factoryPtr = nullptr;
+    mTarget->GetFactory(&factoryPtr);
+    const DFactorPtr factory(factoryPtr);
+    ID2D1PathGeometry* geometryPtr = nullptr;
+    throwIfD2DFailed(factory->CreatePathGeometry(&geometryPtr), "create path geometry error");
+    DPathGeometryPtr geometry(geometryPtr);
+    ID2D1GeometrySink* sink = nullptr;
+    throwIfD2DFailed(geometry->Open(&sink), "open path geometry error");
+    sink->SetFillMode(path.fillRule() == FillRule::EvenOdd ? D2D1_FILL_MODE_ALTERNATE : D2D1_FILL_MODE_WINDING);
+
+    // D2D curves are flattened by the device, the path is converted verb by verb.
+    bool open = false;
+    const Point* p = path.points().data();
+    for (const PathVerb verb : path.verbs()) {
+        switch (verb) {
+        case PathVerb::Move:
+            if (open) { sink->EndFigure(D2D1_FIGURE_END_OPEN); }
+            sink->BeginFigure(convert_to_DPointF(*p++), D2D1_FIGURE_BEGIN_FILLED);
+            open = true;
+            break;
+        case PathVerb::Line: sink->AddLine(convert_to_DPointF(*p++)); break;
+        case PathVerb::Quad:
+            sink->AddQuadraticBezier(D2D1::QuadraticBezierSegment(convert_to_DPointF(p[0]), convert_to_DPointF(p[1])));
+            p += 2;
+            break;
+        case PathVerb::Cubic:
+            sink->AddBezier(
+                D2D1::BezierSegment(convert_to_DPointF(p[0]), convert_to_DPointF(p[1]), convert_to_DPointF(p[2]))
+            );
+            p += 3;
+            break;
+        case PathVerb::Close:
+            sink->EndFigure(D2D1_FIGURE_END_CLOSED);
+            open = false;
+            break;
+        }
+    }
+    if (open) { sink->EndFigure(D2D1_FIGURE_END_OPEN); }
+    const HRESULT hr = sink->Close();
+    sink->Release();
+    throwIfD2DFailed(hr, "close path geometry error");
+    return geometry;
+}
+
+void D2DWindowTarget::fillPath(const Path& path, Brush& brush) {
+    if (path.isEmpty()) { return; }
+    ID2D1Brush* brushPtr = nativeBrush(brush);
+    if (!brushPtr) { return; }
+    mTarget->FillGeometry(pathGeometry(path).get(), brushPtr);
+}
+
+void D2DWindowTarget::fillRoundRect(const RoundRect& rect, Brush& brush) {
+    ID2D1Brush* brushPtr = nativeBrush(brush);
+    if (!brushPtr || !rect.rect.isValid()) { return; }
+    const CornerRadius& r = rect.radii;
+    if (r.isUniform()) {
+        mTarget->FillRoundedRectangle(convert_to_DRoundRect(rect.rect, r.topLeft, r.topLeft), brushPtr);
+        return;
+    }
+    // D2D rounded rectangles only support a single radius, mixed corners need a path geometry.
+    mTarget->FillGeometry(pathGeometry(Path().addRoundRect(rect)).get(), brushPtr);
+}
+
+void D2DWindowTarget::fillEllipse(const Ellipse& ellipse, Brush& brush) {
+    if (ID2D1Brush* brushPtr = nativeBrush(brush)) { mTarget->FillEllipse(convert_to_Ellipse(ellipse), brushPtr); }
+}
 
-    mTarget->FillRectangle(convert_to_DRectF(rect), brushPtr);
+void D2DWindowTarget::drawBitmap(
+    const Bitmap& bitmap,
+    const Rect& src,
+    const Rect& dst,
+    float opacity,
+    BitmapSampling sampling
+) {
+    if (bitmap.isEmpty() || src.isEmpty() || dst.isEmpty()) { return; }
+    const Rect bounds(0, 0, static_cast<float>(bitmap.width()), static_cast<float>(bitmap.height()));
+    const Rect clipped = src.intersected(bounds);
+    if (clipped.isEmpty()) { return; }
+    // Parts of the region outside of the bitmap are cut from the destination as well.
+    const float sx = dst.width() / src.width();
+    const float sy = dst.height() / src.height();
+    const Rect target(
+        dst.left + (clipped.left - src.left) * sx,
+        dst.top + (clipped.top - src.top) * sy,
+        dst.right - (src.right - clipped.right) * sx,
+        dst.bottom - (src.bottom - clipped.bottom) * sy
+    );
+
+    // D2D does not mip bitmaps, downscaled immutable bitmaps are drawn from the level closest to the drawn size.
+    D2D1_MATRIX_3X2_F m{};
+    mTarget->GetTransform(&m);
+    const float scale = std::min(
+        target.width() * std::hypot(m._11, m._12) / clipped.width(),
+        target.height() * std::hypot(m._21, m._22) / clipped.height()
+    );
+    const size_t level = bitmap.mipLevelFor(scale);
+    const Bitmap& sampled = bitmap.mipLevel(level);
+    const float fx = static_cast<float>(sampled.width()) / static_cast<float>(bitmap.width());
+    const float fy = static_cast<float>(sampled.height()) / static_cast<float>(bitmap.height());
+    const D2D1_RECT_F source{clipped.left * fx, clipped.top * fy, clipped.right * fx, clipped.bottom * fy};
+
+    const auto mode = sampling == BitmapSampling::Nearest ? D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR
+                                                          : D2D1_BITMAP_INTERPOLATION_MODE_LINEAR;
+    mTarget->DrawBitmap(
+        prepareBitmap(bitmap, level),
+        convert_to_DRectF(target),
+        std::clamp(opacity, 0.f, 1.f),
+        mode,
+        &source
+    );
+}
+
+ID2D1Bitmap* D2DWindowTarget::prepareBitmap(const Bitmap& bitmap, size_t level) {
+    // Levels never exceed 32, the low bits of the key hold the level.
+    const uint64_t key = bitmap.id() << 6 | level;
+    if (auto* cached = mBitmaps.find(key)) { return cached->get(); }
+
+    const Bitmap& sampled = bitmap.mipLevel(level);
+    const Bitmap upload = sampled.format() == PixelFormat::BGRA8Premultiplied
+                              ? sampled
+                              : sampled.copy(PixelFormat::BGRA8Premultiplied);
+    const auto props = D2D1::BitmapProperties(
+        D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED)
+    );
+    ID2D1Bitmap* bitmapPtr = nullptr;
+    auto hr = mTarget->CreateBitmap(
+        D2D1::SizeU(static_cast<UINT32>(upload.width()), static_cast<UINT32>(upload.height())),
+        upload.data(),
+        static_cast<UINT32>(upload.stride()),
+        props,
+        &bitmapPtr
+    );
+    throwIfD2DFailed(hr, "create bitmap fail");
+    return mBitmaps.insert(key, DBitmapPtr(bitmapPtr)).get();
 }
 
-void D2DWindowTarget::drawRectangle(const UIRect& rect, Pen& pen) {
-    assert(pen.testCast(mSafeScopeId, D2DPen_CAST_ID));
-    auto penPtr = static_cast<D2DPen*>(&pen)->prepare();
-    auto width = numeric_cast<float>(penPtr->strokeWidth());
-    mTarget->DrawRectangle(convert_to_DRectF(rect), penPtr->brush(), width, penPtr->strokeStyle());
+void D2DWindowTarget::drawRectangle(const Rect& rect, const Pen& pen) {
+    auto penPtr = mPen->prepare(pen);
+    mTarget->DrawRectangle(convert_to_DRectF(rect), penPtr->brush(), penPtr->strokeWidth(), penPtr->strokeStyle());
 }
 
-void D2DWindowTarget::drawRoundRect(const UIRect& rect, int radiusX, int radiusY, Pen& pen) {
-    assert(pen.testCast(mSafeScopeId, D2DPen_CAST_ID));
-    auto penPtr = static_cast<D2DPen*>(&pen)->prepare();
-    auto width = numeric_cast<float>(penPtr->strokeWidth());
+void D2DWindowTarget::drawRects(span<const Rect> rects, const Pen& pen) {
+    auto penPtr = mPen->prepare(pen);
+    for (const Rect& rect : rects) {
+        mTarget->DrawRectangle(convert_to_DRectF(rect), penPtr->brush(), penPtr->strokeWidth(), penPtr->strokeStyle());
+    }
+}
+
+void D2DWindowTarget::drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) {
+    auto penPtr = mPen->prepare(pen);
     mTarget->DrawRoundedRectangle(
         convert_to_DRoundRect(rect, radiusX, radiusY),
         penPtr->brush(),
-        width,
+        penPtr->strokeWidth(),
+        penPtr->strokeStyle()
+    );
+}
+
+void D2DWindowTarget::drawRoundRect(const RoundRect& rect, const Pen& pen) {
+    if (!rect.rect.isValid()) { return; }
+    const CornerRadius& r = rect.radii;
+    if (r.isUniform()) {
+        drawRoundRect(rect.rect, r.topLeft, r.topLeft, pen);
+        return;
+    }
+    auto penPtr = mPen->prepare(pen);
+    mTarget->DrawGeometry(
+        pathGeometry(Path().addRoundRect(rect)).get(),
+        penPtr->brush(),
+        penPtr->strokeWidth(),
         penPtr->strokeStyle()
     );
 }
 
-void D2DWindowTarget::drawEllipse(const UIEllipse& ellipse, Pen& pen) {
-    assert(pen.testCast(mSafeScopeId, D2DPen_CAST_ID));
-    auto penPtr = static_cast<D2DPen*>(&pen)->prepare();
-    auto width = numeric_cast<float>(penPtr->strokeWidth());
-    mTarget->DrawEllipse(convert_to_Ellipse(ellipse), penPtr->brush(), width, penPtr->strokeStyle());
+void D2DWindowTarget::drawEllipse(const Ellipse& ellipse, const Pen& pen) {
+    auto penPtr = mPen->prepare(pen);
+    mTarget->DrawEllipse(convert_to_Ellipse(ellipse), penPtr->brush(), penPtr->strokeWidth(), penPtr->strokeStyle());
 }
 
 void D2DWindowTarget::measureText(TextPaint& format, TextMetrics& metrics) {
@@ -179,39 +383,33 @@ void D2DWindowTarget::measureText(TextPaint& format, TextMetrics& metrics) {
     metrics.lineCount = static_cast<int>(textMetrics.lineCount);
 }
 
-void D2DWindowTarget::drawText(const UIPoint& origin, TextPaint& text, Pen& pen) {
-    assert(pen.testCast(mSafeScopeId, D2DPen_CAST_ID));
+void D2DWindowTarget::drawText(const Point& origin, TextPaint& text, const Pen& pen) {
     assert(text.testCast(mSafeScopeId, D2DTextFormat_CAST_ID));
-    auto penPtr = static_cast<D2DPen*>(&pen)->prepare();
+    auto penPtr = mPen->prepare(pen);
     auto textPtr = static_cast<D2DTextFormat*>(&text)->prepare();
     mTarget
         ->DrawTextLayout(convert_to_DPointF(origin), textPtr->layout(), penPtr->brush(), D2D1_DRAW_TEXT_OPTIONS_CLIP);
 }
 
-void D2DWindowTarget::drawLine(const UILine& line, Pen& pen) {
-    assert(pen.testCast(mSafeScopeId, D2DPen_CAST_ID));
-    auto penPtr = static_cast<D2DPen*>(&pen)->prepare();
-    auto width = numeric_cast<float>(penPtr->strokeWidth());
+void D2DWindowTarget::drawLine(const geom::Line& line, const Pen& pen) {
+    auto penPtr = mPen->prepare(pen);
     mTarget->DrawLine(
-        convert_to_DPointF(line.p0),
-        convert_to_DPointF(line.p1),
+        convert_to_DPointF(line.start),
+        convert_to_DPointF(line.end),
         penPtr->brush(),
-        width,
+        penPtr->strokeWidth(),
         penPtr->strokeStyle()
     );
 }
 
-void D2DWindowTarget::drawLines(const vector<UILine>& lines, Pen& pen) {
-    assert(pen.testCast(mSafeScopeId, D2DPen_CAST_ID));
-    auto penPtr = static_cast<D2DPen*>(&pen)->prepare();
-    auto width = numeric_cast<float>(penPtr->strokeWidth());
-
+void D2DWindowTarget::drawLines(span<const geom::Line> lines, const Pen& pen) {
+    auto penPtr = mPen->prepare(pen);
     for (const auto& line : lines) {
         mTarget->DrawLine(
-            convert_to_DPointF(line.p0),
-            convert_to_DPointF(line.p1),
+            convert_to_DPointF(line.start),
+            convert_to_DPointF(line.end),
             penPtr->brush(),
-            width,
+            penPtr->strokeWidth(),
             penPtr->strokeStyle()
         );
     }
@@ -224,14 +422,31 @@ ColorBrushPtr D2DWindowTarget::createColorBrush(const Color& color) {
     return std::make_unique<D2DSolidColorBrush>(DSolidColorBrushPtr(brushPtr), mTarget.get(), mSafeScopeId);
 }
 
-PenPtr D2DWindowTarget::createPen(const Color& color) {
-    ID2D1SolidColorBrush* brushPtr = nullptr;
-    auto hr = mTarget->CreateSolidColorBrush(convert_to_DColorF(color), &brushPtr);
-    throwIfD2DFailed(hr, "create pen fail");
-    return std::make_unique<D2DPen>(DSolidColorBrushPtr(brushPtr), color, mSafeScopeId);
+LinearGradientBrushPtr D2DWindowTarget::createLinearGradientBrush(
+    const Point& start,
+    const Point& end,
+    const Gradient& gradient
+) {
+    return make_unique<D2DLinearGradientBrush>(mTarget.get(), mSafeScopeId, start, end, gradient);
+}
+
+RadialGradientBrushPtr D2DWindowTarget::createRadialGradientBrush(const Ellipse& ellipse, const Gradient& gradient) {
+    return make_unique<D2DRadialGradientBrush>(mTarget.get(), mSafeScopeId, ellipse, gradient);
+}
+
+ConicGradientBrushPtr D2DWindowTarget::createConicGradientBrush(
+    const Point& center,
+    float startAngle,
+    const Gradient& gradient
+) {
+    // Direct2D has no sweep gradient brush.
+    BIX_UNUSED(center)
+    BIX_UNUSED(startAngle)
+    BIX_UNUSED(gradient)
+    return nullptr;
 }
 
 TextPaintPtr D2DWindowTarget::createTextPaint() {
-    return make_unique<D2DTextFormat>(mWriteFactory, mSafeScopeId, 1);
+    return make_unique<D2DTextFormat>(mWriteFactory, mTextCache, mSafeScopeId, 1);
 }
 } // namespace bix
\ No newline at end of file
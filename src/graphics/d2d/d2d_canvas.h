@@ -15,18 +15,24 @@
  */
 
 #pragma once
+#include "bixlib/graphics/clip_stack.h"
+#include "bixlib/utils/lru_cache.h"
+
 #include "engine.h"
+#include "pen.h"
 
 namespace bix {
 
-enum class ClipType {
-    AlignedClip,
-    Layer
+// A rounded clip moved to the origin, clips of the same size and radii share one geometry.
+struct ClipGeometryKey {
+    Size size;
+    CornerRadius radii;
+
+    bool operator==(const ClipGeometryKey& other) const noexcept;
 };
 
-class ClipHolder {
-public:
-    bool isLayerClip = false;
+struct ClipGeometryKeyHash {
+    size_t operator()(const ClipGeometryKey& key) const noexcept;
 };
 
 // https://learn.microsoft.com/zh-cn/windows/win32/learnwin32/dpi-and-device-independent-pixels?redirectedfrom=MSDN
@@ -35,35 +41,76 @@ public:
     D2DWindowTarget(DHwndRenderTargetPtr renderTarget, Direct2DEngine* engine);
 
     [[nodiscard]] ColorBrushPtr createColorBrush(const Color& color) override;
-    [[nodiscard]] PenPtr createPen(const Color& color) override;
+    [[nodiscard]] LinearGradientBrushPtr createLinearGradientBrush(
+        const Point& start,
+        const Point& end,
+        const Gradient& gradient
+    ) override;
+    [[nodiscard]] RadialGradientBrushPtr createRadialGradientBrush(
+        const Ellipse& ellipse,
+        const Gradient& gradient
+    ) override;
+    [[nodiscard]] ConicGradientBrushPtr createConicGradientBrush(
+        const Point& center,
+        float startAngle,
+        const Gradient& gradient
+    ) override;
     [[nodiscard]] TextPaintPtr createTextPaint() override;
 
     void beginDraw() override;
     DrawResult endDraw() override;
     void setTransform(const Transform& transform) override;
-    void resize(const UISize& size) override;
+    void resize(const Size& size) override;
     void clear(const Color& c) override;
-    bool pushClip(const UIFlexRoundedRect& rect) override;
+    bool pushClip(const RoundRect& rect) override;
     void popClip() override;
     SizeF size() const noexcept override;
-    void fillRectangle(const UIRect& rect, Brush& brush) override;
-    void drawRectangle(const UIRect& rect, Pen& pen) override;
-    void drawRoundRect(const UIRect& rect, int radiusX, int radiusY, Pen& pen) override;
-    void drawEllipse(const UIEllipse& ellipse, Pen& pen) override;
+    void fillRectangle(const Rect& rect, Brush& brush) override;
+    void fillRects(std::span<const Rect> rects, Brush& brush) override;
+    void fillPath(const Path& path, Brush& brush) override;
+    void fillRoundRect(const RoundRect& rect, Brush& brush) override;
+    void fillEllipse(const Ellipse& ellipse, Brush& brush) override;
+    void drawBitmap(
+        const Bitmap& bitmap,
+        const Rect& src,
+        const Rect& dst,
+        float opacity,
+        BitmapSampling sampling
+    ) override;
+    void drawRectangle(const Rect& rect, const Pen& pen) override;
+    void drawRects(std::span<const Rect> rects, const Pen& pen) override;
+    void drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) override;
+    void drawRoundRect(const RoundRect& rect, const Pen& pen) override;
+    void drawEllipse(const Ellipse& ellipse, const Pen& pen) override;
     void measureText(TextPaint& format, TextMetrics& metrics) override;
-    void drawText(const UIPoint& origin, TextPaint& text, Pen& pen) override;
-    void drawLine(const UILine& line, Pen& pen) override;
-    void drawLines(const std::vector<UILine>& lines, Pen& pen) override;
+    void drawText(const Point& origin, TextPaint& text, const Pen& pen) override;
+    void drawLine(const geom::Line& line, const Pen& pen) override;
+    void drawLines(std::span<const geom::Line> lines, const Pen& pen) override;
 
 protected:
     DHwndRenderTargetPtr mTarget = nullptr;
     const uintptr_t mSafeScopeId;
 
     IDWriteFactory* mWriteFactory = nullptr;
+    D2DTextCachePtr mTextCache = nullptr;
     DLayerPtr mCurrentLayer = nullptr;
+    std::unique_ptr<D2DPen> mPen;
 
 private:
-    std::stack<ClipHolder> mClipStack;
+    // Returns the native brush of a brush created by this canvas, or nullptr for unsupported styles.
+    ID2D1Brush* nativeBrush(Brush& brush);
+    // Converts a path into a new native geometry.
+    DPathGeometryPtr pathGeometry(const Path& path);
+    // Returns the cached geometry of a rounded clip at the origin, creating it on first use.
+    ID2D1Geometry* clipGeometry(const RoundRect& clip);
+    // Returns the uploaded copy of a bitmap mip level, uploading it on first use.
+    ID2D1Bitmap* prepareBitmap(const Bitmap& bitmap, size_t level);
+
+    // Decides which clips need an axis-aligned clip or a layer, clips containing the current clip are skipped.
+    ClipStack mClips;
+    LruCache<ClipGeometryKey, DGeometryPtr, ClipGeometryKeyHash> mClipGeometries{32};
+    // Uploaded bitmaps keyed by the bitmap id and mip level, stale ids of modified bitmaps age out.
+    LruCache<uint64_t, DBitmapPtr> mBitmaps{128};
 };
 
 } // namespace bix
\ No newline at end of file
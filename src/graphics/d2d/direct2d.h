@@ -34,10 +34,16 @@ using DFactorPtr = std::unique_ptr<ID2D1Factory, IUnknownDeleter>;
 using DWriteFactoryPtr = std::unique_ptr<IDWriteFactory, IUnknownDeleter>;
 using DBrushPtr = std::unique_ptr<ID2D1Brush, IUnknownDeleter>;
 using DSolidColorBrushPtr = std::unique_ptr<ID2D1SolidColorBrush, IUnknownDeleter>;
+using DLinearGradientBrushPtr = std::unique_ptr<ID2D1LinearGradientBrush, IUnknownDeleter>;
+using DRadialGradientBrushPtr = std::unique_ptr<ID2D1RadialGradientBrush, IUnknownDeleter>;
+using DGradientStopsPtr = std::unique_ptr<ID2D1GradientStopCollection, IUnknownDeleter>;
+using DBitmapPtr = std::unique_ptr<ID2D1Bitmap, IUnknownDeleter>;
 using DHwndRenderTargetPtr = std::unique_ptr<ID2D1HwndRenderTarget, IUnknownDeleter>;
 using DWriteTextFormatPtr = std::unique_ptr<IDWriteTextFormat, IUnknownDeleter>;
 using DWriteTextLayoutPtr = std::unique_ptr<IDWriteTextLayout, IUnknownDeleter>;
 using DStrokeStylePtr = std::unique_ptr<ID2D1StrokeStyle, IUnknownDeleter>;
+using DPathGeometryPtr = std::unique_ptr<ID2D1PathGeometry, IUnknownDeleter>;
+using DGeometryPtr = std::unique_ptr<ID2D1Geometry, IUnknownDeleter>;
 using DLayerPtr = std::unique_ptr<ID2D1Layer, IUnknownDeleter>;
 using DWInlineObjPtr = std::unique_ptr<IDWriteInlineObject, IUnknownDeleter>;
 
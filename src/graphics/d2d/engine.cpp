@@ -20,6 +20,7 @@
 
 #include "convert-inl.h"
 #include "d2d_canvas.h"
+#include "pen.h"
 
 namespace bix {
 
@@ -30,6 +31,9 @@ Direct2DEngine::~Direct2DEngine() {
 }
 
 void Direct2DEngine::shutdown() noexcept {
+    // Cached layouts hold DirectWrite objects and must go before the factory.
+    if (mTextCache) { mTextCache->clear(); }
+    mStrokeStyles.clear();
     mDWriteFactory = nullptr;
     mD2DFactory = nullptr;
 }
@@ -105,6 +109,22 @@ IDWriteFactory* Direct2DEngine::writeFactory() const noexcept {
     return mDWriteFactory.get();
 }
 
+const D2DTextCachePtr& Direct2DEngine::textCache() const noexcept {
+    return mTextCache;
+}
+
+ID2D1StrokeStyle* Direct2DEngine::strokeStyle(const StrokeStyle& stroke) {
+    // Key on a fixed width, the width is passed to every draw call separately.
+    StrokeStyle key = stroke.withWidth(1.f);
+    if (auto it = mStrokeStyles.find(key); it != mStrokeStyles.end()) { return it->second.get(); }
+    if (!mD2DFactory) { return nullptr; }
+    auto native = createD2DStrokeStyle(mD2DFactory.get(), key);
+    ID2D1StrokeStyle* result = native.get();
+    // Failures are not cached, a null stroke style draws solid lines.
+    if (native) { mStrokeStyles.emplace(std::move(key), std::move(native)); }
+    return result;
+}
+
 Direct2DEngine::Direct2DEngine() {
     // Create a Direct2D factory.
 
@@ -126,5 +146,7 @@ Direct2DEngine::Direct2DEngine() {
         reinterpret_cast<IUnknown**>(&wfactory)
     );
     if (hr == S_OK) { mDWriteFactory = DWriteFactoryPtr(wfactory); }
+
+    mTextCache = make_shared<TextLayoutCache<D2DTextLayout>>();
 }
 } // namespace bix
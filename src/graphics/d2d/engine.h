@@ -17,8 +17,12 @@
 #pragma once
 
 #include "bixlib/graphics/engine.h"
+#include "bixlib/graphics/stroke_style.h"
 
 #include "direct2d.h"
+#include "text_format.h"
+
+#include <unordered_map>
 
 namespace bix {
 
@@ -41,9 +45,21 @@ public:
 
     IDWriteFactory* writeFactory() const noexcept;
 
+    /** Returns the text layout cache shared by all canvases of this engine. */
+    const D2DTextCachePtr& textCache() const noexcept;
+
+    /**
+     * Returns the native stroke style shared by all canvases of this engine, creating it on first use.
+     * Native styles do not include the width, strokes differing only in width share one object. The returned
+     * pointer stays valid until shutdown().
+     */
+    ID2D1StrokeStyle* strokeStyle(const StrokeStyle& stroke);
+
 protected:
     DFactorPtr mD2DFactory = nullptr;
     DWriteFactoryPtr mDWriteFactory = nullptr;
+    D2DTextCachePtr mTextCache = nullptr;
+    std::unordered_map<StrokeStyle, DStrokeStylePtr, StrokeStyleHash> mStrokeStyles;
 
 private:
     Direct2DEngine();
@@ -17,6 +17,7 @@
 #include "pen.h"
 
 #include "convert-inl.h"
+#include "engine.h"
 
 using namespace std;
 
@@ -53,89 +54,46 @@ D2D1_LINE_JOIN convert_toLineJoinStyle(LineJoinStyle s) {
     }
 }
 
-D2DPen::D2DPen(DSolidColorBrushPtr brush, const Color& c, uintptr_t scopeId)
-    : mBrush(std::move(brush))
-    , mColor(c)
-    , mScopeId(scopeId) {}
-
-void D2DPen::setStrokeWidth(int w) {
-    mStrokeWidth = w;
-}
-
-void D2DPen::setColor(const Color& c) {
-    mColor = c;
-    mBrush->SetColor(convert_to_DColorF(c));
-}
-
-void D2DPen::setMiterLimit(float limit) {
-    if (limit < 1.f) { return; }
-    mMiterLimit = limit;
-    mStrokeStyle = nullptr;
-}
-
-void D2DPen::setDashOffset(float dashOffset) {
-    if (dashOffset < 0.f || fuzzyCompareEqual<float, 2>(mDashOffset, dashOffset)) { return; }
-    mDashOffset = dashOffset;
-    mStrokeStyle = nullptr;
-}
-
-void D2DPen::setLineStyle(LineStyle style) {
-    if (style == mLineStyle) { return; }
-    mLineStyle = style;
-    mStrokeStyle = nullptr;
-}
-
-void D2DPen::setLineJoin(LineJoinStyle lineJoin) {
-    if (lineJoin == mJoinStyle) { return; }
-    mJoinStyle = lineJoin;
-    mStrokeStyle = nullptr;
-}
-
-void D2DPen::setLineCap(CapStyle start, CapStyle end, CapStyle dash) {
-    setStartCap(start);
-    setEndCap(end);
-    setDashCap(dash);
-}
-
-void D2DPen::setStartCap(CapStyle start) {
-    if (start == mStartCap) { return; }
-    mStartCap = start;
-    mStrokeStyle = nullptr;
-}
-
-void D2DPen::setEndCap(CapStyle end) {
-    if (end == mEndCap) { return; }
-    mEndCap = end;
-    mStrokeStyle = nullptr;
-}
-
-void D2DPen::setDashCap(CapStyle dash) {
-    if (dash == mDashCap) { return; }
-    mDashCap = dash;
-    mStrokeStyle = nullptr;
-}
-
-void D2DPen::setCustomDash(const vector<float>& dashes) {
-    mDashes = dashes;
-    mLineStyle = LineStyle::CustomDash;
-    mStrokeStyle = nullptr;
-}
+DStrokeStylePtr createD2DStrokeStyle(ID2D1Factory* factory, const StrokeStyle& stroke) {
+    const D2D1_STROKE_STYLE_PROPERTIES strokeStyleProperties = D2D1::StrokeStyleProperties(
+        convert_toDCapStyle(stroke.startCap()), // The start cap.
+        convert_toDCapStyle(stroke.endCap()),   // The end cap.
+        convert_toDCapStyle(stroke.dashCap()),  // The dash cap.
+        convert_toLineJoinStyle(stroke.lineJoin()),
+        stroke.miterLimit(),
+        convert_toDDashStyle(stroke.lineStyle()), // The dash style.
+        stroke.dashOffset()                       // The dash offset.
+    );
+    const float* dashes = nullptr;
+    UINT dashesCount = 0;
 
-bool D2DPen::testCast(uintptr_t scope, long castId) const noexcept {
-    if (scope != mScopeId || D2DPen_CAST_ID != castId) { return false; }
-    return true;
-}
+    if (stroke.lineStyle() == LineStyle::CustomDash) {
+        dashes = stroke.customDash().data();
+        dashesCount = static_cast<UINT>(stroke.customDash().size());
+    }
 
-int D2DPen::strokeWidth() const noexcept {
-    return mStrokeWidth;
+    ID2D1StrokeStyle* strokeStyle = nullptr;
+    if (auto hr = factory->CreateStrokeStyle(strokeStyleProperties, dashes, dashesCount, &strokeStyle); hr != S_OK) {
+        return nullptr;
+    }
+    return DStrokeStylePtr(strokeStyle);
 }
 
-const Color& D2DPen::color() const noexcept {
-    return mColor;
-}
+D2DPen::D2DPen(DSolidColorBrushPtr brush, Direct2DEngine* engine)
+    : mBrush(std::move(brush))
+    , mEngine(engine) {}
 
-D2DPen* D2DPen::prepare() {
-    if (!mStrokeStyle && shouldCreate()) { createStrokeStyle(); }
+D2DPen* D2DPen::prepare(const Pen& pen) {
+    if (!mInitialized || mColor != pen.color()) {
+        mColor = pen.color();
+        mBrush->SetColor(convert_to_DColorF(mColor));
+    }
+    // Interned strokes compare by reference, pens sharing a stroke never look up the engine cache again.
+    if (!mInitialized || mStroke != pen.strokeStyleRef()) {
+        mStroke = pen.strokeStyleRef();
+        mStrokeStyle = mStroke->isSimple() ? nullptr : mEngine->strokeStyle(*mStroke);
+    }
+    mInitialized = true;
     return this;
 }
 
@@ -144,42 +102,10 @@ ID2D1Brush* D2DPen::brush() const noexcept {
 }
 
 ID2D1StrokeStyle* D2DPen::strokeStyle() const noexcept {
-    return mStrokeStyle.get();
-}
-
-void D2DPen::createStrokeStyle() {
-    ID2D1StrokeStyle* stroke;
-
-    D2D1_STROKE_STYLE_PROPERTIES strokeStyleProperties = D2D1::StrokeStyleProperties(
-        convert_toDCapStyle(mStartCap), // The start cap.
-        convert_toDCapStyle(mEndCap),   // The end cap.
-        convert_toDCapStyle(mDashCap),  // The dash cap.
-        convert_toLineJoinStyle(mJoinStyle),
-        mMiterLimit,
-        convert_toDDashStyle(mLineStyle), // The dash style.
-        mDashOffset                       // The dash offset.
-    );
-    float* dashes = nullptr;
-    UINT dashesCount = 0;
-
-    if (mLineStyle == LineStyle::CustomDash) {
-        dashes = mDashes.data();
-        dashesCount = numeric_cast<UINT>(mDashes.size());
-    }
-
-    ID2D1Factory* factory = nullptr;
-    mBrush->GetFactory(&factory);
-    if (auto hr = factory->CreateStrokeStyle(strokeStyleProperties, dashes, dashesCount, &stroke); hr != S_OK) {
-        return;
-    }
-    mStrokeStyle = DStrokeStylePtr(stroke);
+    return mStrokeStyle;
 }
 
-bool D2DPen::shouldCreate() const {
-    if (mLineStyle != LineStyle::Solid) { return true; }
-    if (mStartCap != CapStyle::Flat || mEndCap != CapStyle::Flat || mDashCap != CapStyle::Flat) { return true; }
-    if (mJoinStyle != LineJoinStyle::Miter) { return true; }
-    if (!fuzzyCompareEqual(mMiterLimit, 10.f) || !fuzzyCompareEqual(mDashOffset, 0.f)) { return true; }
-    return false;
+float D2DPen::strokeWidth() const noexcept {
+    return mStroke ? mStroke->width() : 1.f;
 }
-} // namespace bix
\ No newline at end of file
+} // namespace bix
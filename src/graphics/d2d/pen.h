@@ -15,56 +15,40 @@
  */
 
 #pragma once
+#include "bixlib/graphics/colors.h"
 #include "bixlib/graphics/pen.h"
 
 #include "brush.h"
 
 namespace bix {
 
-constexpr static long D2DPen_CAST_ID = 1766411953L;
+class Direct2DEngine;
 
-class D2DPen : public Pen {
-public:
-    D2DPen(DSolidColorBrushPtr brush, const Color& c, uintptr_t scopeId);
+/** Creates the native stroke style of a StrokeStyle, the width is not part of it and is passed per draw call. */
+DStrokeStylePtr createD2DStrokeStyle(ID2D1Factory* factory, const StrokeStyle& stroke);
 
-    void setStrokeWidth(int w) override;
-    void setColor(const Color& c) override;
-    void setMiterLimit(float limit) override;
-    void setDashOffset(float dashOffset) override;
-    void setLineStyle(LineStyle style) override;
-    void setLineJoin(LineJoinStyle lineJoin) override;
-    void setLineCap(CapStyle start, CapStyle end, CapStyle dash) override;
-    void setStartCap(CapStyle start) override;
-    void setEndCap(CapStyle end) override;
-    void setDashCap(CapStyle dash) override;
-    void setCustomDash(const std::vector<float>& dashes) override;
-    bool testCast(uintptr_t scope, long castId) const noexcept override;
-    int strokeWidth() const noexcept override;
-    const Color& color() const noexcept override;
+/**
+ * Caches the D2D resources needed to stroke with a bix::Pen.
+ *
+ * Each canvas owns one D2DPen that updates its solid brush when the color changes. Native stroke styles are shared
+ * by all canvases of the engine, see Direct2DEngine::strokeStyle(), so the pen only swaps a pointer when the
+ * interned stroke of the incoming pen differs from the previous one.
+ */
+class D2DPen {
+public:
+    D2DPen(DSolidColorBrushPtr brush, Direct2DEngine* engine);
 
-    D2DPen* prepare();
+    D2DPen* prepare(const Pen& pen);
     ID2D1Brush* brush() const noexcept;
     ID2D1StrokeStyle* strokeStyle() const noexcept;
-
-protected:
-    void createStrokeStyle();
-    bool shouldCreate() const;
+    float strokeWidth() const noexcept;
 
 private:
     DSolidColorBrushPtr mBrush = nullptr;
+    Direct2DEngine* mEngine = nullptr;
+    ID2D1StrokeStyle* mStrokeStyle = nullptr;
+    StrokeStyleRef mStroke;
     Color mColor;
-    const uintptr_t mScopeId;
-    int mStrokeWidth = 0;
-    DStrokeStylePtr mStrokeStyle = nullptr;
-
-    // default
-    LineStyle mLineStyle{LineStyle::Solid};
-    CapStyle mStartCap{CapStyle::Flat};
-    CapStyle mEndCap{CapStyle::Flat};
-    CapStyle mDashCap{CapStyle::Flat};
-    LineJoinStyle mJoinStyle{LineJoinStyle::Miter};
-    std::vector<float> mDashes;
-    float mMiterLimit = 10.0f;
-    float mDashOffset = 0.0f;
+    bool mInitialized = false;
 };
-} // namespace bix
\ No newline at end of file
+} // namespace bix
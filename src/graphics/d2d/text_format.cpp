@@ -71,8 +71,9 @@ DWRITE_WORD_WRAPPING convert_as_D2DWordWrapping(WordWrapping src) {
     }
 }
 
-D2DTextFormat::D2DTextFormat(IDWriteFactory* factory, uintptr_t scopeId, float density)
+D2DTextFormat::D2DTextFormat(IDWriteFactory* factory, D2DTextCachePtr cache, uintptr_t scopeId, float density)
     : mFactory(factory)
+    , mCache(std::move(cache))
     , mScopeId(scopeId)
     , mDisplayDensity(density) {
     BIX_UNUSED(mDisplayDensity)
@@ -81,73 +82,57 @@ D2DTextFormat::D2DTextFormat(IDWriteFactory* factory, uintptr_t scopeId, float d
 void D2DTextFormat::setFontFamily(const std::string& name) {
     if (name.empty() || name == mFontFamilyName) { return; }
     mFontFamilyName = name;
-
-    if (mLayout) {
-        auto s = utf8_to_wstring(name);
-        throw_if_fail(mLayout->SetFontFamilyName(s.c_str(), mTmpTextRange));
-    }
+    mLayout = nullptr;
 }
 
 void D2DTextFormat::setTextSize(float size) {
-    if (size < 0.01) { return; }
+    if (size < 0.01 || math::exactlyEqual(size, mTextSize)) { return; }
     mTextSize = size;
-    if (mLayout) { throw_if_fail(mLayout->SetFontSize(mTextSize, mTmpTextRange)); }
+    mLayout = nullptr;
 }
 
 void D2DTextFormat::setFontWeight(int weight) {
     if (weight < 1 || weight > 999 || mFontWeight == weight) { return; }
     mFontWeight = weight;
-    if (mLayout) { throw_if_fail(mLayout->SetFontWeight(static_cast<DWRITE_FONT_WEIGHT>(mFontWeight), mTmpTextRange)); }
+    mLayout = nullptr;
 }
 
 void D2DTextFormat::setWordWrapping(WordWrapping wrap) {
-    if (wrap == WordWrapping::Wrap) { return; }
+    if (wrap == mWordWrapping) { return; }
     mWordWrapping = wrap;
-    if (mLayout) { throw_if_fail(mLayout->SetWordWrapping(convert_as_D2DWordWrapping(wrap))); }
+    mLayout = nullptr;
 }
 
 void D2DTextFormat::setFontStyle(FontStyle style) {
     if (style == mFontStyle) { return; }
     mFontStyle = style;
-    if (mLayout) { throw_if_fail(mLayout->SetFontStyle(convert_as_D2DFontStyle(style), mTmpTextRange)); }
-}
-
-void D2DTextFormat::setMaxSize(const UISize& maxSize) {
-    if (mMaxSize == maxSize) { return; }
-    mMaxSize = maxSize;
-    if (mMaxSize.width < 0) { mMaxSize.width = 0; }
-    if (mMaxSize.height < 0) { mMaxSize.height = 0; }
-    if (mLayout) {
-        throw_if_fail(mLayout->SetMaxWidth(numeric_cast<float>(mMaxSize.width)));
-        throw_if_fail(mLayout->SetMaxHeight(numeric_cast<float>(mMaxSize.height)));
-        debugTo(mLayout.get());
-    }
+    mLayout = nullptr;
 }
 
 void D2DTextFormat::setMaxWidth(int w) {
-    if (mMaxSize.width == w) { return; }
     if (w < 0) { w = 0; }
+    if (mMaxSize.width == w) { return; }
     mMaxSize.width = w;
-    if (mLayout) { throw_if_fail(mLayout->SetMaxWidth(numeric_cast<float>(mMaxSize.width))); }
+    mLayout = nullptr;
 }
 
 void D2DTextFormat::setMaxHeight(int h) {
-    if (mMaxSize.height == h) { return; }
     if (h < 0) { h = 0; }
+    if (mMaxSize.height == h) { return; }
     mMaxSize.height = h;
-    if (mLayout) { throw_if_fail(mLayout->SetMaxHeight(numeric_cast<float>(mMaxSize.height))); }
+    mLayout = nullptr;
 }
 
 void D2DTextFormat::setText(const std::string& text) {
     if (text == mText) { return; }
     mText = text;
-    release();
+    mLayout = nullptr;
 }
 
 void D2DTextFormat::setTrimming(TextTrimming trimming) {
     if (mTextTrimming == trimming) { return; }
     mTextTrimming = trimming;
-    setupTrimming();
+    mLayout = nullptr;
 }
 
 bool D2DTextFormat::testCast(uintptr_t scope, long castId) const noexcept {
@@ -156,15 +141,28 @@ bool D2DTextFormat::testCast(uintptr_t scope, long castId) const noexcept {
 }
 
 D2DTextFormat* D2DTextFormat::prepare() {
-    if (!mLayout) { create(); }
+    if (mLayout) { return this; }
+    TextLayoutKey key;
+    key.text = mText;
+    key.fontFamily = mFontFamilyName;
+    key.textSize = mTextSize;
+    key.fontWeight = mFontWeight;
+    key.fontStyle = mFontStyle;
+    key.wordWrapping = mWordWrapping;
+    key.trimming = mTextTrimming;
+    key.maxWidth = mMaxSize.width;
+    key.maxHeight = mMaxSize.height;
+    mLayout = mCache->obtain(key, [this] { return create(); });
     return this;
 }
 
 IDWriteTextLayout* D2DTextFormat::layout() const noexcept {
-    return mLayout.get();
+    return mLayout ? mLayout->layout.get() : nullptr;
 }
 
-void D2DTextFormat::create() {
+shared_ptr<const D2DTextLayout> D2DTextFormat::create() const {
+    auto result = make_shared<D2DTextLayout>();
+
     IDWriteTextFormat* format = nullptr;
     auto hr = mFactory->CreateTextFormat(
         utf8_to_wstring(mFontFamilyName).c_str(), // Font family name.
@@ -178,14 +176,14 @@ void D2DTextFormat::create() {
     );
     throw_if_fail(hr);
 
-    mFormat = DWriteTextFormatPtr(format);
+    result->format = DWriteTextFormatPtr(format);
 
     auto text = utf8_to_wstring(mText);
     IDWriteTextLayout* layout = nullptr;
     hr = mFactory->CreateTextLayout(
         text.c_str(),
         numeric_cast<UINT32>(text.size()),
-        mFormat.get(),
+        result->format.get(),
         numeric_cast<float>(mMaxSize.width),
         numeric_cast<float>(mMaxSize.height),
         &layout
@@ -194,45 +192,34 @@ void D2DTextFormat::create() {
 
     debugTo(layout);
 
-    mLayout = DWriteTextLayoutPtr(layout);
-    throw_if_fail(mLayout->SetWordWrapping(convert_as_D2DWordWrapping(mWordWrapping)));
+    result->layout = DWriteTextLayoutPtr(layout);
+    throw_if_fail(result->layout->SetWordWrapping(convert_as_D2DWordWrapping(mWordWrapping)));
 
-    setupTrimming();
+    setupTrimming(*result);
 
     debugTo(layout);
+    return result;
 }
 
-void D2DTextFormat::release() {
-    mLayout = nullptr;
-    mFormat = nullptr;
-    mTrimmingSign = nullptr;
-}
-
-void D2DTextFormat::setupTrimming() {
-    if (!mLayout) { return; }
+void D2DTextFormat::setupTrimming(D2DTextLayout& layout) const {
+    DWRITE_TRIMMING trim{DWRITE_TRIMMING_GRANULARITY_CHARACTER, 0, 0};
 
     switch (mTextTrimming) {
     case TextTrimming::None:
-        mDWTrim.granularity = DWRITE_TRIMMING_GRANULARITY_NONE;
-        mLayout->SetTrimming(&mDWTrim, nullptr);
+        trim.granularity = DWRITE_TRIMMING_GRANULARITY_NONE;
+        layout.layout->SetTrimming(&trim, nullptr);
         break;
-    case TextTrimming::Ellipsis:
-        mDWTrim.granularity = DWRITE_TRIMMING_GRANULARITY_CHARACTER;
-        if (!mTrimmingSign) {
-            IDWriteInlineObject* trimSign = nullptr;
-            mFactory->CreateEllipsisTrimmingSign(mLayout.get(), &trimSign);
-            mTrimmingSign = DWInlineObjPtr(trimSign);
-        }
-        mLayout->SetTrimming(&mDWTrim, mTrimmingSign.get());
-        break;
-    case TextTrimming::Clip:
-        mDWTrim.granularity = DWRITE_TRIMMING_GRANULARITY_CHARACTER;
-        mLayout->SetTrimming(&mDWTrim, nullptr);
+    case TextTrimming::Ellipsis: {
+        IDWriteInlineObject* trimSign = nullptr;
+        mFactory->CreateEllipsisTrimmingSign(layout.layout.get(), &trimSign);
+        layout.trimmingSign = DWInlineObjPtr(trimSign);
+        layout.layout->SetTrimming(&trim, layout.trimmingSign.get());
         break;
+    }
+    case TextTrimming::Clip: layout.layout->SetTrimming(&trim, nullptr); break;
     default:
         // TODO custom trimming
-        mDWTrim.granularity = DWRITE_TRIMMING_GRANULARITY_CHARACTER;
-        mLayout->SetTrimming(&mDWTrim, nullptr);
+        layout.layout->SetTrimming(&trim, nullptr);
     }
 }
 } // namespace bix
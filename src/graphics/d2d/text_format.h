@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include "bixlib/graphics/text_cache.h"
 #include "bixlib/graphics/text_format.h"
 
 #include <dwrite.h>
@@ -25,16 +26,30 @@ namespace bix {
 
 constexpr static long D2DTextFormat_CAST_ID = 1766413641L;
 
+/** A DirectWrite layout together with the objects it references, immutable once cached. */
+struct D2DTextLayout {
+    DWriteTextFormatPtr format = nullptr;
+    DWriteTextLayoutPtr layout = nullptr;
+    DWInlineObjPtr trimmingSign = nullptr;
+};
+
+using D2DTextCachePtr = std::shared_ptr<TextLayoutCache<D2DTextLayout>>;
+
+/**
+ * TextPaint implementation on DirectWrite.
+ *
+ * Property changes only mark the paint dirty, prepare() then fetches the layout from the engine wide
+ * TextLayoutCache and only creates a new IDWriteTextLayout on a miss.
+ */
 class D2DTextFormat : public TextPaint {
 public:
-    explicit D2DTextFormat(IDWriteFactory* factory, uintptr_t scopeId, float density);
+    D2DTextFormat(IDWriteFactory* factory, D2DTextCachePtr cache, uintptr_t scopeId, float density);
 
     void setFontFamily(const std::string& name) override;
     void setTextSize(float size) override;
     void setFontWeight(int weight) override;
     void setWordWrapping(WordWrapping wrap) override;
     void setFontStyle(FontStyle style) override;
-    void setMaxSize(const UISize& maxSize) override;
     void setMaxWidth(int w) override;
     void setMaxHeight(int h) override;
     void setText(const std::string& text) override;
@@ -45,13 +60,12 @@ public:
     IDWriteTextLayout* layout() const noexcept;
 
 private:
-    void create();
-
-    void release();
+    std::shared_ptr<const D2DTextLayout> create() const;
 
-    void setupTrimming();
+    void setupTrimming(D2DTextLayout& layout) const;
 
     IDWriteFactory* mFactory = nullptr;
+    D2DTextCachePtr mCache;
     uintptr_t mScopeId = 0;
     float mDisplayDensity = 1.f;
 
@@ -65,15 +79,10 @@ private:
     // TODO
     std::string mLocale = "en-us";
 
-    DWRITE_TEXT_RANGE mTmpTextRange{0, 0};
     TextTrimming mTextTrimming = TextTrimming::None;
 
-    DWRITE_TRIMMING mDWTrim{DWRITE_TRIMMING_GRANULARITY_CHARACTER, 0, 0};
-
-    UISize mMaxSize = {0, 0};
+    SizeI mMaxSize = {0, 0};
 
-    DWInlineObjPtr mTrimmingSign = nullptr;
-    DWriteTextFormatPtr mFormat = nullptr;
-    DWriteTextLayoutPtr mLayout = nullptr;
+    std::shared_ptr<const D2DTextLayout> mLayout = nullptr;
 };
 } // namespace bix
\ No newline at end of file
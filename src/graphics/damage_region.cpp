@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/graphics/damage_region.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace bix {
+
+namespace {
+float area(const Rect& r) noexcept {
+    return r.width() * r.height();
+}
+
+/** Returns the area a merged rectangle covers beyond the two source rectangles. */
+float mergeWaste(const Rect& a, const Rect& b) noexcept {
+    const float overlap = a.intersects(b) ? area(a.intersected(b)) : 0.0f;
+    return area(a.united(b)) - area(a) - area(b) + overlap;
+}
+
+Rect snapOut(const Rect& r) noexcept {
+    return {std::floor(r.left), std::floor(r.top), std::ceil(r.right), std::ceil(r.bottom)};
+}
+} // namespace
+
+DamageRegion::DamageRegion(size_t capacity) : mCapacity(std::max<size_t>(capacity, 1)) {
+    mRects.reserve(mCapacity + 1);
+}
+
+void DamageRegion::add(const Rect& rect) {
+    if (!rect.isValid() || rect.isEmpty()) { return; }
+
+    Rect pending = snapOut(rect);
+    for (const auto& r : mRects) {
+        if (r.contains(pending)) { return; }
+    }
+
+    // Rectangles are merged when the union wastes no area, e.g. overlapping or edge-adjacent aligned rectangles.
+    // Merging may grow the pending rectangle so that it now overlaps others, repeat until nothing changes.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (auto it = mRects.begin(); it != mRects.end(); ++it) {
+            if (mergeWaste(pending, *it) <= 0.0f) {
+                pending = pending.united(*it);
+                mRects.erase(it);
+                merged = true;
+                break;
+            }
+        }
+    }
+    mRects.push_back(pending);
+
+    while (mRects.size() > mCapacity) { mergeCheapestPair(); }
+}
+
+void DamageRegion::add(const DamageRegion& other) {
+    for (const auto& r : other.mRects) { add(r); }
+}
+
+bool DamageRegion::intersects(const Rect& rect) const noexcept {
+    return std::ranges::any_of(mRects, [&rect](const Rect& r) { return r.intersects(rect); });
+}
+
+Rect DamageRegion::bounds() const noexcept {
+    Rect result;
+    for (const auto& r : mRects) { result = result.united(r); }
+    return result;
+}
+
+void DamageRegion::mergeCheapestPair() {
+    size_t first = 0;
+    size_t second = 1;
+    float best = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < mRects.size(); ++i) {
+        for (size_t j = i + 1; j < mRects.size(); ++j) {
+            const float waste = mergeWaste(mRects[i], mRects[j]);
+            if (waste < best) {
+                best = waste;
+                first = i;
+                second = j;
+            }
+        }
+    }
+    mRects[first] = mRects[first].united(mRects[second]);
+    mRects.erase(mRects.begin() + static_cast<std::ptrdiff_t>(second));
+}
+} // namespace bix
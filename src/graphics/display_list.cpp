@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/graphics/display_list.h"
+
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace bix {
+
+namespace {
+struct ClearRecord {
+    Color color;
+};
+
+struct TransformRecord {
+    Transform transform;
+};
+
+struct ClipRecord {
+    RoundRect rect;
+};
+
+struct FillRecord {
+    Rect rect;
+    Color color;
+    float opacity;
+};
+
+struct GradientFillRecord {
+    Rect rect;
+    uint32_t gradient;
+};
+
+// A range of a batch side table.
+struct BatchRange {
+    uint32_t first;
+    uint32_t count;
+};
+
+struct FillBatchRecord {
+    BatchRange rects;
+    Color color;
+    float opacity;
+};
+
+struct GradientFillBatchRecord {
+    BatchRange rects;
+    uint32_t gradient;
+};
+
+struct PathFillRecord {
+    uint32_t path;
+    Color color;
+    float opacity;
+};
+
+struct GradientPathFillRecord {
+    uint32_t path;
+    uint32_t gradient;
+};
+
+struct RoundFillRecord {
+    RoundRect rect;
+    Color color;
+    float opacity;
+};
+
+struct GradientRoundFillRecord {
+    RoundRect rect;
+    uint32_t gradient;
+};
+
+struct EllipseFillRecord {
+    Ellipse ellipse;
+    Color color;
+    float opacity;
+};
+
+struct GradientEllipseFillRecord {
+    Ellipse ellipse;
+    uint32_t gradient;
+};
+
+struct BitmapRecord {
+    Rect src;
+    Rect dst;
+    float opacity;
+    uint32_t bitmap;
+    BitmapSampling sampling;
+};
+
+struct RectRecord {
+    Rect rect;
+    uint32_t pen;
+};
+
+struct RoundRectRecord {
+    Rect rect;
+    float radiusX;
+    float radiusY;
+    uint32_t pen;
+};
+
+struct RoundRectRadiiRecord {
+    RoundRect rect;
+    uint32_t pen;
+};
+
+struct EllipseRecord {
+    Ellipse ellipse;
+    uint32_t pen;
+};
+
+struct TextRecord {
+    Point origin;
+    uint32_t text;
+    uint32_t pen;
+};
+
+struct LineRecord {
+    geom::Line line;
+    uint32_t pen;
+};
+
+struct BatchRecord {
+    BatchRange items;
+    uint32_t pen;
+};
+
+template <typename T>
+T read(const std::byte* p) noexcept {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+template <typename T>
+std::span<const T> batch(const std::vector<T>& table, BatchRange range) noexcept {
+    return {table.data() + range.first, range.count};
+}
+} // namespace
+
+template <typename T>
+void DisplayList::append(Op op, const T& payload) {
+    static_assert(std::is_trivially_copyable_v<T>, "display list records must be trivially copyable");
+    static_assert(sizeof(T) <= std::numeric_limits<uint16_t>::max(), "display list record too large");
+
+    const Header header{op, 0, static_cast<uint16_t>(std::is_empty_v<T> ? 0 : sizeof(T))};
+    const size_t offset = mStream.size();
+    mStream.resize(offset + sizeof(Header) + header.size);
+    std::memcpy(mStream.data() + offset, &header, sizeof(Header));
+    if (header.size > 0) { std::memcpy(mStream.data() + offset + sizeof(Header), &payload, sizeof(T)); }
+    ++mCommandCount;
+}
+
+template <typename T>
+uint32_t DisplayList::appendBatch(std::vector<T>& table, std::span<const T> items) {
+    const auto first = static_cast<uint32_t>(table.size());
+    table.insert(table.end(), items.begin(), items.end());
+    return first;
+}
+
+uint32_t DisplayList::penIndex(const Pen& pen) {
+    // Consecutive commands usually share the same pen, only store it once.
+    if (mPens.empty() || !(mPens.back() == pen)) { mPens.push_back(pen); }
+    return static_cast<uint32_t>(mPens.size() - 1);
+}
+
+bool DisplayList::GradientFill::operator==(const GradientFill& rhs) const noexcept {
+    return style == rhs.style && math::exactlyEqual(opacity, rhs.opacity) && origin == rhs.origin
+           && extent == rhs.extent && math::exactlyEqual(angle, rhs.angle) && gradient == rhs.gradient;
+}
+
+uint32_t DisplayList::gradientIndex(const GradientBrush& brush) {
+    GradientFill fill{brush.style(), brush.gradient(), brush.opacity(), {}, {}, 0.f};
+    switch (brush.style()) {
+    case BrushStyle::LinearGradient: {
+        const auto& linear = static_cast<const LinearGradientBrush&>(brush);
+        fill.origin = linear.startPoint();
+        fill.extent = linear.endPoint();
+        break;
+    }
+    case BrushStyle::RadialGradient: {
+        const Ellipse& ellipse = static_cast<const RadialGradientBrush&>(brush).ellipse();
+        fill.origin = ellipse.center;
+        fill.extent = {ellipse.radiusX, ellipse.radiusY};
+        break;
+    }
+    default: {
+        const auto& conic = static_cast<const ConicGradientBrush&>(brush);
+        fill.origin = conic.center();
+        fill.angle = conic.startAngle();
+        break;
+    }
+    }
+    // Like pens, consecutive fills usually share the same brush.
+    if (mGradients.empty() || !(mGradients.back() == fill)) { mGradients.push_back(std::move(fill)); }
+    return static_cast<uint32_t>(mGradients.size() - 1);
+}
+
+uint32_t DisplayList::pathIndex(const Path& path) {
+    // Copies share the geometry, so recording a path does not copy its points.
+    mPaths.push_back(path);
+    return static_cast<uint32_t>(mPaths.size() - 1);
+}
+
+Brush& DisplayList::colorBrush(Canvas& target, const Color& color, float opacity) {
+    // All solid fills share one brush that is recolored per command.
+    if (mBrush) {
+        mBrush->setColor(color);
+    } else {
+        mBrush = target.createColorBrush(color);
+    }
+    mBrush->setOpacity(opacity);
+    return *mBrush;
+}
+
+Brush* DisplayList::gradientBrush(Canvas& target, uint32_t index) {
+    if (mGradientBrushes.size() < mGradients.size()) { mGradientBrushes.resize(mGradients.size()); }
+    auto& brush = mGradientBrushes[index];
+    if (brush) { return brush.get(); }
+
+    const GradientFill& fill = mGradients[index];
+    switch (fill.style) {
+    case BrushStyle::LinearGradient:
+        brush = target.createLinearGradientBrush(fill.origin, fill.extent, fill.gradient);
+        break;
+    case BrushStyle::RadialGradient:
+        brush = target.createRadialGradientBrush(Ellipse(fill.origin, fill.extent.x, fill.extent.y), fill.gradient);
+        break;
+    default: brush = target.createConicGradientBrush(fill.origin, fill.angle, fill.gradient); break;
+    }
+    if (brush) { brush->setOpacity(fill.opacity); }
+    return brush.get();
+}
+
+void DisplayList::reset() {
+    mStream.clear();
+    mPens.clear();
+    mLines.clear();
+    mRects.clear();
+    mTexts.clear();
+    mGradients.clear();
+    mGradientBrushes.clear();
+    mBitmaps.clear();
+    mPaths.clear();
+    mCommandCount = 0;
+}
+
+void DisplayList::releaseResources() noexcept {
+    mBrush = nullptr;
+    mGradientBrushes.clear();
+    mBrushOwner = nullptr;
+}
+
+void DisplayList::clear(const Color& c) {
+    append(Op::Clear, ClearRecord{c});
+}
+
+void DisplayList::setTransform(const Transform& transform) {
+    append(Op::SetTransform, TransformRecord{transform});
+}
+
+void DisplayList::pushClip(const RoundRect& rect) {
+    append(Op::PushClip, ClipRecord{rect});
+}
+
+void DisplayList::popClip() {
+    struct Empty {};
+    append(Op::PopClip, Empty{});
+}
+
+void DisplayList::fillRectangle(const Rect& rect, const Color& color, float opacity) {
+    append(Op::FillRect, FillRecord{rect, color, opacity});
+}
+
+void DisplayList::fillRectangle(const Rect& rect, const GradientBrush& brush) {
+    append(Op::FillRectGradient, GradientFillRecord{rect, gradientIndex(brush)});
+}
+
+void DisplayList::fillRects(std::span<const Rect> rects, const Color& color, float opacity) {
+    if (rects.empty()) { return; }
+    const BatchRange range{appendBatch(mRects, rects), static_cast<uint32_t>(rects.size())};
+    append(Op::FillRects, FillBatchRecord{range, color, opacity});
+}
+
+void DisplayList::fillRects(std::span<const Rect> rects, const GradientBrush& brush) {
+    if (rects.empty()) { return; }
+    const BatchRange range{appendBatch(mRects, rects), static_cast<uint32_t>(rects.size())};
+    append(Op::FillRectsGradient, GradientFillBatchRecord{range, gradientIndex(brush)});
+}
+
+void DisplayList::fillPath(const Path& path, const Color& color, float opacity) {
+    if (path.isEmpty()) { return; }
+    append(Op::FillPath, PathFillRecord{pathIndex(path), color, opacity});
+}
+
+void DisplayList::fillPath(const Path& path, const GradientBrush& brush) {
+    if (path.isEmpty()) { return; }
+    append(Op::FillPathGradient, GradientPathFillRecord{pathIndex(path), gradientIndex(brush)});
+}
+
+void DisplayList::fillRoundRect(const RoundRect& rect, const Color& color, float opacity) {
+    append(Op::FillRoundRect, RoundFillRecord{rect, color, opacity});
+}
+
+void DisplayList::fillRoundRect(const RoundRect& rect, const GradientBrush& brush) {
+    append(Op::FillRoundRectGradient, GradientRoundFillRecord{rect, gradientIndex(brush)});
+}
+
+void DisplayList::fillEllipse(const Ellipse& ellipse, const Color& color, float opacity) {
+    append(Op::FillEllipse, EllipseFillRecord{ellipse, color, opacity});
+}
+
+void DisplayList::fillEllipse(const Ellipse& ellipse, const GradientBrush& brush) {
+    append(Op::FillEllipseGradient, GradientEllipseFillRecord{ellipse, gradientIndex(brush)});
+}
+
+void DisplayList::drawBitmap(
+    const Bitmap& bitmap,
+    const Rect& src,
+    const Rect& dst,
+    float opacity,
+    BitmapSampling sampling
+) {
+    if (bitmap.isEmpty()) { return; }
+    // Icons are often drawn several times in a row, consecutive draws share one entry.
+    if (mBitmaps.empty() || mBitmaps.back().data() != bitmap.data() || mBitmaps.back().id() != bitmap.id()) {
+        mBitmaps.push_back(bitmap);
+    }
+    append(Op::DrawBitmap, BitmapRecord{src, dst, opacity, static_cast<uint32_t>(mBitmaps.size() - 1), sampling});
+}
+
+void DisplayList::drawRectangle(const Rect& rect, const Pen& pen) {
+    append(Op::DrawRect, RectRecord{rect, penIndex(pen)});
+}
+
+void DisplayList::drawRects(std::span<const Rect> rects, const Pen& pen) {
+    if (rects.empty()) { return; }
+    const BatchRange range{appendBatch(mRects, rects), static_cast<uint32_t>(rects.size())};
+    append(Op::DrawRects, BatchRecord{range, penIndex(pen)});
+}
+
+void DisplayList::drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) {
+    append(Op::DrawRoundRect, RoundRectRecord{rect, radiusX, radiusY, penIndex(pen)});
+}
+
+void DisplayList::drawRoundRect(const RoundRect& rect, const Pen& pen) {
+    append(Op::DrawRoundRectRadii, RoundRectRadiiRecord{rect, penIndex(pen)});
+}
+
+void DisplayList::drawEllipse(const Ellipse& ellipse, const Pen& pen) {
+    append(Op::DrawEllipse, EllipseRecord{ellipse, penIndex(pen)});
+}
+
+void DisplayList::drawText(const Point& origin, TextPaint& text, const Pen& pen) {
+    mTexts.push_back(&text);
+    append(Op::DrawText, TextRecord{origin, static_cast<uint32_t>(mTexts.size() - 1), penIndex(pen)});
+}
+
+void DisplayList::drawLine(const geom::Line& line, const Pen& pen) {
+    append(Op::DrawLine, LineRecord{line, penIndex(pen)});
+}
+
+void DisplayList::drawLines(std::span<const geom::Line> lines, const Pen& pen) {
+    if (lines.empty()) { return; }
+    const BatchRange range{appendBatch(mLines, lines), static_cast<uint32_t>(lines.size())};
+    append(Op::DrawLines, BatchRecord{range, penIndex(pen)});
+}
+
+void DisplayList::replay(Canvas& target, const Transform& base) {
+    if (mBrushOwner != &target) {
+        mBrush = nullptr;
+        mGradientBrushes.clear();
+        mBrushOwner = &target;
+    }
+    target.setTransform(base);
+
+    const std::byte* p = mStream.data();
+    const std::byte* end = p + mStream.size();
+    while (p < end) {
+        const auto header = read<Header>(p);
+        p += sizeof(Header);
+
+        switch (header.op) {
+        case Op::Clear: target.clear(read<ClearRecord>(p).color); break;
+        case Op::SetTransform: target.setTransform(read<TransformRecord>(p).transform * base); break;
+        case Op::PushClip: target.pushClip(read<ClipRecord>(p).rect); break;
+        case Op::PopClip: target.popClip(); break;
+        case Op::FillRect: {
+            const auto r = read<FillRecord>(p);
+            target.fillRectangle(r.rect, colorBrush(target, r.color, r.opacity));
+            break;
+        }
+        case Op::FillRectGradient: {
+            const auto r = read<GradientFillRecord>(p);
+            if (Brush* brush = gradientBrush(target, r.gradient)) { target.fillRectangle(r.rect, *brush); }
+            break;
+        }
+        case Op::FillRects: {
+            const auto r = read<FillBatchRecord>(p);
+            target.fillRects(batch(mRects, r.rects), colorBrush(target, r.color, r.opacity));
+            break;
+        }
+        case Op::FillRectsGradient: {
+            const auto r = read<GradientFillBatchRecord>(p);
+            if (Brush* brush = gradientBrush(target, r.gradient)) { target.fillRects(batch(mRects, r.rects), *brush); }
+            break;
+        }
+        case Op::FillPath: {
+            const auto r = read<PathFillRecord>(p);
+            target.fillPath(mPaths[r.path], colorBrush(target, r.color, r.opacity));
+            break;
+        }
+        case Op::FillPathGradient: {
+            const auto r = read<GradientPathFillRecord>(p);
+            if (Brush* brush = gradientBrush(target, r.gradient)) { target.fillPath(mPaths[r.path], *brush); }
+            break;
+        }
+        case Op::FillRoundRect: {
+            const auto r = read<RoundFillRecord>(p);
+            target.fillRoundRect(r.rect, colorBrush(target, r.color, r.opacity));
+            break;
+        }
+        case Op::FillRoundRectGradient: {
+            const auto r = read<GradientRoundFillRecord>(p);
+            if (Brush* brush = gradientBrush(target, r.gradient)) { target.fillRoundRect(r.rect, *brush); }
+            break;
+        }
+        case Op::FillEllipse: {
+            const auto r = read<EllipseFillRecord>(p);
+            target.fillEllipse(r.ellipse, colorBrush(target, r.color, r.opacity));
+            break;
+        }
+        case Op::FillEllipseGradient: {
+            const auto r = read<GradientEllipseFillRecord>(p);
+            if (Brush* brush = gradientBrush(target, r.gradient)) { target.fillEllipse(r.ellipse, *brush); }
+            break;
+        }
+        case Op::DrawBitmap: {
+            const auto r = read<BitmapRecord>(p);
+            target.drawBitmap(mBitmaps[r.bitmap], r.src, r.dst, r.opacity, r.sampling);
+            break;
+        }
+        case Op::DrawRect: {
+            const auto r = read<RectRecord>(p);
+            target.drawRectangle(r.rect, mPens[r.pen]);
+            break;
+        }
+        case Op::DrawRects: {
+            const auto r = read<BatchRecord>(p);
+            target.drawRects(batch(mRects, r.items), mPens[r.pen]);
+            break;
+        }
+        case Op::DrawRoundRect: {
+            const auto r = read<RoundRectRecord>(p);
+            target.drawRoundRect(r.rect, r.radiusX, r.radiusY, mPens[r.pen]);
+            break;
+        }
+        case Op::DrawRoundRectRadii: {
+            const auto r = read<RoundRectRadiiRecord>(p);
+            target.drawRoundRect(r.rect, mPens[r.pen]);
+            break;
+        }
+        case Op::DrawEllipse: {
+            const auto r = read<EllipseRecord>(p);
+            target.drawEllipse(r.ellipse, mPens[r.pen]);
+            break;
+        }
+        case Op::DrawText: {
+            const auto r = read<TextRecord>(p);
+            target.drawText(r.origin, *mTexts[r.text], mPens[r.pen]);
+            break;
+        }
+        case Op::DrawLine: {
+            const auto r = read<LineRecord>(p);
+            target.drawLine(r.line, mPens[r.pen]);
+            break;
+        }
+        case Op::DrawLines: {
+            const auto r = read<BatchRecord>(p);
+            target.drawLines(batch(mLines, r.items), mPens[r.pen]);
+            break;
+        }
+        }
+        p += header.size;
+    }
+}
+} // namespace bix
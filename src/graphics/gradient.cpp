@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/graphics/gradient.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+inline void hashCombine(size_t& seed, size_t value) noexcept {
+    seed ^= value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2);
+}
+
+// Matches the premultiplication of solid colors in the software backend, see blend-inl.h.
+uint32_t premultiply(const Color& c) noexcept {
+    if (!c.isValid()) { return 0; }
+    const auto a = static_cast<uint32_t>(c.alpha());
+    auto channel = [a](int v) {
+        const uint32_t x = static_cast<uint32_t>(v) * a + 128;
+        return (x + (x >> 8)) >> 8;
+    };
+    return channel(c.red()) | channel(c.green()) << 8 | channel(c.blue()) << 16 | a << 24;
+}
+} // namespace
+
+Gradient::Gradient(vector<GradientStop> stops, ColorInterpolation interpolation, GradientSpread spread)
+    : mStops(std::move(stops))
+    , mInterpolation(interpolation)
+    , mSpread(spread) {
+    for (auto& stop : mStops) { stop.offset = std::isnan(stop.offset) ? 0.f : std::clamp(stop.offset, 0.f, 1.f); }
+    std::stable_sort(mStops.begin(), mStops.end(), [](const GradientStop& a, const GradientStop& b) {
+        return a.offset < b.offset;
+    });
+}
+
+float Gradient::applySpread(float t, GradientSpread spread) noexcept {
+    if (!std::isfinite(t)) { return 0.f; }
+    switch (spread) {
+    case GradientSpread::Repeat: return t - std::floor(t);
+    case GradientSpread::Reflect: {
+        const float m = t - 2.f * std::floor(t * 0.5f);
+        return m > 1.f ? 2.f - m : m;
+    }
+    default: return std::clamp(t, 0.f, 1.f);
+    }
+}
+
+Color Gradient::colorAt(float t) const noexcept {
+    if (mStops.empty()) { return {}; }
+    t = applySpread(t, mSpread);
+    if (t <= mStops.front().offset) { return mStops.front().color; }
+    if (t >= mStops.back().offset) { return mStops.back().color; }
+
+    // The first stop past t, the stop before it is at or before t so the segment is never empty.
+    const auto next = std::upper_bound(mStops.begin(), mStops.end(), t, [](float v, const GradientStop& stop) {
+        return v < stop.offset;
+    });
+    const auto prev = next - 1;
+    const float local = (t - prev->offset) / (next->offset - prev->offset);
+    return Color::lerp(prev->color, next->color, local, mInterpolation);
+}
+
+size_t Gradient::hash() const noexcept {
+    size_t seed = mStops.size();
+    hashCombine(seed, static_cast<size_t>(mInterpolation));
+    hashCombine(seed, static_cast<size_t>(mSpread));
+    for (const auto& stop : mStops) {
+        hashCombine(seed, std::bit_cast<uint32_t>(stop.offset));
+        const Color& c = stop.color;
+        hashCombine(seed, static_cast<size_t>(c.red() | c.green() << 8 | c.blue() << 16 | c.alpha() << 24));
+        hashCombine(seed, c.isValid() ? 1 : 0);
+    }
+    return seed;
+}
+
+bool Gradient::operator==(const Gradient& rhs) const noexcept {
+    return mInterpolation == rhs.mInterpolation && mSpread == rhs.mSpread && mStops == rhs.mStops;
+}
+
+GradientRamp::GradientRamp(const Gradient& gradient) : GradientRamp(gradient, preferredSize(gradient)) {}
+
+GradientRamp::GradientRamp(const Gradient& gradient, size_t size)
+    : mPixels(std::max<size_t>(size, 2))
+    , mSpread(gradient.spread()) {
+    // Entries sample [0, 1] inclusively, the spread mode is applied on lookup.
+    const Gradient padded(gradient.stops(), gradient.interpolation(), GradientSpread::Pad);
+    const auto last = static_cast<float>(mPixels.size() - 1);
+    for (size_t i = 0; i < mPixels.size(); ++i) {
+        mPixels[i] = premultiply(padded.colorAt(static_cast<float>(i) / last));
+        mOpaque = mOpaque && (mPixels[i] >> 24) == 255;
+    }
+}
+
+size_t GradientRamp::preferredSize(const Gradient& gradient) noexcept {
+    // Stops closer than a few entries of the default ramp would blur into each other.
+    const auto& stops = gradient.stops();
+    for (size_t i = 1; i < stops.size(); ++i) {
+        const float gap = stops[i].offset - stops[i - 1].offset;
+        if (gap > 0.f && gap < 4.f / static_cast<float>(kDefaultSize)) { return kDetailedSize; }
+    }
+    return kDefaultSize;
+}
+
+GradientRampPtr GradientRampCache::obtain(const Gradient& gradient) {
+    if (auto* ramp = mRamps.find(gradient)) {
+        ++mStats.hits;
+        return *ramp;
+    }
+    ++mStats.misses;
+    auto ramp = make_shared<const GradientRamp>(gradient);
+    mRamps.insert(gradient, ramp);
+    mStats.evictions = mRamps.evictions();
+    return ramp;
+}
+} // namespace bix
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/graphics/image_cache.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+namespace bix {
+
+// The budget bounds the cache, the entry count is never the limiting factor.
+ImageCache::ImageCache(size_t budget) : mImages(numeric_limits<size_t>::max()), mBudget(budget) {}
+
+ImageCache& ImageCache::shared() {
+    static ImageCache cache;
+    return cache;
+}
+
+Bitmap ImageCache::find(const string& key) {
+    if (auto* image = mImages.find(key)) {
+        ++mStats.hits;
+        return *image;
+    }
+    ++mStats.misses;
+    return {};
+}
+
+Bitmap ImageCache::insert(const string& key, Bitmap bitmap) {
+    if (bitmap.isEmpty()) { return bitmap; }
+    if (bitmap.isBorrowed() || bitmap.format() != PixelFormat::RGBA8Premultiplied) {
+        bitmap = bitmap.copy(PixelFormat::RGBA8Premultiplied);
+    }
+    bitmap.setImmutable();
+
+    erase(key);
+    const size_t charged = cost(bitmap);
+    if (charged > mBudget) { return bitmap; }
+    trim(mBudget - charged);
+    mBytes += charged;
+    return mImages.insert(key, std::move(bitmap));
+}
+
+bool ImageCache::erase(const string& key) {
+    // Looking the entry up marks it as recently used, which does not matter since it is removed.
+    const auto* image = mImages.find(key);
+    if (!image) { return false; }
+    mBytes -= cost(*image);
+    return mImages.erase(key);
+}
+
+void ImageCache::clear() noexcept {
+    mImages.clear();
+    mBytes = 0;
+}
+
+void ImageCache::setBudget(size_t budget) {
+    mBudget = budget;
+    trim(budget);
+}
+
+size_t ImageCache::cost(const Bitmap& bitmap) noexcept {
+    // The whole mip chain is charged up front, so levels generated later never push the cache over its budget.
+    size_t bytes = 0;
+    for (size_t w = static_cast<size_t>(bitmap.width()), h = static_cast<size_t>(bitmap.height()); w * h > 0;) {
+        bytes += w * h * 4;
+        if (w == 1 && h == 1) { break; }
+        w = std::max<size_t>(w / 2, 1);
+        h = std::max<size_t>(h / 2, 1);
+    }
+    return bytes;
+}
+
+void ImageCache::trim(size_t budget) {
+    while (mBytes > budget) {
+        const Bitmap* oldest = mImages.leastRecent();
+        if (!oldest) { break; }
+        mBytes -= cost(*oldest);
+        mImages.evictLeastRecent();
+        ++mStats.evictions;
+    }
+}
+} // namespace bix
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/graphics/nine_patch.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+// The four edges of the three columns or rows along one axis, in source and destination space.
+struct Edges {
+    array<float, 4> src;
+    array<float, 4> dst;
+};
+
+Edges splitAxis(int begin, int end, int extent, float target) {
+    if (begin >= end) {
+        // Nothing stretchable along this axis, stretch everything.
+        begin = 0;
+        end = extent;
+    }
+    const auto head = static_cast<float>(begin);
+    const auto tail = static_cast<float>(extent - end);
+    float dstHead = head;
+    float dstTail = tail;
+    if (head + tail > target) {
+        // Shrink the borders proportionally, rounded so the seam between them stays on a pixel edge.
+        dstHead = round(head * target / (head + tail));
+        dstTail = target - dstHead;
+    }
+    return {
+        {0.f, head, static_cast<float>(end), static_cast<float>(extent)},
+        {0.f, dstHead, target - dstTail, target},
+    };
+}
+} // namespace
+
+NinePatch::NinePatch(Bitmap bitmap, const RectI& center)
+    : mBitmap(std::move(bitmap))
+    , mCenter(center.intersected(mBitmap.bounds())) {
+    if (!mCenter.isValid()) { mCenter = {}; }
+}
+
+span<const NinePatch::Slice> NinePatch::slices(const Size& size) {
+    if (math::exactlyEqual(size.width, mCachedSize.width) && math::exactlyEqual(size.height, mCachedSize.height)) {
+        return {mSlices.data(), mSliceCount};
+    }
+    mCachedSize = size;
+    mSliceCount = 0;
+    if (mBitmap.isEmpty() || size.width <= 0.f || size.height <= 0.f) { return {}; }
+
+    const Edges columns = splitAxis(mCenter.left, mCenter.right, mBitmap.width(), size.width);
+    const Edges rows = splitAxis(mCenter.top, mCenter.bottom, mBitmap.height(), size.height);
+    for (size_t row = 0; row < 3; ++row) {
+        for (size_t column = 0; column < 3; ++column) {
+            const Rect src(columns.src[column], rows.src[row], columns.src[column + 1], rows.src[row + 1]);
+            const Rect dst(columns.dst[column], rows.dst[row], columns.dst[column + 1], rows.dst[row + 1]);
+            if (src.isEmpty() || dst.isEmpty()) { continue; }
+            mSlices[mSliceCount++] = {src, dst};
+        }
+    }
+    return {mSlices.data(), mSliceCount};
+}
+
+void NinePatch::draw(Canvas& canvas, const Rect& dst, float opacity, BitmapSampling sampling) {
+    for (const Slice& slice : slices(dst.size())) {
+        canvas.drawBitmap(mBitmap, slice.src, slice.dst.translated(dst.left, dst.top), opacity, sampling);
+    }
+}
+} // namespace bix
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/graphics/path.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+constexpr int kMaxSegments = 256;
+
+float length(const Point& v) noexcept {
+    return hypot(v.x, v.y);
+}
+
+/**
+ * Returns the number of line segments a curve is split into so that the polygon stays within the tolerance
+ * (Wang's formula). \a deviation is the largest second difference of the control points, already scaled by
+ * the degree factor of the curve.
+ */
+int segmentCount(float deviation, float tolerance) noexcept {
+    const float n = ceil(sqrt(deviation / tolerance));
+    return n >= static_cast<float>(kMaxSegments) ? kMaxSegments : max(static_cast<int>(n), 1);
+}
+
+// The start point is passed by value, it usually refers to the last point of \a out which grows while flattening.
+void flattenQuad(vector<Point>& out, Point p0, const Point& p1, const Point& p2, float tolerance) {
+    const int n = segmentCount(length(p0 - p1 * 2.f + p2) * 0.25f, tolerance);
+    const float step = 1.f / static_cast<float>(n);
+    for (int i = 1; i < n; ++i) {
+        const float t = static_cast<float>(i) * step;
+        const float u = 1.f - t;
+        out.push_back(p0 * (u * u) + p1 * (2.f * u * t) + p2 * (t * t));
+    }
+    out.push_back(p2);
+}
+
+void flattenCubic(vector<Point>& out, Point p0, const Point& p1, const Point& p2, const Point& p3, float tolerance) {
+    const float dd = max(length(p0 - p1 * 2.f + p2), length(p1 - p2 * 2.f + p3));
+    const int n = segmentCount(dd * 0.75f, tolerance);
+    const float step = 1.f / static_cast<float>(n);
+    for (int i = 1; i < n; ++i) {
+        const float t = static_cast<float>(i) * step;
+        const float u = 1.f - t;
+        out.push_back(p0 * (u * u * u) + p1 * (3.f * u * u * t) + p2 * (3.f * u * t * t) + p3 * (t * t * t));
+    }
+    out.push_back(p3);
+}
+
+// Rounds a scale up to a quarter octave.
+float scaleBucket(float scale) noexcept {
+    const float s = max(abs(scale), 1.f / 64.f);
+    return exp2(ceil(log2(s) * 4.f) * 0.25f);
+}
+} // namespace
+
+Path& Path::moveTo(const Point& p) {
+    addVerb(PathVerb::Move, {p});
+    mContourOpen = true;
+    mContourStart = p;
+    return *this;
+}
+
+Path& Path::lineTo(const Point& p) {
+    ensureContour();
+    addVerb(PathVerb::Line, {p});
+    return *this;
+}
+
+Path& Path::quadTo(const Point& control, const Point& end) {
+    ensureContour();
+    addVerb(PathVerb::Quad, {control, end});
+    return *this;
+}
+
+Path& Path::cubicTo(const Point& control1, const Point& control2, const Point& end) {
+    ensureContour();
+    addVerb(PathVerb::Cubic, {control1, control2, end});
+    return *this;
+}
+
+Path& Path::arcTo(const Ellipse& ellipse, float startAngle, float sweepAngle) {
+    constexpr float kRadians = numbers::pi_v<float> / 180.f;
+    const float sweep = clamp(sweepAngle, -360.f, 360.f) * kRadians;
+    auto pointAt = [&ellipse](float a) {
+        return Point(ellipse.center.x + ellipse.radiusX * cos(a), ellipse.center.y + ellipse.radiusY * sin(a));
+    };
+    auto tangentAt = [&ellipse](float a) { return Point(-ellipse.radiusX * sin(a), ellipse.radiusY * cos(a)); };
+
+    float a0 = startAngle * kRadians;
+    const Point start = pointAt(a0);
+    if (!mContourOpen) {
+        moveTo(start);
+    } else if (!(mData->points.back() == start)) {
+        lineTo(start);
+    }
+
+    // Each quarter turn or less is approximated by one cubic.
+    const int n = max(static_cast<int>(ceil(abs(sweep) / (numbers::pi_v<float> * 0.5f) - 1e-4f)), 1);
+    const float step = sweep / static_cast<float>(n);
+    const float k = 4.f / 3.f * tan(step * 0.25f);
+    for (int i = 0; i < n; ++i) {
+        const float a1 = a0 + step;
+        cubicTo(pointAt(a0) + tangentAt(a0) * k, pointAt(a1) - tangentAt(a1) * k, pointAt(a1));
+        a0 = a1;
+    }
+    return *this;
+}
+
+Path& Path::close() {
+    if (mContourOpen) {
+        addVerb(PathVerb::Close, {});
+        mContourOpen = false;
+    }
+    return *this;
+}
+
+Path& Path::addRect(const Rect& rect) {
+    moveTo(rect.lt());
+    lineTo(rect.rt());
+    lineTo(rect.rb());
+    lineTo(rect.lb());
+    return close();
+}
+
+Path& Path::addRoundRect(const RoundRect& rect) {
+    const Rect& r = rect.rect;
+    const float limit = max(min(r.width(), r.height()) * 0.5f, 0.f);
+    const float tl = clamp(rect.radii.topLeft, 0.f, limit);
+    const float tr = clamp(rect.radii.topRight, 0.f, limit);
+    const float br = clamp(rect.radii.bottomRight, 0.f, limit);
+    const float bl = clamp(rect.radii.bottomLeft, 0.f, limit);
+
+    // arcTo() connects to the start of each arc, sharp corners are plain line joints.
+    auto corner = [this](const Point& p, const Point& center, float radius, float startAngle) {
+        if (radius > 0.f) {
+            arcTo(Ellipse(center, radius), startAngle, 90.f);
+        } else {
+            lineTo(p);
+        }
+    };
+    moveTo({r.left + tl, r.top});
+    corner(r.rt(), {r.right - tr, r.top + tr}, tr, -90.f);
+    corner(r.rb(), {r.right - br, r.bottom - br}, br, 0.f);
+    corner(r.lb(), {r.left + bl, r.bottom - bl}, bl, 90.f);
+    corner(r.lt(), {r.left + tl, r.top + tl}, tl, 180.f);
+    return close();
+}
+
+Path& Path::addEllipse(const Ellipse& ellipse) {
+    moveTo({ellipse.center.x + ellipse.radiusX, ellipse.center.y});
+    arcTo(ellipse, 0, 360);
+    return close();
+}
+
+Path& Path::addPolygon(span<const Point> points, bool closed) {
+    if (points.empty()) { return *this; }
+    moveTo(points.front());
+    for (const Point& p : points.subspan(1)) { lineTo(p); }
+    return closed ? close() : *this;
+}
+
+void Path::reset() {
+    if (mData && mData.use_count() == 1) {
+        mData->verbs.clear();
+        mData->points.clear();
+        mData->bounds = {};
+        mData->flattened = nullptr;
+    } else {
+        mData = nullptr;
+    }
+    mContourOpen = false;
+    mContourStart = {};
+}
+
+span<const PathVerb> Path::verbs() const noexcept {
+    if (!mData) { return {}; }
+    return mData->verbs;
+}
+
+span<const Point> Path::points() const noexcept {
+    if (!mData) { return {}; }
+    return mData->points;
+}
+
+FlattenedPathPtr Path::flatten(float scale) const {
+    static const FlattenedPathPtr kEmpty = make_shared<FlattenedPath>();
+    if (isEmpty()) { return kEmpty; }
+    const float bucket = scaleBucket(scale);
+    if (mData->flattened && math::exactlyEqual(mData->flattened->scale, bucket)) { return mData->flattened; }
+
+    auto flat = make_shared<FlattenedPath>();
+    flat->scale = bucket;
+    const float tolerance = kTolerance / bucket;
+    auto& out = flat->points;
+    out.reserve(mData->points.size());
+    uint32_t contourStart = 0;
+    // Keeps the current contour when it has at least one segment.
+    auto finishContour = [&] {
+        const auto end = static_cast<uint32_t>(out.size());
+        if (end - contourStart >= 2) {
+            flat->contourEnds.push_back(end);
+        } else {
+            out.resize(contourStart);
+        }
+        contourStart = static_cast<uint32_t>(out.size());
+    };
+
+    const Point* p = mData->points.data();
+    for (const PathVerb verb : mData->verbs) {
+        switch (verb) {
+        case PathVerb::Move:
+            finishContour();
+            out.push_back(*p++);
+            break;
+        case PathVerb::Line: out.push_back(*p++); break;
+        case PathVerb::Quad:
+            flattenQuad(out, out.back(), p[0], p[1], tolerance);
+            p += 2;
+            break;
+        case PathVerb::Cubic:
+            flattenCubic(out, out.back(), p[0], p[1], p[2], tolerance);
+            p += 3;
+            break;
+        case PathVerb::Close: finishContour(); break;
+        }
+    }
+    finishContour();
+
+    if (!out.empty()) {
+        Rect bounds{out[0].x, out[0].y, out[0].x, out[0].y};
+        for (const Point& q : out) {
+            bounds = {min(bounds.left, q.x), min(bounds.top, q.y), max(bounds.right, q.x), max(bounds.bottom, q.y)};
+        }
+        flat->bounds = bounds;
+    }
+    mData->flattened = flat;
+    return flat;
+}
+
+Path::Data& Path::mutate() {
+    if (!mData) {
+        mData = make_shared<Data>();
+    } else if (mData.use_count() > 1) {
+        mData = make_shared<Data>(*mData);
+    }
+    mData->flattened = nullptr;
+    return *mData;
+}
+
+void Path::addVerb(PathVerb verb, initializer_list<Point> points) {
+    Data& data = mutate();
+    for (const Point& p : points) {
+        if (data.points.empty()) {
+            data.bounds = {p.x, p.y, p.x, p.y};
+        } else {
+            data.bounds = {
+                min(data.bounds.left, p.x),
+                min(data.bounds.top, p.y),
+                max(data.bounds.right, p.x),
+                max(data.bounds.bottom, p.y)
+            };
+        }
+    }
+    data.verbs.push_back(verb);
+    data.points.insert(data.points.end(), points);
+}
+
+void Path::ensureContour() {
+    if (!mContourOpen) { moveTo(mContourStart); }
+}
+} // namespace bix
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/graphics/pen.h"
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+// Default constructed pens share one style without a lookup.
+const StrokeStyleRef& defaultStroke() {
+    static const StrokeStyleRef stroke = StrokeStyleCache::shared().intern(StrokeStyle());
+    return stroke;
+}
+} // namespace
+
+Pen::Pen() : mStroke(defaultStroke()) {}
+
+Pen::Pen(Color color, float width) : mColor(color), mStroke(defaultStroke()) {
+    if (!math::exactlyEqual(width, mStroke->width())) { setStrokeWidth(width); }
+}
+
+Pen::Pen(Color color, const StrokeStyle& stroke) : mColor(color) {
+    setStrokeStyle(stroke);
+}
+
+void Pen::setStrokeStyle(const StrokeStyle& stroke) {
+    mStroke = StrokeStyleCache::shared().intern(stroke);
+}
+
+void Pen::setStrokeWidth(float w) {
+    modifyStroke([w](StrokeStyle& s) { s.setWidth(w); });
+}
+
+void Pen::setLineStyle(LineStyle style) {
+    modifyStroke([style](StrokeStyle& s) { s.setLineStyle(style); });
+}
+
+void Pen::setLineJoin(LineJoinStyle lineJoin) {
+    modifyStroke([lineJoin](StrokeStyle& s) { s.setLineJoin(lineJoin); });
+}
+
+void Pen::setLineCap(CapStyle start, CapStyle end, CapStyle dash) {
+    modifyStroke([=](StrokeStyle& s) { s.setLineCap(start, end, dash); });
+}
+
+void Pen::setStartCap(CapStyle start) {
+    modifyStroke([start](StrokeStyle& s) { s.setStartCap(start); });
+}
+
+void Pen::setEndCap(CapStyle end) {
+    modifyStroke([end](StrokeStyle& s) { s.setEndCap(end); });
+}
+
+void Pen::setDashCap(CapStyle dash) {
+    modifyStroke([dash](StrokeStyle& s) { s.setDashCap(dash); });
+}
+
+void Pen::setMiterLimit(float limit) {
+    modifyStroke([limit](StrokeStyle& s) { s.setMiterLimit(limit); });
+}
+
+void Pen::setDashOffset(float dashOffset) {
+    modifyStroke([dashOffset](StrokeStyle& s) { s.setDashOffset(dashOffset); });
+}
+
+void Pen::setCustomDash(const vector<float>& dashes) {
+    modifyStroke([&dashes](StrokeStyle& s) { s.setCustomDash(dashes); });
+}
+} // namespace bix
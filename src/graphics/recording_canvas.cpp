@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/graphics/recording_canvas.h"
+
+#include <stdexcept>
+
+namespace bix {
+
+RecordingCanvas::RecordingCanvas(DisplayList& list, Canvas& resources) : mList(list), mResources(resources) {
+    mList.reset();
+}
+
+ColorBrushPtr RecordingCanvas::createColorBrush(const Color& color) {
+    return mResources.createColorBrush(color);
+}
+
+LinearGradientBrushPtr RecordingCanvas::createLinearGradientBrush(
+    const Point& start,
+    const Point& end,
+    const Gradient& gradient
+) {
+    return mResources.createLinearGradientBrush(start, end, gradient);
+}
+
+RadialGradientBrushPtr RecordingCanvas::createRadialGradientBrush(const Ellipse& ellipse, const Gradient& gradient) {
+    return mResources.createRadialGradientBrush(ellipse, gradient);
+}
+
+ConicGradientBrushPtr RecordingCanvas::createConicGradientBrush(
+    const Point& center,
+    float startAngle,
+    const Gradient& gradient
+) {
+    return mResources.createConicGradientBrush(center, startAngle, gradient);
+}
+
+TextPaintPtr RecordingCanvas::createTextPaint() {
+    return mResources.createTextPaint();
+}
+
+void RecordingCanvas::beginDraw() {
+    mList.reset();
+    mClipDepth = 0;
+}
+
+DrawResult RecordingCanvas::endDraw() {
+    return mClipDepth == 0 ? DrawResult::Success : DrawResult::Error;
+}
+
+void RecordingCanvas::setTransform(const Transform& transform) {
+    mList.setTransform(transform);
+}
+
+void RecordingCanvas::resize(const Size& size) {
+    BIX_UNUSED(size)
+}
+
+void RecordingCanvas::clear(const Color& c) {
+    mList.clear(c);
+}
+
+bool RecordingCanvas::pushClip(const RoundRect& rect) {
+    if (!rect.rect.isValid()) { return false; }
+    mList.pushClip(rect);
+    ++mClipDepth;
+    return true;
+}
+
+void RecordingCanvas::popClip() {
+    if (mClipDepth == 0) { throw std::runtime_error("pop clip fail,clip stack empty"); }
+    mList.popClip();
+    --mClipDepth;
+}
+
+Size RecordingCanvas::size() const noexcept {
+    return mResources.size();
+}
+
+void RecordingCanvas::fillRectangle(const Rect& rect, Brush& brush) {
+    // Brushes are captured by value, later changes to the brush do not affect the recording.
+    if (brush.style() == BrushStyle::SolidColor) {
+        mList.fillRectangle(rect, static_cast<ColorBrush&>(brush).color(), brush.opacity());
+    } else {
+        mList.fillRectangle(rect, static_cast<GradientBrush&>(brush));
+    }
+}
+
+void RecordingCanvas::fillRects(std::span<const Rect> rects, Brush& brush) {
+    if (brush.style() == BrushStyle::SolidColor) {
+        mList.fillRects(rects, static_cast<ColorBrush&>(brush).color(), brush.opacity());
+    } else {
+        mList.fillRects(rects, static_cast<GradientBrush&>(brush));
+    }
+}
+
+void RecordingCanvas::fillPath(const Path& path, Brush& brush) {
+    if (brush.style() == BrushStyle::SolidColor) {
+        mList.fillPath(path, static_cast<ColorBrush&>(brush).color(), brush.opacity());
+    } else {
+        mList.fillPath(path, static_cast<GradientBrush&>(brush));
+    }
+}
+
+void RecordingCanvas::fillRoundRect(const RoundRect& rect, Brush& brush) {
+    if (brush.style() == BrushStyle::SolidColor) {
+        mList.fillRoundRect(rect, static_cast<ColorBrush&>(brush).color(), brush.opacity());
+    } else {
+        mList.fillRoundRect(rect, static_cast<GradientBrush&>(brush));
+    }
+}
+
+void RecordingCanvas::fillEllipse(const Ellipse& ellipse, Brush& brush) {
+    if (brush.style() == BrushStyle::SolidColor) {
+        mList.fillEllipse(ellipse, static_cast<ColorBrush&>(brush).color(), brush.opacity());
+    } else {
+        mList.fillEllipse(ellipse, static_cast<GradientBrush&>(brush));
+    }
+}
+
+void RecordingCanvas::drawBitmap(
+    const Bitmap& bitmap,
+    const Rect& src,
+    const Rect& dst,
+    float opacity,
+    BitmapSampling sampling
+) {
+    mList.drawBitmap(bitmap, src, dst, opacity, sampling);
+}
+
+void RecordingCanvas::drawRectangle(const Rect& rect, const Pen& pen) {
+    mList.drawRectangle(rect, pen);
+}
+
+void RecordingCanvas::drawRects(std::span<const Rect> rects, const Pen& pen) {
+    mList.drawRects(rects, pen);
+}
+
+void RecordingCanvas::drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) {
+    mList.drawRoundRect(rect, radiusX, radiusY, pen);
+}
+
+void RecordingCanvas::drawRoundRect(const RoundRect& rect, const Pen& pen) {
+    mList.drawRoundRect(rect, pen);
+}
+
+void RecordingCanvas::drawEllipse(const Ellipse& ellipse, const Pen& pen) {
+    mList.drawEllipse(ellipse, pen);
+}
+
+void RecordingCanvas::measureText(TextPaint& format, TextMetrics& metrics) {
+    mResources.measureText(format, metrics);
+}
+
+void RecordingCanvas::drawText(const Point& origin, TextPaint& text, const Pen& pen) {
+    mList.drawText(origin, text, pen);
+}
+
+void RecordingCanvas::drawLine(const geom::Line& line, const Pen& pen) {
+    mList.drawLine(line, pen);
+}
+
+void RecordingCanvas::drawLines(std::span<const geom::Line> lines, const Pen& pen) {
+    mList.drawLines(lines, pen);
+}
+} // namespace bix
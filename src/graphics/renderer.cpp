@@ -14,14 +14,24 @@
  * limitations under the License.
  */
 
-#include "render/d2d/engine.h"
-
 #include <bixlib/graphics/engine.h>
 
+#ifdef BIX_RENDERER_D2D
+    #include "d2d/engine.h"
+#endif
+#ifdef BIX_RENDERER_SOFTWARE
+    #include "software/engine.h"
+#endif
+
 namespace bix {
 
 RenderEngine* RenderEngine::from(Type t) {
+#ifdef BIX_RENDERER_D2D
     if (t == Direct2D) { return Direct2DEngine::instance(); }
+#endif
+#ifdef BIX_RENDERER_SOFTWARE
+    if (t == Software) { return SoftwareEngine::instance(); }
+#endif
     return nullptr;
 }
 } // namespace bix
\ No newline at end of file
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scan_converter.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+
+namespace bix::raster {
+
+namespace {
+// floor() and ceil() of non-negative values, cheaper than the library calls on targets without SSE4.1.
+int floorPositive(float v) noexcept {
+    return static_cast<int>(v);
+}
+
+int ceilPositive(float v) noexcept {
+    const int i = static_cast<int>(v);
+    return static_cast<float>(i) < v ? i + 1 : i;
+}
+} // namespace
+
+void ScanConverter::reset(const RectI& clip) {
+    mClip = clip;
+    mEdges.clear();
+    mMinX = mMinY = numeric_limits<float>::max();
+    mMaxX = mMaxY = numeric_limits<float>::lowest();
+}
+
+void ScanConverter::addEdge(Point p0, Point p1) {
+    if (math::exactlyEqual(p0.y, p1.y) || !isfinite(p0.x + p0.y + p1.x + p1.y)) { return; }
+    const auto top = static_cast<float>(mClip.top);
+    const auto bottom = static_cast<float>(mClip.bottom);
+    if ((p0.y <= top && p1.y <= top) || (p0.y >= bottom && p1.y >= bottom)) { return; }
+
+    // Coverage only flows to the right, so the parts of an edge left of the clip become a vertical edge on its
+    // left side and the parts right of it are dropped. The edge is split where it crosses the clip sides.
+    const auto left = static_cast<float>(mClip.left);
+    const auto right = static_cast<float>(mClip.right);
+    float cuts[4]{0, 1, 1, 1};
+    int cutCount = 1;
+    for (const float side : {left, right}) {
+        if ((p0.x - side) * (p1.x - side) < 0) { cuts[cutCount++] = (side - p0.x) / (p1.x - p0.x); }
+    }
+    cuts[cutCount++] = 1;
+    sort(cuts, cuts + cutCount);
+
+    const Point d = p1 - p0;
+    for (int i = 0; i + 1 < cutCount; ++i) {
+        const Point a = p0 + d * cuts[i];
+        const Point b = i + 2 == cutCount ? p1 : p0 + d * cuts[i + 1];
+        const float mid = (a.x + b.x) * 0.5f;
+        if (mid >= right) {
+            // The shape may extend to the right side of the clip.
+            mMaxX = max(mMaxX, right);
+            continue;
+        }
+        if (mid <= left) {
+            pushEdge(left, a.y, left, b.y);
+        } else {
+            pushEdge(clamp(a.x, left, right), a.y, clamp(b.x, left, right), b.y);
+        }
+    }
+}
+
+void ScanConverter::addPolygon(span<const Point> points) {
+    if (points.size() < 2) { return; }
+    for (size_t i = 1; i < points.size(); ++i) { addEdge(points[i - 1], points[i]); }
+    addEdge(points.back(), points.front());
+}
+
+RectI ScanConverter::bounds() const noexcept {
+    if (mEdges.empty()) { return {}; }
+    const RectI touched{
+        static_cast<int>(floor(mMinX)),
+        static_cast<int>(floor(mMinY)),
+        static_cast<int>(ceil(mMaxX)),
+        static_cast<int>(ceil(mMaxY))
+    };
+    return touched.intersected(mClip);
+}
+
+void ScanConverter::pushEdge(float x0, float y0, float x1, float y1) {
+    if (math::exactlyEqual(y0, y1)) { return; }
+    float dir = 1;
+    if (y0 > y1) {
+        swap(x0, x1);
+        swap(y0, y1);
+        dir = -1;
+    }
+    mEdges.push_back({x0, y0, x1, y1, dir});
+    mMinX = min({mMinX, x0, x1});
+    mMaxX = max({mMaxX, x0, x1});
+    mMinY = min(mMinY, y0);
+    mMaxY = max(mMaxY, y1);
+}
+
+void ScanConverter::prepare(const RectI& area) {
+    mArea = area;
+    mStride = static_cast<size_t>(area.width()) + 2;
+    // The accumulation buffer is all zero between sweeps, resolveRow() clears every row it reads.
+    const size_t size = mStride * kBandHeight;
+    if (mAccum.size() < size) { mAccum.resize(size, 0.f); }
+    mBlockStride = (mStride + kBlockWidth - 1) / kBlockWidth;
+    if (mDirty.size() < mBlockStride * kBandHeight) { mDirty.resize(mBlockStride * kBandHeight, 0); }
+    if (mCoverage.size() < static_cast<size_t>(area.width())) { mCoverage.resize(static_cast<size_t>(area.width())); }
+    sort(mEdges.begin(), mEdges.end(), [](const Edge& a, const Edge& b) { return a.y0 < b.y0; });
+}
+
+void ScanConverter::accumulateBand(int top, int bottom) {
+    const auto bandBottom = static_cast<float>(bottom);
+    const auto bandTop = static_cast<float>(top);
+    for (const Edge& edge : mEdges) {
+        if (edge.y0 >= bandBottom) { break; }
+        if (edge.y1 > bandTop) { accumulate(edge, top, bottom); }
+    }
+}
+
+void ScanConverter::accumulate(const Edge& edge, int top, int bottom) {
+    const float y0 = max(edge.y0, static_cast<float>(top));
+    const float y1 = min(edge.y1, static_cast<float>(bottom));
+    if (y0 >= y1) { return; }
+    const float dxdy = (edge.x1 - edge.x0) / (edge.y1 - edge.y0);
+    const auto width = static_cast<float>(mArea.width());
+    float x = edge.x0 + (y0 - edge.y0) * dxdy - static_cast<float>(mArea.left);
+
+    const auto yEnd = static_cast<int>(ceil(y1));
+    for (auto y = static_cast<int>(floor(y0)); y < yEnd; ++y) {
+        float* row = mAccum.data() + static_cast<size_t>(y - top) * mStride;
+        const auto fy = static_cast<float>(y);
+        const float dy = min(fy + 1.f, y1) - max(fy, y0);
+        const float xNext = x + dxdy * dy;
+        const float d = dy * edge.dir;
+        const float xa = clamp(min(x, xNext), 0.f, width);
+        const float xb = clamp(max(x, xNext), 0.f, width);
+        const int ia = floorPositive(xa);
+        const int ib = ceilPositive(xb);
+        const auto xaFloor = static_cast<float>(ia);
+        uint8_t* dirty = mDirty.data() + static_cast<size_t>(y - top) * mBlockStride;
+        fill(dirty + ia / kBlockWidth, dirty + (ib + 1) / kBlockWidth + 1, uint8_t{1});
+
+        if (ib <= ia + 1) {
+            // The edge stays within one pixel column, the part of the pixel right of it is covered.
+            const float xm = (xa + xb) * 0.5f - xaFloor;
+            row[ia] += d - d * xm;
+            row[ia + 1] += d * xm;
+        } else {
+            // Distribute the trapezoid areas over the columns the edge crosses.
+            const float s = 1.f / (xb - xa);
+            const float fa = xa - xaFloor;
+            const float a0 = 0.5f * s * (1.f - fa) * (1.f - fa);
+            const float fb = xb - static_cast<float>(ib) + 1.f;
+            const float am = 0.5f * s * fb * fb;
+            row[ia] += d * a0;
+            if (ib == ia + 2) {
+                row[ia + 1] += d * (1.f - a0 - am);
+            } else {
+                const float a1 = s * (1.5f - fa);
+                row[ia + 1] += d * (a1 - a0);
+                for (int i = ia + 2; i < ib - 1; ++i) { row[i] += d * s; }
+                const float a2 = a1 + static_cast<float>(ib - ia - 3) * s;
+                row[ib - 1] += d * (1.f - a2 - am);
+            }
+            row[ib] += d * am;
+        }
+        x = xNext;
+    }
+}
+
+span<const uint8_t> ScanConverter::resolveRow(int row, FillRule rule, int& x) {
+    float* acc = mAccum.data() + static_cast<size_t>(row) * mStride;
+    uint8_t* dirty = mDirty.data() + static_cast<size_t>(row) * mBlockStride;
+    uint8_t* coverage = mCoverage.data();
+    const int width = mArea.width();
+    auto toCoverage = [rule](float sum) {
+        float c = abs(sum);
+        if (rule == FillRule::EvenOdd) {
+            c -= 2.f * static_cast<float>(floorPositive(c * 0.5f));
+            if (c > 1.f) { c = 2.f - c; }
+        } else {
+            c = min(c, 1.f);
+        }
+        return static_cast<uint8_t>(c * 255.f + 0.5f);
+    };
+
+    // Clean blocks are collected into runs that are filled with one call.
+    float sum = 0;
+    uint8_t current = 0;
+    int clean = 0;
+    for (int begin = 0, block = 0; begin < width; begin += kBlockWidth, ++block) {
+        if (!dirty[block]) { continue; }
+        dirty[block] = 0;
+        if (begin > clean) { memset(coverage + clean, current, static_cast<size_t>(begin - clean)); }
+        const int end = min(begin + kBlockWidth, width);
+        for (int i = begin; i < end; ++i) {
+            sum += acc[i];
+            acc[i] = 0;
+            coverage[i] = toCoverage(sum);
+        }
+        current = coverage[end - 1];
+        clean = end;
+    }
+    if (width > clean) { memset(coverage + clean, current, static_cast<size_t>(width - clean)); }
+    // Edges on the right side of the area also touch the two columns past it.
+    acc[width] = 0;
+    acc[width + 1] = 0;
+    fill(dirty, dirty + mBlockStride, uint8_t{0});
+
+    int first = 0;
+    int last = width;
+    while (first < last && coverage[first] == 0) { ++first; }
+    while (last > first && coverage[last - 1] == 0) { --last; }
+    if (first == last) { return {}; }
+    x = mArea.left + first;
+    return {coverage + first, static_cast<size_t>(last - first)};
+}
+} // namespace bix::raster
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/graphics/path.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace bix::raster {
+
+/**
+ * Converts polygons in device space into anti-aliased coverage spans.
+ *
+ * Every edge adds the exact area it covers to the pixels it crosses and the coverage of a row is the running sum
+ * of those contributions, so coverage is computed analytically instead of by supersampling. Overlapping contours
+ * combine by their signed winding, which is exact for non-zero fills and for even-odd fills as long as contours do
+ * not overlap within one pixel.
+ *
+ * Only the column blocks crossed by an edge are resolved pixel by pixel, the blocks in between are filled with
+ * the running coverage at once. Rows are accumulated in bands of kBandHeight rows, memory use depends on the clip
+ * width only and the buffers are reused, so a converter kept by a canvas does not allocate once warmed up. It does
+ * not depend on a pixel format and can be used by any CPU backend.
+ */
+class ScanConverter {
+public:
+    static constexpr int kBandHeight = 16;
+    /** Columns are tracked in blocks, blocks not crossed by an edge keep the coverage of their left neighbor. */
+    static constexpr int kBlockWidth = 16;
+
+    /**
+     * Removes all edges and starts a new shape.
+     * @param clip The device area coverage is computed for, everything outside is discarded.
+     */
+    void reset(const RectI& clip);
+
+    /** Adds a directed edge in device space. */
+    void addEdge(Point p0, Point p1);
+
+    /** Adds a closed polygon in device space. */
+    void addPolygon(std::span<const Point> points);
+
+    /** Returns the device area touched by the added edges, within the clip. */
+    RectI bounds() const noexcept;
+
+    /**
+     * Computes the coverage of the shape and passes it row by row to \a emit as
+     * `emit(int y, int x, const uint8_t* coverage, int count)`. Empty rows are skipped and leading and trailing
+     * empty pixels of a row are trimmed.
+     */
+    template <typename Emit>
+    void sweep(FillRule rule, Emit&& emit) {
+        const RectI area = bounds();
+        if (area.isEmpty()) { return; }
+        prepare(area);
+        for (int top = area.top; top < area.bottom; top += kBandHeight) {
+            const int bottom = std::min(top + kBandHeight, area.bottom);
+            accumulateBand(top, bottom);
+            for (int y = top; y < bottom; ++y) {
+                int x = 0;
+                const std::span<const uint8_t> coverage = resolveRow(y - top, rule, x);
+                if (!coverage.empty()) { emit(y, x, coverage.data(), static_cast<int>(coverage.size())); }
+            }
+        }
+    }
+
+    /** Returns the number of edges added since the last reset. */
+    size_t edgeCount() const noexcept { return mEdges.size(); }
+
+private:
+    // An edge with y0 < y1, dir is +1 for edges going down and -1 for edges going up.
+    struct Edge {
+        float x0;
+        float y0;
+        float x1;
+        float y1;
+        float dir;
+    };
+
+    void pushEdge(float x0, float y0, float x1, float y1);
+    void prepare(const RectI& area);
+    void accumulateBand(int top, int bottom);
+    void accumulate(const Edge& edge, int top, int bottom);
+    // Returns the trimmed coverage of a band row and clears the row for the next band.
+    std::span<const uint8_t> resolveRow(int row, FillRule rule, int& x);
+
+    RectI mClip;
+    float mMinX = 0;
+    float mMinY = 0;
+    float mMaxX = 0;
+    float mMaxY = 0;
+    std::vector<Edge> mEdges;
+
+    RectI mArea;
+    size_t mStride = 0;
+    size_t mBlockStride = 0;
+    std::vector<float> mAccum;
+    std::vector<uint8_t> mDirty; ///< Blocks of each band row crossed by an edge.
+    std::vector<uint8_t> mCoverage;
+};
+} // namespace bix::raster
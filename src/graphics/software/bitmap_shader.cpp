@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bitmap_shader.h"
+
+#include "blend-inl.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace bix {
+
+namespace {
+// Sample positions are stepped in 16.16 fixed point, 64 bits wide to cover any bitmap size.
+constexpr int kFixedShift = 16;
+constexpr float kFixedOne = 65536.f;
+
+int64_t toFixed(float v) noexcept {
+    return static_cast<int64_t>(std::llround(v * kFixedOne));
+}
+
+// The pixel containing a fixed point position and the 8-bit weight of the next pixel.
+int pixelOf(int64_t v) noexcept {
+    return static_cast<int>(v >> kFixedShift);
+}
+
+uint32_t weightOf(int64_t v) noexcept {
+    return static_cast<uint32_t>((v >> (kFixedShift - 8)) & 0xFF);
+}
+} // namespace
+
+BitmapShader::BitmapShader(
+    const Bitmap& bitmap,
+    const Rect& src,
+    const Rect& dst,
+    uint8_t opacity,
+    BitmapSampling sampling,
+    float scaleX,
+    float scaleY,
+    float offsetX,
+    float offsetY,
+    std::vector<uint32_t>& scratch
+)
+    : Shader(opacity)
+    , mBitmap(bitmap)
+    , mSampling(sampling)
+    , mScratch(scratch) {
+    const RectI covered(
+        math::floor_cast<int>(src.left),
+        math::floor_cast<int>(src.top),
+        math::ceil_cast<int>(src.right),
+        math::ceil_cast<int>(src.bottom)
+    );
+    mRegion = covered.intersected(bitmap.bounds());
+
+    // Device pixel center -> canvas space -> bitmap pixels, positions are stepped in fixed point so rows start
+    // without any float conversions.
+    const float ratioX = src.width() / dst.width();
+    const float ratioY = src.height() / dst.height();
+    const float center = sampling == BitmapSampling::Linear ? 0.5f : 0.f;
+    const float originX = src.left - center - static_cast<float>(mRegion.left);
+    const float originY = src.top - center - static_cast<float>(mRegion.top);
+    mStepX = toFixed(ratioX / scaleX);
+    mStepY = toFixed(ratioY / scaleY);
+    mX0 = toFixed(originX + ((0.5f - offsetX) / scaleX - dst.left) * ratioX);
+    mY0 = toFixed(originY + ((0.5f - offsetY) / scaleY - dst.top) * ratioY);
+
+    if (bitmap.format() != PixelFormat::RGBA8Premultiplied) {
+        const auto width = static_cast<size_t>(std::max(mRegion.width(), 0));
+        if (mScratch.size() < width * 2) { mScratch.resize(width * 2); }
+    }
+}
+
+const uint32_t* BitmapShader::sourceRow(int y) noexcept {
+    if (mBitmap.format() == PixelFormat::RGBA8Premultiplied) {
+        return reinterpret_cast<const uint32_t*>(mBitmap.row(y)) + mRegion.left;
+    }
+    const auto width = static_cast<size_t>(mRegion.width());
+    for (int slot = 0; slot < 2; ++slot) {
+        if (mCachedRows[slot] == y) {
+            // Keep the row that was just used, the next conversion goes into the other slot.
+            mNextSlot = 1 - slot;
+            return mScratch.data() + static_cast<size_t>(slot) * width;
+        }
+    }
+    const int slot = mNextSlot;
+    mNextSlot = 1 - slot;
+    mCachedRows[slot] = y;
+    uint32_t* row = mScratch.data() + static_cast<size_t>(slot) * width;
+    mBitmap.readPixels(y, mRegion.left, mRegion.width(), row);
+    return row;
+}
+
+void BitmapShader::shadeRow(int y, int x, int count, uint32_t* out) noexcept {
+    if (mRegion.isEmpty()) {
+        std::fill_n(out, count, 0u);
+        return;
+    }
+    const int lastX = mRegion.width() - 1;
+    const int lastY = mRegion.height() - 1;
+    const int64_t fy = mY0 + y * mStepY;
+    int64_t fx = mX0 + x * mStepX;
+
+    if (mSampling == BitmapSampling::Nearest) {
+        const uint32_t* row = sourceRow(mRegion.top + std::clamp(pixelOf(fy), 0, lastY));
+        for (int i = 0; i < count; ++i, fx += mStepX) { out[i] = row[std::clamp(pixelOf(fx), 0, lastX)]; }
+        return;
+    }
+
+    // Bilinear sampling interpolates between the pixels whose centers surround the sample position.
+    const uint32_t wy = weightOf(fy);
+    const uint32_t* top = sourceRow(mRegion.top + std::clamp(pixelOf(fy), 0, lastY));
+    const uint32_t* bottom = wy != 0 ? sourceRow(mRegion.top + std::clamp(pixelOf(fy) + 1, 0, lastY)) : top;
+    for (int i = 0; i < count; ++i, fx += mStepX) {
+        const int px = pixelOf(fx);
+        const int x0 = std::clamp(px, 0, lastX);
+        const int x1 = std::clamp(px + 1, 0, lastX);
+        const uint32_t wx = weightOf(fx);
+        const uint32_t upper = pixel::lerp(top[x0], top[x1], wx);
+        out[i] = wy == 0 ? upper : pixel::lerp(upper, pixel::lerp(bottom[x0], bottom[x1], wx), wy);
+    }
+}
+} // namespace bix
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/graphics/bitmap.h"
+
+#include "shader.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace bix {
+
+/**
+ * Samples a region of a bitmap scaled into a rectangle for rows of device pixels.
+ *
+ * Pixel centers are mapped back through the canvas transform and the rectangle into bitmap pixels. Samples are
+ * clamped to the pixels of the region, so neighbouring pixels of an atlas or a nine-patch never bleed in.
+ */
+class BitmapShader final : public Shader {
+public:
+    /**
+     * @param bitmap The bitmap to sample, usually a mip level.
+     * @param src The region of the bitmap in its pixels, within the bitmap bounds.
+     * @param dst The rectangle the region is drawn into, in canvas space.
+     * @param opacity The opacity multiplied into all pixels.
+     * @param sampling How pixels are sampled.
+     * @param scaleX Horizontal scale of the canvas transform.
+     * @param scaleY Vertical scale of the canvas transform.
+     * @param offsetX Horizontal translation of the canvas transform.
+     * @param offsetY Vertical translation of the canvas transform.
+     * @param scratch Storage for converted rows of bitmaps not in RGBA8Premultiplied format.
+     */
+    BitmapShader(
+        const Bitmap& bitmap,
+        const Rect& src,
+        const Rect& dst,
+        uint8_t opacity,
+        BitmapSampling sampling,
+        float scaleX,
+        float scaleY,
+        float offsetX,
+        float offsetY,
+        std::vector<uint32_t>& scratch
+    );
+
+    void shadeRow(int y, int x, int count, uint32_t* out) noexcept override;
+
+private:
+    // Returns a row of the region in premultiplied RGBA8, indexed by bitmap column.
+    const uint32_t* sourceRow(int y) noexcept;
+
+    const Bitmap& mBitmap;
+    BitmapSampling mSampling;
+    RectI mRegion;
+
+    // Fixed point position relative to the region of the center of device pixel (0, 0) and the step per device
+    // pixel, bilinear positions are shifted by half a pixel so that they address pixel centers.
+    int64_t mX0 = 0;
+    int64_t mY0 = 0;
+    int64_t mStepX = 0;
+    int64_t mStepY = 0;
+
+    // Two converted rows for non-native formats, bilinear sampling reads pairs of neighbouring rows.
+    std::vector<uint32_t>& mScratch;
+    int mCachedRows[2]{-1, -1};
+    int mNextSlot = 0;
+};
+} // namespace bix
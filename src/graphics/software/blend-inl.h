@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/graphics/color.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace bix::pixel {
+
+// Pixels are stored as premultiplied RGBA8, red in the lowest byte, so that the byte order in memory is R, G, B, A
+// on little-endian machines.
+
+constexpr uint32_t kRedBlueMask = 0x00FF00FFu;
+
+/** Divides a product of two 8-bit values by 255 with correct rounding. */
+constexpr uint32_t div255(uint32_t v) noexcept {
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+constexpr uint32_t pack(uint32_t r, uint32_t g, uint32_t b, uint32_t a) noexcept {
+    return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+constexpr uint32_t alphaOf(uint32_t p) noexcept {
+    return p >> 24;
+}
+
+/**
+ * Converts a color into a premultiplied pixel.
+ * @param c The source color, invalid colors map to a fully transparent pixel.
+ * @param opacity Additional opacity in range [0, 1] multiplied into the color alpha.
+ */
+inline uint32_t premultiply(const Color& c, float opacity = 1.0f) noexcept {
+    if (!c.isValid()) { return 0; }
+    auto a = static_cast<uint32_t>(c.alpha());
+    if (opacity < 1.0f) { a = static_cast<uint32_t>(static_cast<float>(a) * std::max(opacity, 0.0f) + 0.5f); }
+    return pack(
+        div255(static_cast<uint32_t>(c.red()) * a),
+        div255(static_cast<uint32_t>(c.green()) * a),
+        div255(static_cast<uint32_t>(c.blue()) * a),
+        a
+    );
+}
+
+/** Converts a premultiplied pixel back into a straight-alpha color. */
+inline Color unpremultiply(uint32_t p) noexcept {
+    const uint32_t a = alphaOf(p);
+    if (a == 0) { return {0, 0, 0, 0}; }
+    auto channel = [a](uint32_t v) { return static_cast<int>(std::min<uint32_t>((v * 255 + a / 2) / a, 255)); };
+    return {channel(p & 0xFF), channel((p >> 8) & 0xFF), channel((p >> 16) & 0xFF), static_cast<int>(a)};
+}
+
+/**
+ * Scales all four channels of a pixel.
+ * @param p The premultiplied pixel.
+ * @param factor The factor in range [0, 256], where 256 keeps the pixel unchanged.
+ */
+constexpr uint32_t scale(uint32_t p, uint32_t factor) noexcept {
+    const uint32_t rb = (((p & kRedBlueMask) * factor) >> 8) & kRedBlueMask;
+    const uint32_t ag = (((p >> 8) & kRedBlueMask) * factor) & ~kRedBlueMask;
+    return rb | ag;
+}
+
+/**
+ * Interpolates between two pixels.
+ * @param weight The weight of \a b in range [0, 256].
+ */
+constexpr uint32_t lerp(uint32_t a, uint32_t b, uint32_t weight) noexcept {
+    const uint32_t inv = 256 - weight;
+    const uint32_t rb = (((a & kRedBlueMask) * inv + (b & kRedBlueMask) * weight) >> 8) & kRedBlueMask;
+    const uint32_t ag = (((a >> 8) & kRedBlueMask) * inv + ((b >> 8) & kRedBlueMask) * weight) & ~kRedBlueMask;
+    return rb | ag;
+}
+
+/**
+ * Multiplies all four channels of a pixel by an 8-bit factor, dividing by 255 with correct rounding.
+ * @param p The premultiplied pixel.
+ * @param factor The factor in range [0, 255], where 255 keeps the pixel unchanged.
+ */
+constexpr uint32_t mul255(uint32_t p, uint32_t factor) noexcept {
+    uint32_t rb = (p & kRedBlueMask) * factor + 0x00800080u;
+    rb = ((rb + ((rb >> 8) & kRedBlueMask)) >> 8) & kRedBlueMask;
+    uint32_t ag = ((p >> 8) & kRedBlueMask) * factor + 0x00800080u;
+    ag = (ag + ((ag >> 8) & kRedBlueMask)) & ~kRedBlueMask;
+    return rb | ag;
+}
+
+/** Converts a straight-alpha pixel into a premultiplied pixel. */
+constexpr uint32_t premultiplyPixel(uint32_t p) noexcept {
+    const uint32_t a = alphaOf(p);
+    return (mul255(p, a) & 0x00FFFFFFu) | (a << 24);
+}
+
+/** Converts a premultiplied pixel back into a straight-alpha pixel. */
+constexpr uint32_t unpremultiplyPixel(uint32_t p) noexcept {
+    const uint32_t a = alphaOf(p);
+    if (a == 255 || a == 0) { return a == 0 ? 0 : p; }
+    auto channel = [a](uint32_t v) { return std::min<uint32_t>((v * 255 + a / 2) / a, 255); };
+    return pack(channel(p & 0xFF), channel((p >> 8) & 0xFF), channel((p >> 16) & 0xFF), a);
+}
+
+/** Maps an 8-bit coverage value to the [0, 256] range used by scale(). */
+constexpr uint32_t coverageScale(uint32_t coverage) noexcept {
+    return coverage + (coverage >> 7);
+}
+
+/** Composites a premultiplied source pixel over a destination pixel (Porter-Duff source-over). */
+constexpr uint32_t srcOver(uint32_t src, uint32_t dst) noexcept {
+    return src + mul255(dst, 255 - alphaOf(src));
+}
+
+/** Multiplies two 8-bit coverage values. */
+constexpr uint8_t mulCoverage(uint32_t a, uint32_t b) noexcept {
+    return static_cast<uint8_t>(div255(a * b));
+}
+
+/** Blends a single premultiplied color over a run of pixels with a constant coverage. */
+inline void blendRow(uint32_t* dst, int count, uint32_t src, uint8_t coverage) noexcept {
+    if (coverage == 0 || src == 0) { return; }
+    if (coverage == 255 && alphaOf(src) == 255) {
+        std::fill_n(dst, count, src);
+        return;
+    }
+    const uint32_t s = coverage == 255 ? src : mul255(src, coverage);
+    const uint32_t inv = 255 - alphaOf(s);
+    for (int i = 0; i < count; ++i) { dst[i] = s + mul255(dst[i], inv); }
+}
+
+/** Blends a single premultiplied color over a run of pixels using per-pixel coverage. */
+inline void blendRow(uint32_t* dst, const uint8_t* coverage, int count, uint32_t src) noexcept {
+    if (src == 0) { return; }
+    const bool opaque = alphaOf(src) == 255;
+    for (int i = 0; i < count; ++i) {
+        const uint8_t c = coverage[i];
+        if (c == 0) { continue; }
+        if (c == 255 && opaque) {
+            dst[i] = src;
+        } else {
+            dst[i] = srcOver(mul255(src, c), dst[i]);
+        }
+    }
+}
+
+/** Composites a row of premultiplied pixels, multiplied by an opacity, over another row. */
+inline void blendSpan(uint32_t* dst, const uint32_t* src, int count, uint8_t opacity) noexcept {
+    if (opacity == 0) { return; }
+    for (int i = 0; i < count; ++i) {
+        const uint32_t s = opacity == 255 ? src[i] : mul255(src[i], opacity);
+        if (s == 0) { continue; }
+        dst[i] = alphaOf(s) == 255 ? s : srcOver(s, dst[i]);
+    }
+}
+
+/** Multiplies all channels of a row of pixels by an opacity. */
+inline void multiplyRow(uint32_t* row, int count, uint8_t opacity) noexcept {
+    if (opacity == 255) { return; }
+    for (int i = 0; i < count; ++i) { row[i] = mul255(row[i], opacity); }
+}
+
+inline void premultiplyRow(uint32_t* row, int count) noexcept {
+    for (int i = 0; i < count; ++i) { row[i] = premultiplyPixel(row[i]); }
+}
+
+inline void unpremultiplyRow(uint32_t* row, int count) noexcept {
+    for (int i = 0; i < count; ++i) { row[i] = unpremultiplyPixel(row[i]); }
+}
+} // namespace bix::pixel
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/graphics/brush.h"
+#include "bixlib/utils/concepts.h"
+
+#include <algorithm>
+
+namespace bix {
+
+constexpr static long SoftColorBrush_CAST_ID = 1766498211L;
+constexpr static long SoftGradientBrush_CAST_ID = 1766498212L;
+
+class SoftColorBrush : public ColorBrush {
+public:
+    SoftColorBrush(const Color& color, uintptr_t scopeId) : mColor(color), mScopeId(scopeId) {}
+
+    void setColor(const Color& color) override { mColor = color; }
+
+    Color color() const noexcept override { return mColor; }
+
+    void setOpacity(float opacity) override { mOpacity = std::clamp(opacity, 0.0f, 1.0f); }
+
+    float opacity() const noexcept override { return mOpacity; }
+
+    bool testCast(uintptr_t scope, long castId) const noexcept override {
+        if (scope != mScopeId || SoftColorBrush_CAST_ID != castId) { return false; }
+        return true;
+    }
+
+private:
+    Color mColor;
+    float mOpacity = 1.0f;
+    const uintptr_t mScopeId;
+};
+
+/**
+ * Gradient brush of the software backend, holding the ramp of its gradient from the shared cache.
+ * @tparam Base One of the public gradient brush classes.
+ */
+template <DerivedFrom<GradientBrush> Base>
+class SoftGradientBrush final : public Base {
+public:
+    template <typename... Args>
+    SoftGradientBrush(uintptr_t scopeId, GradientRampCachePtr cache, Args&&... args)
+        : Base(std::forward<Args>(args)...)
+        , mCache(std::move(cache))
+        , mScopeId(scopeId) {}
+
+    void setGradient(Gradient gradient) override {
+        Base::setGradient(std::move(gradient));
+        mRamp = nullptr;
+    }
+
+    /** Returns the baked ramp, looked up in the cache on first use after the gradient changed. */
+    const GradientRamp& ramp() {
+        if (!mRamp) { mRamp = mCache->obtain(this->gradient()); }
+        return *mRamp;
+    }
+
+    bool testCast(uintptr_t scope, long castId) const noexcept override {
+        return scope == mScopeId && castId == SoftGradientBrush_CAST_ID;
+    }
+
+private:
+    GradientRampCachePtr mCache;
+    GradientRampPtr mRamp;
+    const uintptr_t mScopeId;
+};
+
+using SoftLinearGradientBrush = SoftGradientBrush<LinearGradientBrush>;
+using SoftRadialGradientBrush = SoftGradientBrush<RadialGradientBrush>;
+using SoftConicGradientBrush = SoftGradientBrush<ConicGradientBrush>;
+} // namespace bix
@@ -0,0 +1,571 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "builtin_font.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace bix {
+
+namespace {
+constexpr int kGlyphCount = static_cast<int>(BuiltinFont::kLastChar - BuiltinFont::kFirstChar + 1);
+
+// Printable ASCII glyphs of DejaVu Sans Mono (Bitstream Vera license), rasterized in monochrome at 26px
+// with the baseline placed on row 24 of a 16x32 cell.
+constexpr uint16_t kGlyphBitmaps[kGlyphCount * BuiltinFont::kCellHeight] = {
+    // ' '
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '!'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x0000, 0x0000, 0x0000, 0x01C0, 0x01C0, 0x01C0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '"'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0630, 0x0630, 0x0630,
+    0x0630, 0x0630, 0x0630, 0x0630, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '#'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x018C, 0x030C,
+    0x031C, 0x0318, 0x0318, 0x7FFF, 0x7FFF, 0x0630, 0x0630, 0x0C30,
+    0x0C60, 0xFFFE, 0xFFFE, 0x1860, 0x18C0, 0x18C0, 0x38C0, 0x31C0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '$'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0080, 0x0080, 0x03F0,
+    0x0FF8, 0x1E88, 0x1C80, 0x1C80, 0x1C80, 0x1E80, 0x0F80, 0x07F0,
+    0x01F8, 0x00BC, 0x009C, 0x009C, 0x009C, 0x10B8, 0x1FF8, 0x0FE0,
+    0x0080, 0x0080, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '%'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C00, 0x7E00, 0xE700,
+    0xC300, 0xC300, 0xE700, 0x7E0C, 0x3C38, 0x00E0, 0x0380, 0x0E00,
+    0x3878, 0x60FC, 0x01CE, 0x0186, 0x0186, 0x01CE, 0x00FC, 0x0078,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '&'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07C0, 0x0FE0, 0x1E20,
+    0x1C00, 0x1C00, 0x1C00, 0x0E00, 0x0F00, 0x1F00, 0x3F83, 0x33C3,
+    0x71E3, 0x70E3, 0x70F6, 0x707E, 0x783C, 0x3C3E, 0x1FEE, 0x0FCF,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '\''
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '('
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x00C0, 0x00C0, 0x0180,
+    0x0180, 0x0380, 0x0380, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0380, 0x0380, 0x0180, 0x0180,
+    0x00C0, 0x00C0, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ')'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0600, 0x0300, 0x0300, 0x0180,
+    0x0180, 0x01C0, 0x01C0, 0x00C0, 0x00E0, 0x00E0, 0x00E0, 0x00E0,
+    0x00E0, 0x00E0, 0x00E0, 0x00C0, 0x01C0, 0x01C0, 0x0180, 0x0180,
+    0x0300, 0x0300, 0x0600, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '*'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x3118,
+    0x3938, 0x0FE0, 0x0380, 0x0380, 0x0FE0, 0x3938, 0x3118, 0x0100,
+    0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '+'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x7FFE,
+    0x7FFE, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ','
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0300, 0x0700, 0x0600, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '-'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x07F0, 0x07F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '.'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '/'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001C, 0x0038, 0x0038,
+    0x0070, 0x0070, 0x00E0, 0x00E0, 0x01C0, 0x01C0, 0x0380, 0x0380,
+    0x0380, 0x0700, 0x0700, 0x0E00, 0x0E00, 0x1C00, 0x1C00, 0x3800,
+    0x3800, 0x7000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '0'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x0FF0, 0x1E78,
+    0x1C38, 0x1C38, 0x381C, 0x381C, 0x381C, 0x3B9C, 0x3B9C, 0x3B9C,
+    0x381C, 0x381C, 0x381C, 0x1C38, 0x1C38, 0x1E78, 0x0FF0, 0x03C0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '1'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07C0, 0x1FC0, 0x19C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x1FFC, 0x1FFC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '2'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0FC0, 0x3FF0, 0x3878,
+    0x203C, 0x001C, 0x001C, 0x001C, 0x003C, 0x003C, 0x0078, 0x00F0,
+    0x01E0, 0x03C0, 0x0780, 0x0F00, 0x1E00, 0x3800, 0x3FFC, 0x3FFC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '3'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x1FF0, 0x1038,
+    0x001C, 0x001C, 0x001C, 0x001C, 0x0078, 0x07F0, 0x07E0, 0x0078,
+    0x003C, 0x001C, 0x001C, 0x001C, 0x003C, 0x2078, 0x3FF0, 0x0FC0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '4'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E0, 0x01E0, 0x01E0,
+    0x03E0, 0x06E0, 0x06E0, 0x0CE0, 0x0CE0, 0x18E0, 0x30E0, 0x30E0,
+    0x60E0, 0x7FFC, 0x7FFC, 0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x00E0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '5'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FF8, 0x1FF8, 0x1C00,
+    0x1C00, 0x1C00, 0x1C00, 0x1FE0, 0x1FF0, 0x1078, 0x0038, 0x001C,
+    0x001C, 0x001C, 0x001C, 0x001C, 0x0038, 0x2078, 0x3FF0, 0x1FC0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '6'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03F0, 0x07F8, 0x0F08,
+    0x1C00, 0x1C00, 0x3800, 0x3800, 0x39E0, 0x3BF8, 0x3C38, 0x3C1C,
+    0x381C, 0x381C, 0x381C, 0x181C, 0x1C1C, 0x1C38, 0x0FF0, 0x03E0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '7'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3FFC, 0x3FFC, 0x0038,
+    0x0038, 0x0078, 0x0070, 0x0070, 0x00F0, 0x00E0, 0x00E0, 0x01C0,
+    0x01C0, 0x03C0, 0x0380, 0x0380, 0x0780, 0x0700, 0x0700, 0x0E00,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '8'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x1FF8, 0x1C38,
+    0x381C, 0x381C, 0x381C, 0x381C, 0x1C38, 0x07E0, 0x0FF0, 0x1C38,
+    0x381C, 0x381C, 0x381C, 0x381C, 0x381C, 0x1C38, 0x1FF8, 0x07E0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '9'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07C0, 0x0FF0, 0x1C38,
+    0x3838, 0x3818, 0x381C, 0x381C, 0x381C, 0x383C, 0x1C3C, 0x1FDC,
+    0x079C, 0x001C, 0x003C, 0x0038, 0x0038, 0x10F0, 0x1FE0, 0x0FC0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ':'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0380, 0x0380, 0x0380, 0x0380, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ';'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0380, 0x0380, 0x0380, 0x0380, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0300, 0x0700, 0x0600, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '<'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0004, 0x003C, 0x00FC, 0x03E0, 0x1F80, 0x7C00, 0x7000,
+    0x7C00, 0x1F80, 0x03E0, 0x00FC, 0x003C, 0x0004, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '='
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7FFC, 0x7FFC, 0x0000, 0x0000,
+    0x0000, 0x7FFC, 0x7FFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '>'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x4000, 0x7800, 0x7E00, 0x0F80, 0x03F0, 0x007C, 0x001C,
+    0x007C, 0x03F0, 0x0F80, 0x7E00, 0x7800, 0x4000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '?'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07C0, 0x0FF0, 0x1878,
+    0x1038, 0x0038, 0x0078, 0x00F0, 0x01E0, 0x01C0, 0x03C0, 0x0380,
+    0x0380, 0x0380, 0x0380, 0x0000, 0x0000, 0x0380, 0x0380, 0x0380,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '@'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01F8, 0x07FC,
+    0x0E0E, 0x1C06, 0x3803, 0x3003, 0x307B, 0x61FF, 0x6187, 0x6303,
+    0x6303, 0x6303, 0x6303, 0x6187, 0x61FF, 0x307B, 0x3000, 0x1800,
+    0x1C00, 0x0F04, 0x07FC, 0x01FC, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'A'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C0, 0x03E0, 0x03E0,
+    0x03E0, 0x03E0, 0x0770, 0x0770, 0x0770, 0x0E38, 0x0E38, 0x0E38,
+    0x1C1C, 0x1FFC, 0x1FFC, 0x3C1E, 0x380E, 0x380E, 0x780F, 0x7007,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'B'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7F80, 0x7FE0, 0x70E0,
+    0x7070, 0x7070, 0x7070, 0x7070, 0x70E0, 0x7FC0, 0x7FC0, 0x7070,
+    0x7030, 0x7038, 0x7038, 0x7038, 0x7038, 0x7070, 0x7FF0, 0x7FC0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'C'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03F0, 0x0FF8, 0x1E18,
+    0x3C08, 0x3800, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000,
+    0x7000, 0x7000, 0x7000, 0x3800, 0x3808, 0x1E18, 0x0FF8, 0x03F0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'D'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7F00, 0x7FC0, 0x70E0,
+    0x7070, 0x7070, 0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7038,
+    0x7038, 0x7038, 0x7038, 0x7070, 0x7070, 0x70E0, 0x7FC0, 0x7F00,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'E'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FF8, 0x7FF8, 0x7000,
+    0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7FF0, 0x7FF0, 0x7000,
+    0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7FF8, 0x7FF8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'F'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FF8, 0x7FF8, 0x7000,
+    0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7FF0, 0x7FF0, 0x7000,
+    0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'G'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03F0, 0x0FF8, 0x1E18,
+    0x3808, 0x3800, 0x7000, 0x7000, 0x7000, 0x7000, 0x70FC, 0x70FC,
+    0x701C, 0x701C, 0x701C, 0x381C, 0x381C, 0x1C1C, 0x0FFC, 0x03F0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'H'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7038, 0x7038, 0x7038,
+    0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7FF8, 0x7FF8, 0x7038,
+    0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7038,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'I'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FFC, 0x1FFC, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x1FFC, 0x1FFC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'J'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0FF0, 0x0FF0, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x4070, 0x60E0, 0x7FE0, 0x1F80,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'K'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x700E, 0x701C, 0x7038,
+    0x7070, 0x70E0, 0x71C0, 0x7380, 0x7700, 0x7F00, 0x7F80, 0x7BC0,
+    0x71C0, 0x71E0, 0x70F0, 0x7070, 0x7078, 0x703C, 0x701C, 0x701E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'L'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7000, 0x7000, 0x7000,
+    0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000,
+    0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7FF8, 0x7FF8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'M'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x783C, 0x783C, 0x7C7C,
+    0x7C7C, 0x7C7C, 0x745C, 0x76DC, 0x76DC, 0x729C, 0x739C, 0x739C,
+    0x739C, 0x701C, 0x701C, 0x701C, 0x701C, 0x701C, 0x701C, 0x701C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'N'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7838, 0x7838, 0x7C38,
+    0x7C38, 0x7C38, 0x7638, 0x7638, 0x7638, 0x7338, 0x7338, 0x7338,
+    0x71B8, 0x71B8, 0x71B8, 0x70F8, 0x70F8, 0x70F8, 0x7078, 0x7078,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'O'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07C0, 0x1FF0, 0x1C70,
+    0x3838, 0x3838, 0x701C, 0x701C, 0x701C, 0x701C, 0x701C, 0x701C,
+    0x701C, 0x701C, 0x701C, 0x3838, 0x3838, 0x3C70, 0x1FF0, 0x07C0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'P'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FC0, 0x7FE0, 0x7070,
+    0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7070, 0x7FF0, 0x7FC0,
+    0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000, 0x7000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'Q'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07C0, 0x1FF0, 0x1C70,
+    0x3838, 0x3838, 0x701C, 0x701C, 0x701C, 0x701C, 0x701C, 0x701C,
+    0x701C, 0x701C, 0x701C, 0x3838, 0x3838, 0x3C70, 0x1FF0, 0x07C0,
+    0x00E0, 0x0078, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'R'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FC0, 0x7FE0, 0x7070,
+    0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7070, 0x7FE0, 0x7FC0,
+    0x71E0, 0x70F0, 0x7070, 0x7078, 0x7038, 0x703C, 0x701C, 0x701E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'S'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0FE0, 0x1FF0, 0x3C30,
+    0x7010, 0x7000, 0x7000, 0x7800, 0x7E00, 0x3FC0, 0x1FF0, 0x01F0,
+    0x0078, 0x0038, 0x0038, 0x0038, 0x4038, 0x70F0, 0x7FE0, 0x1FC0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'T'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0x7FFF, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'U'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7038, 0x7038, 0x7038,
+    0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x7038,
+    0x7038, 0x7038, 0x7038, 0x7038, 0x7038, 0x3870, 0x1FE0, 0x0FC0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'V'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x700E, 0x781E, 0x381C,
+    0x381C, 0x381C, 0x1C38, 0x1C38, 0x1C38, 0x1E78, 0x0E70, 0x0E70,
+    0x0E70, 0x07E0, 0x07E0, 0x07E0, 0x07E0, 0x03C0, 0x03C0, 0x03C0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'W'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE007, 0xE007, 0xE007,
+    0x700E, 0x700E, 0x718E, 0x73CE, 0x73CE, 0x73CE, 0x73CE, 0x3E5C,
+    0x3E7C, 0x3E7C, 0x3E7C, 0x3C3C, 0x3C3C, 0x1C3C, 0x1C38, 0x1C18,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'X'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x780F, 0x3C1E, 0x1C1C,
+    0x1E3C, 0x0F78, 0x0770, 0x07F0, 0x03E0, 0x01C0, 0x01C0, 0x03E0,
+    0x07E0, 0x0770, 0x0F78, 0x0E38, 0x1E3C, 0x3C1C, 0x380E, 0x780F,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'Y'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x780F, 0x380E, 0x3C1E,
+    0x1C1C, 0x0E38, 0x0F78, 0x0770, 0x07F0, 0x03E0, 0x03E0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'Z'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFC, 0x7FFC, 0x003C,
+    0x0078, 0x0070, 0x00F0, 0x00E0, 0x01E0, 0x03C0, 0x0380, 0x0780,
+    0x0F00, 0x0E00, 0x1E00, 0x1C00, 0x3C00, 0x7800, 0x7FFC, 0x7FFC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '['
+    0x0000, 0x0000, 0x0000, 0x0000, 0x03F0, 0x03F0, 0x0380, 0x0380,
+    0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0380, 0x03F0, 0x03F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '\\'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7000, 0x3800, 0x3800,
+    0x1C00, 0x1C00, 0x0E00, 0x0E00, 0x0700, 0x0700, 0x0380, 0x0380,
+    0x0380, 0x01C0, 0x01C0, 0x00E0, 0x00E0, 0x0070, 0x0070, 0x0038,
+    0x0038, 0x001C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // ']'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0FC0, 0x0FC0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x0FC0, 0x0FC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '^'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x03C0, 0x07E0,
+    0x0E70, 0x1C38, 0x381C, 0x700E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '_'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
+    // '`'
+    0x0000, 0x0000, 0x0000, 0x0E00, 0x0700, 0x0300, 0x0180, 0x00C0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'a'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x07E0, 0x1FF8, 0x1038, 0x001C, 0x001C, 0x07FC,
+    0x1FFC, 0x3C1C, 0x381C, 0x381C, 0x383C, 0x3C7C, 0x1FDC, 0x0F9C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'b'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3800, 0x3800, 0x3800, 0x3800,
+    0x3800, 0x3800, 0x39E0, 0x3FF0, 0x3C38, 0x3C38, 0x381C, 0x381C,
+    0x381C, 0x381C, 0x381C, 0x381C, 0x3C38, 0x3C38, 0x3FF0, 0x39E0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'c'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x03E0, 0x0FF0, 0x1E18, 0x1C00, 0x3800, 0x3800,
+    0x3800, 0x3800, 0x3800, 0x3800, 0x1C00, 0x1E18, 0x0FF0, 0x03E0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'd'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x001C, 0x001C, 0x001C, 0x001C,
+    0x001C, 0x001C, 0x079C, 0x0FFC, 0x1C7C, 0x3C3C, 0x381C, 0x381C,
+    0x381C, 0x381C, 0x381C, 0x381C, 0x1C3C, 0x1C7C, 0x0FFC, 0x079C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'e'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x03F0, 0x0FF8, 0x1E3C, 0x1C1C, 0x380E, 0x380E,
+    0x3FFE, 0x3FFE, 0x3800, 0x3800, 0x1C00, 0x1E0C, 0x0FFC, 0x03F0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'f'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00FC, 0x01FC, 0x03C0, 0x0380,
+    0x0380, 0x0380, 0x3FFC, 0x3FFC, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'g'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x079C, 0x0FFC, 0x1E3C, 0x1C3C, 0x381C, 0x381C,
+    0x381C, 0x381C, 0x381C, 0x381C, 0x1C3C, 0x1E3C, 0x0FDC, 0x079C,
+    0x001C, 0x001C, 0x0838, 0x0FF0, 0x07E0, 0x0000, 0x0000, 0x0000,
+    // 'h'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3800, 0x3800, 0x3800, 0x3800,
+    0x3800, 0x3800, 0x39E0, 0x3BF0, 0x3C78, 0x3838, 0x3838, 0x3838,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'i'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01C0, 0x01C0, 0x01C0, 0x0000,
+    0x0000, 0x0000, 0x1FC0, 0x1FC0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x3FFE, 0x3FFE,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'j'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00E0, 0x00E0, 0x00E0, 0x0000,
+    0x0000, 0x0000, 0x0FE0, 0x0FE0, 0x00E0, 0x00E0, 0x00E0, 0x00E0,
+    0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x00E0, 0x00E0,
+    0x00E0, 0x00E0, 0x01E0, 0x1FC0, 0x1F00, 0x0000, 0x0000, 0x0000,
+    // 'k'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1C00, 0x1C00, 0x1C00, 0x1C00,
+    0x1C00, 0x1C00, 0x1C1E, 0x1C3C, 0x1C78, 0x1CF0, 0x1DE0, 0x1FC0,
+    0x1FC0, 0x1FE0, 0x1FE0, 0x1EF0, 0x1C78, 0x1C38, 0x1C3C, 0x1C1E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'l'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7F80, 0x7F80, 0x0380, 0x0380,
+    0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x03C0, 0x01FC, 0x00FC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'm'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x7778, 0x7F78, 0x739C, 0x739C, 0x739C, 0x739C,
+    0x739C, 0x739C, 0x739C, 0x739C, 0x739C, 0x739C, 0x739C, 0x739C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'n'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x39E0, 0x3BF0, 0x3C78, 0x3838, 0x3838, 0x3838,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'o'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x07E0, 0x0FF0, 0x1C38, 0x1C38, 0x381C, 0x381C,
+    0x381C, 0x381C, 0x381C, 0x381C, 0x1C38, 0x1C38, 0x0FF0, 0x07E0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'p'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x39E0, 0x3FF0, 0x3C38, 0x3C38, 0x381C, 0x381C,
+    0x381C, 0x381C, 0x381C, 0x381C, 0x3C38, 0x3C38, 0x3FF0, 0x39E0,
+    0x3800, 0x3800, 0x3800, 0x3800, 0x3800, 0x0000, 0x0000, 0x0000,
+    // 'q'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x079C, 0x0FFC, 0x1C3C, 0x1C3C, 0x381C, 0x381C,
+    0x381C, 0x381C, 0x381C, 0x381C, 0x1C3C, 0x1C3C, 0x0FFC, 0x079C,
+    0x001C, 0x001C, 0x001C, 0x001C, 0x001C, 0x0000, 0x0000, 0x0000,
+    // 'r'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x073C, 0x077E, 0x07C2, 0x0780, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 's'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x07E0, 0x0FF0, 0x1E10, 0x1C00, 0x1E00, 0x1FC0,
+    0x0FF0, 0x03F8, 0x0078, 0x0038, 0x0038, 0x1078, 0x1FF0, 0x0FE0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 't'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x7FF8, 0x7FF8, 0x0700, 0x0700, 0x0700, 0x0700,
+    0x0700, 0x0700, 0x0700, 0x0700, 0x0700, 0x0780, 0x03F8, 0x01F8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'u'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3838, 0x3838, 0x3838, 0x3838, 0x3838, 0x3838,
+    0x3838, 0x3838, 0x3838, 0x3838, 0x3878, 0x3C78, 0x1FB8, 0x0F38,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'v'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x701C, 0x3838, 0x3838, 0x3838, 0x1C70, 0x1C70,
+    0x1EF0, 0x0EE0, 0x0EE0, 0x0FE0, 0x07C0, 0x07C0, 0x07C0, 0x0380,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'w'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xE007, 0xE007, 0x700E, 0x700E, 0x718E, 0x718E,
+    0x3BDC, 0x3BDC, 0x3A5C, 0x3E7C, 0x1E78, 0x1C38, 0x1C38, 0x1C38,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'x'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x3C3C, 0x1E78, 0x0E70, 0x0FF0, 0x07E0, 0x03C0,
+    0x0180, 0x03C0, 0x07E0, 0x07E0, 0x0FF0, 0x1E78, 0x3C3C, 0x781E,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // 'y'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x701C, 0x3838, 0x3838, 0x3C78, 0x1C70, 0x1C70,
+    0x0EE0, 0x0EE0, 0x0FE0, 0x07C0, 0x07C0, 0x0380, 0x0380, 0x0380,
+    0x0700, 0x0700, 0x0F00, 0x3E00, 0x3C00, 0x0000, 0x0000, 0x0000,
+    // 'z'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x1FFC, 0x1FFC, 0x003C, 0x0078, 0x00F0, 0x00E0,
+    0x01E0, 0x03C0, 0x0780, 0x0700, 0x0F00, 0x1E00, 0x1FFC, 0x1FFC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '{'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x007C, 0x00FC, 0x01E0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x0380, 0x1F00,
+    0x1F00, 0x0380, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01E0, 0x00FC, 0x007C, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '|'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000, 0x0000,
+    // '}'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1F00, 0x1F80, 0x03C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x00E0, 0x007C,
+    0x007C, 0x00E0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x03C0, 0x1F80, 0x1F00, 0x0000, 0x0000, 0x0000, 0x0000,
+    // '~'
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1E00, 0x7F8C,
+    0x61FC, 0x00F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+// Sub-samples per device pixel along each axis when resampling the master bitmaps.
+constexpr int kSamples = 4;
+// Rows above the baseline are shifted right by one master pixel per this many rows for synthetic italics.
+constexpr int kItalicSlant = 5;
+constexpr int kItalicOverhang = (BuiltinFont::kBaseline + kItalicSlant - 1) / kItalicSlant;
+} // namespace
+
+const uint16_t* BuiltinFont::glyph(char32_t c) noexcept {
+    if (c < kFirstChar || c > kLastChar) { c = U'?'; }
+    return kGlyphBitmaps + static_cast<size_t>(c - kFirstChar) * kCellHeight;
+}
+
+void BuiltinFont::rasterize(char32_t c, float scaleX, float scaleY, bool bold, bool italic, GlyphMask& out) {
+    // Widen every row to 32 bits so that synthetic styles may spill past the right edge of the cell.
+    std::array<uint32_t, kCellHeight> rows{};
+    const uint16_t* master = glyph(c);
+    for (int y = 0; y < kCellHeight; ++y) {
+        uint32_t bits = static_cast<uint32_t>(master[y]) << 16;
+        if (bold) { bits |= bits >> 1; }
+        if (italic) {
+            const int shift = (kBaseline - y) / kItalicSlant;
+            bits = shift >= 0 ? bits >> shift : bits << -shift;
+        }
+        rows[static_cast<size_t>(y)] = bits;
+    }
+
+    const int cellWidth = kCellWidth + (bold ? 1 : 0) + (italic ? kItalicOverhang : 0);
+    out.width = static_cast<int>(std::ceil(static_cast<float>(cellWidth) * scaleX));
+    out.height = static_cast<int>(std::ceil(static_cast<float>(kCellHeight) * scaleY));
+    out.coverage.assign(static_cast<size_t>(out.width) * static_cast<size_t>(out.height), 0);
+    if (out.width <= 0 || out.height <= 0) { return; }
+
+    // Map every sub-sample column to its master column once, the mapping is shared by all rows.
+    std::vector<int> columns(static_cast<size_t>(out.width * kSamples));
+    for (size_t i = 0; i < columns.size(); ++i) {
+        const float sx = (static_cast<float>(i) + 0.5f) / static_cast<float>(kSamples) / scaleX;
+        columns[i] = std::min(static_cast<int>(sx), 31);
+    }
+
+    uint8_t* dst = out.coverage.data();
+    for (int y = 0; y < out.height; ++y) {
+        std::array<uint32_t, kSamples> sampleRows{};
+        bool empty = true;
+        for (int s = 0; s < kSamples; ++s) {
+            const float sy = (static_cast<float>(y * kSamples + s) + 0.5f) / static_cast<float>(kSamples) / scaleY;
+            const int row = static_cast<int>(sy);
+            sampleRows[static_cast<size_t>(s)] = row < kCellHeight ? rows[static_cast<size_t>(row)] : 0u;
+            empty = empty && sampleRows[static_cast<size_t>(s)] == 0;
+        }
+        if (empty) {
+            dst += out.width;
+            continue;
+        }
+        for (int x = 0; x < out.width; ++x) {
+            int hits = 0;
+            for (int i = 0; i < kSamples; ++i) {
+                const uint32_t bit = 0x80000000u >> columns[static_cast<size_t>(x * kSamples + i)];
+                for (const uint32_t bits : sampleRows) { hits += (bits & bit) != 0 ? 1 : 0; }
+            }
+            *dst++ = static_cast<uint8_t>(hits * 255 / (kSamples * kSamples));
+        }
+    }
+}
+} // namespace bix
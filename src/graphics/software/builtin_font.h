@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace bix {
+
+/**
+ * Coverage mask of a single rasterized glyph cell.
+ *
+ * The mask always spans the whole scaled cell, its top row lines up with the top of the text line.
+ */
+struct GlyphMask {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> coverage;
+};
+
+/**
+ * A monospaced bitmap font compiled into the software backend.
+ *
+ * The software canvas must be able to measure and draw text on machines without any font
+ * configuration (CI runners, containers), so it ships the printable ASCII range of DejaVu Sans Mono
+ * rasterized at a fixed size. Other sizes are produced by resampling the 1-bit master glyphs, and
+ * bold or italic styles are synthesized. Code points outside the table are drawn as '?'.
+ */
+class BuiltinFont {
+public:
+    static constexpr int kCellWidth = 16;   ///< Width of a master glyph cell, equals the advance.
+    static constexpr int kCellHeight = 32;  ///< Height of a master glyph cell, equals the line height.
+    static constexpr int kBaseline = 24;    ///< Row of the baseline inside the master cell.
+    static constexpr float kEmSize = 26.0f; ///< Pixel size the master glyphs were rasterized at.
+
+    static constexpr char32_t kFirstChar = 0x20;
+    static constexpr char32_t kLastChar = 0x7E;
+
+    /**
+     * Returns the master bitmap of a glyph.
+     * @param c The code point, unsupported values fall back to '?'.
+     * @return kCellHeight row masks, the most significant bit is the leftmost pixel.
+     */
+    static const uint16_t* glyph(char32_t c) noexcept;
+
+    /** Returns the horizontal advance of every glyph at the given text size. */
+    static float advance(float textSize) noexcept { return kCellWidth * textSize / kEmSize; }
+
+    /** Returns the height of one text line at the given text size. */
+    static float lineHeight(float textSize) noexcept { return kCellHeight * textSize / kEmSize; }
+
+    /**
+     * Rasterizes a glyph into an anti-aliased coverage mask.
+     *
+     * @param c The code point to rasterize.
+     * @param scaleX Horizontal scale from master cell pixels to device pixels.
+     * @param scaleY Vertical scale from master cell pixels to device pixels.
+     * @param bold Synthesizes a bold face by widening every stem by one master pixel.
+     * @param italic Synthesizes an oblique face by shearing rows around the baseline.
+     * @param[out] out The resulting mask, its buffer is reused when large enough.
+     */
+    static void rasterize(char32_t c, float scaleX, float scaleY, bool bold, bool italic, GlyphMask& out);
+};
+} // namespace bix
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "clip_mask.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+
+constexpr auto kSub = static_cast<float>(CornerMaskCache::kSubpixels);
+
+inline void hashCombine(size_t& seed, size_t value) noexcept {
+    seed ^= value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2);
+}
+} // namespace
+
+size_t ClipMaskKeyHash::operator()(const ClipMaskKey& key) const noexcept {
+    size_t seed = static_cast<size_t>(key.pixelWidth) << 32 | static_cast<uint32_t>(key.pixelHeight);
+    for (const auto* values : {&key.edges, &key.rx, &key.ry}) {
+        for (const int32_t v : *values) { hashCombine(seed, static_cast<uint32_t>(v)); }
+    }
+    return seed;
+}
+
+ClipMaskPtr ClipMaskCache::obtain(
+    const raster::RoundShape& shape,
+    CornerMaskCache& corners,
+    int& originX,
+    int& originY
+) {
+    const RectI pixels = Rect(shape.left, shape.top, shape.right, shape.bottom).aligned();
+    originX = pixels.left;
+    originY = pixels.top;
+
+    // The shape is snapped like the corners of RoundRectRaster, which keeps the key exact.
+    auto snap = [](float v) { return static_cast<int32_t>(lround(v * kSub)); };
+    ClipMaskKey key{pixels.width(), pixels.height()};
+    key.edges = {
+        snap(shape.left - static_cast<float>(originX)),
+        snap(shape.top - static_cast<float>(originY)),
+        snap(shape.right - static_cast<float>(originX)),
+        snap(shape.bottom - static_cast<float>(originY)),
+    };
+    for (size_t i = 0; i < 4; ++i) {
+        key.rx[i] = snap(shape.rx[i]);
+        key.ry[i] = snap(shape.ry[i]);
+    }
+
+    if (auto* mask = mMasks.find(key)) {
+        ++mStats.hits;
+        return *mask;
+    }
+    ++mStats.misses;
+    auto mask = bake(key, corners);
+    mMasks.insert(key, mask);
+    mStats.evictions = mMasks.evictions();
+    return mask;
+}
+
+ClipMaskPtr ClipMaskCache::bake(const ClipMaskKey& key, CornerMaskCache& corners) {
+    auto mask = make_shared<ClipMask>();
+    mask->area = {0, 0, key.pixelWidth, key.pixelHeight};
+    mask->coverage.assign(static_cast<size_t>(key.pixelWidth) * static_cast<size_t>(key.pixelHeight), 0);
+
+    raster::RoundShape shape{
+        static_cast<float>(key.edges[0]) / kSub,
+        static_cast<float>(key.edges[1]) / kSub,
+        static_cast<float>(key.edges[2]) / kSub,
+        static_cast<float>(key.edges[3]) / kSub,
+    };
+    for (size_t i = 0; i < 4; ++i) {
+        shape.rx[i] = static_cast<float>(key.rx[i]) / kSub;
+        shape.ry[i] = static_cast<float>(key.ry[i]) / kSub;
+    }
+    bakeClipMask(shape, *mask, mRaster, corners, mScratch);
+    return mask;
+}
+
+void bakeClipMask(
+    const raster::RoundShape& shape,
+    ClipMask& mask,
+    raster::RoundRectRaster& raster,
+    CornerMaskCache& corners,
+    vector<uint8_t>& scratch
+) {
+    const RectI& area = mask.area;
+    auto at = [&mask, &area](int y, int x) {
+        return mask.coverage.data() + static_cast<size_t>(y - area.top) * static_cast<size_t>(area.width())
+               + static_cast<size_t>(x - area.left);
+    };
+    auto span = [&at](int y, int x, const uint8_t* coverage, int count) { copy_n(coverage, count, at(y, x)); };
+    auto solid = [&at](int y, int x0, int x1, uint8_t coverage) { fill_n(at(y, x0), x1 - x0, coverage); };
+    if (raster.prepare(shape, corners)) {
+        raster::scanRoundRect(raster, nullptr, area, scratch, span, solid);
+        return;
+    }
+    raster::scanRing(
+        shape.inset(-1.0f),
+        shape.inset(1.0f),
+        true,
+        area,
+        scratch,
+        [&shape](float x, float y) { return 0.5f - shape.distance(x, y); },
+        span,
+        solid
+    );
+}
+} // namespace bix
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/utils/lru_cache.h"
+
+#include "corner_mask.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace bix {
+
+/**
+ * Coverage mask of a non pixel-aligned clip, stored for the area it covers.
+ */
+struct ClipMask {
+    RectI area;
+    std::vector<uint8_t> coverage;
+
+    const uint8_t* row(int y) const noexcept {
+        return coverage.data() + static_cast<size_t>(y - area.top) * static_cast<size_t>(area.width());
+    }
+};
+
+using ClipMaskPtr = std::shared_ptr<const ClipMask>;
+
+/**
+ * Rasterizes a clip shape into the area of a mask, the coverage must be zero-initialized.
+ * @param shape The clip in the coordinates of the mask.
+ * @param raster Raster prepared for the shape, its previous state is discarded.
+ * @param scratch Scratch row buffer.
+ */
+void bakeClipMask(
+    const raster::RoundShape& shape,
+    ClipMask& mask,
+    raster::RoundRectRaster& raster,
+    CornerMaskCache& corners,
+    std::vector<uint8_t>& scratch
+);
+
+/**
+ * Identifies a clip mask. The pixel size is the size of the mask, all other values are in
+ * 1/CornerMaskCache::kSubpixels pixel units relative to the top-left pixel of the mask.
+ */
+struct ClipMaskKey {
+    int32_t pixelWidth = 0;
+    int32_t pixelHeight = 0;
+    // Left, top, right and bottom edge.
+    std::array<int32_t, 4> edges{};
+    std::array<int32_t, 4> rx{};
+    std::array<int32_t, 4> ry{};
+
+    bool operator==(const ClipMaskKey&) const noexcept = default;
+};
+
+struct ClipMaskKeyHash {
+    size_t operator()(const ClipMaskKey& key) const noexcept;
+};
+
+/** Hit and miss counters of a ClipMaskCache. */
+struct ClipMaskStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+};
+
+/**
+ * @class ClipMaskCache
+ * @brief An LRU cache of clip masks keyed by size, radii and subpixel phase.
+ *
+ * Masks are baked relative to their top-left pixel, so a rounded card clipped on every frame, or a list of cards of
+ * the same size, shares one mask wherever it is placed on the pixel grid. Masks are large, the cache only keeps a few.
+ */
+class ClipMaskCache {
+public:
+    /** The default maximum number of cached masks. */
+    static constexpr size_t kDefaultCapacity = 32;
+
+    explicit ClipMaskCache(size_t capacity = kDefaultCapacity) : mMasks(capacity) {}
+
+    /**
+     * Returns the cached mask of a clip shape, baking and caching it on a miss.
+     * @param shape The clip in device space.
+     * @param corners Corner masks used to bake the clip.
+     * @param originX Receives the device column of the first mask column.
+     * @param originY Receives the device row of the first mask row.
+     */
+    ClipMaskPtr obtain(const raster::RoundShape& shape, CornerMaskCache& corners, int& originX, int& originY);
+
+    void clear() noexcept { mMasks.clear(); }
+
+    size_t size() const noexcept { return mMasks.size(); }
+
+    size_t capacity() const noexcept { return mMasks.capacity(); }
+
+    const ClipMaskStats& stats() const noexcept { return mStats; }
+
+private:
+    ClipMaskPtr bake(const ClipMaskKey& key, CornerMaskCache& corners);
+
+    LruCache<ClipMaskKey, ClipMaskPtr, ClipMaskKeyHash> mMasks;
+    ClipMaskStats mStats;
+    raster::RoundRectRaster mRaster;
+    std::vector<uint8_t> mScratch;
+};
+} // namespace bix
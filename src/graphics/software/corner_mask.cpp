@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "corner_mask.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+
+constexpr int kSub = CornerMaskCache::kSubpixels;
+constexpr float kSubStep = 1.0f / static_cast<float>(kSub);
+// Snapped coordinates have to fit an int, shapes beyond this are left to the generic path.
+constexpr float kMaxCoordinate = 1.0e6f;
+
+int floorDiv(int v, int d) noexcept {
+    return v >= 0 ? v / d : -((d - 1 - v) / d);
+}
+
+int ceilDiv(int v, int d) noexcept {
+    return -floorDiv(-v, d);
+}
+
+CornerMaskPtr bake(const CornerKey& key) {
+    auto mask = make_shared<CornerMask>();
+    mask->width = (key.phaseX + key.rx + kSub - 1) / kSub;
+    mask->height = (key.phaseY + key.ry + kSub - 1) / kSub;
+    const auto width = static_cast<size_t>(mask->width);
+    vector<float> area(width * static_cast<size_t>(mask->height), 0.0f);
+
+    // The corner box spans whole subpixel columns, sampling each at its center integrates it exactly along x.
+    const float top = static_cast<float>(key.phaseY) * kSubStep;
+    const float a = static_cast<float>(key.rx) * kSubStep;
+    const float b = static_cast<float>(key.ry) * kSubStep;
+    const float cx = static_cast<float>(key.phaseX) * kSubStep + a;
+    const float cy = top + b;
+    for (int s = key.phaseX; s < key.phaseX + key.rx; ++s) {
+        const float t = (cx - (static_cast<float>(s) + 0.5f) * kSubStep) / a;
+        const float edge = cy - b * sqrt(max(1.0f - t * t, 0.0f));
+        const auto column = static_cast<size_t>(s / kSub);
+        for (int y = 0; static_cast<float>(y) < edge; ++y) {
+            area[static_cast<size_t>(y) * width + column] += raster::overlap(y, top, edge) * kSubStep;
+        }
+    }
+
+    mask->cutout.resize(area.size());
+    transform(area.begin(), area.end(), mask->cutout.begin(), raster::toCoverage);
+    return mask;
+}
+} // namespace
+
+CornerMaskPtr CornerMaskCache::obtain(const CornerKey& key) {
+    if (auto* mask = mMasks.find(key)) {
+        ++mStats.hits;
+        return *mask;
+    }
+    ++mStats.misses;
+    auto mask = bake(key);
+    mMasks.insert(key, mask);
+    mStats.evictions = mMasks.evictions();
+    return mask;
+}
+
+namespace raster {
+
+bool RoundRectRaster::prepare(const RoundShape& shape, CornerMaskCache& cache) {
+    for (Corner& corner : mCorners) { corner.mask.reset(); }
+    for (const float v : {shape.left, shape.top, shape.right, shape.bottom}) {
+        if (!(abs(v) < kMaxCoordinate)) { return false; }
+    }
+    for (int i = 0; i < 4; ++i) {
+        if (shape.rx[i] > CornerMaskCache::kMaxRadius || shape.ry[i] > CornerMaskCache::kMaxRadius) { return false; }
+    }
+
+    auto snap = [](float v) { return static_cast<int>(lround(v * static_cast<float>(kSub))); };
+    const int left = snap(shape.left);
+    const int top = snap(shape.top);
+    const int right = max(snap(shape.right), left);
+    const int bottom = max(snap(shape.bottom), top);
+    // Straight edges keep their exact position, only the corners are snapped.
+    mLeft = shape.left;
+    mTop = shape.top;
+    mRight = shape.right;
+    mBottom = shape.bottom;
+    mBounds = Rect(mLeft, mTop, mRight, mBottom).aligned();
+    mSolidLeft = math::ceil_cast<int>(mLeft);
+    mSolidRight = max(math::floor_cast<int>(mRight), mSolidLeft);
+
+    for (int i = 0; i < 4; ++i) {
+        // Rounding may push two radii of a side past its length, the masks must not overlap.
+        const int rx = min(snap(shape.rx[i]), (right - left) / 2);
+        const int ry = min(snap(shape.ry[i]), (bottom - top) / 2);
+        if (rx <= 0 || ry <= 0) { continue; }
+
+        Corner& corner = mCorners[i];
+        const bool isRight = (i & 1) != 0;
+        const bool isBottom = (i & 2) != 0;
+        const int phaseX = isRight ? ceilDiv(right, kSub) * kSub - right : left - floorDiv(left, kSub) * kSub;
+        const int phaseY = isBottom ? ceilDiv(bottom, kSub) * kSub - bottom : top - floorDiv(top, kSub) * kSub;
+        corner.originX = isRight ? ceilDiv(right, kSub) - 1 : floorDiv(left, kSub);
+        corner.originY = isBottom ? ceilDiv(bottom, kSub) - 1 : floorDiv(top, kSub);
+        corner.stepX = isRight ? -1 : 1;
+        corner.stepY = isBottom ? -1 : 1;
+        corner.mask = cache.obtain(
+            {static_cast<uint16_t>(rx),
+             static_cast<uint16_t>(ry),
+             static_cast<uint8_t>(phaseX),
+             static_cast<uint8_t>(phaseY)}
+        );
+    }
+    return true;
+}
+
+RoundRectRaster::RowLayout RoundRectRaster::layout(int y) const noexcept {
+    RowLayout row;
+    const float v = overlap(y, mTop, mBottom);
+    if (v <= 0.0f) { return row; }
+
+    row.x0 = mBounds.left;
+    row.x1 = mBounds.right;
+    row.middle = toCoverage(v);
+    row.a = mSolidLeft;
+    row.b = mSolidRight;
+    for (const int i : {0, 2}) {
+        if (mCorners[i].rowAt(y)) { row.a = max(row.a, mCorners[i].originX + mCorners[i].mask->width); }
+    }
+    for (const int i : {1, 3}) {
+        if (mCorners[i].rowAt(y)) { row.b = min(row.b, mCorners[i].originX + 1 - mCorners[i].mask->width); }
+    }
+    if (row.a >= row.b) { row.a = row.b = row.x1; }
+    return row;
+}
+
+void RoundRectRaster::coverage(int y, int x0, int x1, uint8_t* out) const noexcept {
+    const float v = overlap(y, mTop, mBottom);
+    // The rectangle first, only the partially covered edge columns differ from the middle.
+    const int s0 = clamp(mSolidLeft, x0, x1);
+    const int s1 = clamp(mSolidRight, s0, x1);
+    for (int x = x0; x < s0; ++x) { out[x - x0] = toCoverage(overlap(x, mLeft, mRight) * v); }
+    fill(out + (s0 - x0), out + (s1 - x0), toCoverage(v));
+    for (int x = s1; x < x1; ++x) { out[x - x0] = toCoverage(overlap(x, mLeft, mRight) * v); }
+
+    // Then the cutouts, corners never overlap so subtracting each one on its own is exact.
+    for (const Corner& corner : mCorners) {
+        const uint8_t* cutout = corner.rowAt(y);
+        if (!cutout) { continue; }
+        const int width = corner.mask->width;
+        if (corner.stepX > 0) {
+            const int from = max(corner.originX, x0);
+            const int to = min(corner.originX + width, x1);
+            for (int x = from; x < to; ++x) {
+                uint8_t& c = out[x - x0];
+                const uint8_t m = cutout[x - corner.originX];
+                c = c > m ? static_cast<uint8_t>(c - m) : uint8_t{0};
+            }
+        } else {
+            const int from = max(corner.originX + 1 - width, x0);
+            const int to = min(corner.originX + 1, x1);
+            for (int x = from; x < to; ++x) {
+                uint8_t& c = out[x - x0];
+                const uint8_t m = cutout[corner.originX - x];
+                c = c > m ? static_cast<uint8_t>(c - m) : uint8_t{0};
+            }
+        }
+    }
+}
+} // namespace raster
+} // namespace bix
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/utils/lru_cache.h"
+
+#include "coverage-inl.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace bix {
+
+/**
+ * Coverage of the area a rounded corner cuts off its bounding rectangle, baked for the top-left corner.
+ *
+ * Pixel (0, 0) is the pixel containing the corner of the rectangle. The other corners read the mask mirrored.
+ */
+struct CornerMask {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> cutout;
+
+    const uint8_t* row(int y) const noexcept {
+        return cutout.data() + static_cast<size_t>(y) * static_cast<size_t>(width);
+    }
+};
+
+using CornerMaskPtr = std::shared_ptr<const CornerMask>;
+
+/**
+ * Identifies a corner mask, all values are in 1/CornerMaskCache::kSubpixels pixel units.
+ *
+ * The phase is the offset of the rectangle corner from the pixel grid, seen from the corner.
+ */
+struct CornerKey {
+    uint16_t rx = 0;
+    uint16_t ry = 0;
+    uint8_t phaseX = 0;
+    uint8_t phaseY = 0;
+
+    bool operator==(const CornerKey&) const noexcept = default;
+};
+
+struct CornerKeyHash {
+    size_t operator()(const CornerKey& key) const noexcept {
+        return (static_cast<size_t>(key.rx) << 24) ^ (static_cast<size_t>(key.ry) << 8)
+               ^ (static_cast<size_t>(key.phaseX) << 4) ^ key.phaseY;
+    }
+};
+
+/** Hit and miss counters of a CornerMaskCache. */
+struct CornerCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+};
+
+/**
+ * @class CornerMaskCache
+ * @brief An LRU cache of corner masks keyed by radius and subpixel phase.
+ *
+ * Themes use a handful of corner radii, so rounded rectangles of any size share the same few masks and filling one
+ * costs little more than filling a rectangle. Radii above kMaxRadius are not cached.
+ */
+class CornerMaskCache {
+public:
+    /** The default maximum number of cached masks. */
+    static constexpr size_t kDefaultCapacity = 256;
+    /** The largest cached radius in device pixels, the masks of a larger corner would mostly be empty. */
+    static constexpr float kMaxRadius = 64.0f;
+    /** Radii and corner positions are snapped to this fraction of a pixel. */
+    static constexpr int kSubpixels = 64;
+
+    explicit CornerMaskCache(size_t capacity = kDefaultCapacity) : mMasks(capacity) {}
+
+    /** Returns the cached mask of a corner, baking and caching it on a miss. */
+    CornerMaskPtr obtain(const CornerKey& key);
+
+    void clear() noexcept { mMasks.clear(); }
+
+    size_t size() const noexcept { return mMasks.size(); }
+
+    size_t capacity() const noexcept { return mMasks.capacity(); }
+
+    const CornerCacheStats& stats() const noexcept { return mStats; }
+
+private:
+    LruCache<CornerKey, CornerMaskPtr, CornerKeyHash> mMasks;
+    CornerCacheStats mStats;
+};
+
+namespace raster {
+
+/**
+ * Computes the exact area coverage of a rounded rectangle from cached corner masks.
+ *
+ * The coverage of a pixel is the coverage of the bounding rectangle minus the cutouts of the corners it touches, so
+ * only the pixels under a corner or along a partially covered edge are evaluated one by one. Corners are snapped to
+ * 1/CornerMaskCache::kSubpixels pixel.
+ */
+class RoundRectRaster {
+public:
+    /** The columns of one row: [x0, a) and [b, x1) vary per pixel, [a, b) has the constant coverage \a middle. */
+    struct RowLayout {
+        int x0 = 0;
+        int a = 0;
+        int b = 0;
+        int x1 = 0;
+        uint8_t middle = 0;
+    };
+
+    /**
+     * Prepares a shape in device space.
+     * @return False if a corner is too large for the cache, nothing may be rasterized then.
+     */
+    bool prepare(const RoundShape& shape, CornerMaskCache& cache);
+
+    /** Returns the pixels touched by the shape. */
+    const RectI& bounds() const noexcept { return mBounds; }
+
+    /** Returns the layout of row \a y, all columns are empty if the row is outside the shape. */
+    RowLayout layout(int y) const noexcept;
+
+    /** Writes the coverage of the columns [x0, x1) of row \a y to \a out. */
+    void coverage(int y, int x0, int x1, uint8_t* out) const noexcept;
+
+private:
+    struct Corner {
+        CornerMaskPtr mask;
+        int originX = 0;
+        int originY = 0;
+        int stepX = 1;
+        int stepY = 1;
+
+        // Returns the mask row of device row y, or nullptr if the corner does not reach the row.
+        const uint8_t* rowAt(int y) const noexcept {
+            if (!mask) { return nullptr; }
+            const int j = (y - originY) * stepY;
+            return j >= 0 && j < mask->height ? mask->row(j) : nullptr;
+        }
+    };
+
+    float mLeft = 0;
+    float mTop = 0;
+    float mRight = 0;
+    float mBottom = 0;
+    RectI mBounds;
+    // Columns next to the left and right edge that only partially cover their pixel.
+    int mSolidLeft = 0;
+    int mSolidRight = 0;
+    Corner mCorners[4];
+};
+/**
+ * Scans a rounded rectangle, or the ring between two nested ones, row by row.
+ *
+ * Pixels whose coverage is constant over a run are reported as one run, which covers the straight part of every row
+ * and the empty inside of a ring.
+ *
+ * @param inner The shape cut out of \a outer, or nullptr to fill \a outer. It must lie inside \a outer.
+ * @param clip Device area to restrict the scan to.
+ * @param span Receives per-pixel runs as (y, x, coverage, count).
+ * @param solid Receives constant runs as (y, x0, x1, coverage), runs of zero coverage are skipped.
+ */
+template <typename SpanFn, typename SolidFn>
+void scanRoundRect(
+    const RoundRectRaster& outer,
+    const RoundRectRaster* inner,
+    const RectI& clip,
+    std::vector<uint8_t>& scratch,
+    SpanFn&& span,
+    SolidFn&& solid
+) {
+    const RectI area = outer.bounds().intersected(clip);
+    if (area.isEmpty()) { return; }
+    const auto width = static_cast<size_t>(area.width());
+    if (scratch.size() < width * 2) { scratch.resize(width * 2); }
+
+    for (int y = area.top; y < area.bottom; ++y) {
+        const RoundRectRaster::RowLayout o = outer.layout(y);
+        const RoundRectRaster::RowLayout in = inner ? inner->layout(y) : RoundRectRaster::RowLayout{};
+        const bool ring = in.x0 < in.x1;
+
+        // Adjacent per-pixel runs are merged and reported once.
+        int pendingFrom = area.left;
+        int pendingTo = area.left;
+        auto flush = [&]() {
+            if (pendingFrom >= pendingTo) { return; }
+            uint8_t* coverage = scratch.data();
+            outer.coverage(y, pendingFrom, pendingTo, coverage);
+            if (ring) {
+                uint8_t* cut = scratch.data() + width;
+                inner->coverage(y, pendingFrom, pendingTo, cut);
+                for (int i = 0; i < pendingTo - pendingFrom; ++i) {
+                    coverage[i] = coverage[i] > cut[i] ? static_cast<uint8_t>(coverage[i] - cut[i]) : uint8_t{0};
+                }
+            }
+            span(y, pendingFrom, coverage, pendingTo - pendingFrom);
+            pendingFrom = pendingTo;
+        };
+        auto pixels = [&](int from, int to) {
+            from = std::max(from, area.left);
+            to = std::min(to, area.right);
+            if (from >= to) { return; }
+            if (from != pendingTo) {
+                flush();
+                pendingFrom = from;
+            }
+            pendingTo = to;
+        };
+        auto constant = [&](int from, int to, int coverage) {
+            from = std::max(from, area.left);
+            to = std::min(to, area.right);
+            if (from >= to) { return; }
+            flush();
+            if (coverage > 0) { solid(y, from, to, static_cast<uint8_t>(coverage)); }
+        };
+
+        if (!ring) {
+            pixels(o.x0, o.a);
+            constant(o.a, o.b, o.middle);
+            pixels(o.b, o.x1);
+            flush();
+            continue;
+        }
+        // Between the outer edge and the inner shape only the outer coverage varies.
+        const int s0 = std::min(o.a, in.x0);
+        const int s1 = std::max(o.b, in.x1);
+        const int m0 = std::max(o.a, in.a);
+        const int m1 = std::min(o.b, in.b);
+        if (m0 >= m1) {
+            pixels(o.x0, o.x1);
+            flush();
+            continue;
+        }
+        pixels(o.x0, s0);
+        constant(s0, in.x0, o.middle);
+        pixels(in.x0, m0);
+        constant(m0, m1, o.middle - in.middle);
+        pixels(m1, in.x1);
+        constant(in.x1, s1, o.middle);
+        pixels(s1, o.x1);
+        flush();
+    }
+}
+} // namespace raster
+} // namespace bix
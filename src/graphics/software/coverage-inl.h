@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/geometry.h"
+#include "bixlib/graphics/stroke_style.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace bix::raster {
+
+/** Returns the length of the overlap between the pixel interval [p, p + 1) and [a, b). */
+inline float overlap(int p, float a, float b) noexcept {
+    const auto fp = static_cast<float>(p);
+    return std::clamp(std::min(b, fp + 1.0f) - std::max(a, fp), 0.0f, 1.0f);
+}
+
+/**
+ * Estimates the signed distance from a point to an axis-aligned ellipse centered at the origin.
+ * @param px The distance from the center along x, must be non-negative.
+ * @param py The distance from the center along y, must be non-negative.
+ */
+inline float ellipseDistance(float px, float py, float a, float b) noexcept {
+    if (math::exactlyEqual(a, b)) { return std::hypot(px, py) - a; }
+    const float k0 = std::hypot(px / a, py / b);
+    const float k1 = std::hypot(px / (a * a), py / (b * b));
+    if (k1 <= 0.0f) { return -std::min(a, b); }
+    return k0 * (k0 - 1.0f) / k1;
+}
+
+/**
+ * A rectangle with independent elliptical radii per corner, used for rounded rectangles and ellipses.
+ *
+ * Corners are indexed top-left, top-right, bottom-left, bottom-right, matching CornerRadiiT.
+ */
+struct RoundShape {
+    float left = 0;
+    float top = 0;
+    float right = 0;
+    float bottom = 0;
+    float rx[4]{};
+    float ry[4]{};
+
+    static RoundShape make(const Rect& r, float radiusX, float radiusY) noexcept {
+        const float radii[4]{1, 1, 1, 1};
+        return make(r, radii, radiusX, radiusY);
+    }
+
+    /**
+     * Creates a shape with per-corner radii, each corner radius is multiplied by the axis scale and clamped
+     * to half of the rectangle size.
+     */
+    static RoundShape make(const Rect& r, const float (&radii)[4], float scaleX, float scaleY) noexcept {
+        RoundShape s{r.left, r.top, r.right, r.bottom};
+        const float maxX = std::max(r.width() * 0.5f, 0.0f);
+        const float maxY = std::max(r.height() * 0.5f, 0.0f);
+        for (int i = 0; i < 4; ++i) {
+            s.rx[i] = std::clamp(radii[i] * scaleX, 0.0f, maxX);
+            s.ry[i] = std::clamp(radii[i] * scaleY, 0.0f, maxY);
+            if (s.rx[i] <= 0.0f || s.ry[i] <= 0.0f) { s.rx[i] = s.ry[i] = 0.0f; }
+        }
+        return s;
+    }
+
+    bool isEmpty() const noexcept { return right <= left || bottom <= top; }
+
+    /**
+     * Returns the shape moved inwards by \a d, a negative value grows it.
+     * @note Growing a sharp corner keeps it sharp, the result then bounds the exact offset curve.
+     */
+    RoundShape inset(float d) const noexcept {
+        RoundShape s{left + d, top + d, right - d, bottom - d};
+        for (int i = 0; i < 4; ++i) {
+            if (rx[i] <= 0.0f) { continue; }
+            s.rx[i] = std::max(rx[i] - d, 0.0f);
+            s.ry[i] = std::max(ry[i] - d, 0.0f);
+            if (s.rx[i] <= 0.0f || s.ry[i] <= 0.0f) { s.rx[i] = s.ry[i] = 0.0f; }
+        }
+        return s;
+    }
+
+    /** Estimates the signed distance from a point to the outline, negative inside. */
+    float distance(float x, float y) const noexcept {
+        const int corner = (x < (left + right) * 0.5f ? 0 : 1) + (y < (top + bottom) * 0.5f ? 0 : 2);
+        const float a = rx[corner];
+        const float b = ry[corner];
+        if (a > 0.0f) {
+            const float px = (corner & 1) != 0 ? x - (right - a) : left + a - x;
+            const float py = (corner & 2) != 0 ? y - (bottom - b) : top + b - y;
+            if (px > 0.0f && py > 0.0f) { return ellipseDistance(px, py, a, b); }
+        }
+        const float dx = std::max(left - x, x - right);
+        const float dy = std::max(top - y, y - bottom);
+        if (dx > 0.0f && dy > 0.0f) { return std::hypot(dx, dy); }
+        return std::max(dx, dy);
+    }
+
+    /**
+     * Computes the range covered by the left and right outline over the horizontal band [y0, y1].
+     * @return False if the band is not entirely inside the vertical extent of the shape.
+     */
+    bool rowExtent(float y0, float y1, float& leftMin, float& leftMax, float& rightMin, float& rightMax) const noexcept {
+        if (isEmpty() || y0 < top || y1 > bottom) { return false; }
+        sideExtent(y0, y1, 0, 2, leftMin, leftMax);
+        sideExtent(y0, y1, 1, 3, rightMin, rightMax);
+        // Offsets from the edge are computed for the left side, mirror them for the right side.
+        leftMin += left;
+        leftMax += left;
+        const float rMin = right - rightMax;
+        rightMax = right - rightMin;
+        rightMin = rMin;
+        return true;
+    }
+
+private:
+    // Horizontal inset of the outline from the straight edge at row y, for the corners of one side.
+    float insetAt(float y, int upper, int lower) const noexcept {
+        if (ry[upper] > 0.0f && y < top + ry[upper]) {
+            const float t = (top + ry[upper] - y) / ry[upper];
+            return rx[upper] * (1.0f - std::sqrt(std::max(1.0f - t * t, 0.0f)));
+        }
+        if (ry[lower] > 0.0f && y > bottom - ry[lower]) {
+            const float t = (y - (bottom - ry[lower])) / ry[lower];
+            return rx[lower] * (1.0f - std::sqrt(std::max(1.0f - t * t, 0.0f)));
+        }
+        return 0.0f;
+    }
+
+    void sideExtent(float y0, float y1, int upper, int lower, float& minInset, float& maxInset) const noexcept {
+        const float a = insetAt(y0, upper, lower);
+        const float b = insetAt(y1, upper, lower);
+        maxInset = std::max(a, b);
+        // The inset shrinks towards the straight part of the edge, which may lie inside the band.
+        const bool touchesStraight = y0 <= bottom - ry[lower] && y1 >= top + ry[upper];
+        minInset = touchesStraight ? 0.0f : std::min(a, b);
+    }
+};
+
+/**
+ * A stroked line segment with independent caps on both ends.
+ *
+ * Round and triangle caps are both rendered as round caps.
+ */
+struct LineShape {
+    Point origin;
+    float ux = 1;
+    float uy = 0;
+    float length = 0;
+    float halfWidth = 0;
+    float startExtent = 0;
+    float endExtent = 0;
+    bool roundStart = false;
+    bool roundEnd = false;
+
+    LineShape(const Point& p0, const Point& p1, float hw, CapStyle startCap, CapStyle endCap) noexcept
+        : origin(p0)
+        , halfWidth(hw) {
+        const float dx = p1.x - p0.x;
+        const float dy = p1.y - p0.y;
+        length = std::hypot(dx, dy);
+        if (length > 0.0f) {
+            ux = dx / length;
+            uy = dy / length;
+        }
+        roundStart = startCap == CapStyle::Round || startCap == CapStyle::Triangle;
+        roundEnd = endCap == CapStyle::Round || endCap == CapStyle::Triangle;
+        startExtent = startCap == CapStyle::Square ? hw : 0.0f;
+        endExtent = endCap == CapStyle::Square ? hw : 0.0f;
+    }
+
+    /** Returns how far the shape can reach beyond the segment end points. */
+    float reach() const noexcept { return halfWidth + std::max(startExtent, endExtent); }
+
+    /** Returns the signed distance from a point to the stroked outline, negative inside. */
+    float distance(float x, float y) const noexcept {
+        const float rx = x - origin.x;
+        const float ry = y - origin.y;
+        const float u = rx * ux + ry * uy;
+        const float v = ry * ux - rx * uy;
+        if (u < 0.0f && roundStart) { return std::hypot(u, v) - halfWidth; }
+        if (u > length && roundEnd) { return std::hypot(u - length, v) - halfWidth; }
+        const float du = std::max(-startExtent - u, u - (length + endExtent));
+        const float dv = std::abs(v) - halfWidth;
+        if (du > 0.0f && dv > 0.0f) { return std::hypot(du, dv); }
+        return std::max(du, dv);
+    }
+};
+
+/** Converts a coverage fraction to an 8-bit value, clamping out-of-range input. */
+inline uint8_t toCoverage(float c) noexcept {
+    if (c <= 0.0f) { return 0; }
+    if (c >= 1.0f) { return 255; }
+    return static_cast<uint8_t>(c * 255.0f + 0.5f);
+}
+
+/**
+ * Scans the region between two nested outlines row by row.
+ *
+ * Pixels between \a outer and \a inner are evaluated one by one with \a coverageAt, pixels inside \a inner are
+ * either skipped or reported as one fully covered run. \a outer must enclose every partially covered pixel and
+ * \a inner must only contain pixels of uniform coverage.
+ *
+ * @param clip Device area to restrict the scan to.
+ * @param innerFilled Whether pixels inside \a inner are fully covered (fill) or empty (stroke).
+ * @param coverageAt Returns the coverage in range [0, 1] of the pixel centered at (x, y).
+ * @param span Receives per-pixel runs as (y, x, coverage, count).
+ * @param solid Receives constant runs as (y, x0, x1, coverage).
+ */
+template <typename CoverageFn, typename SpanFn, typename SolidFn>
+void scanRing(
+    const RoundShape& outer,
+    const RoundShape& inner,
+    bool innerFilled,
+    const RectI& clip,
+    std::vector<uint8_t>& scratch,
+    CoverageFn&& coverageAt,
+    SpanFn&& span,
+    SolidFn&& solid
+) {
+    if (outer.isEmpty()) { return; }
+    const RectI area = Rect(outer.left, outer.top, outer.right, outer.bottom).aligned().intersected(clip);
+    if (area.isEmpty()) { return; }
+    if (scratch.size() < static_cast<size_t>(area.width())) { scratch.resize(static_cast<size_t>(area.width())); }
+
+    auto evaluate = [&](int y, int x0, int x1) {
+        if (x0 >= x1) { return; }
+        const float cy = static_cast<float>(y) + 0.5f;
+        for (int x = x0; x < x1; ++x) {
+            scratch[static_cast<size_t>(x - x0)] = toCoverage(coverageAt(static_cast<float>(x) + 0.5f, cy));
+        }
+        span(y, x0, scratch.data(), x1 - x0);
+    };
+
+    for (int y = area.top; y < area.bottom; ++y) {
+        const auto y0 = static_cast<float>(y);
+        const float y1 = y0 + 1.0f;
+        int x0 = area.left;
+        int x1 = area.right;
+        float lMin = 0, lMax = 0, rMin = 0, rMax = 0;
+        if (outer.rowExtent(y0, y1, lMin, lMax, rMin, rMax)) {
+            x0 = std::max(x0, static_cast<int>(std::floor(lMin)));
+            x1 = std::min(x1, static_cast<int>(std::ceil(rMax)));
+        }
+        int h0 = x1;
+        int h1 = x1;
+        if (inner.rowExtent(y0, y1, lMin, lMax, rMin, rMax)) {
+            h0 = std::clamp(static_cast<int>(std::ceil(lMax)), x0, x1);
+            h1 = std::clamp(static_cast<int>(std::floor(rMin)), h0, x1);
+        }
+        if (h0 >= h1) {
+            evaluate(y, x0, x1);
+            continue;
+        }
+        evaluate(y, x0, h0);
+        if (innerFilled) { solid(y, h0, h1, uint8_t{255}); }
+        evaluate(y, h1, x1);
+    }
+}
+} // namespace bix::raster
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "engine.h"
+
+#include "soft_canvas.h"
+
+namespace bix {
+
+void SoftwareEngine::shutdown() noexcept {
+    mTextCache = nullptr;
+    mGradientCache = nullptr;
+}
+
+RenderEngine::Type SoftwareEngine::type() const noexcept {
+    return Type::Software;
+}
+
+CanvasPtr SoftwareEngine::createCanvas(const Window& w) {
+    BIX_UNUSED(w)
+    return nullptr;
+}
+
+CanvasPtr SoftwareEngine::createOffscreenCanvas(const SizeI& size) {
+    if (size.width <= 0 || size.height <= 0) { return nullptr; }
+    return std::make_unique<SoftwareCanvas>(size, textCache(), gradientCache());
+}
+
+const SoftTextCachePtr& SoftwareEngine::textCache() {
+    if (!mTextCache) { mTextCache = std::make_shared<SoftTextCache>(); }
+    return mTextCache;
+}
+
+const GradientRampCachePtr& SoftwareEngine::gradientCache() {
+    if (!mGradientCache) { mGradientCache = std::make_shared<GradientRampCache>(); }
+    return mGradientCache;
+}
+} // namespace bix
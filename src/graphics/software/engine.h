@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/graphics/engine.h"
+#include "bixlib/graphics/gradient.h"
+
+#include "text_paint.h"
+
+namespace bix {
+
+/**
+ * Render engine rasterizing on the CPU without any GPU or windowing system dependency.
+ *
+ * It renders into off-screen premultiplied RGBA8 buffers and serves as the reference backend for
+ * headless environments, tests and benchmarks.
+ */
+class SoftwareEngine : public RenderEngine {
+public:
+    static SoftwareEngine* instance() {
+        static SoftwareEngine instance;
+        return &instance;
+    }
+
+    void shutdown() noexcept override;
+    Type type() const noexcept override;
+
+    /**
+     * The software engine has no presentation surface, window canvases are therefore not supported.
+     * @return Always nullptr, use createOffscreenCanvas() instead.
+     */
+    [[nodiscard]]
+    CanvasPtr createCanvas(const Window& w) override;
+
+    [[nodiscard]]
+    CanvasPtr createOffscreenCanvas(const SizeI& size) override;
+
+    /** Returns the text caches shared by all canvases created by this engine. */
+    const SoftTextCachePtr& textCache();
+
+    /** Returns the gradient ramps shared by all canvases created by this engine. */
+    const GradientRampCachePtr& gradientCache();
+
+private:
+    SoftwareEngine() = default;
+
+    SoftTextCachePtr mTextCache;
+    GradientRampCachePtr mGradientCache;
+};
+
+} // namespace bix
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "gradient_shader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace bix {
+
+GradientShader::GradientShader(
+    const GradientBrush& brush,
+    const GradientRamp& ramp,
+    float scaleX,
+    float scaleY,
+    float offsetX,
+    float offsetY
+) noexcept
+    : Shader(static_cast<uint8_t>(brush.opacity() * 255.f + 0.5f))
+    , mRamp(ramp)
+    , mStyle(brush.style())
+    , mOffsetX(offsetX)
+    , mOffsetY(offsetY) {
+    if (mOpacity == 0 || brush.gradient().isEmpty() || math::exactlyEqual(scaleX, 0.f)
+        || math::exactlyEqual(scaleY, 0.f)) {
+        mEmpty = true;
+        return;
+    }
+    mInvScaleX = 1.f / scaleX;
+    mInvScaleY = 1.f / scaleY;
+
+    switch (mStyle) {
+    case BrushStyle::LinearGradient: {
+        const auto& linear = static_cast<const LinearGradientBrush&>(brush);
+        const Point& start = linear.startPoint();
+        const float dx = linear.endPoint().x - start.x;
+        const float dy = linear.endPoint().y - start.y;
+        const float lengthSq = dx * dx + dy * dy;
+        mX = start.x;
+        mY = start.y;
+        // A zero length gradient line paints the last stop.
+        if (lengthSq > 0.f) {
+            mU = dx / lengthSq;
+            mV = dy / lengthSq;
+        }
+        break;
+    }
+    case BrushStyle::RadialGradient: {
+        const Ellipse& ellipse = static_cast<const RadialGradientBrush&>(brush).ellipse();
+        mX = ellipse.center.x;
+        mY = ellipse.center.y;
+        mU = ellipse.radiusX > 0.f ? 1.f / ellipse.radiusX : 0.f;
+        mV = ellipse.radiusY > 0.f ? 1.f / ellipse.radiusY : 0.f;
+        break;
+    }
+    case BrushStyle::ConicGradient: {
+        const auto& conic = static_cast<const ConicGradientBrush&>(brush);
+        mX = conic.center().x;
+        mY = conic.center().y;
+        mU = conic.startAngle() / 360.f;
+        break;
+    }
+    default: mEmpty = true; break;
+    }
+}
+
+void GradientShader::shadeRow(int y, int x, int count, uint32_t* out) noexcept {
+    const float v = ((static_cast<float>(y) + 0.5f) - mOffsetY) * mInvScaleY - mY;
+    const float u0 = ((static_cast<float>(x) + 0.5f) - mOffsetX) * mInvScaleX - mX;
+    auto u = [u0, this](int i) { return u0 + static_cast<float>(i) * mInvScaleX; };
+
+    switch (mStyle) {
+    case BrushStyle::LinearGradient: {
+        if (math::exactlyEqual(mU, 0.f) && math::exactlyEqual(mV, 0.f)) {
+            std::fill_n(out, count, mRamp.lookup(1.f));
+            return;
+        }
+        // The position along the gradient line changes by a constant step per pixel.
+        const float t0 = u0 * mU + v * mV;
+        const float dt = mInvScaleX * mU;
+        for (int i = 0; i < count; ++i) { out[i] = mRamp.lookup(t0 + static_cast<float>(i) * dt); }
+        break;
+    }
+    case BrushStyle::RadialGradient: {
+        if (math::exactlyEqual(mU, 0.f) || math::exactlyEqual(mV, 0.f)) {
+            std::fill_n(out, count, mRamp.lookup(1.f));
+            return;
+        }
+        const float ny = v * mV;
+        for (int i = 0; i < count; ++i) {
+            const float nx = u(i) * mU;
+            out[i] = mRamp.lookup(std::sqrt(nx * nx + ny * ny));
+        }
+        break;
+    }
+    default: {
+        // Angles grow clockwise on screen because the y-axis points down.
+        constexpr float kTurn = 1.f / (2.f * std::numbers::pi_v<float>);
+        for (int i = 0; i < count; ++i) {
+            float t = std::atan2(v, u(i)) * kTurn - mU;
+            t -= std::floor(t);
+            out[i] = mRamp.lookup(t);
+        }
+        break;
+    }
+    }
+}
+} // namespace bix
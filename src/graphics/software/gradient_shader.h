@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "bixlib/graphics/brush.h"
+
+#include "shader.h"
+
+#include <cstdint>
+
+namespace bix {
+
+/**
+ * Evaluates a gradient brush for rows of device pixels.
+ *
+ * Pixel centers are mapped back through the canvas transform into the space the brush was specified in, so the
+ * gradient scales and moves with the transform. The color of a pixel is a lookup into the baked ramp of the brush.
+ */
+class GradientShader final : public Shader {
+public:
+    /**
+     * @param brush The brush to evaluate.
+     * @param ramp The baked ramp of the brush gradient.
+     * @param scaleX Horizontal scale of the canvas transform.
+     * @param scaleY Vertical scale of the canvas transform.
+     * @param offsetX Horizontal translation of the canvas transform.
+     * @param offsetY Vertical translation of the canvas transform.
+     */
+    GradientShader(
+        const GradientBrush& brush,
+        const GradientRamp& ramp,
+        float scaleX,
+        float scaleY,
+        float offsetX,
+        float offsetY
+    ) noexcept;
+
+    /** Returns whether the shader paints nothing, because the brush is transparent or the transform degenerate. */
+    bool isEmpty() const noexcept { return mEmpty; }
+
+    void shadeRow(int y, int x, int count, uint32_t* out) noexcept override;
+
+private:
+    const GradientRamp& mRamp;
+    BrushStyle mStyle;
+    bool mEmpty = false;
+
+    // Inverse of the canvas transform, mapping device pixels into brush space.
+    float mInvScaleX = 0.f;
+    float mInvScaleY = 0.f;
+    float mOffsetX;
+    float mOffsetY;
+
+    // Linear: start point and the direction divided by its squared length.
+    // Radial: center and the reciprocal radii. Conic: center and the start angle in turns.
+    float mX = 0.f;
+    float mY = 0.f;
+    float mU = 0.f;
+    float mV = 0.f;
+};
+} // namespace bix
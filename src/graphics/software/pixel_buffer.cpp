@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pixel_buffer.h"
+
+#include "blend-inl.h"
+
+namespace bix {
+
+PixelBuffer::PixelBuffer(int width, int height) {
+    reset(width, height);
+}
+
+void PixelBuffer::reset(int width, int height) {
+    mWidth = std::max(width, 0);
+    mHeight = std::max(height, 0);
+    mPixels.assign(static_cast<size_t>(mWidth) * static_cast<size_t>(mHeight), 0u);
+}
+
+Color PixelBuffer::colorAt(int x, int y) const noexcept {
+    return pixel::unpremultiply(pixel(x, y));
+}
+} // namespace bix
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/geometry/rect.h"
+#include "bixlib/graphics/color.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace bix {
+
+/**
+ * A tightly packed premultiplied RGBA8 image stored in CPU memory.
+ *
+ * Rows are contiguous and the stride always equals the width, which keeps span loops free of any per-row
+ * pointer arithmetic beyond a single multiplication.
+ */
+class PixelBuffer {
+public:
+    PixelBuffer() = default;
+    PixelBuffer(int width, int height);
+
+    /**
+     * Reallocates the buffer, all pixels become fully transparent.
+     * @param width The new width in pixels, negative values are treated as zero.
+     * @param height The new height in pixels, negative values are treated as zero.
+     */
+    void reset(int width, int height);
+
+    int width() const noexcept { return mWidth; }
+
+    int height() const noexcept { return mHeight; }
+
+    RectI bounds() const noexcept { return {0, 0, mWidth, mHeight}; }
+
+    uint32_t* row(int y) noexcept { return mPixels.data() + static_cast<size_t>(y) * static_cast<size_t>(mWidth); }
+
+    const uint32_t* row(int y) const noexcept {
+        return mPixels.data() + static_cast<size_t>(y) * static_cast<size_t>(mWidth);
+    }
+
+    const uint32_t* data() const noexcept { return mPixels.data(); }
+
+    /** Returns the raw premultiplied pixel at the given position. */
+    uint32_t pixel(int x, int y) const noexcept { return row(y)[x]; }
+
+    /** Returns the pixel at the given position converted back to a straight-alpha color. */
+    Color colorAt(int x, int y) const noexcept;
+
+private:
+    int mWidth = 0;
+    int mHeight = 0;
+    std::vector<uint32_t> mPixels;
+};
+} // namespace bix
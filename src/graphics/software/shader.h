@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace bix {
+
+/**
+ * Source of per-pixel colors for the blits of a SoftwareCanvas.
+ *
+ * While a shader is bound, blits take the color of each pixel from the shader instead of a solid color, the coverage
+ * of the rasterized shape is applied on top.
+ */
+class Shader {
+public:
+    virtual ~Shader();
+
+    /** Writes the premultiplied colors of \a count pixels of row \a y starting at column \a x. */
+    virtual void shadeRow(int y, int x, int count, uint32_t* out) noexcept = 0;
+
+    /** Returns the opacity multiplied into all shaded pixels as an 8-bit factor. */
+    uint8_t opacity() const noexcept { return mOpacity; }
+
+protected:
+    explicit Shader(uint8_t opacity) noexcept : mOpacity(opacity) {}
+
+    uint8_t mOpacity;
+};
+} // namespace bix
@@ -0,0 +1,892 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "soft_canvas.h"
+
+#include "blend-inl.h"
+#include "brush.h"
+#include "coverage-inl.h"
+#include "text_paint.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace bix {
+
+using namespace std;
+using raster::LineShape;
+using raster::RoundShape;
+using raster::toCoverage;
+
+namespace {
+// The shortest run of full coverage that is blended as a solid run instead of per-pixel coverage.
+constexpr int kSolidRun = 16;
+
+// Dash patterns of the predefined line styles, in multiples of the stroke width.
+const vector<float>& dashPattern(const Pen& pen) {
+    static const vector<float> kDash{2, 2};
+    static const vector<float> kDot{0, 2};
+    static const vector<float> kDashDot{2, 2, 0, 2};
+    static const vector<float> kDashDotDot{2, 2, 0, 2, 0, 2};
+    switch (pen.lineStyle()) {
+    case LineStyle::Dash: return kDash;
+    case LineStyle::Dot: return kDot;
+    case LineStyle::DashDot: return kDashDot;
+    case LineStyle::DashDotDot: return kDashDotDot;
+    default: return pen.customDash();
+    }
+}
+
+bool isPixelAligned(const Rect& r) {
+    auto aligned = [](float v) { return std::abs(v - std::round(v)) < 1.0f / 256.0f; };
+    return aligned(r.left) && aligned(r.top) && aligned(r.right) && aligned(r.bottom);
+}
+
+// Computes the rect covered by an axis-aligned segment without round caps, such strokes have exact coverage.
+// Returns false for other segments, a zero-length segment without square caps yields an empty rect.
+bool axisAlignedStroke(Point p0, Point p1, float halfWidth, CapStyle startCap, CapStyle endCap, Rect& out) {
+    const float dx = p1.x - p0.x;
+    const float dy = p1.y - p0.y;
+    const bool roundCaps = startCap == CapStyle::Round || startCap == CapStyle::Triangle || endCap == CapStyle::Round
+                           || endCap == CapStyle::Triangle;
+    if (roundCaps || (!math::exactlyEqual(dx, 0.0f) && !math::exactlyEqual(dy, 0.0f))) { return false; }
+
+    const float e0 = startCap == CapStyle::Square ? halfWidth : 0.0f;
+    const float e1 = endCap == CapStyle::Square ? halfWidth : 0.0f;
+    if (math::exactlyEqual(dy, 0.0f) && !math::exactlyEqual(dx, 0.0f)) {
+        const float dir = dx > 0.0f ? 1.0f : -1.0f;
+        const float x0 = p0.x - dir * e0;
+        const float x1 = p1.x + dir * e1;
+        out = {std::min(x0, x1), p0.y - halfWidth, std::max(x0, x1), p0.y + halfWidth};
+    } else if (!math::exactlyEqual(dy, 0.0f)) {
+        const float dir = dy > 0.0f ? 1.0f : -1.0f;
+        const float y0 = p0.y - dir * e0;
+        const float y1 = p1.y + dir * e1;
+        out = {p0.x - halfWidth, std::min(y0, y1), p0.x + halfWidth, std::max(y0, y1)};
+    } else if (e0 > 0.0f || e1 > 0.0f) {
+        // A zero-length segment only shows its square caps.
+        out = {p0.x - halfWidth, p0.y - halfWidth, p0.x + halfWidth, p0.y + halfWidth};
+    } else {
+        out = {};
+    }
+    return true;
+}
+
+// Extends \a run by \a next if \a next continues it along a full edge, to the right or downwards.
+bool extendRect(Rect& run, const Rect& next) noexcept {
+    using math::exactlyEqual;
+    if (exactlyEqual(run.right, next.left) && exactlyEqual(run.top, next.top)
+        && exactlyEqual(run.bottom, next.bottom)) {
+        run.right = next.right;
+        return true;
+    }
+    if (exactlyEqual(run.bottom, next.top) && exactlyEqual(run.left, next.left)
+        && exactlyEqual(run.right, next.right)) {
+        run.bottom = next.bottom;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Merges consecutive device rects that share a full edge before filling them. Cells of a row merge into the row
+ * and rows of equal width merge with the previous row, so a uniform table background becomes a single fill and
+ * shared edges are not blended twice. Rects are filled in their original order.
+ */
+template <typename Fill>
+class RectMerger {
+public:
+    explicit RectMerger(Fill fill) : mFill(std::move(fill)) {}
+
+    void add(const Rect& rect) {
+        if (rect.isEmpty()) { return; }
+        if (!mRun.isEmpty() && extendRect(mRun, rect)) { return; }
+        settle();
+        mRun = rect;
+    }
+
+    void finish() {
+        settle();
+        if (!mPending.isEmpty()) { mFill(mPending); }
+        mPending = {};
+    }
+
+private:
+    // Moves the finished run behind the pending rect, merging both when the run continues it.
+    void settle() {
+        if (mRun.isEmpty()) { return; }
+        if (mPending.isEmpty() || !extendRect(mPending, mRun)) {
+            if (!mPending.isEmpty()) { mFill(mPending); }
+            mPending = mRun;
+        }
+        mRun = {};
+    }
+
+    Fill mFill;
+    Rect mRun;
+    Rect mPending;
+};
+
+// Clips the source region to the bitmap and shrinks the destination by the same proportions.
+bool clipBitmapRects(const Bitmap& bitmap, Rect& src, Rect& dst) {
+    if (bitmap.isEmpty() || src.isEmpty() || dst.isEmpty()) { return false; }
+    const Rect bounds(0, 0, static_cast<float>(bitmap.width()), static_cast<float>(bitmap.height()));
+    const Rect clipped = src.intersected(bounds);
+    if (clipped.isEmpty()) { return false; }
+    const float sx = dst.width() / src.width();
+    const float sy = dst.height() / src.height();
+    dst = Rect(
+        dst.left + (clipped.left - src.left) * sx,
+        dst.top + (clipped.top - src.top) * sy,
+        dst.right - (src.right - clipped.right) * sx,
+        dst.bottom - (src.bottom - clipped.bottom) * sy
+    );
+    src = clipped;
+    return true;
+}
+
+RectI clampedAligned(const Rect& r, const RectI& clip) {
+    if (r.isEmpty()) { return {}; }
+    const RectI result = r.aligned().intersected(clip);
+    return result.isEmpty() ? RectI{} : result;
+}
+} // namespace
+
+SoftwareCanvas::SoftwareCanvas(const SizeI& size, SoftTextCachePtr textCache, GradientRampCachePtr gradientCache)
+    : mSafeScopeId(reinterpret_cast<uintptr_t>(this))
+    , mPixels(size.width, size.height)
+    , mKernels(pixel::spanKernels())
+    , mTextCache(textCache ? std::move(textCache) : make_shared<SoftTextCache>())
+    , mGradientCache(gradientCache ? std::move(gradientCache) : make_shared<GradientRampCache>()) {
+    resetClips();
+}
+
+ColorBrushPtr SoftwareCanvas::createColorBrush(const Color& color) {
+    return make_unique<SoftColorBrush>(color, mSafeScopeId);
+}
+
+LinearGradientBrushPtr SoftwareCanvas::createLinearGradientBrush(
+    const Point& start,
+    const Point& end,
+    const Gradient& gradient
+) {
+    return make_unique<SoftLinearGradientBrush>(mSafeScopeId, mGradientCache, start, end, gradient);
+}
+
+RadialGradientBrushPtr SoftwareCanvas::createRadialGradientBrush(const Ellipse& ellipse, const Gradient& gradient) {
+    return make_unique<SoftRadialGradientBrush>(mSafeScopeId, mGradientCache, ellipse, gradient);
+}
+
+ConicGradientBrushPtr SoftwareCanvas::createConicGradientBrush(
+    const Point& center,
+    float startAngle,
+    const Gradient& gradient
+) {
+    return make_unique<SoftConicGradientBrush>(mSafeScopeId, mGradientCache, center, startAngle, gradient);
+}
+
+TextPaintPtr SoftwareCanvas::createTextPaint() {
+    return make_unique<SoftTextPaint>(mSafeScopeId, mTextCache);
+}
+
+void SoftwareCanvas::beginDraw() {
+    resetClips();
+}
+
+DrawResult SoftwareCanvas::endDraw() {
+    const bool balanced = mClips.depth() == 0;
+    resetClips();
+    return balanced ? DrawResult::Success : DrawResult::Error;
+}
+
+void SoftwareCanvas::setTransform(const Transform& transform) {
+    const float* m = transform.data();
+    mScaleX = m[0];
+    mScaleY = m[4];
+    mOffsetX = m[6];
+    mOffsetY = m[7];
+    mTransform = Transform(mScaleX, 0, 0, 0, mScaleY, 0, mOffsetX, mOffsetY, 1);
+}
+
+void SoftwareCanvas::resize(const Size& size) {
+    mPixels.reset(math::ceil_cast<int>(size.width), math::ceil_cast<int>(size.height));
+    resetClips();
+}
+
+void SoftwareCanvas::resetClips() {
+    const RectI surface = mPixels.bounds();
+    mClips.reset(Rect(
+        static_cast<float>(surface.left),
+        static_cast<float>(surface.top),
+        static_cast<float>(surface.right),
+        static_cast<float>(surface.bottom)
+    ));
+    mClipStates.resize(1);
+    mClipStates[0] = {surface, nullptr};
+}
+
+void SoftwareCanvas::clear(const Color& c) {
+    const uint32_t color = pixel::premultiply(c);
+    const ClipState& clip = currentClip();
+    const int width = clip.bounds.width();
+    for (int y = clip.bounds.top; y < clip.bounds.bottom; ++y) {
+        uint32_t* dst = mPixels.row(y) + clip.bounds.left;
+        if (!clip.mask) {
+            mKernels.fill(dst, width, color);
+            continue;
+        }
+        // Clear replaces the destination, partially covered mask pixels interpolate between both.
+        const uint8_t* mask = clip.maskAt(clip.bounds.left, y);
+        for (int i = 0; i < width; ++i) {
+            const uint32_t m = pixel::coverageScale(mask[i]);
+            dst[i] = pixel::scale(color, m) + pixel::scale(dst[i], 256 - m);
+        }
+    }
+}
+
+bool SoftwareCanvas::pushClip(const RoundRect& rect) {
+    if (!rect.rect.isValid()) { return false; }
+
+    // Clips containing the current clip are only tracked by the stack, they neither change the bounds nor the mask.
+    const ClipOp op = mClips.push(rect, mTransform);
+    if (op == ClipOp::Skip) { return true; }
+
+    const ClipState& parent = currentClip();
+    const Rect device = mapRect(rect.rect);
+    const RectI bounds = clampedAligned(device, parent.bounds);
+
+    if ((op == ClipOp::Intersect && isPixelAligned(device)) || bounds.isEmpty()) {
+        mClipStates.push_back(parent);
+        mClipStates.back().bounds = bounds;
+        return true;
+    }
+
+    // Fractional rects and rounded clips are baked relative to their top-left pixel and cached, so the same clip
+    // moved across the surface reuses its mask. Clips reaching beyond the surface get a mask of their visible part.
+    const RoundShape shape = mapRoundRect(rect);
+    ClipState state{bounds, nullptr};
+    if (mPixels.bounds().contains(device.aligned())) {
+        state.mask = mClipMasks.obtain(shape, mCornerMasks, state.maskX, state.maskY);
+    } else {
+        auto mask = make_shared<ClipMask>();
+        mask->area = bounds;
+        mask->coverage.assign(static_cast<size_t>(bounds.width()) * static_cast<size_t>(bounds.height()), 0);
+        bakeClipMask(shape, *mask, mOuterShape, mCornerMasks, mScanline);
+        state.mask = std::move(mask);
+    }
+
+    if (parent.mask) {
+        auto mask = make_shared<ClipMask>();
+        mask->area = bounds;
+        mask->coverage.resize(static_cast<size_t>(bounds.width()) * static_cast<size_t>(bounds.height()));
+        uint8_t* dst = mask->coverage.data();
+        for (int y = bounds.top; y < bounds.bottom; ++y) {
+            const uint8_t* src = state.maskAt(bounds.left, y);
+            const uint8_t* outer = parent.maskAt(bounds.left, y);
+            for (int i = 0; i < bounds.width(); ++i) { *dst++ = pixel::mulCoverage(src[i], outer[i]); }
+        }
+        state = {bounds, std::move(mask)};
+    }
+
+    mClipStates.push_back(std::move(state));
+    return true;
+}
+
+void SoftwareCanvas::popClip() {
+    if (mClips.pop() != ClipOp::Skip) { mClipStates.pop_back(); }
+}
+
+Size SoftwareCanvas::size() const noexcept {
+    return {static_cast<float>(mPixels.width()), static_cast<float>(mPixels.height())};
+}
+
+template <typename Fill>
+void SoftwareCanvas::withBrush(Brush& brush, Fill&& fill) {
+    if (brush.style() == BrushStyle::SolidColor) {
+        assert(brush.testCast(mSafeScopeId, SoftColorBrush_CAST_ID));
+        const auto& colorBrush = static_cast<SoftColorBrush&>(brush);
+        fill(pixel::premultiply(colorBrush.color(), colorBrush.opacity()));
+        return;
+    }
+
+    assert(brush.testCast(mSafeScopeId, SoftGradientBrush_CAST_ID));
+    const GradientRamp* ramp = nullptr;
+    switch (brush.style()) {
+    case BrushStyle::LinearGradient: ramp = &static_cast<SoftLinearGradientBrush&>(brush).ramp(); break;
+    case BrushStyle::RadialGradient: ramp = &static_cast<SoftRadialGradientBrush&>(brush).ramp(); break;
+    case BrushStyle::ConicGradient: ramp = &static_cast<SoftConicGradientBrush&>(brush).ramp(); break;
+    default: return;
+    }
+    GradientShader shader(static_cast<GradientBrush&>(brush), *ramp, mScaleX, mScaleY, mOffsetX, mOffsetY);
+    if (shader.isEmpty()) { return; }
+
+    // The color only has to be non-zero while the shader is bound, blits take their colors from the shader.
+    mShader = &shader;
+    fill(~0u);
+    mShader = nullptr;
+}
+
+void SoftwareCanvas::fillRectangle(const Rect& rect, Brush& brush) {
+    fillRects({&rect, 1}, brush);
+}
+
+void SoftwareCanvas::fillRects(span<const Rect> rects, Brush& brush) {
+    if (rects.empty()) { return; }
+    withBrush(brush, [&](uint32_t color) { fillDeviceRects(rects, color); });
+}
+
+void SoftwareCanvas::fillPath(const Path& path, Brush& brush) {
+    if (path.isEmpty()) { return; }
+    const FlattenedPathPtr flat = path.flatten(std::max(std::abs(mScaleX), std::abs(mScaleY)));
+    if (flat->contourEnds.empty()) { return; }
+    const RectI& clip = currentClip().bounds;
+    const Rect device = mapRect(flat->bounds);
+    if (device.right <= static_cast<float>(clip.left) || device.bottom <= static_cast<float>(clip.top)
+        || device.left >= static_cast<float>(clip.right) || device.top >= static_cast<float>(clip.bottom)) {
+        return;
+    }
+
+    mScan.reset(clip);
+    for (size_t i = 0; i < flat->contourEnds.size(); ++i) {
+        const span<const Point> contour = flat->contour(i);
+        Point prev = mapPoint(contour.back());
+        for (const Point& p : contour) {
+            const Point next = mapPoint(p);
+            mScan.addEdge(prev, next);
+            prev = next;
+        }
+    }
+    withBrush(brush, [&](uint32_t color) {
+        mScan.sweep(path.fillRule(), [&](int y, int x, const uint8_t* coverage, int count) {
+            // Long fully covered runs in the interior of the shape take the solid fill path.
+            int start = 0;
+            int i = 0;
+            while (i < count) {
+                if (coverage[i] != 255) {
+                    ++i;
+                    continue;
+                }
+                int end = i;
+                while (end < count && coverage[end] == 255) { ++end; }
+                if (end - i >= kSolidRun) {
+                    if (i > start) { blitSpan(y, x + start, coverage + start, i - start, color); }
+                    blitSolid(y, x + i, x + end, 255, color);
+                    start = end;
+                }
+                i = end;
+            }
+            if (count > start) { blitSpan(y, x + start, coverage + start, count - start, color); }
+        });
+    });
+}
+
+void SoftwareCanvas::fillRoundRect(const RoundRect& rect, Brush& brush) {
+    if (!rect.rect.isValid()) { return; }
+    const RoundShape shape = mapRoundRect(rect);
+    withBrush(brush, [&](uint32_t color) { fillShape(shape, color); });
+}
+
+void SoftwareCanvas::fillEllipse(const Ellipse& ellipse, Brush& brush) {
+    if (ellipse.isEmpty()) { return; }
+    const Rect device = mapRect(ellipse.bounds());
+    const RoundShape shape = RoundShape::make(device, device.width() * 0.5f, device.height() * 0.5f);
+    withBrush(brush, [&](uint32_t color) { fillShape(shape, color); });
+}
+
+void SoftwareCanvas::drawBitmap(
+    const Bitmap& bitmap,
+    const Rect& src,
+    const Rect& dst,
+    float opacity,
+    BitmapSampling sampling
+) {
+    Rect source = src;
+    Rect target = dst;
+    const auto alpha = static_cast<uint8_t>(std::clamp(opacity, 0.0f, 1.0f) * 255.0f + 0.5f);
+    if (alpha == 0 || math::exactlyEqual(mScaleX, 0.f) || math::exactlyEqual(mScaleY, 0.f)) { return; }
+    if (!clipBitmapRects(bitmap, source, target)) { return; }
+
+    // Downscaled immutable bitmaps are sampled from the level closest to the drawn size.
+    const Rect device = mapRect(target);
+    const size_t level =
+        bitmap.mipLevelFor(std::min(device.width() / source.width(), device.height() / source.height()));
+    const Bitmap& sampled = bitmap.mipLevel(level);
+    if (level > 0) {
+        const float fx = static_cast<float>(sampled.width()) / static_cast<float>(bitmap.width());
+        const float fy = static_cast<float>(sampled.height()) / static_cast<float>(bitmap.height());
+        source = Rect(source.left * fx, source.top * fy, source.right * fx, source.bottom * fy);
+    }
+
+    BitmapShader shader(sampled, source, target, alpha, sampling, mScaleX, mScaleY, mOffsetX, mOffsetY, mBitmapRows);
+    mShader = &shader;
+    fillDeviceRect(device, {}, ~0u);
+    mShader = nullptr;
+}
+
+void SoftwareCanvas::drawRectangle(const Rect& rect, const Pen& pen) {
+    const uint32_t color = pixel::premultiply(pen.color());
+    if (color == 0 || pen.strokeWidth() <= 0.0f) { return; }
+
+    if (pen.lineStyle() != LineStyle::Solid) {
+        // Dashes run continuously around the outline, starting at the top-left corner.
+        float phase = 0.0f;
+        strokeLine({rect.left, rect.top, rect.right, rect.top}, pen, phase);
+        strokeLine({rect.right, rect.top, rect.right, rect.bottom}, pen, phase);
+        strokeLine({rect.right, rect.bottom, rect.left, rect.bottom}, pen, phase);
+        strokeLine({rect.left, rect.bottom, rect.left, rect.top}, pen, phase);
+        return;
+    }
+
+    const Rect device = mapRect(rect);
+    const float hw = mapWidth(pen.strokeWidth()) * 0.5f;
+    if (pen.lineJoin() == LineJoinStyle::Miter || pen.lineJoin() == LineJoinStyle::MiterOrBevel) {
+        fillDeviceRect(device.inflated(hw, hw), device.inflated(-hw, -hw), color);
+    } else {
+        // The distance field of a sharp rectangle rounds the outer corners, bevel joins are rendered the same way.
+        strokeShape(RoundShape::make(device, 0.0f, 0.0f), hw, color);
+    }
+}
+
+void SoftwareCanvas::drawRects(span<const Rect> rects, const Pen& pen) {
+    for (const Rect& rect : rects) { SoftwareCanvas::drawRectangle(rect, pen); }
+}
+
+void SoftwareCanvas::drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) {
+    const uint32_t color = pixel::premultiply(pen.color());
+    if (color == 0 || pen.strokeWidth() <= 0.0f) { return; }
+    const RoundShape shape =
+        RoundShape::make(mapRect(rect), radiusX * std::abs(mScaleX), radiusY * std::abs(mScaleY));
+    strokeShape(shape, mapWidth(pen.strokeWidth()) * 0.5f, color);
+}
+
+void SoftwareCanvas::drawRoundRect(const RoundRect& rect, const Pen& pen) {
+    const uint32_t color = pixel::premultiply(pen.color());
+    if (color == 0 || pen.strokeWidth() <= 0.0f || !rect.rect.isValid()) { return; }
+    strokeShape(mapRoundRect(rect), mapWidth(pen.strokeWidth()) * 0.5f, color);
+}
+
+void SoftwareCanvas::drawEllipse(const Ellipse& ellipse, const Pen& pen) {
+    const uint32_t color = pixel::premultiply(pen.color());
+    if (color == 0 || pen.strokeWidth() <= 0.0f) { return; }
+    const Rect device = mapRect(ellipse.bounds());
+    const RoundShape shape = RoundShape::make(device, device.width() * 0.5f, device.height() * 0.5f);
+    strokeShape(shape, mapWidth(pen.strokeWidth()) * 0.5f, color);
+}
+
+void SoftwareCanvas::measureText(TextPaint& format, TextMetrics& metrics) {
+    assert(format.testCast(mSafeScopeId, SoftTextPaint_CAST_ID));
+    const auto* paint = static_cast<SoftTextPaint*>(&format)->prepare();
+    metrics.minWidth = math::ceil_cast<int>(paint->minWidth());
+    metrics.width = math::ceil_cast<int>(paint->width());
+    metrics.height = math::ceil_cast<int>(paint->height());
+    metrics.lineCount = static_cast<int>(paint->lines().size());
+}
+
+void SoftwareCanvas::drawText(const Point& origin, TextPaint& text, const Pen& pen) {
+    assert(text.testCast(mSafeScopeId, SoftTextPaint_CAST_ID));
+    const uint32_t color = pixel::premultiply(pen.color());
+    if (color == 0) { return; }
+
+    const auto* paint = static_cast<SoftTextPaint*>(&text)->prepare();
+    const Point o = mapPoint(origin);
+    const float sx = std::abs(mScaleX);
+    const float sy = std::abs(mScaleY);
+    const float advance = BuiltinFont::advance(paint->textSize()) * sx;
+    const float lineHeight = BuiltinFont::lineHeight(paint->textSize()) * sy;
+
+    // Text is clipped to its layout box, matching D2D1_DRAW_TEXT_OPTIONS_CLIP.
+    RectI limit = currentClip().bounds;
+    if (paint->maxWidth() > 0) {
+        const float right = o.x + static_cast<float>(paint->maxWidth()) * sx;
+        limit = limit.intersected(RectI(math::floor_cast<int>(o.x), limit.top, math::ceil_cast<int>(right), limit.bottom));
+    }
+    if (paint->maxHeight() > 0) {
+        const float bottom = o.y + static_cast<float>(paint->maxHeight()) * sy;
+        limit = limit.intersected(RectI(limit.left, math::floor_cast<int>(o.y), limit.right, math::ceil_cast<int>(bottom)));
+    }
+    if (limit.isEmpty()) { return; }
+
+    // Glyph masks are rasterized once per device size and style, then copied out of the atlas.
+    auto& atlas = mTextCache->glyphs;
+    const uint32_t sizeX = GlyphAtlas::quantize(paint->textSize() * sx);
+    const uint32_t sizeY = GlyphAtlas::quantize(paint->textSize() * sy);
+    const float scaleX = GlyphAtlas::dequantize(sizeX) / BuiltinFont::kEmSize;
+    const float scaleY = GlyphAtlas::dequantize(sizeY) / BuiltinFont::kEmSize;
+    uint8_t style = 0;
+    if (paint->isBold()) { style |= GlyphAtlas::Bold; }
+    if (paint->isItalic()) { style |= GlyphAtlas::Italic; }
+
+    const auto& codePoints = paint->codePoints();
+    auto drawGlyph = [&](char32_t c, float x, int top) {
+        if (c == U' ' || c == U'\t') { return; }
+        const GlyphAtlas::Key key{static_cast<uint32_t>(c), 0, sizeX, sizeY, style};
+        const auto* glyph = atlas.find(key);
+        if (!glyph) {
+            BuiltinFont::rasterize(c, scaleX, scaleY, paint->isBold(), paint->isItalic(), mGlyph);
+            glyph = atlas.insert(key, mGlyph.width, mGlyph.height, mGlyph.coverage.data());
+        }
+        // Masks larger than an atlas page are drawn straight from the rasterized glyph.
+        const int width = glyph ? glyph->width : mGlyph.width;
+        const int height = glyph ? glyph->height : mGlyph.height;
+        const int left = static_cast<int>(std::lround(x));
+        const int x0 = std::max(left, limit.left);
+        const int x1 = std::min(left + width, limit.right);
+        if (x0 >= x1) { return; }
+        const int y0 = std::max(top, limit.top);
+        const int y1 = std::min(top + height, limit.bottom);
+        for (int y = y0; y < y1; ++y) {
+            const uint8_t* row = glyph ? atlas.row(*glyph, y - top)
+                                       : mGlyph.coverage.data() + static_cast<size_t>(y - top) * static_cast<size_t>(width);
+            blitSpan(y, x0, row + (x0 - left), x1 - x0, color);
+        }
+    };
+
+    float lineTop = o.y;
+    for (const auto& line : paint->lines()) {
+        const int top = static_cast<int>(std::lround(lineTop));
+        lineTop += lineHeight;
+        if (top >= limit.bottom) { break; }
+        if (top + static_cast<int>(std::ceil(lineHeight)) <= limit.top) { continue; }
+
+        float x = o.x;
+        for (size_t i = line.begin; i < line.end; ++i) {
+            drawGlyph(codePoints[i], x, top);
+            x += advance;
+        }
+        if (line.ellipsis) {
+            for (int i = 0; i < 3; ++i) {
+                drawGlyph(U'.', x, top);
+                x += advance;
+            }
+        }
+    }
+}
+
+void SoftwareCanvas::drawLine(const geom::Line& line, const Pen& pen) {
+    float phase = 0.0f;
+    strokeLine(line, pen, phase);
+}
+
+void SoftwareCanvas::drawLines(span<const geom::Line> lines, const Pen& pen) {
+    const uint32_t color = pixel::premultiply(pen.color());
+    if (color == 0 || pen.strokeWidth() <= 0.0f) { return; }
+    if (pen.lineStyle() != LineStyle::Solid) {
+        for (const auto& line : lines) {
+            float phase = 0.0f;
+            strokeLine(line, pen, phase);
+        }
+        return;
+    }
+
+    // Axis-aligned segments, the usual grid and separator lines, are filled as merged rects. All segments share
+    // one color, so filling them out of order does not change the result.
+    const float halfWidth = mapWidth(pen.strokeWidth()) * 0.5f;
+    RectMerger merger([this, color](const Rect& r) { fillDeviceRect(r, {}, color); });
+    for (const auto& line : lines) {
+        const Point p0 = mapPoint(line.start);
+        const Point p1 = mapPoint(line.end);
+        Rect r;
+        if (axisAlignedStroke(p0, p1, halfWidth, pen.startCap(), pen.endCap(), r)) {
+            merger.add(r);
+        } else {
+            strokeDeviceLine(p0, p1, halfWidth, pen.startCap(), pen.endCap(), color);
+        }
+    }
+    merger.finish();
+}
+
+void SoftwareCanvas::blitSpan(int y, int x, const uint8_t* coverage, int count, uint32_t color) {
+    const ClipState& clip = currentClip();
+    if (y < clip.bounds.top || y >= clip.bounds.bottom) { return; }
+    const int x0 = std::max(x, clip.bounds.left);
+    const int x1 = std::min(x + count, clip.bounds.right);
+    if (x0 >= x1) { return; }
+    coverage += x0 - x;
+    const int n = x1 - x0;
+
+    if (clip.mask) {
+        const uint8_t* mask = clip.maskAt(x0, y);
+        if (mMaskedSpan.size() < static_cast<size_t>(n)) { mMaskedSpan.resize(static_cast<size_t>(n)); }
+        for (int i = 0; i < n; ++i) { mMaskedSpan[static_cast<size_t>(i)] = pixel::mulCoverage(coverage[i], mask[i]); }
+        coverage = mMaskedSpan.data();
+    }
+    if (mShader) {
+        blitShaded(y, x0, n, coverage, 255);
+        return;
+    }
+    mKernels.blendMask(mPixels.row(y) + x0, coverage, n, color);
+}
+
+void SoftwareCanvas::blitSolid(int y, int x0, int x1, uint8_t coverage, uint32_t color) {
+    const ClipState& clip = currentClip();
+    if (coverage == 0 || y < clip.bounds.top || y >= clip.bounds.bottom) { return; }
+    x0 = std::max(x0, clip.bounds.left);
+    x1 = std::min(x1, clip.bounds.right);
+    if (x0 >= x1) { return; }
+
+    if (clip.mask) {
+        const int n = x1 - x0;
+        const uint8_t* mask = clip.maskAt(x0, y);
+        if (mMaskedSpan.size() < static_cast<size_t>(n)) { mMaskedSpan.resize(static_cast<size_t>(n)); }
+        for (int i = 0; i < n; ++i) { mMaskedSpan[static_cast<size_t>(i)] = pixel::mulCoverage(coverage, mask[i]); }
+        if (mShader) {
+            blitShaded(y, x0, n, mMaskedSpan.data(), 255);
+        } else {
+            mKernels.blendMask(mPixels.row(y) + x0, mMaskedSpan.data(), n, color);
+        }
+        return;
+    }
+    if (mShader) {
+        blitShaded(y, x0, x1 - x0, nullptr, coverage);
+        return;
+    }
+    mKernels.blendSolid(mPixels.row(y) + x0, x1 - x0, color, coverage);
+}
+
+void SoftwareCanvas::blitShaded(int y, int x, int count, const uint8_t* coverage, uint8_t constant) {
+    if (mShadedRow.size() < static_cast<size_t>(count)) { mShadedRow.resize(static_cast<size_t>(count)); }
+    uint32_t* row = mShadedRow.data();
+    mShader->shadeRow(y, x, count, row);
+
+    const uint8_t opacity = pixel::mulCoverage(constant, mShader->opacity());
+    if (coverage) {
+        for (int i = 0; i < count; ++i) { row[i] = pixel::mul255(row[i], coverage[i]); }
+    }
+    mKernels.blendSpan(mPixels.row(y) + x, row, count, opacity);
+}
+
+void SoftwareCanvas::fillDeviceRect(const Rect& outer, const Rect& inner, uint32_t color) {
+    if (color == 0) { return; }
+    const RectI area = clampedAligned(outer, currentClip().bounds);
+    if (area.isEmpty()) { return; }
+    const bool hasInner = !inner.isEmpty();
+
+    for (int y = area.top; y < area.bottom; ++y) {
+        const float vo = raster::overlap(y, outer.top, outer.bottom);
+        const float vi = hasInner ? raster::overlap(y, inner.top, inner.bottom) : 0.0f;
+
+        // Columns in [s0, s1) share the same coverage, only the columns around the edges differ.
+        const Rect& solidEdges = vi > 0.0f ? inner : outer;
+        const int s0 = std::clamp(math::ceil_cast<int>(solidEdges.left), area.left, area.right);
+        const int s1 = std::clamp(math::floor_cast<int>(solidEdges.right), s0, area.right);
+
+        auto edge = [&](int from, int to) {
+            if (from >= to) { return; }
+            uint8_t* coverage = scanline(to - from);
+            for (int x = from; x < to; ++x) {
+                float c = raster::overlap(x, outer.left, outer.right) * vo;
+                if (vi > 0.0f) { c -= raster::overlap(x, inner.left, inner.right) * vi; }
+                coverage[x - from] = toCoverage(c);
+            }
+            blitSpan(y, from, coverage, to - from, color);
+        };
+        edge(area.left, s0);
+        blitSolid(y, s0, s1, toCoverage(vo - vi), color);
+        edge(s1, area.right);
+    }
+}
+
+void SoftwareCanvas::fillDeviceRects(span<const Rect> rects, uint32_t color) {
+    if (color == 0) { return; }
+    if (rects.size() == 1) {
+        fillDeviceRect(mapRect(rects[0]), {}, color);
+        return;
+    }
+    RectMerger merger([this, color](const Rect& r) { fillDeviceRect(r, {}, color); });
+    for (const Rect& rect : rects) { merger.add(mapRect(rect)); }
+    merger.finish();
+}
+
+void SoftwareCanvas::fillShape(const RoundShape& shape, uint32_t color) {
+    if (color == 0 || shape.isEmpty()) { return; }
+    auto span = [this, color](int y, int x, const uint8_t* coverage, int count) {
+        blitSpan(y, x, coverage, count, color);
+    };
+    auto solid = [this, color](int y, int x0, int x1, uint8_t coverage) { blitSolid(y, x0, x1, coverage, color); };
+    if (mOuterShape.prepare(shape, mCornerMasks)) {
+        raster::scanRoundRect(mOuterShape, nullptr, currentClip().bounds, mScanline, span, solid);
+        return;
+    }
+    // Corners too large for the mask cache, the distance field only has to be evaluated along the outline.
+    raster::scanRing(
+        shape.inset(-1.0f),
+        shape.inset(1.0f),
+        true,
+        currentClip().bounds,
+        mScanline,
+        [&shape](float x, float y) { return 0.5f - shape.distance(x, y); },
+        span,
+        solid
+    );
+}
+
+void SoftwareCanvas::strokeShape(const RoundShape& shape, float halfWidth, uint32_t color) {
+    if (halfWidth <= 0.0f || shape.isEmpty()) { return; }
+    auto span = [this, color](int y, int x, const uint8_t* coverage, int count) {
+        blitSpan(y, x, coverage, count, color);
+    };
+    auto solid = [this, color](int y, int x0, int x1, uint8_t coverage) { blitSolid(y, x0, x1, coverage, color); };
+
+    // The stroke is the ring between both offsets of the outline, sharp corners get round joins on the outside.
+    RoundShape outer = shape.inset(-halfWidth);
+    for (int i = 0; i < 4; ++i) {
+        if (outer.rx[i] <= 0.0f) { outer.rx[i] = outer.ry[i] = halfWidth; }
+    }
+    const RoundShape inner = shape.inset(halfWidth);
+    if (mOuterShape.prepare(outer, mCornerMasks) && (inner.isEmpty() || mInnerShape.prepare(inner, mCornerMasks))) {
+        const raster::RoundRectRaster* cut = inner.isEmpty() ? nullptr : &mInnerShape;
+        raster::scanRoundRect(mOuterShape, cut, currentClip().bounds, mScanline, span, solid);
+        return;
+    }
+
+    const float margin = halfWidth + 1.0f;
+    raster::scanRing(
+        shape.inset(-margin),
+        shape.inset(margin),
+        false,
+        currentClip().bounds,
+        mScanline,
+        [&shape, halfWidth](float x, float y) { return halfWidth + 0.5f - std::abs(shape.distance(x, y)); },
+        span,
+        solid
+    );
+}
+
+void SoftwareCanvas::strokeDeviceLine(
+    Point p0,
+    Point p1,
+    float halfWidth,
+    CapStyle startCap,
+    CapStyle endCap,
+    uint32_t color
+) {
+    if (halfWidth <= 0.0f) { return; }
+
+    // Axis-aligned lines without round caps are plain rectangles with exact coverage.
+    if (Rect r; axisAlignedStroke(p0, p1, halfWidth, startCap, endCap, r)) {
+        fillDeviceRect(r, {}, color);
+        return;
+    }
+
+    const float dx = p1.x - p0.x;
+    const float dy = p1.y - p0.y;
+    const LineShape shape(p0, p1, halfWidth, startCap, endCap);
+    const float reach = shape.reach() + 1.0f;
+    const Rect bounds(
+        std::min(p0.x, p1.x) - reach,
+        std::min(p0.y, p1.y) - reach,
+        std::max(p0.x, p1.x) + reach,
+        std::max(p0.y, p1.y) + reach
+    );
+    const RectI area = clampedAligned(bounds, currentClip().bounds);
+    if (area.isEmpty()) { return; }
+
+    for (int y = area.top; y < area.bottom; ++y) {
+        int x0 = area.left;
+        int x1 = area.right;
+        if (std::abs(dy) > 1e-3f) {
+            // Only the part of the segment within reach of this row can cover any of its pixels.
+            const auto fy = static_cast<float>(y);
+            const float t0 = std::clamp((fy - reach - p0.y) / dy, 0.0f, 1.0f);
+            const float t1 = std::clamp((fy + 1.0f + reach - p0.y) / dy, 0.0f, 1.0f);
+            const float xa = p0.x + dx * t0;
+            const float xb = p0.x + dx * t1;
+            x0 = std::max(x0, math::floor_cast<int>(std::min(xa, xb) - reach));
+            x1 = std::min(x1, math::ceil_cast<int>(std::max(xa, xb) + reach));
+        }
+        if (x0 >= x1) { continue; }
+
+        uint8_t* coverage = scanline(x1 - x0);
+        const float cy = static_cast<float>(y) + 0.5f;
+        for (int x = x0; x < x1; ++x) {
+            coverage[x - x0] = toCoverage(0.5f - shape.distance(static_cast<float>(x) + 0.5f, cy));
+        }
+        blitSpan(y, x0, coverage, x1 - x0, color);
+    }
+}
+
+void SoftwareCanvas::strokeLine(const geom::Line& line, const Pen& pen, float& dashPhase) {
+    const uint32_t color = pixel::premultiply(pen.color());
+    if (color == 0 || pen.strokeWidth() <= 0.0f) { return; }
+    const float halfWidth = mapWidth(pen.strokeWidth()) * 0.5f;
+    const Point p0 = mapPoint(line.start);
+    const Point p1 = mapPoint(line.end);
+
+    const auto& pattern = dashPattern(pen);
+    float period = 0.0f;
+    for (const float v : pattern) { period += std::max(v, 0.0f); }
+    if (pen.lineStyle() == LineStyle::Solid || period <= 0.0f) {
+        strokeDeviceLine(p0, p1, halfWidth, pen.startCap(), pen.endCap(), color);
+        return;
+    }
+
+    const float length = std::hypot(p1.x - p0.x, p1.y - p0.y);
+    if (length <= 0.0f) { return; }
+    const float unit = halfWidth * 2.0f;
+    const float ux = (p1.x - p0.x) / length;
+    const float uy = (p1.y - p0.y) / length;
+
+    // Advance into the pattern by the dash offset and the distance already covered by previous segments.
+    float skip = std::fmod(pen.dashOffset() * unit + dashPhase, period * unit);
+    size_t index = 0;
+    float remaining = std::max(pattern[0], 0.0f) * unit;
+    while (skip > 0.0f && skip >= remaining) {
+        skip -= remaining;
+        index = (index + 1) % pattern.size();
+        remaining = std::max(pattern[index], 0.0f) * unit;
+    }
+    remaining -= skip;
+
+    float pos = 0.0f;
+    while (pos < length) {
+        const float segment = std::min(remaining, length - pos);
+        if (index % 2 == 0) {
+            const CapStyle startCap = pos <= 0.0f ? pen.startCap() : pen.dashCap();
+            const CapStyle endCap = pos + segment >= length ? pen.endCap() : pen.dashCap();
+            const Point a{p0.x + ux * pos, p0.y + uy * pos};
+            const Point b{p0.x + ux * (pos + segment), p0.y + uy * (pos + segment)};
+            strokeDeviceLine(a, b, halfWidth, startCap, endCap, color);
+        }
+        pos += segment;
+        remaining -= segment;
+        if (remaining <= 0.0f) {
+            index = (index + 1) % pattern.size();
+            remaining = std::max(pattern[index], 0.0f) * unit;
+        }
+    }
+    dashPhase += length;
+}
+
+Rect SoftwareCanvas::mapRect(const Rect& r) const noexcept {
+    const Point a = mapPoint(r.lt());
+    const Point b = mapPoint(r.rb());
+    return {std::min(a.x, b.x), std::min(a.y, b.y), std::max(a.x, b.x), std::max(a.y, b.y)};
+}
+
+RoundShape SoftwareCanvas::mapRoundRect(const RoundRect& r) const noexcept {
+    const float radii[4]{r.radii.topLeft, r.radii.topRight, r.radii.bottomLeft, r.radii.bottomRight};
+    return RoundShape::make(mapRect(r.rect), radii, std::abs(mScaleX), std::abs(mScaleY));
+}
+
+float SoftwareCanvas::mapWidth(float w) const noexcept {
+    return w * (std::abs(mScaleX) + std::abs(mScaleY)) * 0.5f;
+}
+
+uint8_t* SoftwareCanvas::scanline(int count) {
+    if (mScanline.size() < static_cast<size_t>(count)) { mScanline.resize(static_cast<size_t>(count)); }
+    return mScanline.data();
+}
+} // namespace bix
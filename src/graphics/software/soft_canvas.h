@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/graphics/canvas.h"
+#include "bixlib/graphics/clip_stack.h"
+
+#include "../scan_converter.h"
+#include "bitmap_shader.h"
+#include "builtin_font.h"
+#include "clip_mask.h"
+#include "corner_mask.h"
+#include "gradient_shader.h"
+#include "pixel_buffer.h"
+#include "span_kernels.h"
+#include "text_paint.h"
+
+#include <memory>
+#include <vector>
+
+namespace bix {
+
+/**
+ * Canvas implementation rasterizing on the CPU into a premultiplied RGBA8 PixelBuffer.
+ *
+ * All primitives are reduced to horizontal coverage spans which are clipped and blended by blitSpan().
+ * Axis-aligned rectangles are rasterized with exact area coverage, rounded rectangles and ellipses subtract cached
+ * corner masks from it. Larger curves and diagonal lines use a signed distance estimate per pixel and only evaluate
+ * the pixels close to the outline. Paths are flattened and scan converted with exact area coverage.
+ *
+ * @note Only translation and scale components of the transform are honored.
+ */
+class SoftwareCanvas : public Canvas {
+public:
+    /**
+     * @param size The surface size in pixels.
+     * @param textCache Text caches shared with other canvases, a private cache is created if null.
+     * @param gradientCache Gradient ramps shared with other canvases, a private cache is created if null.
+     */
+    explicit SoftwareCanvas(
+        const SizeI& size,
+        SoftTextCachePtr textCache = nullptr,
+        GradientRampCachePtr gradientCache = nullptr
+    );
+
+    [[nodiscard]] ColorBrushPtr createColorBrush(const Color& color) override;
+    [[nodiscard]] LinearGradientBrushPtr createLinearGradientBrush(
+        const Point& start,
+        const Point& end,
+        const Gradient& gradient
+    ) override;
+    [[nodiscard]] RadialGradientBrushPtr createRadialGradientBrush(
+        const Ellipse& ellipse,
+        const Gradient& gradient
+    ) override;
+    [[nodiscard]] ConicGradientBrushPtr createConicGradientBrush(
+        const Point& center,
+        float startAngle,
+        const Gradient& gradient
+    ) override;
+    [[nodiscard]] TextPaintPtr createTextPaint() override;
+
+    void beginDraw() override;
+    DrawResult endDraw() override;
+    void setTransform(const Transform& transform) override;
+    void resize(const Size& size) override;
+    void clear(const Color& c) override;
+    bool pushClip(const RoundRect& rect) override;
+    void popClip() override;
+    Size size() const noexcept override;
+    void fillRectangle(const Rect& rect, Brush& brush) override;
+    void fillRects(std::span<const Rect> rects, Brush& brush) override;
+    void fillPath(const Path& path, Brush& brush) override;
+    void fillRoundRect(const RoundRect& rect, Brush& brush) override;
+    void fillEllipse(const Ellipse& ellipse, Brush& brush) override;
+    void drawBitmap(
+        const Bitmap& bitmap,
+        const Rect& src,
+        const Rect& dst,
+        float opacity,
+        BitmapSampling sampling
+    ) override;
+    void drawRectangle(const Rect& rect, const Pen& pen) override;
+    void drawRects(std::span<const Rect> rects, const Pen& pen) override;
+    void drawRoundRect(const Rect& rect, float radiusX, float radiusY, const Pen& pen) override;
+    void drawRoundRect(const RoundRect& rect, const Pen& pen) override;
+    void drawEllipse(const Ellipse& ellipse, const Pen& pen) override;
+    void measureText(TextPaint& format, TextMetrics& metrics) override;
+    void drawText(const Point& origin, TextPaint& text, const Pen& pen) override;
+    void drawLine(const geom::Line& line, const Pen& pen) override;
+    void drawLines(std::span<const geom::Line> lines, const Pen& pen) override;
+
+    /** Returns the rendered pixels. */
+    const PixelBuffer& pixels() const noexcept { return mPixels; }
+
+    /** Returns the shaped text and glyph caches used by this canvas. */
+    const SoftTextCache& textCache() const noexcept { return *mTextCache; }
+
+    /** Returns the gradient ramps used by this canvas. */
+    const GradientRampCache& gradientCache() const noexcept { return *mGradientCache; }
+
+    /** Returns the corner masks of rounded rectangles and ellipses. */
+    const CornerMaskCache& cornerMasks() const noexcept { return mCornerMasks; }
+
+    /** Returns the masks of rounded clips. */
+    const ClipMaskCache& clipMasks() const noexcept { return mClipMasks; }
+
+    /** Returns the clip stack, which decides which clips need a mask. */
+    const ClipStack& clipStack() const noexcept { return mClips; }
+
+protected:
+    struct ClipState {
+        RectI bounds;
+        ClipMaskPtr mask;
+        // Device position of the mask origin, cached masks are shared by clips at different positions.
+        int maskX = 0;
+        int maskY = 0;
+
+        /** Returns the mask coverage of the device pixel (x, y). */
+        const uint8_t* maskAt(int x, int y) const noexcept {
+            return mask->row(y - maskY) + (x - maskX - mask->area.left);
+        }
+    };
+
+    /**
+     * Blends a run of per-pixel coverage values onto row \a y starting at column \a x.
+     * The run is clipped against the current clip bounds and multiplied by the clip mask.
+     */
+    void blitSpan(int y, int x, const uint8_t* coverage, int count, uint32_t color);
+    /** Blends a run of constant coverage covering the columns [x0, x1) of row \a y. */
+    void blitSolid(int y, int x0, int x1, uint8_t coverage, uint32_t color);
+    /**
+     * Blends \a count pixels of the bound shader onto row \a y starting at the already clipped column \a x.
+     * @param coverage Per-pixel coverage, or nullptr to use \a constant for every pixel.
+     */
+    void blitShaded(int y, int x, int count, const uint8_t* coverage, uint8_t constant);
+
+    /**
+     * Binds the colors of a brush and calls \a fill with the solid color to blit, the color only has to be
+     * non-zero when a shader is bound. Nothing is filled when the brush is empty.
+     */
+    template <typename Fill>
+    void withBrush(Brush& brush, Fill&& fill);
+    /** Fills the area of \a outer that is not covered by \a inner, both in device space. */
+    void fillDeviceRect(const Rect& outer, const Rect& inner, uint32_t color);
+    /** Maps a batch of rects into device space and fills them, merging rects that share an edge. */
+    void fillDeviceRects(std::span<const Rect> rects, uint32_t color);
+    /** Fills a rounded shape given in device space. */
+    void fillShape(const raster::RoundShape& shape, uint32_t color);
+    void strokeShape(const raster::RoundShape& shape, float halfWidth, uint32_t color);
+    void strokeDeviceLine(Point p0, Point p1, float halfWidth, CapStyle startCap, CapStyle endCap, uint32_t color);
+    void strokeLine(const geom::Line& line, const Pen& pen, float& dashPhase);
+
+    Point mapPoint(const Point& p) const noexcept { return {p.x * mScaleX + mOffsetX, p.y * mScaleY + mOffsetY}; }
+
+    Rect mapRect(const Rect& r) const noexcept;
+    raster::RoundShape mapRoundRect(const RoundRect& r) const noexcept;
+    float mapWidth(float w) const noexcept;
+
+    const ClipState& currentClip() const noexcept { return mClipStates.back(); }
+
+    uint8_t* scanline(int count);
+
+private:
+    /** Resets the clip to the whole surface. */
+    void resetClips();
+
+    const uintptr_t mSafeScopeId;
+    PixelBuffer mPixels;
+    const pixel::SpanKernels& mKernels;
+
+    float mScaleX = 1.f;
+    float mScaleY = 1.f;
+    float mOffsetX = 0.f;
+    float mOffsetY = 0.f;
+    Transform mTransform;
+
+    ClipStack mClips;
+    // One entry per applied clip, skipped clips share the entry of their parent.
+    // The bottom entry is the whole surface and is never popped.
+    std::vector<ClipState> mClipStates;
+    ClipMaskCache mClipMasks;
+    std::vector<uint8_t> mScanline;
+    std::vector<uint8_t> mMaskedSpan;
+    GlyphMask mGlyph;
+    raster::ScanConverter mScan;
+    CornerMaskCache mCornerMasks;
+    raster::RoundRectRaster mOuterShape;
+    raster::RoundRectRaster mInnerShape;
+    SoftTextCachePtr mTextCache;
+    GradientRampCachePtr mGradientCache;
+
+    // While bound, blits take their colors from the shader instead of the solid color argument.
+    Shader* mShader = nullptr;
+    std::vector<uint32_t> mShadedRow;
+    std::vector<uint32_t> mBitmapRows;
+};
+
+} // namespace bix
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "span_kernels.h"
+
+#include "blend-inl.h"
+
+#if defined(BIX_HAS_X86_KERNELS) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace bix::pixel {
+
+namespace {
+void fillScalar(uint32_t* dst, int count, uint32_t src) noexcept {
+    std::fill_n(dst, count, src);
+}
+
+void blendSolidScalar(uint32_t* dst, int count, uint32_t src, uint8_t coverage) noexcept {
+    blendRow(dst, count, src, coverage);
+}
+
+void blendMaskScalar(uint32_t* dst, const uint8_t* coverage, int count, uint32_t src) noexcept {
+    blendRow(dst, coverage, count, src);
+}
+
+#ifdef BIX_HAS_X86_KERNELS
+bool cpuSupportsAvx2() noexcept {
+#if defined(_MSC_VER)
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7) { return false; }
+    __cpuid(info, 1);
+    // OSXSAVE and AVX, then the OS must save the YMM state on context switches.
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) { return false; }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif defined(__GNUC__)
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+#endif
+} // namespace
+
+const SpanKernels& scalarSpanKernels() noexcept {
+    static constexpr SpanKernels kernels{
+        SimdLevel::Scalar,
+        fillScalar,
+        blendSolidScalar,
+        blendMaskScalar,
+        blendSpan,
+        multiplyRow,
+        premultiplyRow,
+        unpremultiplyRow,
+    };
+    return kernels;
+}
+
+SimdLevel detectSimdLevel() noexcept {
+#ifdef BIX_HAS_X86_KERNELS
+    // SSE2 is part of every x86-64 CPU and assumed on 32-bit x86 as well.
+    return cpuSupportsAvx2() ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+const SpanKernels* spanKernels(SimdLevel level) noexcept {
+    if (level == SimdLevel::Scalar) { return &scalarSpanKernels(); }
+#ifdef BIX_HAS_X86_KERNELS
+    if (static_cast<int>(level) > static_cast<int>(detectSimdLevel())) { return nullptr; }
+    return level == SimdLevel::AVX2 ? &avx2SpanKernels() : &sse2SpanKernels();
+#else
+    return nullptr;
+#endif
+}
+
+const SpanKernels& spanKernels() noexcept {
+    static const SpanKernels& kernels = *spanKernels(detectSimdLevel());
+    return kernels;
+}
+} // namespace bix::pixel
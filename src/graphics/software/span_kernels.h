@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace bix::pixel {
+
+/** Instruction set extensions a set of span kernels is written for. */
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2,
+};
+
+/**
+ * Row kernels operating on premultiplied RGBA8 pixels, see blend-inl.h for the pixel format.
+ *
+ * Every implementation produces bit identical results to the scalar kernels, vectorized variants only differ
+ * in speed. All kernels accept any count including zero and have no alignment requirements.
+ */
+struct SpanKernels {
+    SimdLevel level;
+
+    /** Sets \a count pixels to \a src. */
+    void (*fill)(uint32_t* dst, int count, uint32_t src) noexcept;
+
+    /** Composites \a src with a constant coverage over a run of pixels. */
+    void (*blendSolid)(uint32_t* dst, int count, uint32_t src, uint8_t coverage) noexcept;
+
+    /** Composites \a src with per-pixel coverage over a run of pixels. */
+    void (*blendMask)(uint32_t* dst, const uint8_t* coverage, int count, uint32_t src) noexcept;
+
+    /** Composites a row of pixels, multiplied by \a opacity, over another row. */
+    void (*blendSpan)(uint32_t* dst, const uint32_t* src, int count, uint8_t opacity) noexcept;
+
+    /** Multiplies all channels of a row by \a opacity. */
+    void (*multiplyOpacity)(uint32_t* row, int count, uint8_t opacity) noexcept;
+
+    /** Converts a row of straight-alpha pixels into premultiplied pixels in place. */
+    void (*premultiply)(uint32_t* row, int count) noexcept;
+
+    /** Converts a row of premultiplied pixels back into straight-alpha pixels in place. */
+    void (*unpremultiply)(uint32_t* row, int count) noexcept;
+};
+
+/** Returns the widest instruction set supported by both the build and the running CPU. */
+SimdLevel detectSimdLevel() noexcept;
+
+/** Returns the fastest kernels for the running CPU, resolved once on first use. */
+const SpanKernels& spanKernels() noexcept;
+
+/**
+ * Returns the kernels of a specific instruction set.
+ * @return The kernels, or nullptr if they are not compiled in or not supported by the CPU.
+ */
+const SpanKernels* spanKernels(SimdLevel level) noexcept;
+
+// Per instruction set tables, only defined when the matching source file is compiled in.
+const SpanKernels& scalarSpanKernels() noexcept;
+const SpanKernels& sse2SpanKernels() noexcept;
+const SpanKernels& avx2SpanKernels() noexcept;
+} // namespace bix::pixel
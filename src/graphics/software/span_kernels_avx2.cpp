@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "span_kernels.h"
+
+#include <cstring>
+#include <immintrin.h>
+
+// Compiled with AVX2 enabled and only called after detectSimdLevel() confirmed CPU support. Like the SSE2 kernels
+// it avoids shared inline functions so that no AVX2 code can leak into other translation units.
+
+namespace bix::pixel {
+
+namespace {
+// Pixels are processed as 16-bit lanes. Unpacking works per 128-bit half, a register therefore holds pixels
+// {0, 1, 4, 5} after unpacklo and {2, 3, 6, 7} after unpackhi, and packus restores the original order.
+
+inline __m256i mul255x16(__m256i x, __m256i f) noexcept {
+    const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(x, f), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+inline __m256i broadcastAlpha(__m256i x) noexcept {
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+inline __m256i srcOverx16(__m256i s, __m256i d) noexcept {
+    const __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), broadcastAlpha(s));
+    return _mm256_add_epi16(s, mul255x16(d, inv));
+}
+
+inline uint32_t mulPixel(uint32_t p, uint32_t factor) noexcept {
+    const __m128i x = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(p)), _mm_setzero_si128());
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, _mm_set1_epi16(static_cast<short>(factor))), _mm_set1_epi16(128));
+    t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(t, t)));
+}
+
+inline __m256i load(const uint32_t* p) noexcept {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+inline void store(uint32_t* p, __m256i v) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+void fillAvx2(uint32_t* dst, int count, uint32_t src) noexcept {
+    const __m256i v = _mm256_set1_epi32(static_cast<int>(src));
+    int i = 0;
+    for (; i + 8 <= count; i += 8) { store(dst + i, v); }
+    for (; i < count; ++i) { dst[i] = src; }
+}
+
+void blendSolidAvx2(uint32_t* dst, int count, uint32_t src, uint8_t coverage) noexcept {
+    if (coverage == 0 || src == 0) { return; }
+    if (coverage == 255 && (src >> 24) == 255) {
+        fillAvx2(dst, count, src);
+        return;
+    }
+    const uint32_t s = coverage == 255 ? src : mulPixel(src, coverage);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i s16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(s)), zero);
+    const __m256i inv = _mm256_set1_epi16(static_cast<short>(255 - (s >> 24)));
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i d = load(dst + i);
+        const __m256i lo = _mm256_add_epi16(s16, mul255x16(_mm256_unpacklo_epi8(d, zero), inv));
+        const __m256i hi = _mm256_add_epi16(s16, mul255x16(_mm256_unpackhi_epi8(d, zero), inv));
+        store(dst + i, _mm256_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().blendSolid(dst + i, count - i, src, coverage);
+}
+
+void blendMaskAvx2(uint32_t* dst, const uint8_t* coverage, int count, uint32_t src) noexcept {
+    if (src == 0) { return; }
+    const bool opaque = (src >> 24) == 255;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i s16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(static_cast<int>(src)), zero);
+    // Spread coverage bytes over the channel lanes of their pixel, matching the unpack order described above.
+    const __m256i spreadLo = _mm256_setr_epi8(
+        0, -1, 0, -1, 0, -1, 0, -1, 1, -1, 1, -1, 1, -1, 1, -1, 4, -1, 4, -1, 4, -1, 4, -1, 5, -1, 5, -1, 5, -1, 5, -1
+    );
+    const __m256i spreadHi = _mm256_setr_epi8(
+        2, -1, 2, -1, 2, -1, 2, -1, 3, -1, 3, -1, 3, -1, 3, -1, 6, -1, 6, -1, 6, -1, 6, -1, 7, -1, 7, -1, 7, -1, 7, -1
+    );
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        uint64_t c8 = 0;
+        std::memcpy(&c8, coverage + i, sizeof(c8));
+        if (c8 == 0) { continue; }
+        if (c8 == ~uint64_t(0) && opaque) {
+            store(dst + i, _mm256_set1_epi32(static_cast<int>(src)));
+            continue;
+        }
+        const __m256i c = _mm256_broadcastsi128_si256(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(coverage + i)));
+        const __m256i d = load(dst + i);
+        const __m256i lo = srcOverx16(mul255x16(s16, _mm256_shuffle_epi8(c, spreadLo)), _mm256_unpacklo_epi8(d, zero));
+        const __m256i hi = srcOverx16(mul255x16(s16, _mm256_shuffle_epi8(c, spreadHi)), _mm256_unpackhi_epi8(d, zero));
+        store(dst + i, _mm256_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().blendMask(dst + i, coverage + i, count - i, src);
+}
+
+void blendSpanAvx2(uint32_t* dst, const uint32_t* src, int count, uint8_t opacity) noexcept {
+    if (opacity == 0) { return; }
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i op = _mm256_set1_epi16(static_cast<short>(opacity));
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i s = load(src + i);
+        if (_mm256_testz_si256(s, s)) { continue; }
+        __m256i sLo = _mm256_unpacklo_epi8(s, zero);
+        __m256i sHi = _mm256_unpackhi_epi8(s, zero);
+        if (opacity != 255) {
+            sLo = mul255x16(sLo, op);
+            sHi = mul255x16(sHi, op);
+        }
+        const __m256i d = load(dst + i);
+        const __m256i lo = srcOverx16(sLo, _mm256_unpacklo_epi8(d, zero));
+        const __m256i hi = srcOverx16(sHi, _mm256_unpackhi_epi8(d, zero));
+        store(dst + i, _mm256_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().blendSpan(dst + i, src + i, count - i, opacity);
+}
+
+void multiplyOpacityAvx2(uint32_t* row, int count, uint8_t opacity) noexcept {
+    if (opacity == 255) { return; }
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i op = _mm256_set1_epi16(static_cast<short>(opacity));
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i p = load(row + i);
+        const __m256i lo = mul255x16(_mm256_unpacklo_epi8(p, zero), op);
+        const __m256i hi = mul255x16(_mm256_unpackhi_epi8(p, zero), op);
+        store(row + i, _mm256_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().multiplyOpacity(row + i, count - i, opacity);
+}
+
+void premultiplyAvx2(uint32_t* row, int count) noexcept {
+    const __m256i zero = _mm256_setzero_si256();
+    // Color lanes are multiplied by alpha, the alpha lane by 255 which keeps it unchanged.
+    const __m256i colorLanes = _mm256_set1_epi64x(0x0000FFFFFFFFFFFFll);
+    const __m256i alphaLanes = _mm256_set1_epi64x(0x00FF000000000000ll);
+    auto premultiply = [&](__m256i p) {
+        const __m256i f = _mm256_or_si256(_mm256_and_si256(broadcastAlpha(p), colorLanes), alphaLanes);
+        return mul255x16(p, f);
+    };
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i p = load(row + i);
+        const __m256i lo = premultiply(_mm256_unpacklo_epi8(p, zero));
+        const __m256i hi = premultiply(_mm256_unpackhi_epi8(p, zero));
+        store(row + i, _mm256_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().premultiply(row + i, count - i);
+}
+
+void unpremultiplyAvx2(uint32_t* row, int count) noexcept {
+    // Partially transparent pixels go through the exact scalar division, opaque blocks are skipped.
+    const __m256i opaque = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i p = load(row + i);
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(p, opaque), opaque)) == -1) { continue; }
+        scalarSpanKernels().unpremultiply(row + i, 8);
+    }
+    scalarSpanKernels().unpremultiply(row + i, count - i);
+}
+} // namespace
+
+const SpanKernels& avx2SpanKernels() noexcept {
+    static constexpr SpanKernels kernels{
+        SimdLevel::AVX2,
+        fillAvx2,
+        blendSolidAvx2,
+        blendMaskAvx2,
+        blendSpanAvx2,
+        multiplyOpacityAvx2,
+        premultiplyAvx2,
+        unpremultiplyAvx2,
+    };
+    return kernels;
+}
+} // namespace bix::pixel
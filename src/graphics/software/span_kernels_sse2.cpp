@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "span_kernels.h"
+
+#include <cstring>
+#include <emmintrin.h>
+
+// This file must not include headers with inline functions shared with other translation units (blend-inl.h,
+// standard algorithms), the linker could otherwise keep a copy compiled for this instruction set. Remainders that
+// do not fill a whole vector are handed to the scalar kernels instead.
+
+namespace bix::pixel {
+
+namespace {
+// Pixels are processed as 16-bit lanes, two pixels per register, so that products of two channels fit.
+
+inline __m128i mul255x8(__m128i x, __m128i f) noexcept {
+    const __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, f), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+inline __m128i broadcastAlpha(__m128i x) noexcept {
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+inline __m128i srcOverx8(__m128i s, __m128i d) noexcept {
+    const __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), broadcastAlpha(s));
+    return _mm_add_epi16(s, mul255x8(d, inv));
+}
+
+inline uint32_t mulPixel(uint32_t p, uint32_t factor) noexcept {
+    const __m128i x = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(p)), _mm_setzero_si128());
+    const __m128i r = mul255x8(x, _mm_set1_epi16(static_cast<short>(factor)));
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(r, r)));
+}
+
+inline __m128i load(const uint32_t* p) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline void store(uint32_t* p, __m128i v) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+void fillSse2(uint32_t* dst, int count, uint32_t src) noexcept {
+    const __m128i v = _mm_set1_epi32(static_cast<int>(src));
+    int i = 0;
+    for (; i + 4 <= count; i += 4) { store(dst + i, v); }
+    for (; i < count; ++i) { dst[i] = src; }
+}
+
+void blendSolidSse2(uint32_t* dst, int count, uint32_t src, uint8_t coverage) noexcept {
+    if (coverage == 0 || src == 0) { return; }
+    if (coverage == 255 && (src >> 24) == 255) {
+        fillSse2(dst, count, src);
+        return;
+    }
+    const uint32_t s = coverage == 255 ? src : mulPixel(src, coverage);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i s16 = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(s)), zero);
+    const __m128i inv = _mm_set1_epi16(static_cast<short>(255 - (s >> 24)));
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i d = load(dst + i);
+        const __m128i lo = _mm_add_epi16(s16, mul255x8(_mm_unpacklo_epi8(d, zero), inv));
+        const __m128i hi = _mm_add_epi16(s16, mul255x8(_mm_unpackhi_epi8(d, zero), inv));
+        store(dst + i, _mm_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().blendSolid(dst + i, count - i, src, coverage);
+}
+
+void blendMaskSse2(uint32_t* dst, const uint8_t* coverage, int count, uint32_t src) noexcept {
+    if (src == 0) { return; }
+    const bool opaque = (src >> 24) == 255;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i s16 = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(src)), zero);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32_t c4 = 0;
+        std::memcpy(&c4, coverage + i, sizeof(c4));
+        if (c4 == 0) { continue; }
+        if (c4 == 0xFFFFFFFFu && opaque) {
+            store(dst + i, _mm_set1_epi32(static_cast<int>(src)));
+            continue;
+        }
+        // Spread each coverage byte over the four channel lanes of its pixel.
+        const __m128i c16 = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(c4)), zero);
+        const __m128i c32 = _mm_unpacklo_epi16(c16, c16);
+        const __m128i d = load(dst + i);
+        const __m128i lo = srcOverx8(mul255x8(s16, _mm_unpacklo_epi32(c32, c32)), _mm_unpacklo_epi8(d, zero));
+        const __m128i hi = srcOverx8(mul255x8(s16, _mm_unpackhi_epi32(c32, c32)), _mm_unpackhi_epi8(d, zero));
+        store(dst + i, _mm_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().blendMask(dst + i, coverage + i, count - i, src);
+}
+
+void blendSpanSse2(uint32_t* dst, const uint32_t* src, int count, uint8_t opacity) noexcept {
+    if (opacity == 0) { return; }
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i op = _mm_set1_epi16(static_cast<short>(opacity));
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i s = load(src + i);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(s, zero)) == 0xFFFF) { continue; }
+        __m128i sLo = _mm_unpacklo_epi8(s, zero);
+        __m128i sHi = _mm_unpackhi_epi8(s, zero);
+        if (opacity != 255) {
+            sLo = mul255x8(sLo, op);
+            sHi = mul255x8(sHi, op);
+        }
+        const __m128i d = load(dst + i);
+        const __m128i lo = srcOverx8(sLo, _mm_unpacklo_epi8(d, zero));
+        const __m128i hi = srcOverx8(sHi, _mm_unpackhi_epi8(d, zero));
+        store(dst + i, _mm_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().blendSpan(dst + i, src + i, count - i, opacity);
+}
+
+void multiplyOpacitySse2(uint32_t* row, int count, uint8_t opacity) noexcept {
+    if (opacity == 255) { return; }
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i op = _mm_set1_epi16(static_cast<short>(opacity));
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i p = load(row + i);
+        const __m128i lo = mul255x8(_mm_unpacklo_epi8(p, zero), op);
+        const __m128i hi = mul255x8(_mm_unpackhi_epi8(p, zero), op);
+        store(row + i, _mm_packus_epi16(lo, hi));
+    }
+    scalarSpanKernels().multiplyOpacity(row + i, count - i, opacity);
+}
+
+void premultiplySse2(uint32_t* row, int count) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    // Color lanes are multiplied by alpha, the alpha lane by 255 which keeps it unchanged.
+    const __m128i colorLanes = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaLanes = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    auto premultiply = [&](__m128i p) {
+        const __m128i f = _mm_or_si128(_mm_and_si128(broadcastAlpha(p), colorLanes), alphaLanes);
+        return mul255x8(p, f);
+    };
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i p = load(row + i);
+        store(row + i, _mm_packus_epi16(premultiply(_mm_unpacklo_epi8(p, zero)), premultiply(_mm_unpackhi_epi8(p, zero))));
+    }
+    scalarSpanKernels().premultiply(row + i, count - i);
+}
+
+void unpremultiplySse2(uint32_t* row, int count) noexcept {
+    // Division has no vector form in SSE2, only blocks of opaque pixels, the common case, are skipped as a whole.
+    const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i p = load(row + i);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(p, opaque), opaque)) == 0xFFFF) { continue; }
+        scalarSpanKernels().unpremultiply(row + i, 4);
+    }
+    scalarSpanKernels().unpremultiply(row + i, count - i);
+}
+} // namespace
+
+const SpanKernels& sse2SpanKernels() noexcept {
+    static constexpr SpanKernels kernels{
+        SimdLevel::SSE2,
+        fillSse2,
+        blendSolidSse2,
+        blendMaskSse2,
+        blendSpanSse2,
+        multiplyOpacitySse2,
+        premultiplySse2,
+        unpremultiplySse2,
+    };
+    return kernels;
+}
+} // namespace bix::pixel
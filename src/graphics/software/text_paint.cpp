@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "text_paint.h"
+
+#include "builtin_font.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace bix {
+using namespace std;
+
+namespace {
+constexpr char32_t kReplacementChar = 0xFFFD;
+
+// Decodes UTF-8 into code points, malformed sequences become U+FFFD and carriage returns are dropped.
+u32string decodeUtf8(const string& text) {
+    u32string out;
+    out.reserve(text.size());
+    size_t i = 0;
+    while (i < text.size()) {
+        const auto lead = static_cast<unsigned char>(text[i]);
+        int extra = 0;
+        char32_t cp = 0;
+        if (lead < 0x80) {
+            cp = lead;
+        } else if ((lead & 0xE0) == 0xC0) {
+            extra = 1;
+            cp = lead & 0x1F;
+        } else if ((lead & 0xF0) == 0xE0) {
+            extra = 2;
+            cp = lead & 0x0F;
+        } else if ((lead & 0xF8) == 0xF0) {
+            extra = 3;
+            cp = lead & 0x07;
+        } else {
+            out.push_back(kReplacementChar);
+            ++i;
+            continue;
+        }
+        if (i + static_cast<size_t>(extra) >= text.size() && extra > 0) {
+            out.push_back(kReplacementChar);
+            break;
+        }
+        bool valid = true;
+        for (int k = 1; k <= extra; ++k) {
+            const auto next = static_cast<unsigned char>(text[i + static_cast<size_t>(k)]);
+            if ((next & 0xC0) != 0x80) {
+                valid = false;
+                break;
+            }
+            cp = (cp << 6) | (next & 0x3F);
+        }
+        if (!valid) {
+            out.push_back(kReplacementChar);
+            ++i;
+            continue;
+        }
+        i += static_cast<size_t>(extra) + 1;
+        if (cp != U'\r') { out.push_back(cp); }
+    }
+    return out;
+}
+
+bool isSpace(char32_t c) {
+    return c == U' ' || c == U'\t';
+}
+
+// Breaks text into lines, the built-in font is monospaced so widths are character counts times the advance.
+class LineBreaker {
+public:
+    LineBreaker(const TextLayoutKey& key, SoftTextLayout& out) : mKey(key), mOut(out) {}
+
+    void run() {
+        mOut.codePoints = decodeUtf8(mKey.text);
+        const auto& codePoints = mOut.codePoints;
+        const float advance = BuiltinFont::advance(mKey.textSize);
+        size_t maxChars = numeric_limits<size_t>::max();
+        if (mKey.maxWidth > 0) {
+            maxChars = std::max<size_t>(static_cast<size_t>(static_cast<float>(mKey.maxWidth) / advance), 1);
+        }
+        const WordWrapping wrapping = mKey.wordWrapping;
+        const bool wrap = wrapping != WordWrapping::NoWrap && maxChars != numeric_limits<size_t>::max();
+
+        size_t longestRun = 0;
+        size_t run = 0;
+        for (const char32_t c : codePoints) {
+            const bool breakable = isSpace(c) || c == U'\n' || wrapping == WordWrapping::Character;
+            run = breakable ? (isSpace(c) || c == U'\n' ? 0 : 1) : run + 1;
+            longestRun = std::max(longestRun, run);
+        }
+        mOut.minWidth = static_cast<float>(longestRun) * advance;
+
+        const size_t count = codePoints.size();
+        size_t paragraph = 0;
+        while (paragraph <= count) {
+            size_t paragraphEnd = codePoints.find(U'\n', paragraph);
+            if (paragraphEnd == u32string::npos) { paragraphEnd = count; }
+
+            size_t pos = paragraph;
+            bool wrapped = false;
+            while (wrap && paragraphEnd - pos > maxChars) {
+                const size_t limit = pos + maxChars;
+                size_t lineEnd = limit;
+                size_t next = limit;
+                if (wrapping != WordWrapping::Character) {
+                    // Break after the last space that still fits, the space itself is swallowed.
+                    size_t space = limit;
+                    while (space > pos && !isSpace(codePoints[space])) { --space; }
+                    if (space > pos) {
+                        lineEnd = space;
+                        next = space + 1;
+                    } else if (wrapping == WordWrapping::WholeWord) {
+                        // Never split a word, let it overflow up to the next break opportunity.
+                        lineEnd = limit;
+                        while (lineEnd < paragraphEnd && !isSpace(codePoints[lineEnd])) { ++lineEnd; }
+                        next = std::min(lineEnd + 1, paragraphEnd);
+                    }
+                }
+                addLine(pos, lineEnd, maxChars);
+                wrapped = true;
+                pos = next;
+                while (pos < paragraphEnd && isSpace(codePoints[pos])) { ++pos; }
+            }
+            if (pos < paragraphEnd || !wrapped) { addLine(pos, paragraphEnd, maxChars); }
+            paragraph = paragraphEnd + 1;
+        }
+    }
+
+private:
+    void addLine(size_t begin, size_t end, size_t maxChars) {
+        SoftTextLayout::Line line{begin, end, false};
+        size_t visible = end;
+        while (visible > begin && isSpace(mOut.codePoints[visible - 1])) { --visible; }
+
+        if (visible - begin > maxChars) {
+            if (mKey.trimming == TextTrimming::Ellipsis) {
+                line.end = begin + (maxChars > 3 ? maxChars - 3 : 0);
+                line.ellipsis = true;
+                visible = line.end;
+            } else if (mKey.trimming != TextTrimming::None) {
+                line.end = begin + maxChars;
+                visible = line.end;
+            }
+        }
+
+        const size_t chars = visible - begin + (line.ellipsis ? 3 : 0);
+        mOut.width = std::max(mOut.width, static_cast<float>(chars) * BuiltinFont::advance(mKey.textSize));
+        mOut.lines.push_back(line);
+    }
+
+    const TextLayoutKey& mKey;
+    SoftTextLayout& mOut;
+};
+} // namespace
+
+SoftTextPaint::SoftTextPaint(uintptr_t scopeId, SoftTextCachePtr cache) : mScopeId(scopeId), mCache(std::move(cache)) {}
+
+void SoftTextPaint::setText(const string& text) {
+    if (text == mText) { return; }
+    mText = text;
+    mDirty = true;
+}
+
+void SoftTextPaint::setFontFamily(const string& name) {
+    // The built-in font is the only face available, the name is kept for diagnostics.
+    mFontFamilyName = name;
+}
+
+void SoftTextPaint::setMaxWidth(int w) {
+    w = std::max(w, 0);
+    if (mMaxWidth == w) { return; }
+    mMaxWidth = w;
+    mDirty = true;
+}
+
+void SoftTextPaint::setMaxHeight(int h) {
+    mMaxHeight = std::max(h, 0);
+}
+
+void SoftTextPaint::setTextSize(float size) {
+    if (size < 0.01f || math::exactlyEqual(size, mTextSize)) { return; }
+    mTextSize = size;
+    mDirty = true;
+}
+
+void SoftTextPaint::setFontWeight(int weight) {
+    if (weight < 1 || weight > 999) { return; }
+    mFontWeight = weight;
+}
+
+void SoftTextPaint::setWordWrapping(WordWrapping wrap) {
+    if (wrap == mWordWrapping) { return; }
+    mWordWrapping = wrap;
+    mDirty = true;
+}
+
+void SoftTextPaint::setFontStyle(FontStyle style) {
+    mFontStyle = style;
+}
+
+void SoftTextPaint::setTrimming(TextTrimming trimming) {
+    if (trimming == mTextTrimming) { return; }
+    mTextTrimming = trimming;
+    mDirty = true;
+}
+
+bool SoftTextPaint::testCast(uintptr_t scope, long castId) const noexcept {
+    if (scope != mScopeId || SoftTextPaint_CAST_ID != castId) { return false; }
+    return true;
+}
+
+SoftTextPaint* SoftTextPaint::prepare() {
+    if (!mDirty) { return this; }
+    mDirty = false;
+
+    // Weight, style and max height do not affect line breaking and are left out of the key.
+    TextLayoutKey key;
+    key.text = mText;
+    key.textSize = mTextSize;
+    key.wordWrapping = mWordWrapping;
+    key.trimming = mTextTrimming;
+    key.maxWidth = mMaxWidth;
+    mLayout = mCache->layouts.obtain(key, [&key] {
+        auto layout = make_shared<SoftTextLayout>();
+        LineBreaker(key, *layout).run();
+        return layout;
+    });
+    return this;
+}
+
+float SoftTextPaint::height() const noexcept {
+    return static_cast<float>(mLayout->lines.size()) * BuiltinFont::lineHeight(mTextSize);
+}
+} // namespace bix
+
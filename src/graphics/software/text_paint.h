@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bixlib/graphics/text_cache.h"
+#include "bixlib/graphics/text_format.h"
+
+#include <memory>
+#include <vector>
+
+namespace bix {
+
+constexpr static long SoftTextPaint_CAST_ID = 1766498377L;
+
+/**
+ * Line breaking result of a text laid out with the BuiltinFont.
+ */
+struct SoftTextLayout {
+    /** A laid out line, referencing a range of decoded code points. */
+    struct Line {
+        size_t begin = 0;
+        size_t end = 0;
+        bool ellipsis = false; ///< The line was cut and must be followed by "...".
+    };
+
+    std::u32string codePoints;
+    std::vector<Line> lines;
+    float width = 0.f;    ///< Width of the widest line, in px.
+    float minWidth = 0.f; ///< Width of the longest unbreakable run, in px.
+};
+
+/**
+ * Text caches shared by all canvases of the software engine.
+ */
+struct SoftTextCache {
+    TextLayoutCache<SoftTextLayout> layouts;
+    GlyphAtlas glyphs;
+};
+
+using SoftTextCachePtr = std::shared_ptr<SoftTextCache>;
+
+/**
+ * TextPaint implementation of the software backend.
+ *
+ * Text is laid out with the monospaced BuiltinFont, so layout reduces to counting characters per line.
+ * The layout is looked up in the shared SoftTextCache by prepare() after any property changed, and only
+ * computed on a cache miss.
+ */
+class SoftTextPaint : public TextPaint {
+public:
+    using Line = SoftTextLayout::Line;
+
+    SoftTextPaint(uintptr_t scopeId, SoftTextCachePtr cache);
+
+    void setText(const std::string& text) override;
+    void setFontFamily(const std::string& name) override;
+    void setMaxWidth(int w) override;
+    void setMaxHeight(int h) override;
+    void setTextSize(float size) override;
+    void setFontWeight(int weight) override;
+    void setWordWrapping(WordWrapping wrap) override;
+    void setFontStyle(FontStyle style) override;
+    void setTrimming(TextTrimming trimming) override;
+    bool testCast(uintptr_t scope, long castId) const noexcept override;
+
+    SoftTextPaint* prepare();
+
+    float textSize() const noexcept { return mTextSize; }
+
+    bool isBold() const noexcept { return mFontWeight >= 600; }
+
+    bool isItalic() const noexcept { return mFontStyle != FontStyle::Normal; }
+
+    /** Returns the layout box width, zero means unbounded. */
+    int maxWidth() const noexcept { return mMaxWidth; }
+
+    /** Returns the layout box height, zero means unbounded. */
+    int maxHeight() const noexcept { return mMaxHeight; }
+
+    const std::u32string& codePoints() const noexcept { return mLayout->codePoints; }
+
+    const std::vector<Line>& lines() const noexcept { return mLayout->lines; }
+
+    /** Returns the width of the widest line, in px. */
+    float width() const noexcept { return mLayout->width; }
+
+    /** Returns the width of the longest unbreakable run, in px. */
+    float minWidth() const noexcept { return mLayout->minWidth; }
+
+    float height() const noexcept;
+
+private:
+    const uintptr_t mScopeId;
+    SoftTextCachePtr mCache;
+
+    std::string mText{};
+    std::string mFontFamilyName{};
+    float mTextSize = 12.f;
+    int mFontWeight = 400;
+    FontStyle mFontStyle = FontStyle::Normal;
+    WordWrapping mWordWrapping = WordWrapping::Wrap;
+    TextTrimming mTextTrimming = TextTrimming::None;
+    int mMaxWidth = 0;
+    int mMaxHeight = 0;
+
+    bool mDirty = true;
+    std::shared_ptr<const SoftTextLayout> mLayout;
+};
+} // namespace bix
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "bixlib/graphics/stroke_style.h"
+
+#include "bixlib/utils/numeric.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+inline void hashCombine(size_t& seed, size_t value) noexcept {
+    seed ^= value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2);
+}
+
+// Hashes -0 like 0, the two compare equal.
+inline size_t floatBits(float v) noexcept {
+    return math::exactlyEqual(v, 0.f) ? 0 : std::bit_cast<uint32_t>(v);
+}
+} // namespace
+
+StrokeStyle::StrokeStyle(float width) {
+    setWidth(width);
+}
+
+void StrokeStyle::setWidth(float w) {
+    // Also maps NaN and -0 to zero, so that equal styles hash equally.
+    mWidth = w > 0.f ? w : 0.f;
+}
+
+void StrokeStyle::setLineCap(CapStyle start, CapStyle end, CapStyle dash) {
+    mStartCap = start;
+    mEndCap = end;
+    mDashCap = dash;
+}
+
+void StrokeStyle::setMiterLimit(float limit) {
+    if (limit < 1.f) { return; }
+    mMiterLimit = limit;
+}
+
+void StrokeStyle::setDashOffset(float dashOffset) {
+    if (dashOffset < 0.f) { return; }
+    mDashOffset = dashOffset;
+}
+
+void StrokeStyle::setCustomDash(const vector<float>& dashes) {
+    mDashes = dashes;
+    mLineStyle = LineStyle::CustomDash;
+}
+
+bool StrokeStyle::isSimple() const noexcept {
+    if (mLineStyle != LineStyle::Solid) { return false; }
+    if (mStartCap != CapStyle::Flat || mEndCap != CapStyle::Flat || mDashCap != CapStyle::Flat) { return false; }
+    if (mJoinStyle != LineJoinStyle::Miter) { return false; }
+    return math::exactlyEqual(mMiterLimit, 10.f) && math::exactlyEqual(mDashOffset, 0.f);
+}
+
+StrokeStyle StrokeStyle::withWidth(float width) const {
+    StrokeStyle style = *this;
+    style.setWidth(width);
+    return style;
+}
+
+size_t StrokeStyle::hash() const noexcept {
+    size_t seed = floatBits(mWidth);
+    hashCombine(seed, static_cast<size_t>(mLineStyle));
+    hashCombine(seed, static_cast<size_t>(mStartCap) | static_cast<size_t>(mEndCap) << 4);
+    hashCombine(seed, static_cast<size_t>(mDashCap) | static_cast<size_t>(mJoinStyle) << 4);
+    hashCombine(seed, floatBits(mMiterLimit));
+    hashCombine(seed, floatBits(mDashOffset));
+    for (float dash : mDashes) { hashCombine(seed, floatBits(dash)); }
+    return seed;
+}
+
+bool StrokeStyle::operator==(const StrokeStyle& rhs) const noexcept {
+    return math::exactlyEqual(mWidth, rhs.mWidth) && mLineStyle == rhs.mLineStyle && mStartCap == rhs.mStartCap
+           && mEndCap == rhs.mEndCap && mDashCap == rhs.mDashCap && mJoinStyle == rhs.mJoinStyle
+           && math::exactlyEqual(mMiterLimit, rhs.mMiterLimit) && math::exactlyEqual(mDashOffset, rhs.mDashOffset)
+           && mDashes == rhs.mDashes;
+}
+
+StrokeStyleCache& StrokeStyleCache::shared() {
+    static StrokeStyleCache cache;
+    return cache;
+}
+
+StrokeStyleRef StrokeStyleCache::intern(const StrokeStyle& style) {
+    const size_t hash = style.hash();
+    lock_guard lock(mMutex);
+    auto [first, last] = mStyles.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+        if (auto existing = it->second.lock(); existing && *existing == style) { return existing; }
+    }
+    if (mStyles.size() >= mPurgeThreshold) {
+        // Drop expired entries before growing, the threshold doubles with the live entries so purging stays
+        // amortized constant per insertion.
+        purgeLocked();
+        mPurgeThreshold = std::max<size_t>(64, mStyles.size() * 2);
+    }
+    auto interned = make_shared<const StrokeStyle>(style);
+    mStyles.emplace(hash, interned);
+    return interned;
+}
+
+size_t StrokeStyleCache::size() const {
+    lock_guard lock(mMutex);
+    return mStyles.size();
+}
+
+void StrokeStyleCache::purge() {
+    lock_guard lock(mMutex);
+    purgeLocked();
+}
+
+void StrokeStyleCache::purgeLocked() {
+    std::erase_if(mStyles, [](const auto& entry) { return entry.second.expired(); });
+}
+} // namespace bix
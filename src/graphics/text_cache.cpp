@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/graphics/text_cache.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+namespace bix {
+using namespace std;
+
+namespace {
+inline void hashCombine(size_t& seed, size_t value) noexcept {
+    seed ^= value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2);
+}
+
+// One pixel of empty space around every glyph, see GlyphAtlas.
+constexpr int kGutter = 1;
+} // namespace
+
+size_t TextLayoutKey::hash() const noexcept {
+    size_t seed = std::hash<string>{}(text);
+    hashCombine(seed, std::hash<string>{}(fontFamily));
+    hashCombine(seed, std::bit_cast<uint32_t>(textSize));
+    hashCombine(seed, static_cast<size_t>(fontWeight));
+    hashCombine(seed, static_cast<size_t>(fontStyle));
+    hashCombine(seed, static_cast<size_t>(wordWrapping));
+    hashCombine(seed, static_cast<size_t>(trimming));
+    hashCombine(seed, static_cast<size_t>(maxWidth));
+    hashCombine(seed, static_cast<size_t>(maxHeight));
+    return seed;
+}
+
+bool TextLayoutKey::operator==(const TextLayoutKey& rhs) const noexcept {
+    return math::exactlyEqual(textSize, rhs.textSize) && fontWeight == rhs.fontWeight && fontStyle == rhs.fontStyle
+           && wordWrapping == rhs.wordWrapping && trimming == rhs.trimming && maxWidth == rhs.maxWidth
+           && maxHeight == rhs.maxHeight && text == rhs.text && fontFamily == rhs.fontFamily;
+}
+
+size_t GlyphAtlas::KeyHash::operator()(const Key& key) const noexcept {
+    size_t seed = key.glyph;
+    hashCombine(seed, key.face);
+    hashCombine(seed, key.sizeX);
+    hashCombine(seed, key.sizeY);
+    hashCombine(seed, key.style);
+    return seed;
+}
+
+uint32_t GlyphAtlas::quantize(float px) noexcept {
+    if (!(px > 0.f)) { return 0; }
+    return static_cast<uint32_t>(std::lround(px * 64.f));
+}
+
+GlyphAtlas::GlyphAtlas(int pageSize, int maxPages) : mPageSize(std::max(pageSize, 16)), mMaxPages(std::max(maxPages, 1)) {}
+
+const GlyphAtlas::Entry* GlyphAtlas::find(const Key& key) {
+    auto it = mEntries.find(key);
+    if (it == mEntries.end()) {
+        ++mStats.misses;
+        return nullptr;
+    }
+    ++mStats.hits;
+    mPages[static_cast<size_t>(it->second.page)].lastUse = ++mTick;
+    return &it->second;
+}
+
+const GlyphAtlas::Entry* GlyphAtlas::insert(const Key& key, int width, int height, const uint8_t* coverage) {
+    width = std::max(width, 0);
+    height = std::max(height, 0);
+    if (width + kGutter > mPageSize || height + kGutter > mPageSize) { return nullptr; }
+
+    int index = -1;
+    int x = 0;
+    int y = 0;
+    for (size_t i = 0; i < mPages.size(); ++i) {
+        if (allocate(mPages[i], width, height, x, y)) {
+            index = static_cast<int>(i);
+            break;
+        }
+    }
+    if (index < 0) {
+        if (static_cast<int>(mPages.size()) < mMaxPages) {
+            Page page;
+            page.pixels.assign(static_cast<size_t>(mPageSize) * static_cast<size_t>(mPageSize), 0);
+            mPages.push_back(std::move(page));
+            index = static_cast<int>(mPages.size()) - 1;
+        } else {
+            auto lru = std::min_element(mPages.begin(), mPages.end(), [](const Page& a, const Page& b) {
+                return a.lastUse < b.lastUse;
+            });
+            index = static_cast<int>(lru - mPages.begin());
+            resetPage(index);
+        }
+        allocate(mPages[static_cast<size_t>(index)], width, height, x, y);
+    }
+
+    auto& page = mPages[static_cast<size_t>(index)];
+    for (int row = 0; row < height; ++row) {
+        std::memcpy(
+            page.pixels.data() + static_cast<size_t>(y + row) * static_cast<size_t>(mPageSize) + static_cast<size_t>(x),
+            coverage + static_cast<size_t>(row) * static_cast<size_t>(width),
+            static_cast<size_t>(width)
+        );
+    }
+    page.lastUse = ++mTick;
+    ++page.version;
+
+    auto [it, inserted] = mEntries.insert_or_assign(key, Entry{index, x, y, width, height});
+    BIX_UNUSED(inserted)
+    return &it->second;
+}
+
+void GlyphAtlas::clear() {
+    mEntries.clear();
+    mPages.clear();
+}
+
+bool GlyphAtlas::allocate(Page& page, int width, int height, int& x, int& y) const {
+    const int w = width + kGutter;
+    const int h = height + kGutter;
+    // Best fit: the lowest shelf that still has room, wasting as little height as possible.
+    Shelf* best = nullptr;
+    for (auto& shelf : page.shelves) {
+        if (shelf.height < h || shelf.x + w > mPageSize) { continue; }
+        if (!best || shelf.height < best->height) { best = &shelf; }
+    }
+    // A much taller shelf would waste its height, open a new one if there is room left.
+    if ((!best || best->height > h + h / 2) && page.shelfBottom + h <= mPageSize) {
+        page.shelves.push_back({page.shelfBottom, h, 0});
+        page.shelfBottom += h;
+        best = &page.shelves.back();
+    }
+    if (!best) { return false; }
+    x = best->x;
+    y = best->y;
+    best->x += w;
+    return true;
+}
+
+void GlyphAtlas::resetPage(int index) {
+    std::erase_if(mEntries, [index](const auto& entry) { return entry.second.page == index; });
+    auto& page = mPages[static_cast<size_t>(index)];
+    page.shelves.clear();
+    page.shelfBottom = 0;
+    ++page.version;
+    ++mStats.evictions;
+}
+} // namespace bix
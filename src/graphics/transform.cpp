@@ -152,6 +152,21 @@ void Transform::reset() {
     *this = Transform();
 }
 
+Transform Transform::operator*(const Transform& rhs) const {
+    if (type() == None) { return rhs; }
+    if (rhs.type() == None) { return *this; }
+
+    Transform result;
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            result.mMatrix[r][c] = mMatrix[r][0] * rhs.mMatrix[0][c] + mMatrix[r][1] * rhs.mMatrix[1][c]
+                                   + mMatrix[r][2] * rhs.mMatrix[2][c];
+        }
+    }
+    result.mDirty = Project;
+    return result;
+}
+
 const float* Transform::data() const {
     return &mMatrix[0][0];
 }
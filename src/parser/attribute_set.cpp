@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/parser/attribute_set.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace std;
+
+namespace bix {
+
+AttributeValue AttributeValue::fromColor(const Color& color) noexcept {
+    const auto bits = static_cast<uint32_t>(color.red()) | static_cast<uint32_t>(color.green()) << 8
+                      | static_cast<uint32_t>(color.blue()) << 16 | static_cast<uint32_t>(color.alpha()) << 24;
+    return {{}, bits, LayoutValueType::Color, 0};
+}
+
+AttributeValue AttributeValue::fromFloat(float value) noexcept {
+    return {{}, bit_cast<uint32_t>(value), LayoutValueType::Float, 0};
+}
+
+const AttributeSet::Entry* AttributeSet::lowerBound(AttrId id) const noexcept {
+    return lower_bound(mEntries.begin(), mEntries.end(), id, [](const Entry& e, AttrId v) { return e.id < v; });
+}
+
+void AttributeSet::set(AttrId id, const AttributeValue& value) {
+    const auto* it = lowerBound(id);
+    if (it != mEntries.end() && it->id == id) {
+        mEntries[static_cast<size_t>(it - mEntries.begin())].value = value;
+        return;
+    }
+    mEntries.insert(it, {id, value});
+}
+
+bool AttributeSet::remove(AttrId id) noexcept {
+    const auto* it = lowerBound(id);
+    if (it == mEntries.end() || it->id != id) { return false; }
+    mEntries.erase(it);
+    return true;
+}
+
+const AttributeValue* AttributeSet::find(AttrId id) const noexcept {
+    const auto* it = lowerBound(id);
+    return it != mEntries.end() && it->id == id ? &it->value : nullptr;
+}
+
+bool AttributeSet::getString(AttrId id, string& out) const {
+    string_view view;
+    if (!getString(id, view)) { return false; }
+    out.assign(view);
+    return true;
+}
+
+bool AttributeSet::getString(AttrId id, string_view& out) const noexcept {
+    const auto* value = find(id);
+    if (!value || value->type != LayoutValueType::String) { return false; }
+    out = value->text;
+    return true;
+}
+
+bool AttributeSet::getLength(AttrId id, Length& out) const noexcept {
+    const auto* value = find(id);
+    if (!value || value->type != LayoutValueType::Length) { return false; }
+    out = value->record().toLength();
+    return true;
+}
+
+bool AttributeSet::getColor(AttrId id, Color& out) const noexcept {
+    const auto* value = find(id);
+    if (!value || value->type != LayoutValueType::Color) { return false; }
+    out = value->record().toColor();
+    return true;
+}
+
+bool AttributeSet::getBool(AttrId id, bool& out) const noexcept {
+    const auto* value = find(id);
+    if (!value || value->type != LayoutValueType::Bool) { return false; }
+    out = value->bits != 0;
+    return true;
+}
+
+bool AttributeSet::getFloat(AttrId id, float& out) const noexcept {
+    const auto* value = find(id);
+    if (!value || value->type != LayoutValueType::Float) { return false; }
+    out = value->record().toFloat();
+    return true;
+}
+} // namespace bix
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/parser/compiled_layout.h"
+
+#include "bixlib/errors.h"
+
+#include <algorithm>
+#include <fstream>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+template <typename T>
+const T* tableAt(span<const byte> data, uint32_t offset, uint32_t count) {
+    if (offset % alignof(T) != 0 || offset > data.size() || count > (data.size() - offset) / sizeof(T)) {
+        throw RuntimeError("invalid compiled layout: table out of bounds");
+    }
+    return reinterpret_cast<const T*>(data.data() + offset);
+}
+} // namespace
+
+CompiledLayout::CompiledLayout(span<const byte> data) : mData(data) {
+    validate();
+}
+
+CompiledLayout::CompiledLayout(vector<byte> data) : mOwned(std::move(data)) {
+    mData = mOwned;
+    validate();
+}
+
+CompiledLayout CompiledLayout::fromFile(const filesystem::path& path) {
+    ifstream file(path, ios::binary | ios::ate);
+    if (!file) { throw RuntimeError("failed to open compiled layout {}", path.string()); }
+    const auto size = file.tellg();
+    vector<byte> data(static_cast<size_t>(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data.data()), size)) {
+        throw RuntimeError("failed to read compiled layout {}", path.string());
+    }
+    return CompiledLayout(std::move(data));
+}
+
+void CompiledLayout::validate() {
+    if constexpr (endian::native != endian::little) {
+        throw RuntimeError("compiled layouts are only supported on little-endian machines");
+    }
+    if (reinterpret_cast<uintptr_t>(mData.data()) % alignof(LayoutFileHeader) != 0) {
+        throw RuntimeError("compiled layout data must be 4-byte aligned");
+    }
+    mHeader = tableAt<LayoutFileHeader>(mData, 0, 1);
+    const auto& h = *mHeader;
+    if (h.magic != kMagic) { throw RuntimeError("invalid compiled layout: bad magic"); }
+    if (h.version != kVersion) { throw RuntimeError("unsupported compiled layout version {}", h.version); }
+    if (h.fileSize != mData.size()) { throw RuntimeError("invalid compiled layout: size mismatch"); }
+
+    mNodes = tableAt<LayoutNode>(mData, h.nodeOffset, h.nodeCount);
+    mAttributes = tableAt<LayoutAttribute>(mData, h.attrOffset, h.attrCount);
+    mStrings = tableAt<LayoutString>(mData, h.stringOffset, h.stringCount);
+    mChars = tableAt<char>(mData, h.charsOffset, h.charsSize);
+    if (h.nodeCount == 0) { throw RuntimeError("invalid compiled layout: no root element"); }
+
+    for (uint32_t i = 0; i < h.stringCount; ++i) {
+        const auto& s = mStrings[i];
+        if (s.offset > h.charsSize || s.length > h.charsSize - s.offset) {
+            throw RuntimeError("invalid compiled layout: string {} out of bounds", i);
+        }
+    }
+    for (uint32_t i = 1; i < h.stringCount; ++i) {
+        if (string(i - 1) >= string(i)) { throw RuntimeError("invalid compiled layout: unsorted string table"); }
+    }
+    // The pre-order is checked once here so that loaders can walk the nodes without bounds checks.
+    for (uint32_t i = 0; i < h.nodeCount; ++i) {
+        const auto& n = mNodes[i];
+        const bool validParent =
+            i == 0 ? n.parent == kNone : n.parent < i && mNodes[n.parent].subtreeEnd >= n.subtreeEnd;
+        if (!validParent || n.subtreeEnd <= i || n.subtreeEnd > h.nodeCount || n.type >= h.stringCount) {
+            throw RuntimeError("invalid compiled layout: node {} is malformed", i);
+        }
+        if (n.firstAttr > h.attrCount || n.attrCount > h.attrCount - n.firstAttr) {
+            throw RuntimeError("invalid compiled layout: attributes of node {} out of bounds", i);
+        }
+    }
+    if (mNodes[0].subtreeEnd != h.nodeCount) { throw RuntimeError("invalid compiled layout: multiple roots"); }
+    for (uint32_t i = 0; i < h.attrCount; ++i) {
+        const auto& a = mAttributes[i];
+        if (a.name >= h.stringCount || a.type > LayoutValueType::Enum
+            || (a.type == LayoutValueType::String && a.value >= h.stringCount)
+            || (a.type == LayoutValueType::Length && a.unit > Length::SPECIAL)) {
+            throw RuntimeError("invalid compiled layout: attribute {} is malformed", i);
+        }
+    }
+}
+
+uint32_t CompiledLayout::findString(string_view str) const noexcept {
+    const auto* first = mStrings;
+    const auto* last = mStrings + mHeader->stringCount;
+    auto view = [this](const LayoutString& s) { return string_view(mChars + s.offset, s.length); };
+    const auto* it = lower_bound(first, last, str, [&](const LayoutString& s, string_view v) { return view(s) < v; });
+    if (it == last || view(*it) != str) { return kNone; }
+    return static_cast<uint32_t>(it - first);
+}
+} // namespace bix
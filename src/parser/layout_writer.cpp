@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/parser/layout_writer.h"
+
+#include "bixlib/errors.h"
+#include "bixlib/widgets/widget_defs.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <numeric>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+bool isLengthAttribute(string_view name) {
+    return name == "width" || name == "height" || name == "minWidth" || name == "minHeight" || name == "maxWidth"
+           || name == "maxHeight";
+}
+
+bool isColorAttribute(string_view name) {
+    return name == "color" || name == "background" || name.ends_with("Color");
+}
+
+bool isBoolAttribute(string_view name) {
+    return name == "enable" || name == "horizontal" || name == "clickable" || name == "boundsClip" || name == "lazy";
+}
+
+// Length::parse falls back to 0px, which is only a valid result for inputs spelling it.
+bool isZeroPx(string_view value) {
+    if (!value.ends_with("px")) { return false; }
+    value.remove_suffix(2);
+    return !value.empty() && value.find_first_not_of("0.") == string_view::npos;
+}
+
+} // namespace
+
+LayoutAttribute parseLayoutAttribute(string_view name, string_view value) {
+    LayoutAttribute attr{};
+    if (isLengthAttribute(name)) {
+        auto length = Length::parse(value);
+        if (length == Length::px(0) && !isZeroPx(value)) {
+            throw RuntimeError("invalid length '{}' of attribute {}", value, name);
+        }
+        attr.type = LayoutValueType::Length;
+        attr.unit = length.unit();
+        attr.value = bit_cast<uint32_t>(length.fixedValue());
+    } else if (isColorAttribute(name)) {
+        const auto color = Color::fromHexString(value);
+        if (!color.isValid()) { throw RuntimeError("invalid color '{}' of attribute {}", value, name); }
+        attr.type = LayoutValueType::Color;
+        attr.value = static_cast<uint32_t>(color.red()) | static_cast<uint32_t>(color.green()) << 8
+                     | static_cast<uint32_t>(color.blue()) << 16 | static_cast<uint32_t>(color.alpha()) << 24;
+    } else if (isBoolAttribute(name)) {
+        if (value != "true" && value != "false") {
+            throw RuntimeError("invalid boolean '{}' of attribute {}", value, name);
+        }
+        attr.type = LayoutValueType::Bool;
+        attr.value = value == "true" ? 1 : 0;
+    } else if (name == "alpha") {
+        float alpha = 0.f;
+        const auto result = from_chars(value.data(), value.data() + value.size(), alpha);
+        if (result.ec != errc() || result.ptr != value.data() + value.size()) {
+            throw RuntimeError("invalid number '{}' of attribute {}", value, name);
+        }
+        attr.type = LayoutValueType::Float;
+        attr.value = bit_cast<uint32_t>(alpha);
+    } else if (name == "visible") {
+        auto visibility = Visibility::Visible;
+        if (value == "false") {
+            visibility = Visibility::Invisible;
+        } else if (value == "gone") {
+            visibility = Visibility::Collapsed;
+        } else if (value != "true") {
+            throw RuntimeError("invalid visibility '{}' of attribute {}", value, name);
+        }
+        attr.type = LayoutValueType::Enum;
+        attr.value = static_cast<uint32_t>(visibility);
+    } else {
+        attr.type = LayoutValueType::String;
+    }
+    return attr;
+}
+
+namespace {
+template <typename T>
+void appendTable(vector<byte>& out, uint32_t& offset, const vector<T>& table) {
+    offset = static_cast<uint32_t>(out.size());
+    // An empty table may have no data to copy from, GCC warns about the zero length read in a Release build.
+    if (table.empty()) { return; }
+    const size_t size = table.size() * sizeof(T);
+    out.resize(offset + size);
+    memcpy(out.data() + offset, table.data(), size);
+}
+} // namespace
+
+uint32_t LayoutWriter::intern(string_view str) {
+    auto [it, inserted] = mStringIds.try_emplace(string(str), static_cast<uint32_t>(mStrings.size()));
+    if (inserted) { mStrings.emplace_back(str); }
+    return it->second;
+}
+
+void LayoutWriter::beginElement(string_view type) {
+    if (mOpen.empty() && !mNodes.empty()) { throw LogicError("a layout must have a single root element"); }
+    const auto index = static_cast<CompiledLayout::Index>(mNodes.size());
+    mNodes.push_back({
+        .type = intern(type),
+        .parent = mOpen.empty() ? CompiledLayout::kNone : mOpen.back(),
+        .subtreeEnd = index + 1,
+        .firstAttr = static_cast<uint32_t>(mAttributes.size()),
+        .attrCount = 0,
+    });
+    mOpen.push_back(index);
+}
+
+void LayoutWriter::attribute(string_view name, string_view value) {
+    if (mOpen.empty()) { throw LogicError("attribute {} outside of an element", name); }
+    // The attributes of a node are stored contiguously, they can't follow its children.
+    if (mOpen.back() + 1 != mNodes.size()) { throw LogicError("attribute {} after a child element", name); }
+    auto attr = parseLayoutAttribute(name, value);
+    attr.name = intern(name);
+    if (attr.type == LayoutValueType::String) { attr.value = intern(value); }
+    mAttributes.push_back(attr);
+    ++mNodes.back().attrCount;
+}
+
+void LayoutWriter::endElement() {
+    if (mOpen.empty()) { throw LogicError("no open element"); }
+    mNodes[mOpen.back()].subtreeEnd = static_cast<uint32_t>(mNodes.size());
+    mOpen.pop_back();
+}
+
+vector<byte> LayoutWriter::finish() {
+    if (mNodes.empty() || !mOpen.empty()) { throw LogicError("the layout is empty or has unclosed elements"); }
+
+    // Sorts the string table so that loaders can look names up with a binary search, then remaps the indices.
+    vector<uint32_t> order(mStrings.size());
+    iota(order.begin(), order.end(), 0u);
+    sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) { return mStrings[a] < mStrings[b]; });
+    vector<uint32_t> remap(mStrings.size());
+    vector<LayoutString> strings;
+    string chars;
+    strings.reserve(mStrings.size());
+    for (uint32_t i = 0; i < order.size(); ++i) {
+        const auto& s = mStrings[order[i]];
+        remap[order[i]] = i;
+        strings.push_back({static_cast<uint32_t>(chars.size()), static_cast<uint32_t>(s.size())});
+        chars += s;
+    }
+    for (auto& node : mNodes) { node.type = remap[node.type]; }
+    for (auto& attr : mAttributes) {
+        attr.name = remap[attr.name];
+        if (attr.type == LayoutValueType::String) { attr.value = remap[attr.value]; }
+    }
+
+    LayoutFileHeader header{};
+    header.magic = CompiledLayout::kMagic;
+    header.version = CompiledLayout::kVersion;
+    header.nodeCount = static_cast<uint32_t>(mNodes.size());
+    header.attrCount = static_cast<uint32_t>(mAttributes.size());
+    header.stringCount = static_cast<uint32_t>(strings.size());
+    header.charsSize = static_cast<uint32_t>(chars.size());
+
+    vector<byte> out(sizeof(LayoutFileHeader));
+    appendTable(out, header.nodeOffset, mNodes);
+    appendTable(out, header.attrOffset, mAttributes);
+    appendTable(out, header.stringOffset, strings);
+    header.charsOffset = static_cast<uint32_t>(out.size());
+    const auto* c = reinterpret_cast<const byte*>(chars.data());
+    out.insert(out.end(), c, c + chars.size());
+    out.resize((out.size() + 3) & ~size_t{3});
+    header.fileSize = static_cast<uint32_t>(out.size());
+    memcpy(out.data(), &header, sizeof(header));
+
+    mNodes.clear();
+    mAttributes.clear();
+    mStrings.clear();
+    mStringIds.clear();
+    return out;
+}
+} // namespace bix
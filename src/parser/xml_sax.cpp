@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/parser/xml_sax.h"
+
+#include "bixlib/errors.h"
+
+#include <algorithm>
+#include <charconv>
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+bool isSpace(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool isNameStart(char c) noexcept {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':'
+           || static_cast<unsigned char>(c) >= 0x80;
+}
+
+bool isNameChar(char c) noexcept {
+    return isNameStart(c) || (c >= '0' && c <= '9') || c == '-' || c == '.';
+}
+
+void appendUtf8(string& out, uint32_t cp) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+} // namespace
+
+void XmlSaxParser::fail(const char* what) const {
+    const auto end = mSource.begin() + static_cast<ptrdiff_t>(min(mPos, mSource.size()));
+    const auto line = count(mSource.begin(), end, '\n');
+    throw RuntimeError("xml:{}: {}", line + 1, what);
+}
+
+bool XmlSaxParser::consume(string_view token) noexcept {
+    if (!mSource.substr(mPos).starts_with(token)) { return false; }
+    mPos += token.size();
+    return true;
+}
+
+void XmlSaxParser::skipWhitespace() noexcept {
+    while (mPos < mSource.size() && isSpace(mSource[mPos])) { ++mPos; }
+}
+
+void XmlSaxParser::skipPast(string_view terminator) {
+    const auto end = mSource.find(terminator, mPos);
+    if (end == string_view::npos) { fail("unexpected end of document"); }
+    mPos = end + terminator.size();
+}
+
+string_view XmlSaxParser::readName() {
+    const auto start = mPos;
+    if (mPos >= mSource.size() || !isNameStart(mSource[mPos])) { fail("expected a name"); }
+    while (mPos < mSource.size() && isNameChar(mSource[mPos])) { ++mPos; }
+    return mSource.substr(start, mPos - start);
+}
+
+void XmlSaxParser::decode(string_view raw, string& out) const {
+    for (size_t i = 0; i < raw.size(); ++i) {
+        if (raw[i] != '&') {
+            out += raw[i];
+            continue;
+        }
+        const auto end = raw.find(';', i);
+        if (end == string_view::npos) { fail("unterminated reference"); }
+        const auto ref = raw.substr(i + 1, end - i - 1);
+        if (ref == "lt") {
+            out += '<';
+        } else if (ref == "gt") {
+            out += '>';
+        } else if (ref == "amp") {
+            out += '&';
+        } else if (ref == "quot") {
+            out += '"';
+        } else if (ref == "apos") {
+            out += '\'';
+        } else if (ref.starts_with('#')) {
+            const bool hex = ref.size() > 1 && ref[1] == 'x';
+            const auto digits = ref.substr(hex ? 2 : 1);
+            uint32_t cp = 0;
+            const auto result = from_chars(digits.data(), digits.data() + digits.size(), cp, hex ? 16 : 10);
+            if (digits.empty() || result.ec != errc() || result.ptr != digits.data() + digits.size() || cp == 0
+                || cp > 0x10FFFF) {
+                fail("invalid character reference");
+            }
+            appendUtf8(out, cp);
+        } else {
+            fail("unknown entity");
+        }
+        i = end;
+    }
+}
+
+void XmlSaxParser::decodeAttributes() {
+    mAttributes.clear();
+    mValues.clear();
+    // Decoded values are never longer than the raw ones, reserving their total length keeps the views valid.
+    size_t total = 0;
+    for (const auto& raw : mRawAttributes) { total += raw.value.size(); }
+    mValues.reserve(total);
+    for (const auto& raw : mRawAttributes) {
+        if (raw.value.find('&') == string_view::npos) {
+            mAttributes.push_back({raw.name, raw.value});
+            continue;
+        }
+        const auto start = mValues.size();
+        decode(raw.value, mValues);
+        mAttributes.push_back({raw.name, string_view(mValues).substr(start)});
+    }
+}
+
+void XmlSaxParser::parseText(XmlHandler& handler, bool report) {
+    const auto start = mPos;
+    mPos = min(mSource.find('<', mPos), mSource.size());
+    const auto raw = mSource.substr(start, mPos - start);
+    if (mOpen.empty()) {
+        if (!all_of(raw.begin(), raw.end(), isSpace)) { fail("text outside of the root element"); }
+        return;
+    }
+    if (!report) { return; }
+    if (raw.find('&') == string_view::npos) {
+        handler.characters(raw);
+        return;
+    }
+    mText.clear();
+    decode(raw, mText);
+    handler.characters(mText);
+}
+
+void XmlSaxParser::parse(XmlHandler& handler) {
+    mPos = 0;
+    mOpen.clear();
+    bool seenRoot = false;
+    // The depth of the element whose content is skipped, 0 when reporting.
+    size_t skipDepth = 0;
+
+    while (mPos < mSource.size()) {
+        if (mSource[mPos] != '<') {
+            parseText(handler, skipDepth == 0);
+        } else if (consume("<!--")) {
+            skipPast("-->");
+        } else if (consume("<![CDATA[")) {
+            const auto start = mPos;
+            skipPast("]]>");
+            if (mOpen.empty()) { fail("CDATA outside of the root element"); }
+            if (skipDepth == 0) { handler.characters(mSource.substr(start, mPos - 3 - start)); }
+        } else if (consume("<?")) {
+            skipPast("?>");
+        } else if (consume("<!")) {
+            const auto end = mSource.find_first_of("[>", mPos);
+            if (end == string_view::npos || mSource[end] == '[') { fail("unsupported document type declaration"); }
+            mPos = end + 1;
+        } else if (consume("</")) {
+            const auto name = readName();
+            skipWhitespace();
+            if (!consume(">")) { fail("expected '>'"); }
+            if (mOpen.empty() || mOpen.back().name != name) { fail("mismatched end tag"); }
+            const auto start = mOpen.back().start;
+            mOpen.pop_back();
+            if (skipDepth != 0 && mOpen.size() >= skipDepth) { continue; }
+            skipDepth = 0;
+            handler.endElement(name, mSource.substr(start, mPos - start));
+        } else {
+            const auto start = mPos++;
+            const auto name = readName();
+            if (mOpen.empty() && seenRoot) { fail("multiple root elements"); }
+            seenRoot = true;
+            mRawAttributes.clear();
+            bool empty = false;
+            while (true) {
+                const auto before = mPos;
+                skipWhitespace();
+                if (consume("/>")) {
+                    empty = true;
+                    break;
+                }
+                if (consume(">")) { break; }
+                if (mPos == before) { fail("expected whitespace before an attribute"); }
+                const auto attrName = readName();
+                skipWhitespace();
+                if (!consume("=")) { fail("expected '='"); }
+                skipWhitespace();
+                if (mPos >= mSource.size() || (mSource[mPos] != '"' && mSource[mPos] != '\'')) {
+                    fail("expected a quoted attribute value");
+                }
+                const char quote = mSource[mPos++];
+                const auto end = mSource.find(quote, mPos);
+                if (end == string_view::npos) { fail("unterminated attribute value"); }
+                const auto value = mSource.substr(mPos, end - mPos);
+                if (value.find('<') != string_view::npos) { fail("'<' in attribute value"); }
+                mRawAttributes.push_back({attrName, value});
+                mPos = end + 1;
+            }
+
+            if (skipDepth != 0) {
+                if (!empty) { mOpen.push_back({name, start}); }
+                continue;
+            }
+            decodeAttributes();
+            const bool descend = handler.startElement(name, mAttributes);
+            if (empty) {
+                handler.endElement(name, mSource.substr(start, mPos - start));
+                continue;
+            }
+            mOpen.push_back({name, start});
+            if (!descend) { skipDepth = mOpen.size(); }
+        }
+    }
+    if (!mOpen.empty()) { fail("unclosed element"); }
+    if (!seenRoot) { fail("no root element"); }
+}
+} // namespace bix
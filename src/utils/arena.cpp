@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/utils/arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace bix {
+
+namespace {
+constexpr size_t kHeaderSize = (sizeof(void*) * 2 + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+std::byte* alignUp(std::byte* p, size_t alignment) noexcept {
+    const auto v = reinterpret_cast<uintptr_t>(p);
+    return p + ((alignment - (v & (alignment - 1))) & (alignment - 1));
+}
+} // namespace
+
+MonotonicArena::MonotonicArena(size_t blockSize) noexcept : mNextBlockSize(std::max<size_t>(blockSize, 256)) {}
+
+MonotonicArena::~MonotonicArena() {
+    freeBlocks(mHead);
+}
+
+void MonotonicArena::freeBlocks(Block* block) noexcept {
+    while (block) {
+        Block* next = block->next;
+        ::operator delete(block);
+        block = next;
+    }
+}
+
+void MonotonicArena::addBlock(size_t minSize) {
+    const size_t size = std::max(mNextBlockSize, minSize);
+    auto* block = static_cast<Block*>(::operator new(kHeaderSize + size));
+    block->next = mHead;
+    block->size = size;
+    mHead = block;
+    mCursor = reinterpret_cast<std::byte*>(block) + kHeaderSize;
+    mEnd = mCursor + size;
+    mNextBlockSize = std::min(mNextBlockSize * 2, kMaxBlockSize);
+    ++mBlockCount;
+}
+
+void* MonotonicArena::allocate(size_t size, size_t alignment) {
+    size = std::max<size_t>(size, 1);
+    std::byte* p = mCursor ? alignUp(mCursor, alignment) : nullptr;
+    if (!p || p > mEnd || static_cast<size_t>(mEnd - p) < size) {
+        // Blocks are aligned to max_align_t, over-aligned requests reserve room for the padding.
+        addBlock(size + (alignment > alignof(std::max_align_t) ? alignment : 0));
+        p = alignUp(mCursor, alignment);
+    }
+    mUsed += static_cast<size_t>(p + size - mCursor);
+    mCursor = p + size;
+    ++mLive;
+    return p;
+}
+
+void MonotonicArena::deallocate(void* p) noexcept {
+    if (p && mLive > 0) { --mLive; }
+}
+
+void MonotonicArena::reset() noexcept {
+    if (!mHead) { return; }
+    // Keep the oldest block, it is the one every arena starts with.
+    Block* first = mHead;
+    Block* newer = nullptr;
+    while (first->next) {
+        Block* next = first->next;
+        first->next = newer;
+        newer = first;
+        first = next;
+    }
+    freeBlocks(newer);
+    mHead = first;
+    mCursor = reinterpret_cast<std::byte*>(first) + kHeaderSize;
+    mEnd = mCursor + first->size;
+    mBlockCount = 1;
+    mUsed = 0;
+    mLive = 0;
+}
+} // namespace bix
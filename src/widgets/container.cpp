@@ -16,15 +16,108 @@
 
 #include "bixlib/widgets/container.h"
 
-#include "window/window_private.h"
+#include <algorithm>
+#include <memory>
 
-#include <bixlib/utils/fmt_bix.h>
-#include <bixlib/widgets/button.h>
+namespace bix {
 
-#include <stdio.h>
-#include <windows.h>
+void Container::setArena(MonotonicArena* arena) noexcept {
+    mArena = arena;
+    if (mChildren.empty()) { mChildren = ChildList(ChildList::allocator_type(arena)); }
+}
 
-#include <memory>
+Widget* Container::addChildImpl(WidgetPtr child, int index) {
+    if (!child) { return nullptr; }
+    Widget* raw = child.get();
+    child->setParent(this);
+    if (isValidIndex(index)) {
+        mChildren.insert(mChildren.begin() + index, std::move(child));
+    } else {
+        mChildren.push_back(std::move(child));
+    }
+    requestLayout();
+    return raw;
+}
+
+WidgetPtr Container::removeChild(Widget* child) {
+    if (!child) { return nullptr; }
+    auto it = std::ranges::find_if(mChildren, [child](const WidgetPtr& p) { return p.get() == child; });
+    return it != mChildren.end() ? removeChildImpl(it) : nullptr;
+}
+
+WidgetPtr Container::removeChildAt(int index) {
+    return isValidIndex(index) ? removeChildImpl(mChildren.begin() + index) : nullptr;
+}
+
+void Container::clearChildren() {
+    if (mChildren.empty()) { return; }
+    for (auto& child : mChildren) {
+        if (!child) { continue; }
+        invalidateWindowRect(child->windowBounds());
+        child->setParent(nullptr);
+    }
+    mChildren.clear();
+    requestLayout();
+}
+
+WidgetPtr Container::removeChildImpl(ChildIterator it) {
+    WidgetPtr removed = std::move(*it);
+    mChildren.erase(it);
+    if (removed) {
+        // The pixels of the child stay on screen until the area it covered is painted again.
+        invalidateWindowRect(removed->windowBounds());
+        removed->setParent(nullptr);
+    }
+    requestLayout();
+    return removed;
+}
+
+Widget* Container::findByIdImpl(std::string_view id) const {
+    for (const auto& child : mChildren) {
+        if (!child) { continue; }
+        if (child->id() == id) { return child.get(); }
+        if (child->isContainer()) {
+            if (auto* found = static_cast<const Container*>(child.get())->findByIdImpl(id)) { return found; }
+        }
+    }
+    return nullptr;
+}
+
+int Container::childIndex(const Widget* child) const {
+    auto it = std::ranges::find_if(mChildren, [child](const WidgetPtr& p) { return p.get() == child; });
+    return it != mChildren.end() ? static_cast<int>(std::distance(mChildren.begin(), it)) : -1;
+}
+
+Widget* Container::childAt(int index) const {
+    return isValidIndex(index) ? mChildren[static_cast<size_t>(index)].get() : nullptr;
+}
+
+void Container::requestLayoutFromChild(Widget* child) {
+    BIX_UNUSED(child)
+    // Only the chain from the child up to the root loses its measure cache, siblings stay cached.
+    requestLayout();
+}
+
+void Container::invalidateChild(Widget* child, const Rect& rect) {
+    // Children are laid out relative to the container, move the rect into the local coordinates of the container.
+    const auto& pos = child->position();
+    invalidateRect(rect.translated(pos.left, pos.top));
+}
+
+void Container::invalidateWindowRect(const Rect& rect) {
+    if (auto* parent = this->parent()) { parent->invalidateWindowRect(rect); }
+}
+
+Transform Container::childTransform() const noexcept {
+    return positionTransform();
+}
+
+void Container::dispatchPaint(Canvas& canvas, const DamageRegion* damage) {
+    for (const auto& child : mChildren) {
+        if (child) { child->paint(canvas, damage); }
+    }
+}
+} // namespace bix
 
 // namespace bix::ui {
 //
@@ -102,94 +195,4 @@
 // //     });
 // // }
 //
-// WidgetPtr Container::removeChild(Widget* child) {
-//     if (!child)
-//         return nullptr;
-//
-//     auto it = std::ranges::find_if(mChildren, [child](const WidgetPtr& p) { return p.get() == child; });
-//
-//     return (it != mChildren.end()) ? removeChildImpl(it) : nullptr;
-// }
-//
-// WidgetPtr Container::removeChildAt(int index) {
-//     return isValidIndex(index) ? removeChildImpl(mChildren.begin() + index) : nullptr;
-// }
-//
-// void Container::clearChildren() {
-//     if (mChildren.empty()) {
-//         return;
-//     }
-//     // TODO 批量解绑父子关系
-//     for (auto& child : mChildren) {
-//         if (child) {
-//             child->setParent(nullptr);
-//         }
-//     }
-//
-//     mChildren.clear(); // 触发所有 unique_ptr 批量析构
-//     invalidate();
-// }
-//
-// WidgetPtr Container::removeChildImpl(ChildIterator it) {
-//     // 1. 夺取所有权
-//     WidgetPtr removed = std::move(*it);
-//
-//     // 2. 环境清理
-//     if (removed) {
-//         removed->setParent(nullptr);
-//     }
-//
-//     // 3. 物理移除
-//     mChildren.erase(it);
-//     invalidate();
-//     // TODO dispatchRemoved(tmp.get());
-//     return removed;
-// }
-//
-// Widget* Container::findByIdImpl(std::string_view id) const {
-//     for (const auto& child : mChildren) {
-//         if (!child) {
-//             continue;
-//         }
-//         if (child->id() == id) {
-//             return child.get();
-//         }
-//         if (child->isContainer()) {
-//             const auto* container = static_cast<const Container*>(child.get());
-//             if (auto* found = container->findByIdImpl(id)) {
-//                 return found;
-//             }
-//         }
-//     }
-//     return nullptr;
-// }
-//
-// int Container::childIndex(const Widget* child) const {
-//     auto it = std::ranges::find_if(mChildren, [child](const WidgetPtr& p) { return p.get() == child; });
-//
-//     if (it != mChildren.end()) {
-//         return static_cast<int>(std::distance(mChildren.begin(), it));
-//     }
-//     return -1;
-// }
-//
-// Widget* Container::childAt(int index) const { return isValidIndex(index) ? mChildren[index].get() : nullptr; }
-//
-// Widget* Container::addChildImpl(WidgetPtr child, int index) {
-//     if (!child) {
-//         return nullptr;
-//     }
-//
-//     Widget* rawPtr = child.get();
-//     child->setParent(this);
-//
-//     if (isValidIndex(index)) {
-//         mChildren.insert(mChildren.begin() + index, std::move(child));
-//     } else {
-//         mChildren.push_back(std::move(child));
-//     }
-//
-//     this->invalidate();
-//     return rawPtr;
-// }
 // } // namespace bix::ui
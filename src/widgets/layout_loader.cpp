@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/widgets/layout_loader.h"
+
+#include "bixlib/control_names.h"
+#include "bixlib/errors.h"
+#include "bixlib/layout/linear_layout.h"
+#include "bixlib/parser/layout_writer.h"
+#include "bixlib/parser/xml_sax.h"
+#include "bixlib/widgets/button.h"
+#include "bixlib/widgets/label.h"
+#include "bixlib/widgets/view_stub.h"
+
+using namespace std;
+
+namespace bix {
+
+namespace {
+// Adds a widget to its parent, or makes it the root if there is no parent.
+Widget* attach(Widget* parent, string_view parentType, WidgetPtr widget, WidgetPtr& root) {
+    if (!parent) {
+        root = std::move(widget);
+        return root.get();
+    }
+    if (!parent->isContainer()) { throw RuntimeError("layout element {} can't have children", parentType); }
+    return static_cast<Container*>(parent)->addChild(std::move(widget));
+}
+} // namespace
+
+class LayoutLoader::XmlInflater final : public XmlHandler {
+public:
+    XmlInflater(const LayoutLoader& loader, MonotonicArena* arena) : mLoader(loader), mArena(arena) {}
+
+    WidgetPtr takeRoot() { return std::move(mRoot); }
+
+    bool startElement(string_view name, span<const XmlAttribute> attributes) override {
+        if (!mOpen.empty() && isDeferred(attributes)) {
+            mDeferred = true;
+            return false;
+        }
+
+        auto widget = mLoader.factory(name)(mArena);
+        // The string values view the document or the decoded values of the parser, both valid during this call.
+        mAttributes.clear();
+        for (const auto& a : attributes) {
+            const auto attr = parseLayoutAttribute(a.name, a.value);
+            mAttributes.set(AttrId::fromName(a.name), AttributeValue::fromLayout(attr, a.value));
+        }
+        widget->applyAttributes(mAttributes);
+        const auto parent = mOpen.empty() ? OpenElement{} : mOpen.back();
+        mOpen.push_back({attach(parent.widget, parent.name, std::move(widget), mRoot), name});
+        return true;
+    }
+
+    void endElement(string_view name, string_view source) override {
+        if (mDeferred) {
+            mDeferred = false;
+            auto stub = makeWidget<ViewStub>(mArena, mLoader, string(source));
+            stub->setId(std::move(mDeferredId));
+            attach(mOpen.back().widget, mOpen.back().name, std::move(stub), mRoot);
+            return;
+        }
+        BIX_UNUSED(name)
+        mOpen.pop_back();
+    }
+
+private:
+    struct OpenElement {
+        Widget* widget = nullptr;
+        string_view name; // a view of the document, valid during the whole parse
+    };
+
+    const LayoutLoader& mLoader;
+    MonotonicArena* mArena;
+    WidgetPtr mRoot;
+    vector<OpenElement> mOpen;
+    AttributeSet mAttributes;
+    bool mDeferred = false;
+    string mDeferredId;
+
+    bool isDeferred(span<const XmlAttribute> attributes) {
+        bool lazy = false;
+        bool collapsed = false;
+        mDeferredId.clear();
+        for (const auto& a : attributes) {
+            if (a.name == "lazy") { lazy = a.value == "true"; }
+            if (a.name == "visible") { collapsed = a.value == "gone"; }
+            if (a.name == "id") { mDeferredId = a.value; }
+        }
+        return lazy && collapsed;
+    }
+};
+
+LayoutLoader::LayoutLoader() {
+    registerType<Label>(names::ClsNameLabel);
+    registerType<Button>(names::ClsNameButton);
+    registerType<LinearLayout>("LinearLayout");
+}
+
+void LayoutLoader::registerType(string name, Factory factory) {
+    mFactories.insert_or_assign(std::move(name), factory);
+}
+
+LayoutLoader::Factory LayoutLoader::factory(string_view name) const {
+    const auto it = mFactories.find(name);
+    if (it == mFactories.end()) { throw RuntimeError("unknown layout element {}", name); }
+    return it->second;
+}
+
+WidgetPtr LayoutLoader::inflate(const CompiledLayout& layout, MonotonicArena* arena) const {
+    // Factories and attribute ids are resolved once per string instead of once per node.
+    vector<Factory> factories(layout.stringCount(), nullptr);
+    vector<AttrId> ids(layout.stringCount());
+    for (uint32_t i = 0; i < layout.stringCount(); ++i) { ids[i] = AttrId::fromName(layout.string(i)); }
+    vector<Widget*> widgets(layout.nodeCount(), nullptr);
+    AttributeSet attributes;
+    WidgetPtr root;
+
+    for (CompiledLayout::Index i = 0; i < layout.nodeCount(); ++i) {
+        const auto& node = layout.node(i);
+        auto& create = factories[node.type];
+        if (!create) { create = factory(layout.string(node.type)); }
+
+        auto widget = create(arena);
+        attributes.clear();
+        for (const auto& attr : layout.attributes(i)) {
+            const auto text = attr.type == LayoutValueType::String ? layout.string(attr.value) : string_view();
+            attributes.set(ids[attr.name], AttributeValue::fromLayout(attr, text));
+        }
+        widget->applyAttributes(attributes);
+        if (node.parent == CompiledLayout::kNone) {
+            widgets[i] = attach(nullptr, {}, std::move(widget), root);
+        } else {
+            widgets[i] = attach(widgets[node.parent], layout.typeName(node.parent), std::move(widget), root);
+        }
+    }
+    return root;
+}
+
+WidgetPtr LayoutLoader::inflateXml(string_view xml, MonotonicArena* arena) const {
+    XmlInflater inflater(*this, arena);
+    XmlSaxParser(xml).parse(inflater);
+    return inflater.takeRoot();
+}
+} // namespace bix
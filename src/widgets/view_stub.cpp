@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bixlib/widgets/view_stub.h"
+
+#include "bixlib/errors.h"
+#include "bixlib/widgets/container.h"
+#include "bixlib/widgets/layout_loader.h"
+
+namespace bix {
+
+ViewStub::ViewStub(const LayoutLoader& loader, std::string source) : mLoader(&loader), mSource(std::move(source)) {
+    setVisibility(Visibility::Collapsed);
+}
+
+Widget* ViewStub::inflate() {
+    auto* container = dynamic_cast<Container*>(parent());
+    if (!container) { throw LogicError("a ViewStub must be a child of a container"); }
+
+    auto widget = mLoader->inflateXml(mSource, container->arena());
+    widget->setVisibility(visibility());
+    const int index = container->childIndex(this);
+    // The stub is released when this function returns, no member may be used after the removal.
+    const auto self = container->removeChild(this);
+    return container->addChild(std::move(widget), index);
+}
+
+void ViewStub::onMeasure(Canvas& canvas, const Size& available, const Size& max) {
+    BIX_UNUSED(canvas)
+    BIX_UNUSED(available)
+    BIX_UNUSED(max)
+    setMeasuredSize({0, 0});
+}
+
+void ViewStub::onVisibilityChanged(Visibility visibility) {
+    if (visibility != Visibility::Collapsed && parent()) { inflate(); }
+}
+} // namespace bix
@@ -17,13 +17,46 @@
 #include "bixlib/widgets/widget.h"
 
 #include <bixlib/assert.h>
+#include <bixlib/graphics/recording_canvas.h>
+#include <bixlib/utils/arena.h>
 
 #include <algorithm>
 
 namespace bix {
 
+namespace {
+/**
+ * Resolves a length against the size of the parent on the same axis.
+ * Density-independent pixels map 1:1 until widgets know the density of their display, viewport units are taken
+ * relative to the parent as well.
+ * @return The size in pixels, or -1 for auto, infinite and unset lengths.
+ */
+float resolveLength(const Length& length, float relative) noexcept {
+    if (!length.isValid() || length.isAuto() || length.isInfinity()) { return -1.f; }
+    if (length.isStretch()) { return relative; }
+    switch (length.unit()) {
+    case Length::PX:
+        return static_cast<float>(length.fixedValue());
+    case Length::PERCENT:
+    case Length::VW:
+    case Length::VH:
+        return relative * static_cast<float>(length.fixedValue()) / (Length::FLOAT_SCALE * 100.f);
+    default:
+        return static_cast<float>(length.fixedValue()) / Length::FLOAT_SCALE;
+    }
+}
+} // namespace
+
+void WidgetDeleter::operator()(Widget* widget) const noexcept {
+    if (!arena) {
+        delete widget;
+        return;
+    }
+    arena->destroy(widget);
+}
+
 bool Widget::isEnabled() const noexcept {
-    return !mFlags.testFlag(ControlFlag::Disable);
+    return !mFlags.testFlag(WidgetFlag::Disable);
 }
 
 bool Widget::isHovered() const noexcept {
@@ -31,10 +64,10 @@ bool Widget::isHovered() const noexcept {
 }
 
 bool Widget::isClickable() const noexcept {
-    return mFlags.testFlag(ControlFlag::Clickable);
+    return mFlags.testFlag(WidgetFlag::Clickable);
 }
 
-const UIRect& Widget::position() const noexcept {
+const Rect& Widget::position() const noexcept {
     return mPosition;
 }
 
@@ -42,17 +75,34 @@ Border* Widget::border() const noexcept {
     return mBorder.get();
 }
 
-UIPaddings Widget::getPaddingWithForeground() const noexcept {
-    if (mBorder) { return mPadding + mBorder->insets(); }
-    return mPadding;
+
+void Widget::invalidate() {
+    // Always reported, an invalidation raised while painting must reach the next frame. The damage region merges
+    // repeated rects of the same widget.
+    mFlags.on(WidgetFlag::DirtyPaint);
+    invalidateRect(Rect(mMeasuredSize));
 }
 
-void Widget::invalidate() {}
+void Widget::invalidateRect(const Rect& rect) {
+    Rect dirty = rect;
+    if (mEnableBoundsClip) { dirty = dirty.intersected(Rect(mMeasuredSize)); }
+    if (dirty.isEmpty() || !mParent) { return; }
+    mParent->invalidateChild(this, dirty);
+}
+
+Rect Widget::windowBounds() const noexcept {
+    const float* m = mPosTransform.data();
+    return Rect(mMeasuredSize).translated(m[6], m[7]);
+}
 
 void Widget::setParent(ViewParent* parent) {
     mParent = parent;
 }
 
+void Widget::setId(std::string id) {
+    mId = std::move(id);
+}
+
 void Widget::setWidth(Length width) {
     if (mWidth == width) { return; }
 
@@ -68,11 +118,11 @@ void Widget::setHeight(Length height) {
     requestLayout();
 }
 
-void Widget::setMargins(const UIMargins& margin) {
+void Widget::setMargins(const EdgeInsets& margin) {
     mMargin = margin;
 }
 
-void Widget::setPadding(const UIPaddings& padding) {
+void Widget::setPadding(const EdgeInsets& padding) {
     mPadding = padding;
 }
 
@@ -83,35 +133,34 @@ void Widget::setPadding(const UIPaddings& padding) {
 //     mMeasuredSize.height = h.fixed();
 // }
 
-void Widget::setMaximumSize(const UISize& s) {
-    if (mMinSize.width > 0 && mMinSize.width > s.width) {
-        // TODO throw ?
-        return;
-    }
-    if (mMinSize.height > 0 && mMinSize.height > s.height) { return; }
-    mMaxSize = s;
+void Widget::setMaximumSize(Length w, Length h) {
+    // An unset length keeps the current limit of that axis.
+    BoxConstraints constraints = mConstraints;
+    if (w.isValid()) { constraints.maxWidth = w; }
+    if (h.isValid()) { constraints.maxHeight = h; }
+    if (constraints.maxWidth == mConstraints.maxWidth && constraints.maxHeight == mConstraints.maxHeight) { return; }
+
+    mConstraints = constraints;
+    requestLayout();
 }
 
-void Widget::setMinimumSize(const UISize& s) {
-    if (mMaxSize.width > 0 && mMaxSize.width < s.width) { return; }
-    if (mMaxSize.height > 0 && mMaxSize.height < s.height) { return; }
-    mMinSize = s;
+void Widget::setMinimumSize(Length w, Length h) {
+    BoxConstraints constraints = mConstraints;
+    if (w.isValid()) { constraints.minWidth = w; }
+    if (h.isValid()) { constraints.minHeight = h; }
+    if (constraints.minWidth == mConstraints.minWidth && constraints.minHeight == mConstraints.minHeight) { return; }
+
+    mConstraints = constraints;
+    requestLayout();
 }
 
 void Widget::setVisibility(Visibility value) {
     if (mVisibility == value) return;
     mVisibility = value;
 
-    if (value == Visibility::Visible) {
-        mFlags.unset(WidgetFlag::WillNotDraw);
-        markDirtyLayout();
-    } else if (value == Visibility::Invisible) {
-        mFlags.set(WidgetFlag::WillNotDraw);
-        markDirtyLayout();
-    } else if (value == Visibility::Collapsed) {
-        mFlags.set(WidgetFlag::WillNotDraw);
-        markDirtyLayout();
-    }
+    mFlags.setFlag(WidgetFlag::WillNotDraw, value != Visibility::Visible);
+    requestLayout();
+    onVisibilityChanged(value);
 }
 
 void Widget::setOpacity(float value) {
@@ -119,14 +168,17 @@ void Widget::setOpacity(float value) {
 
     if (std::abs(mOpacity - clamped) < 0.0001f) { return; }
 
+    // Like a visibility change, turning fully transparent adds or removes the subtree from the painted nodes.
+    const bool shown = mOpacity > 0.f;
     mOpacity = clamped;
 
     invalidate();
+    if (shown != (mOpacity > 0.f)) { requestLayout(); }
 }
 
 void Widget::setEnable(bool enabled) {
     if (isEnabled() == enabled) { return; }
-    mFlags.setFlag(ControlFlag::Disable, !enabled);
+    mFlags.setFlag(WidgetFlag::Disable, !enabled);
     invalidate();
 }
 
@@ -138,9 +190,11 @@ void Widget::setHovered(bool hovered) {
 
 void Widget::setBorder(BorderPtr border) {
     mBorder = std::move(border);
+    invalidate();
 }
 
 void Widget::setBorderRadius(int radius) {
+    BIX_UNUSED(radius)
     if (!mBorder) {
         // mBorder = std::make_unique<Border>();
     }
@@ -153,7 +207,7 @@ void Widget::setBoundsClip(bool enable) {
 }
 
 void Widget::setClickable(bool clickable) {
-    mFlags.setFlag(ControlFlag::Clickable, clickable);
+    mFlags.setFlag(WidgetFlag::Clickable, clickable);
 }
 
 void Widget::clearFocus() {
@@ -162,14 +216,16 @@ void Widget::clearFocus() {
 
 void Widget::setBackground(const Color& color) {
     mBackground = std::make_unique<ColorDrawable>(color);
+    invalidate();
 }
 
 void Widget::setBackground(DrawablePtr drawable) {
     if (!drawable) {
         mBackground.reset();
-        return;
+    } else {
+        mBackground = std::move(drawable);
     }
-    mBackground = std::move(drawable);
+    invalidate();
 }
 
 void Widget::setBackgroundColor(const std::string& hexColorStr) {
@@ -179,92 +235,140 @@ void Widget::setBackgroundColor(const std::string& hexColorStr) {
 void Widget::discardCanvas() {
     if (mBackground) { mBackground->discardCanvas(); }
     if (mBorder) { mBorder->onDiscardCanvas(); }
+    // Recorded text paints and the replay brush belong to the discarded canvas.
+    mDisplayList = nullptr;
+    invalidate();
 }
 
-void Widget::applyAttributes(const AttributeSet& attrs) {
-    attrs.getString("id", mId);
-    // attrs.getBool("enable", mEnable);
-    // AttributeSet::getEnum<VisibleFlag>("visible", attrs, mVisible, parseToVisibleFlag);
-}
-
-void Widget::layout(const UIRect& pos) {
+void Widget::applyAttributes(const AttributeSet& attributes) {
+    attributes.getString(attrs::Id, mId);
+
+    Length length;
+    if (attributes.getLength(attrs::Width, length)) { setWidth(length); }
+    if (attributes.getLength(attrs::Height, length)) { setHeight(length); }
+    Length minWidth, minHeight, maxWidth, maxHeight;
+    attributes.getLength(attrs::MinWidth, minWidth);
+    attributes.getLength(attrs::MinHeight, minHeight);
+    attributes.getLength(attrs::MaxWidth, maxWidth);
+    attributes.getLength(attrs::MaxHeight, maxHeight);
+    if (minWidth.isValid() || minHeight.isValid()) { setMinimumSize(minWidth, minHeight); }
+    if (maxWidth.isValid() || maxHeight.isValid()) { setMaximumSize(maxWidth, maxHeight); }
+
+    float alpha = 0.f;
+    if (attributes.getFloat(attrs::Alpha, alpha)) { setOpacity(alpha); }
+    bool flag = false;
+    if (attributes.getBool(attrs::Enable, flag)) { setEnable(flag); }
+    if (attributes.getBool(attrs::Clickable, flag)) { setClickable(flag); }
+    if (attributes.getBool(attrs::BoundsClip, flag)) { setBoundsClip(flag); }
+    Visibility visibility = mVisibility;
+    if (attributes.getEnum(attrs::Visible, visibility)) { setVisibility(visibility); }
+    Color background;
+    if (attributes.getColor(attrs::Background, background)) { setBackground(background); }
+}
+
+void Widget::layout(const Rect& pos) {
+    Transform transform = mPosTransform;
     if (mParent) {
-        auto newPT = mParent->mPosTransform;
-        mPosTransform = newPT.translate(static_cast<float>(pos.left()), static_cast<float>(pos.top()));
+        transform = mParent->childTransform();
+        transform.translate(pos.left, pos.top);
     }
+    const float* oldT = mPosTransform.data();
+    const float* newT = transform.data();
+    const bool moved =
+        pos != mPosition || !math::exactlyEqual(oldT[6], newT[6]) || !math::exactlyEqual(oldT[7], newT[7]);
+    // A clean subtree at the same place keeps the positions computed by the previous pass.
+    if (!moved && !mFlags.testFlag(WidgetFlag::DirtyLayout)) { return; }
+
+    mPosTransform = transform;
     mPosition = pos;
+    mFlags.on(WidgetFlag::DirtyNode);
+    if (moved) {
+        // The content may be unchanged, but the pixels at the old place are stale and the new place is unpainted.
+        const Rect bounds = windowBounds();
+        if (mParent && bounds != mLaidOutBounds) {
+            mParent->invalidateWindowRect(mLaidOutBounds);
+            mParent->invalidateWindowRect(bounds);
+        }
+        mLaidOutBounds = bounds;
+    }
+    mFlags.on(WidgetFlag::InLayout);
     onLayout(pos);
+    mFlags.off(WidgetFlag::InLayout);
+    mFlags.off(WidgetFlag::DirtyLayout);
+    if (auto* stats = LayoutPass::current()) { ++stats->laidOut; }
 }
 
-void Widget::setMeasuredSize(const UISize& size) {
+void Widget::setMeasuredSize(const Size& size) {
     if (!size.isValid()) { throw std::invalid_argument("invalid size"); }
+    if (mMeasuredSize == size) { return; }
     mMeasuredSize = size;
+    invalidate();
 }
 
-void Widget::drawBackground(Canvas& canvas) {
-    // shadow bk state
+void Widget::paintBackground(Canvas& canvas) {
     if (!mBackground) { return; }
-    mBackground->setBounds(UIRect(0, 0, mMeasuredSize));
+    mBackground->setBounds(Rect(mMeasuredSize));
     mBackground->draw(&canvas);
 }
 
-void Widget::onDrawForeground(Canvas& canvas) {
-    BIX_UNUSED(&canvas)
-
-    if (mBorder) { mBorder->onDraw(mPosition, canvas); }
+void Widget::paintForeground(Canvas& canvas) {
+    if (mBorder) { mBorder->onDraw(Rect(mMeasuredSize), canvas); }
 }
 
-void Widget::onMeasure(Canvas& canvas, const UISize& available, const UISize& max) {
+void Widget::onMeasure(Canvas& canvas, const Size& available, const Size& max) {
     BIX_UNUSED(canvas)
     BIX_UNUSED(max)
-    if (!mSize.width.isAuto() && !mSize.height.isAuto()) {
-        int w = mSize.width.get(available.width);
-        int h = mSize.height.get(available.height);
-
-        w = std::max(w, mMinSize.width);
-        h = std::max(h, mMinSize.height);
-
-        if (mMaxSize.width > 0) { w = std::min(w, mMaxSize.width); }
-        if (mMaxSize.height > 0) { h = std::min(h, mMaxSize.height); }
-        setMeasuredSize({w, h});
-        return;
-    }
-    setMeasuredSize(available);
+    // Without content of its own a widget takes its fixed size, axes without one fill the available space.
+    Size size = available;
+    if (const float width = resolveLength(mWidth, available.width); width >= 0) { size.width = width; }
+    if (const float height = resolveLength(mHeight, available.height); height >= 0) { size.height = height; }
+    setMeasuredSize(size);
 }
 
 // bool Control::dispatchHoverEvent(const MouseEvent& event) {return false;}
 
-void Widget::paint(Canvas& canvas) {
-    if (mAlpha <= 0 || mMeasuredSize.isEmpty()) { return; }
+void Widget::paint(Canvas& canvas, const DamageRegion* damage) {
+    if (mOpacity <= 0.f) { return; }
+    const bool hit = !mMeasuredSize.isEmpty() && (!damage || damage->intersects(windowBounds()));
+    // Children of a container without bounds clipping may overflow it, missing its bounds only skips its own content.
+    if (!hit && (mEnableBoundsClip || !isContainer())) { return; }
 
-    canvas.setTransform(mPosTransform);
-
-    bool hasClip = false;
-    if (mParent && mEnableBoundsClip) {
-        if (mBorder) {
-            hasClip = canvas.pushClip(mBorder->makeRect({0, 0, mMeasuredSize}));
-        } else {
-        }
-    }
+    const bool hasClip = mParent && mEnableBoundsClip && pushBoundsClip(canvas);
+    if (hit) { paintContent(canvas); }
 
-    drawBackground(canvas);
+    if (isContainer()) { dispatchPaint(canvas, damage); }
 
-    onPaint(canvas);
-
-    onDrawForeground(canvas);
+    if (hasClip) { canvas.popClip(); }
+}
 
-    if (isContainer()) { dispatchPaint(canvas); }
+void Widget::paintContent(Canvas& canvas) {
+    canvas.setTransform(mPosTransform);
+    if (!mDisplayList || mFlags.testFlag(WidgetFlag::DirtyPaint)) {
+        if (!mDisplayList) { mDisplayList = std::make_unique<DisplayList>(); }
+        // Cleared first, so that an invalidate() from onPaint() records the widget again on the next frame.
+        mFlags.off(WidgetFlag::DirtyPaint);
+        RecordingCanvas recorder(*mDisplayList, canvas);
+        paintBackground(recorder);
+        onPaint(recorder);
+        paintForeground(recorder);
+    }
+    mDisplayList->replay(canvas, mPosTransform);
+}
 
-    if (hasClip) { canvas.popClip(); }
+bool Widget::pushBoundsClip(Canvas& canvas) const {
+    canvas.setTransform(mPosTransform);
+    const Rect bounds(mMeasuredSize);
+    return canvas.pushClip(mBorder ? mBorder->makeRect(bounds) : RoundRect(bounds, 0));
 }
 
 void Widget::requestLayout() {
 
     BIX_ASSERT(!mFlags.testFlag(WidgetFlag::InLayout), "Recursive requestLayout() called during layout!");
 
-    mFlags.on(WidgetFlag::DirtyLayout);
+    mMeasureCache.invalidate();
+    mFlags.on(WidgetFlag::DirtyLayout | WidgetFlag::DirtyNode);
 
-    // mFlags.set(ControlFlag::ForceLayout);
+    // mFlags.set(WidgetFlag::ForceLayout);
 
     if (mParent) { mParent->requestLayoutFromChild(this); }
 }
@@ -290,7 +394,7 @@ void Widget::handleMouseEvent(const MouseEvent& event) {
 
 bool Widget::dispatchMouseMoveEvent(const MouseEvent& event) {
 
-    auto hit = position().contains(event.position());
+    auto hit = position().contains(Point(event.position()));
     if (!hit) {
         setHovered(false);
         return false;
@@ -314,18 +418,40 @@ bool Widget::onMouseHover(const MouseEvent& event) {
     return false;
 }
 
-void Widget::measure(Canvas& canvas, const UISize& available, const UISize& max) {
-
-    if (max.width == 0 && max.height == 0) {
-        setMeasuredSize({0, 0});
+void Widget::measure(Canvas& canvas, const Size& available, const Size& max) {
+    LayoutStats* stats = LayoutPass::current();
+    // On a hit the measured size still holds the cached result.
+    if (mMeasureCache.find(available, max)) {
+        if (stats) { ++stats->cached; }
         return;
     }
 
-    UISize limit = max;
-
-    if (max.width < 0) { limit.width = mMaxSize.width; }
-    if (max.height < 0) { limit.height = mMaxSize.height; }
-    onMeasure(canvas, available, limit);
+    if (math::exactlyEqual(max.width, 0.f) && math::exactlyEqual(max.height, 0.f)) {
+        setMeasuredSize({0, 0});
+    } else {
+        const float minWidth = std::max(resolveLength(mConstraints.minWidth, available.width), 0.f);
+        const float minHeight = std::max(resolveLength(mConstraints.minHeight, available.height), 0.f);
+        const float maxWidth = resolveLength(mConstraints.maxWidth, available.width);
+        const float maxHeight = resolveLength(mConstraints.maxHeight, available.height);
+        // The own maximum tightens the limit of the parent, so that content is measured within it.
+        Size limit = max;
+        if (maxWidth >= 0 && (limit.width < 0 || maxWidth < limit.width)) { limit.width = maxWidth; }
+        if (maxHeight >= 0 && (limit.height < 0 || maxHeight < limit.height)) { limit.height = maxHeight; }
+
+        mFlags.on(WidgetFlag::InMeasure);
+        onMeasure(canvas, available, limit);
+        mFlags.off(WidgetFlag::InMeasure);
+        if (stats) { ++stats->measured; }
+
+        // Like CSS, the minimum wins over the maximum.
+        Size size = mMeasuredSize;
+        if (maxWidth >= 0) { size.width = std::min(size.width, maxWidth); }
+        if (maxHeight >= 0) { size.height = std::min(size.height, maxHeight); }
+        size.width = std::max(size.width, minWidth);
+        size.height = std::max(size.height, minHeight);
+        setMeasuredSize(size);
+    }
+    mMeasureCache.store(available, max, mMeasuredSize);
 }
 
 } // namespace bix
@@ -0,0 +1,79 @@
+
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "window/backends/win32/win32_window.h"
+
+#include <chrono>
+#include <utility>
+
+namespace bix::win32 {
+
+namespace {
+constexpr UINT_PTR kFrameTimer = 1;
+// Posted for a frame that is already due, it is handled before any timer.
+constexpr UINT kFrameMessage = WM_APP + 1;
+} // namespace
+
+void Win32Window::requestFrame(FrameClock::TimePoint time) {
+    if (!mHwnd) { return; }
+    const auto delay = std::chrono::ceil<std::chrono::milliseconds>(time - FrameClock::steady().now());
+    if (delay.count() <= 0) {
+        KillTimer(mHwnd, kFrameTimer);
+        if (!mFramePosted) { mFramePosted = PostMessageW(mHwnd, kFrameMessage, 0, 0) != 0; }
+        return;
+    }
+    // Setting the timer again replaces its due time, so repeated requests are merged into one frame.
+    SetTimer(mHwnd, kFrameTimer, static_cast<UINT>(delay.count()), nullptr);
+}
+
+LRESULT CALLBACK Win32Window::WndProc(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp) {
+    // createNative() passes the window as the creation parameter.
+    if (msg == WM_NCCREATE) {
+        const auto* cs = reinterpret_cast<const CREATESTRUCTW*>(lp);
+        SetWindowLongPtrW(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(cs->lpCreateParams));
+    }
+    auto* window = reinterpret_cast<Win32Window*>(GetWindowLongPtrW(hwnd, GWLP_USERDATA));
+    if (!window) { return DefWindowProcW(hwnd, msg, wp, lp); }
+    window->mHwnd = hwnd;
+    return window->handleMessage(msg, wp, lp);
+}
+
+LRESULT Win32Window::handleMessage(UINT msg, WPARAM wp, LPARAM lp) {
+    switch (msg) {
+    case WM_TIMER:
+        if (wp != kFrameTimer) { break; }
+        // The timer repeats, the host requests the next frame itself if there is more to do.
+        KillTimer(mHwnd, kFrameTimer);
+        mHost->onFrame();
+        return 0;
+    case kFrameMessage:
+        mFramePosted = false;
+        mHost->onFrame();
+        return 0;
+    case WM_NCDESTROY: {
+        // The last message of the window, frames requested later are dropped by requestFrame().
+        HWND hwnd = std::exchange(mHwnd, nullptr);
+        KillTimer(hwnd, kFrameTimer);
+        SetWindowLongPtrW(hwnd, GWLP_USERDATA, 0);
+        mFramePosted = false;
+        return DefWindowProcW(hwnd, msg, wp, lp);
+    }
+    default:
+        break;
+    }
+    return DefWindowProcW(mHwnd, msg, wp, lp);
+}
+} // namespace bix::win32
@@ -30,6 +30,7 @@ public:
     void destroyNative() override;
     bool queryNativeInfo(NativeWindowInfo& info) const override;
     void setTitle(std::string_view title) override;
+    void requestFrame(FrameClock::TimePoint time) override;
     ScreenPtr getScreen() const override;
 
 protected:
@@ -39,6 +40,7 @@ private:
     Host* mHost;
     // WindowCreateParams mParams{};
     HWND mHwnd = nullptr;
+    bool mFramePosted = false; // a frame message is queued, further due requests are merged into it
 
     static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wp, LPARAM lp);
 
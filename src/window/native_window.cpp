@@ -33,6 +33,8 @@ public:
     bool queryNativeInfo(NativeWindowInfo& info) const override { BIX_UNUSED(info) return false; }
 
     void setTitle(std::string_view) override {}
+
+    void requestFrame(FrameClock::TimePoint) override {}
 };
 } // namespace
 
@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <bixlib/core/frame_scheduler.h>
 #include <bixlib/window/screen.h>
 
 #include <memory>
@@ -46,6 +47,9 @@ public:
     class Host {
     public:
         virtual ~Host() = default;
+
+        /** Called by the platform loop for a frame requested with requestFrame() and for system repaints. */
+        virtual void onFrame() = 0;
     };
 
     virtual ~NativeWindow() = default;
@@ -60,6 +64,11 @@ public:
     virtual bool queryNativeInfo(NativeWindowInfo& info) const = 0;
 
     virtual void setTitle(std::string_view title) = 0;
+    /**
+     * Asks the platform loop to call Host::onFrame() once \a time is reached, e.g. by posting a message or
+     * arming a timer. Repeated requests before the frame runs are merged.
+     */
+    virtual void requestFrame(FrameClock::TimePoint time) = 0;
     // virtual void setVisible(bool visible) = 0;
     //
     // virtual void invalidateRect(const UIRect& rect) = 0;
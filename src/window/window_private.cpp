@@ -17,6 +17,7 @@
 #include "window/window_private.h"
 
 #include <bixlib/geometry/rect.h>
+#include <bixlib/graphics/engine.h>
 
 using namespace std;
 
@@ -24,6 +25,49 @@ namespace bix {
 
 WindowPrivate::WindowPrivate(Window* w) : mPublic(w) {
     mNative = NativeWindow::create(this);
+    if (auto s = screen()) { mScheduler.setRefreshRate(s->refreshRate()); }
+    mScheduler.setLayoutCallback([this] { performLayout(); });
+    mScheduler.setPaintCallback([this] { performPaint(); });
+    mScheduler.setWakeupCallback([this](FrameScheduler::TimePoint time) { mNative->requestFrame(time); });
+}
+
+void WindowPrivate::onFrame() {
+    // Woken before the deadline, e.g. by a system repaint, the frame still runs on the refresh grid.
+    if (!mScheduler.tick() && mScheduler.hasPendingFrame()) { mNative->requestFrame(mScheduler.nextFrameTime()); }
+}
+
+void WindowPrivate::performLayout() {
+    Canvas* c = canvas();
+    if (!c) { return; }
+    mScene.resize(c->size());
+    mScene.performLayout(*c);
+}
+
+void WindowPrivate::performPaint() {
+    Canvas* c = canvas();
+    if (!c || mScene.damage().isEmpty()) { return; }
+    c->beginDraw();
+    mScene.paint(*c);
+    c->endDraw();
+}
+
+Canvas* WindowPrivate::canvas() {
+    if (mCanvas) { return mCanvas.get(); }
+    for (const auto type : {RenderEngine::Direct2D, RenderEngine::Software}) {
+        if (auto* engine = RenderEngine::from(type)) { mCanvas = engine->createCanvas(*mPublic); }
+        if (mCanvas) { break; }
+    }
+    return mCanvas.get();
+}
+
+void WindowPrivate::scheduleFrame(const Rect& dirtyRect) {
+    // The damage itself is tracked by the scene, the scheduler only needs to know a paint is pending.
+    BIX_UNUSED(dirtyRect)
+    mScheduler.requestPaint();
+}
+
+void WindowPrivate::requestLayout() {
+    mScheduler.requestLayout();
 }
 
 // void WindowPrivate::createWindow() {}
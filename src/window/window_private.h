@@ -18,7 +18,10 @@
 
 #include "window/native_window.h"
 
+#include <bixlib/core/frame_scheduler.h>
+#include <bixlib/core/scene.h>
 #include <bixlib/core/widget_host.h>
+#include <bixlib/graphics/canvas.h>
 #include <bixlib/window/window.h>
 
 namespace bix {
@@ -68,10 +71,28 @@ public:
     [[nodiscard]]
     ScreenPtr screen() const;
 
+    /** Runs the pending frame of the scheduler, or asks the platform loop to come back at its deadline. */
+    void onFrame() override;
+
+    /**
+     * Returns the scheduler that coalesces layout and paint requests of this window into frames.
+     * It wakes the platform loop with NativeWindow::requestFrame(), which calls back onFrame().
+     */
+    FrameScheduler& frameScheduler() noexcept { return mScheduler; }
+
+    /** Returns the widget tree shown in this window. */
+    Scene& scene() noexcept { return mScene; }
+
 private:
-    // ScenePtr mScene;
+    void performLayout();
+    void performPaint();
+    // Creates the window canvas on first use, null while no render engine can draw into the window.
+    Canvas* canvas();
 
     NativeWindowPtr mNative = nullptr;
+    FrameScheduler mScheduler;
+    Scene mScene{this};
+    CanvasPtr mCanvas = nullptr;
     Window* mPublic = nullptr;
 
     std::string mID{};
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#ifdef HAS_MEMORY_SNIFFER
+#include "memory_sniffer.h"
+
+/**
+ * Runs a statement and fails the test if it made more than a given number of heap allocations.
+ *
+ * Without ENABLE_MEMORY_SNIFFER the statement only runs.
+ */
+#define BIX_EXPECT_ALLOCATIONS_LE(budget, statement)                                                               \
+    do {                                                                                                           \
+        size_t bixAllocations_ = 0;                                                                                \
+        {                                                                                                          \
+            ::bix::test::AllocationScope bixScope_;                                                                \
+            statement;                                                                                             \
+            bixAllocations_ = bixScope_.allocations();                                                             \
+        }                                                                                                          \
+        EXPECT_LE(bixAllocations_, static_cast<size_t>(budget)) << "allocation budget exceeded by: " #statement; \
+    } while (false)
+#else
+#define BIX_EXPECT_ALLOCATIONS_LE(budget, statement) \
+    do {                                             \
+        statement;                                   \
+    } while (false)
+#endif
+
+/** Fails the test if the statement allocates at all, for hot paths that must stay allocation free. */
+#define BIX_EXPECT_NO_ALLOCATIONS(statement) BIX_EXPECT_ALLOCATIONS_LE(0, statement)
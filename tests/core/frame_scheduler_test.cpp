@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/frame_scheduler.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace bix;
+using namespace std::chrono_literals;
+
+namespace {
+class FakeClock : public FrameClock {
+public:
+    TimePoint now() const noexcept override { return mNow; }
+
+    void advance(Duration d) noexcept { mNow += d; }
+
+private:
+    TimePoint mNow{};
+};
+} // namespace
+
+TEST(FrameSchedulerTest, CoalescesRequestsIntoOneFrame) {
+    FakeClock clock;
+    FrameScheduler scheduler(clock, 50);
+    EXPECT_EQ(scheduler.frameInterval(), 20ms);
+
+    int layouts = 0;
+    int paints = 0;
+    std::vector<FrameClock::TimePoint> wakeups;
+    scheduler.setLayoutCallback([&] { ++layouts; });
+    scheduler.setPaintCallback([&] { ++paints; });
+    scheduler.setWakeupCallback([&](FrameClock::TimePoint t) { wakeups.push_back(t); });
+
+    EXPECT_FALSE(scheduler.tick());
+    scheduler.requestPaint();
+    scheduler.requestLayout();
+    scheduler.requestPaint();
+    EXPECT_EQ(wakeups.size(), 1u);
+    EXPECT_TRUE(scheduler.pendingPhases().testFlags(FramePhase::Layout | FramePhase::Paint));
+
+    EXPECT_TRUE(scheduler.tick());
+    EXPECT_EQ(layouts, 1);
+    EXPECT_EQ(paints, 1);
+    EXPECT_FALSE(scheduler.hasPendingFrame());
+    EXPECT_FALSE(scheduler.tick());
+    EXPECT_EQ(scheduler.frameCount(), 1u);
+}
+
+TEST(FrameSchedulerTest, PacesToRefreshInterval) {
+    FakeClock clock;
+    FrameScheduler scheduler(clock, 50);
+    int paints = 0;
+    scheduler.setPaintCallback([&] { ++paints; });
+
+    scheduler.requestPaint();
+    EXPECT_TRUE(scheduler.tick());
+
+    // Bursty updates within one interval produce a single frame at the next deadline.
+    for (int i = 0; i < 5; ++i) {
+        clock.advance(3ms);
+        scheduler.requestPaint();
+        EXPECT_FALSE(scheduler.tick());
+    }
+    EXPECT_EQ(scheduler.nextFrameTime(), FrameClock::TimePoint{} + 20ms);
+    clock.advance(5ms);
+    EXPECT_TRUE(scheduler.tick());
+    EXPECT_EQ(paints, 2);
+
+    // A late frame re-aligns the schedule instead of catching up.
+    clock.advance(100ms);
+    scheduler.requestPaint();
+    EXPECT_TRUE(scheduler.tick());
+    EXPECT_EQ(scheduler.nextFrameTime(), clock.now() + 20ms);
+}
+
+TEST(FrameSchedulerTest, MeasuresPhaseTimings) {
+    FakeClock clock;
+    FrameScheduler scheduler(clock, 0);
+    EXPECT_EQ(scheduler.refreshRate(), FrameScheduler::kDefaultRefreshRate);
+
+    scheduler.setLayoutCallback([&] { clock.advance(3ms); });
+    scheduler.setPaintCallback([&] {
+        clock.advance(5ms);
+        // Requests made during the frame are deferred to the next one.
+        scheduler.requestPaint();
+    });
+
+    scheduler.requestLayout();
+    ASSERT_TRUE(scheduler.tick());
+    const auto& timings = scheduler.lastTimings();
+    EXPECT_EQ(timings.layout, 3ms);
+    EXPECT_EQ(timings.paint, 5ms);
+    EXPECT_EQ(timings.total, 8ms);
+    EXPECT_EQ(timings.frame, 1u);
+    EXPECT_TRUE(scheduler.hasPendingFrame());
+    EXPECT_EQ(scheduler.pendingPhases(), FramePhases(FramePhase::Paint));
+}
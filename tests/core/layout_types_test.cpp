@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/layout_types.h>
+
+#include <gtest/gtest.h>
+
+using namespace bix;
+
+TEST(MeasureCacheTest, EmptyCacheMisses) {
+    const MeasureCache cache;
+    EXPECT_EQ(cache.find({100, 50}, {-1, -1}), nullptr);
+}
+
+TEST(MeasureCacheTest, HitsForTheStoredConstraints) {
+    MeasureCache cache;
+    cache.store({100, 50}, {-1, -1}, {30, 20});
+
+    const Size* size = cache.find({100, 50}, {-1, -1});
+    ASSERT_NE(size, nullptr);
+    EXPECT_EQ(*size, Size(30, 20));
+}
+
+TEST(MeasureCacheTest, MissesForOtherConstraints) {
+    MeasureCache cache;
+    cache.store({100, 50}, {-1, -1}, {30, 20});
+
+    EXPECT_EQ(cache.find({120, 50}, {-1, -1}), nullptr);
+    EXPECT_EQ(cache.find({100, 50}, {80, -1}), nullptr);
+}
+
+TEST(MeasureCacheTest, StoreReplacesThePreviousEntry) {
+    MeasureCache cache;
+    cache.store({100, 50}, {-1, -1}, {30, 20});
+    cache.store({120, 50}, {-1, -1}, {40, 20});
+
+    EXPECT_EQ(cache.find({100, 50}, {-1, -1}), nullptr);
+    ASSERT_NE(cache.find({120, 50}, {-1, -1}), nullptr);
+    EXPECT_EQ(*cache.find({120, 50}, {-1, -1}), Size(40, 20));
+}
+
+TEST(MeasureCacheTest, InvalidateForcesAMiss) {
+    MeasureCache cache;
+    cache.store({100, 50}, {-1, -1}, {30, 20});
+    cache.invalidate();
+
+    EXPECT_EQ(cache.find({100, 50}, {-1, -1}), nullptr);
+}
+
+TEST(LayoutPassTest, NoStatsOutsideOfAPass) {
+    EXPECT_EQ(LayoutPass::current(), nullptr);
+}
+
+TEST(LayoutPassTest, InstallsStatsForItsScope) {
+    LayoutStats stats;
+    {
+        LayoutPass pass(stats);
+        EXPECT_EQ(LayoutPass::current(), &stats);
+        ++LayoutPass::current()->measured;
+    }
+    EXPECT_EQ(LayoutPass::current(), nullptr);
+    EXPECT_EQ(stats.measured, 1);
+}
+
+TEST(LayoutPassTest, NestedPassRestoresTheOuterStats) {
+    LayoutStats outer;
+    LayoutStats inner;
+    LayoutPass outerPass(outer);
+    {
+        LayoutPass innerPass(inner);
+        EXPECT_EQ(LayoutPass::current(), &inner);
+    }
+    EXPECT_EQ(LayoutPass::current(), &outer);
+}
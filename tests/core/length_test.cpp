@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/length.h>
+
+#include <gtest/gtest.h>
+
+#include "alloc_budget.h"
+
+using namespace bix;
+
+TEST(LengthTest, Parse) {
+    Length l = Length::parse("12.5dp");
+    EXPECT_TRUE(l == Length::dp(12.5f));
+    l = Length::parse("16");
+    EXPECT_TRUE(l == Length::dp(16));
+    l = Length::parse("100px");
+    EXPECT_TRUE(l == Length::px(100));
+    l = Length::parse("50.5%");
+    EXPECT_TRUE(l == Length::percent(50.5f));
+    EXPECT_TRUE(Length::parse("auto").isAuto());
+    EXPECT_TRUE(Length::parse("AUTO").isAuto());
+    EXPECT_FALSE(Length::parse("Auto").isAuto());
+    l = Length::parse("invalid");
+    EXPECT_TRUE(l == Length::px(0));
+}
+
+TEST(LengthTest, ParseDoesNotAllocate) {
+    // Parsing runs for every size attribute of every inflated widget.
+    Length l;
+    BIX_EXPECT_NO_ALLOCATIONS(l = Length::parse("12.5dp"));
+    BIX_EXPECT_NO_ALLOCATIONS(l = Length::parse("stretch"));
+    BIX_EXPECT_NO_ALLOCATIONS(l = Length::parse("not a length at all, long enough to defeat small buffers"));
+    EXPECT_TRUE(l == Length::px(0));
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/node_store.h>
+#include <bixlib/graphics/damage_region.h>
+
+#include <gtest/gtest.h>
+
+using namespace bix;
+
+namespace {
+constexpr NodeFlags kShown = NodeFlag::Visible | NodeFlag::Enabled;
+
+//  0 root (0,0 200x200, clips)
+//  +- 1 panel (10,10 100x100, clips)
+//  |  +- 2 item (90,0 50x20)     partially outside of the panel
+//  |  +- 3 item (0,50 20x20)
+//  +- 4 overlay (0,0 50x50)
+//     +- 5 hidden (0,0 10x10)
+//        +- 6 child of hidden
+NodeStore makeTree() {
+    NodeStore store;
+    const auto root = store.append(nullptr, NodeStore::kNone, {0, 0}, {200, 200}, kShown | NodeFlag::BoundsClip);
+    const auto panel = store.append(nullptr, root, {10, 10}, {100, 100}, kShown | NodeFlag::BoundsClip);
+    store.append(nullptr, panel, {90, 0}, {50, 20}, kShown);
+    store.append(nullptr, panel, {0, 50}, {20, 20}, kShown);
+    const auto overlay = store.append(nullptr, root, {0, 0}, {50, 50}, kShown);
+    const auto hidden = store.append(nullptr, overlay, {0, 0}, {10, 10}, NodeFlag::Enabled);
+    store.append(nullptr, hidden, {0, 0}, {5, 5}, kShown);
+    store.updateBounds();
+    return store;
+}
+} // namespace
+
+TEST(NodeStoreTest, PreOrderLinks) {
+    const auto store = makeTree();
+    ASSERT_EQ(store.size(), 7u);
+    EXPECT_EQ(store.parent(0), NodeStore::kNone);
+    EXPECT_EQ(store.firstChild(0), 1u);
+    EXPECT_EQ(store.nextSibling(1), 4u);
+    EXPECT_EQ(store.nextSibling(4), NodeStore::kNone);
+    EXPECT_EQ(store.firstChild(1), 2u);
+    EXPECT_EQ(store.nextSibling(2), 3u);
+    EXPECT_EQ(store.parent(3), 1u);
+    EXPECT_EQ(store.firstChild(3), NodeStore::kNone);
+
+    EXPECT_EQ(store.subtreeEnd(0), 7u);
+    EXPECT_EQ(store.subtreeEnd(1), 4u);
+    EXPECT_EQ(store.subtreeEnd(2), 3u);
+    EXPECT_EQ(store.subtreeEnd(4), 7u);
+}
+
+TEST(NodeStoreTest, Bounds) {
+    const auto store = makeTree();
+    EXPECT_EQ(store.bounds(2), Rect(100, 10, 150, 30));
+    EXPECT_EQ(store.clippedBounds(2), Rect(100, 10, 110, 30));
+    EXPECT_EQ(store.bounds(3), Rect(10, 60, 30, 80));
+    EXPECT_EQ(store.clippedBounds(3), store.bounds(3));
+
+    // Hidden nodes and their descendants have no visible area.
+    EXPECT_TRUE(store.clippedBounds(5).isEmpty());
+    EXPECT_TRUE(store.clippedBounds(6).isEmpty());
+}
+
+TEST(NodeStoreTest, HitTest) {
+    const auto store = makeTree();
+    EXPECT_EQ(store.hitTest({105, 15}), 2u);
+    // The part of the item outside of the clipping panel is not hit, the root is.
+    EXPECT_EQ(store.hitTest({120, 15}), 0u);
+    EXPECT_EQ(store.hitTest({15, 65}), 3u);
+    // The overlay is painted after the panel and wins, the hidden child is skipped.
+    EXPECT_EQ(store.hitTest({12, 12}), 4u);
+    EXPECT_EQ(store.hitTest({2, 2}), 4u);
+    EXPECT_EQ(store.hitTest({300, 300}), NodeStore::kNone);
+}
+
+TEST(NodeStoreTest, Cull) {
+    const auto store = makeTree();
+    DamageRegion damage;
+    std::vector<NodeStore::Index> visible;
+
+    store.cull(damage, visible);
+    EXPECT_TRUE(visible.empty());
+
+    damage.add({150, 150, 160, 160});
+    store.cull(damage, visible);
+    EXPECT_EQ(visible, std::vector<NodeStore::Index>({0}));
+
+    damage.clear();
+    damage.add({12, 62, 14, 64});
+    store.cull(damage, visible);
+    EXPECT_EQ(visible, std::vector<NodeStore::Index>({0, 1, 3}));
+
+    damage.clear();
+    damage.add({0, 0, 200, 200});
+    store.cull(damage, visible);
+    EXPECT_EQ(visible, std::vector<NodeStore::Index>({0, 1, 2, 3, 4}));
+}
+
+TEST(NodeStoreTest, CullSkipsTransparentSubtrees) {
+    auto store = makeTree();
+    store.update(1, {10, 10}, {100, 100}, kShown | NodeFlag::BoundsClip | NodeFlag::Transparent);
+    DamageRegion damage;
+    damage.add({0, 0, 200, 200});
+    std::vector<NodeStore::Index> visible;
+    store.cull(damage, visible);
+    EXPECT_EQ(visible, std::vector<NodeStore::Index>({0, 4}));
+}
+
+TEST(NodeStoreTest, UpdateReportsChanges) {
+    auto store = makeTree();
+    EXPECT_FALSE(store.update(2, {90, 0}, {50, 20}, kShown));
+    EXPECT_TRUE(store.update(2, {80, 0}, {50, 20}, kShown));
+    EXPECT_TRUE(store.update(2, {80, 0}, {40, 20}, kShown));
+    EXPECT_TRUE(store.update(2, {80, 0}, {40, 20}, NodeFlag::Enabled));
+    EXPECT_EQ(store.offset(2), Point(80, 0));
+    EXPECT_EQ(store.measuredSize(2), Size(40, 20));
+    EXPECT_EQ(store.flags(2), NodeFlags(NodeFlag::Enabled));
+    // The links are kept.
+    EXPECT_EQ(store.parent(2), 1u);
+    EXPECT_EQ(store.nextSibling(2), 3u);
+}
+
+TEST(NodeStoreTest, UpdateBoundsOfASubtree) {
+    auto store = makeTree();
+    store.update(1, {30, 30}, {100, 100}, kShown | NodeFlag::BoundsClip);
+    store.update(4, {5, 5}, {50, 50}, kShown);
+    store.updateBounds(1, store.subtreeEnd(1));
+
+    EXPECT_EQ(store.bounds(1), Rect(30, 30, 130, 130));
+    EXPECT_EQ(store.bounds(2), Rect(120, 30, 170, 50));
+    EXPECT_EQ(store.clippedBounds(2), Rect(120, 30, 130, 50));
+    EXPECT_EQ(store.bounds(3), Rect(30, 80, 50, 100));
+    // Nodes outside of the range keep their bounds until they are updated.
+    EXPECT_EQ(store.bounds(4), Rect(0, 0, 50, 50));
+    store.updateBounds(4, store.subtreeEnd(4));
+    EXPECT_EQ(store.bounds(4), Rect(5, 5, 55, 55));
+    EXPECT_TRUE(store.clippedBounds(5).isEmpty());
+}
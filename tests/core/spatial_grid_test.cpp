@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/spatial_grid.h>
+
+#include <gtest/gtest.h>
+
+using namespace bix;
+
+TEST(SpatialGridTest, PointQueries) {
+    SpatialGrid grid(32.f);
+    grid.reset({0, 0, 256, 256});
+    grid.update(0, {0, 0, 256, 256});
+    grid.update(1, {20, 20, 80, 80});
+    grid.update(2, {60, 60, 100, 100});
+
+    EXPECT_EQ(grid.hitTest({10, 10}), 0u);
+    EXPECT_EQ(grid.hitTest({30, 30}), 1u);
+    // Overlapping items resolve to the highest id, the one painted last.
+    EXPECT_EQ(grid.hitTest({70, 70}), 2u);
+    EXPECT_EQ(grid.hitTest({90, 90}), 2u);
+    EXPECT_EQ(grid.hitTest({300, 10}), SpatialGrid::kNone);
+
+    // Items reaching beyond the area are kept in the border cells.
+    grid.update(3, {240, 240, 400, 400});
+    EXPECT_EQ(grid.hitTest({350, 350}), 3u);
+}
+
+TEST(SpatialGridTest, IncrementalUpdates) {
+    SpatialGrid grid(32.f);
+    grid.reset({0, 0, 256, 256});
+    grid.update(0, {0, 0, 40, 40});
+    grid.update(1, {100, 100, 140, 140});
+
+    grid.update(0, {200, 0, 240, 40});
+    EXPECT_EQ(grid.hitTest({10, 10}), SpatialGrid::kNone);
+    EXPECT_EQ(grid.hitTest({210, 10}), 0u);
+
+    grid.remove(1);
+    EXPECT_EQ(grid.hitTest({120, 120}), SpatialGrid::kNone);
+    EXPECT_TRUE(grid.rectOf(1).isEmpty());
+
+    grid.update(5, {0, 0, 10, 10});
+    EXPECT_EQ(grid.idCount(), 6u);
+    grid.truncate(1);
+    EXPECT_EQ(grid.idCount(), 1u);
+    EXPECT_EQ(grid.hitTest({5, 5}), SpatialGrid::kNone);
+    EXPECT_EQ(grid.hitTest({210, 10}), 0u);
+}
+
+TEST(SpatialGridTest, RectQueries) {
+    SpatialGrid grid(16.f);
+    grid.reset({0, 0, 100, 100});
+    // A 10x10 grid view of 10px cells.
+    for (SpatialGrid::Id i = 0; i < 100; ++i) {
+        const auto x = static_cast<float>(i % 10) * 10.f;
+        const auto y = static_cast<float>(i / 10) * 10.f;
+        grid.update(i, {x, y, x + 10, y + 10});
+    }
+
+    std::vector<SpatialGrid::Id> ids;
+    grid.query({15, 15, 25, 25}, ids);
+    EXPECT_EQ(ids, std::vector<SpatialGrid::Id>({11, 12, 21, 22}));
+
+    grid.query({0, 0, 100, 100}, ids);
+    EXPECT_EQ(ids.size(), 100u);
+    EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+
+    grid.query({}, ids);
+    EXPECT_TRUE(ids.empty());
+}
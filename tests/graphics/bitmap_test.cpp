@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/colors.h>
+#include <bixlib/graphics/image_cache.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace bix;
+
+namespace {
+void setPixel(Bitmap& bitmap, int x, int y, uint32_t value) {
+    std::memcpy(bitmap.row(y) + static_cast<size_t>(x) * 4, &value, sizeof(value));
+}
+
+// A checkerboard of opaque black and white pixels.
+Bitmap checkerboard(int size) {
+    Bitmap bitmap({size, size});
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) { setPixel(bitmap, x, y, (x + y) % 2 == 0 ? 0xFF000000u : 0xFFFFFFFFu); }
+    }
+    return bitmap;
+}
+} // namespace
+
+TEST(BitmapTest, OwnedAndBorrowed) {
+    Bitmap empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(empty.id(), 0u);
+    EXPECT_TRUE(Bitmap({0, 4}).isEmpty());
+
+    Bitmap owned({3, 2});
+    EXPECT_FALSE(owned.isEmpty());
+    EXPECT_FALSE(owned.isBorrowed());
+    EXPECT_EQ(owned.stride(), 12u);
+    EXPECT_EQ(owned.byteSize(), 24u);
+    EXPECT_EQ(owned.pixel(2, 1), 0u);
+
+    // Copies share the pixels, copy() does not.
+    Bitmap shared = owned;
+    setPixel(owned, 1, 1, 0xFF0000FFu);
+    EXPECT_EQ(shared.colorAt(1, 1), colors::Red);
+    EXPECT_EQ(shared.id(), owned.id());
+    Bitmap deep = owned.copy();
+    EXPECT_NE(deep.id(), owned.id());
+    setPixel(owned, 1, 1, 0);
+    EXPECT_EQ(deep.colorAt(1, 1), colors::Red);
+
+    uint8_t buffer[2 * 16]{};
+    EXPECT_TRUE(Bitmap::wrap(buffer, {2, 2}, 4, PixelFormat::RGBA8).isEmpty());
+    Bitmap borrowed = Bitmap::wrap(buffer, {2, 2}, 16, PixelFormat::RGBA8);
+    ASSERT_FALSE(borrowed.isEmpty());
+    EXPECT_TRUE(borrowed.isBorrowed());
+    EXPECT_EQ(borrowed.row(1), buffer + 16);
+
+    const uint64_t id = borrowed.id();
+    borrowed.notifyPixelsChanged();
+    EXPECT_NE(borrowed.id(), id);
+}
+
+TEST(BitmapTest, PixelFormats) {
+    // Half transparent red in every format.
+    uint8_t straight[4]{255, 0, 0, 128};
+    uint8_t premultiplied[4]{128, 0, 0, 128};
+    uint8_t bgra[4]{0, 0, 128, 128};
+    auto read = [](uint8_t* bytes, PixelFormat format) { return Bitmap::wrap(bytes, {1, 1}, 4, format).pixel(0, 0); };
+    EXPECT_EQ(read(straight, PixelFormat::RGBA8), 0x80000080u);
+    EXPECT_EQ(read(premultiplied, PixelFormat::RGBA8Premultiplied), 0x80000080u);
+    EXPECT_EQ(read(bgra, PixelFormat::BGRA8Premultiplied), 0x80000080u);
+
+    Bitmap source = Bitmap::wrap(straight, {1, 1}, 4, PixelFormat::RGBA8);
+    EXPECT_EQ(source.colorAt(0, 0), Color(255, 0, 0, 128));
+    Bitmap converted = source.copy(PixelFormat::BGRA8Premultiplied);
+    EXPECT_EQ(converted.format(), PixelFormat::BGRA8Premultiplied);
+    EXPECT_EQ(std::memcmp(converted.data(), bgra, 4), 0);
+    EXPECT_EQ(converted.copy(PixelFormat::RGBA8).colorAt(0, 0), Color(255, 0, 0, 128));
+}
+
+TEST(BitmapTest, MipLevels) {
+    Bitmap bitmap = checkerboard(8);
+    // Mutable bitmaps may change at any time, they have no levels besides themselves.
+    EXPECT_EQ(bitmap.mipLevelCount(), 1u);
+    EXPECT_EQ(&bitmap.mipLevel(2), &bitmap);
+
+    bitmap.setImmutable();
+    ASSERT_EQ(bitmap.mipLevelCount(), 4u); // 8, 4, 2 and 1 pixels
+    const Bitmap& half = bitmap.mipLevel(1);
+    EXPECT_EQ(half.size(), SizeI(4, 4));
+    // Each level averages 2x2 blocks, a checkerboard turns into uniform gray.
+    EXPECT_EQ(half.pixel(1, 2), 0xFF808080u);
+    const Bitmap& last = bitmap.mipLevel(10);
+    EXPECT_EQ(last.size(), SizeI(1, 1));
+    EXPECT_EQ(&last, &bitmap.mipLevel(3));
+    // Levels are generated once and shared by copies.
+    EXPECT_EQ(&Bitmap(bitmap).mipLevel(1), &half);
+
+    EXPECT_EQ(bitmap.mipLevelFor(1.f), 0u);
+    EXPECT_EQ(bitmap.mipLevelFor(2.f), 0u);
+    EXPECT_EQ(bitmap.mipLevelFor(0.6f), 0u);
+    EXPECT_EQ(bitmap.mipLevelFor(0.5f), 1u);
+    EXPECT_EQ(bitmap.mipLevelFor(0.3f), 1u);
+    EXPECT_EQ(bitmap.mipLevelFor(0.01f), 3u);
+
+    Bitmap strip({5, 1});
+    strip.setImmutable();
+    EXPECT_EQ(strip.mipLevelCount(), 3u);
+    EXPECT_EQ(strip.mipLevel(2).size(), SizeI(1, 1));
+}
+
+TEST(ImageCacheTest, BudgetAndEviction) {
+    // Room for two 16x16 images including their mip chains.
+    const size_t imageCost = ImageCache::cost(Bitmap({16, 16}));
+    EXPECT_EQ(imageCost, (256u + 64u + 16u + 4u + 1u) * 4u);
+    ImageCache cache(imageCost * 2);
+
+    int decoded = 0;
+    auto decode = [&decoded] {
+        ++decoded;
+        return Bitmap({16, 16});
+    };
+    Bitmap a = cache.obtain("a", decode);
+    EXPECT_TRUE(a.isImmutable());
+    EXPECT_EQ(cache.obtain("a", decode).id(), a.id());
+    EXPECT_EQ(decoded, 1);
+    EXPECT_EQ(cache.stats().hits, 1u);
+
+    cache.obtain("b", decode);
+    cache.find("a");
+    cache.obtain("c", decode);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.bytes(), imageCost * 2);
+    EXPECT_EQ(cache.stats().evictions, 1u);
+    // The least recently used image was evicted, evicted bitmaps stay valid.
+    EXPECT_TRUE(cache.find("b").isEmpty());
+    EXPECT_FALSE(cache.find("a").isEmpty());
+    EXPECT_EQ(a.width(), 16);
+
+    // Failed decodes are not cached, images larger than the budget are returned uncached.
+    EXPECT_TRUE(cache.obtain("broken", [] { return Bitmap(); }).isEmpty());
+    EXPECT_FALSE(cache.insert("huge", Bitmap({64, 64})).isEmpty());
+    EXPECT_TRUE(cache.find("huge").isEmpty());
+
+    cache.setBudget(imageCost);
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.bytes(), imageCost);
+    EXPECT_TRUE(cache.erase("a"));
+    EXPECT_EQ(cache.bytes(), 0u);
+}
+
+TEST(ImageCacheTest, StoresNativeCopies) {
+    ImageCache cache;
+    uint8_t pixels[4]{255, 0, 0, 255};
+    Bitmap stored = cache.insert("red", Bitmap::wrap(pixels, {1, 1}, 4, PixelFormat::RGBA8));
+    // Borrowed pixels may go away, the cache keeps a premultiplied copy of its own.
+    EXPECT_FALSE(stored.isBorrowed());
+    EXPECT_EQ(stored.format(), PixelFormat::RGBA8Premultiplied);
+    pixels[0] = 0;
+    EXPECT_EQ(cache.find("red").colorAt(0, 0), colors::Red);
+    EXPECT_EQ(&ImageCache::shared(), &ImageCache::shared());
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/clip_stack.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace bix;
+
+TEST(ClipStackTest, SkipsClipsContainingTheCurrentClip) {
+    ClipStack clips;
+    clips.reset(Rect(0, 0, 100, 100));
+    EXPECT_EQ(clips.push(RoundRect(Rect(-10, -10, 200, 200), 0), Transform()), ClipOp::Skip);
+    EXPECT_EQ(clips.push(RoundRect(Rect(10, 10, 50, 50), 0), Transform()), ClipOp::Intersect);
+    EXPECT_EQ(clips.bounds(), Rect(10, 10, 50, 50));
+
+    // A widget clipping to its bounds inside its parent's clip does not need anything pushed.
+    EXPECT_EQ(clips.push(RoundRect(Rect(0, 0, 40, 40), 0), Transform::fromTranslate(10, 10)), ClipOp::Skip);
+    EXPECT_EQ(clips.bounds(), Rect(10, 10, 50, 50));
+    EXPECT_EQ(clips.depth(), 3u);
+    EXPECT_EQ(clips.stats().skipped, 2u);
+    EXPECT_EQ(clips.stats().rects, 1u);
+    EXPECT_EQ(clips.stats().masks, 0u);
+}
+
+TEST(ClipStackTest, IntersectsRectClips) {
+    ClipStack clips;
+    clips.reset(Rect(0, 0, 100, 100));
+    EXPECT_EQ(clips.push(RoundRect(Rect(10, 10, 60, 60), 0), Transform()), ClipOp::Intersect);
+    EXPECT_EQ(clips.push(RoundRect(Rect(10, 10, 30, 30), 0), Transform::fromScale(2, 2)), ClipOp::Intersect);
+    EXPECT_EQ(clips.bounds(), Rect(20, 20, 60, 60));
+    EXPECT_TRUE(clips.isRect());
+
+    // Disjoint clips leave nothing to draw, later clips are skipped.
+    EXPECT_EQ(clips.push(RoundRect(Rect(70, 70, 90, 90), 0), Transform()), ClipOp::Intersect);
+    EXPECT_TRUE(clips.bounds().isEmpty());
+    EXPECT_EQ(clips.push(RoundRect(Rect(0, 0, 10, 10), 4), Transform()), ClipOp::Skip);
+}
+
+TEST(ClipStackTest, OnlyRoundedClipsNeedMasks) {
+    ClipStack clips;
+    clips.reset(Rect(0, 0, 100, 100));
+    EXPECT_EQ(clips.push(RoundRect(Rect(10, 10, 90, 90), 8), Transform()), ClipOp::Mask);
+    EXPECT_FALSE(clips.isRect());
+    EXPECT_EQ(clips.bounds(), Rect(10, 10, 90, 90));
+
+    // The content area of a rounded card stays clear of its corners.
+    EXPECT_EQ(clips.push(RoundRect(Rect(18, 18, 82, 82), 0), Transform()), ClipOp::Intersect);
+    EXPECT_EQ(clips.push(RoundRect(Rect(10, 10, 90, 90), 8), Transform()), ClipOp::Skip);
+    EXPECT_EQ(clips.push(RoundRect(Rect(16, 16, 84, 84), 8), Transform()), ClipOp::Mask);
+
+    ASSERT_EQ(clips.pop(), ClipOp::Mask);
+    ASSERT_EQ(clips.pop(), ClipOp::Skip);
+    ASSERT_EQ(clips.pop(), ClipOp::Intersect);
+    EXPECT_EQ(clips.bounds(), Rect(10, 10, 90, 90));
+    ASSERT_EQ(clips.pop(), ClipOp::Mask);
+    EXPECT_TRUE(clips.isRect());
+    EXPECT_THROW(clips.pop(), std::runtime_error);
+}
+
+TEST(ClipStackTest, TransformedClipsAreBoundedByTheirCorners) {
+    ClipStack clips;
+    clips.reset(Rect(0, 0, 100, 100));
+    const Transform transform(1, 0, 0, 1, 1, 0, 0, 0, 1);
+    EXPECT_EQ(clips.push(RoundRect(Rect(0, 0, 20, 20), 0), transform), ClipOp::Mask);
+    EXPECT_TRUE(clips.bounds().equals(Rect(0, 0, 40, 20)));
+    EXPECT_FALSE(clips.isRect());
+
+    clips.reset(Rect(0, 0, 50, 50));
+    EXPECT_EQ(clips.depth(), 0u);
+    EXPECT_TRUE(clips.isRect());
+    EXPECT_EQ(clips.bounds(), Rect(0, 0, 50, 50));
+}
@@ -18,6 +18,10 @@
 
 #include <gtest/gtest.h>
 
+#include "alloc_budget.h"
+
+#include <vector>
+
 using namespace bix;
 using namespace bix::literals;
 
@@ -58,6 +62,13 @@ TEST(ColorTest, FromHexString) {
     EXPECT_FALSE(Color::fromHexString("invalid").isValid());
     EXPECT_FALSE(Color::fromHexString("#GG0000").isValid());
     EXPECT_FALSE(Color::fromHexString("#12345").isValid()); // Wrong length
+
+    // Parsing runs for every color attribute of every widget and must not touch the heap.
+    Color parsed;
+    BIX_EXPECT_NO_ALLOCATIONS(parsed = Color::fromHexString("#12345678"));
+    EXPECT_EQ(parsed, Color(0x12, 0x34, 0x56, 0x78));
+    BIX_EXPECT_NO_ALLOCATIONS(parsed = Color::fromHexString("not a color"));
+    EXPECT_FALSE(parsed.isValid());
 }
 
 /**
@@ -92,6 +103,50 @@ TEST(ColorTest, StringLiterals) {
     EXPECT_EQ(c, Color(170, 187, 204, 255)); // #AABBCC
 }
 
+/**
+ * Hex parsing and the string literal are usable in constant expressions.
+ */
+TEST(ColorTest, CompileTimeParsing) {
+    static_assert(Color::fromHexString("#1A2b3C") == Color(0x1A, 0x2B, 0x3C));
+    static_assert(Color::fromHexString("0000FF80") == Color(0, 0, 255, 128));
+    static_assert(!Color::fromHexString("#12345").isValid());
+    static_assert(!Color::fromHexString("#GG0000").isValid());
+
+    constexpr Color palette[] = {"#FF0000"_rgba, "#F00"_rgba, "#00FF0080"_rgba};
+    static_assert(palette[0] == colors::Red && palette[1] == colors::Red);
+    static_assert(palette[2] == Color(0, 255, 0, 128));
+    static_assert("#ffffff"_rgba == colors::White);
+    static_assert(0x80808080_rgba == Color(128, 128, 128, 128));
+}
+
+/**
+ * The batch parser matches the single string parser for every input form.
+ */
+TEST(ColorTest, FromHexStrings) {
+    const std::vector<std::string_view> inputs = {
+        "#FF0000", "00FF0080", "#F00", "#12345678", "abcdef", "#fff", "", "#GG0000", "#12345", "##123456",
+        "12345g78", "/:@`GHgh", "#0a0B0c", "9A9a9F9f", "\xff\xff\xff\xff\xff\xff", "#00000000", "#FFFFFF",
+        "\x80" "abcde",
+    };
+    std::vector<Color> out(inputs.size());
+    const size_t parsed = Color::fromHexStrings(inputs, out);
+
+    size_t expected = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const Color c = Color::fromHexString(inputs[i]);
+        if (c.isValid()) { ++expected; }
+        EXPECT_EQ(out[i], c) << inputs[i];
+    }
+    EXPECT_EQ(parsed, expected);
+
+    // Only as many entries as fit into the output are parsed.
+    Color single[1];
+    EXPECT_EQ(Color::fromHexStrings(inputs, single), 1u);
+    EXPECT_EQ(single[0], colors::Red);
+
+    BIX_EXPECT_NO_ALLOCATIONS(Color::fromHexStrings(inputs, out));
+}
+
 /**
  * Test Linear Interpolation (lerp) and float conversion.
  */
@@ -129,6 +184,99 @@ TEST(ColorTest, LerpLogic) {
     EXPECT_EQ(half.alpha(), 127);
 }
 
+TEST(ColorTest, HsvHsl) {
+    const HsvColor hsv = Color(0, 128, 255).toHsv();
+    EXPECT_NEAR(hsv.h, 209.9f, 0.1f);
+    EXPECT_FLOAT_EQ(hsv.s, 1.f);
+    EXPECT_FLOAT_EQ(hsv.v, 1.f);
+    EXPECT_EQ(Color::fromHsv({120, 1, 1}), colors::Green);
+    EXPECT_EQ(Color::fromHsv({-120, 1, 1, 0.5f}), Color(0, 0, 255, 128)); // Hue wraps around
+    EXPECT_EQ(Color::fromHsv({0, 0, 0.5f}), Color(128, 128, 128));
+
+    const HslColor hsl = colors::Red.toHsl();
+    EXPECT_FLOAT_EQ(hsl.h, 0.f);
+    EXPECT_FLOAT_EQ(hsl.s, 1.f);
+    EXPECT_FLOAT_EQ(hsl.l, 0.5f);
+    EXPECT_EQ(Color::fromHsl({240, 1, 0.5f}), colors::Blue);
+    EXPECT_EQ(Color::fromHsl({0, 1, 1}), colors::White);
+    EXPECT_FLOAT_EQ(Color(64, 64, 64).toHsl().s, 0.f);
+
+    for (int i = 0; i < 4096; i += 7) {
+        const Color c(i % 256, (i * 3) % 256, (i * 7) % 256, 200);
+        EXPECT_EQ(Color::fromHsv(c.toHsv()), c);
+        EXPECT_EQ(Color::fromHsl(c.toHsl()), c);
+    }
+}
+
+TEST(ColorTest, FromRgbF) {
+    EXPECT_EQ(Color::fromRgbF(0.0f, 0.0f, 0.0f, 0.0f), Color(0, 0, 0, 0));
+    EXPECT_EQ(Color::fromRgbF(1.0f, 1.0f, 1.0f, 1.0f), colors::White);
+    EXPECT_EQ(Color::fromRgbF(0.5f, 0.2f, 1.0f), Color(128, 51, 255));
+    // Out of range components are clamped instead of overflowing.
+    EXPECT_EQ(Color::fromRgbF(1.5f, -0.5f, 1.0001f, 2.0f), Color(255, 0, 255, 255));
+    static_assert(Color::fromRgbF(1.0f, 0.0f, 0.0f) == Color(255, 0, 0));
+}
+
+TEST(ColorTest, LinearAndOkLab) {
+    EXPECT_NEAR(Color(128, 128, 128).toLinear().r, 0.2158f, 1e-4f);
+    EXPECT_FLOAT_EQ(colors::White.toLinear().g, 1.f);
+    for (int i = 0; i < 256; ++i) {
+        const Color c(i, 255 - i, i / 2, i);
+        EXPECT_EQ(Color::fromLinear(c.toLinear()), c);
+    }
+
+    const OkLabColor red = colors::Red.toOkLab();
+    EXPECT_NEAR(red.l, 0.62796f, 1e-3f);
+    EXPECT_NEAR(red.a, 0.22486f, 1e-3f);
+    EXPECT_NEAR(red.b, 0.12585f, 1e-3f);
+    const OkLabColor white = colors::White.toOkLab();
+    EXPECT_NEAR(white.l, 1.f, 1e-3f);
+    EXPECT_NEAR(white.a, 0.f, 1e-3f);
+
+    for (int i = 0; i < 4096; i += 5) {
+        const Color c(i % 256, (i * 5) % 256, (i * 11) % 256);
+        const Color back = Color::fromOkLab(c.toOkLab());
+        EXPECT_NEAR(back.red(), c.red(), 1);
+        EXPECT_NEAR(back.green(), c.green(), 1);
+        EXPECT_NEAR(back.blue(), c.blue(), 1);
+    }
+}
+
+TEST(ColorTest, PerceptualLerp) {
+    EXPECT_EQ(Color::lerp(colors::Black, colors::White, 0.5f, ColorInterpolation::SRGB), Color(128, 128, 128));
+    EXPECT_EQ(Color::lerp(colors::Black, colors::White, 0.5f, ColorInterpolation::Linear), Color(188, 188, 188));
+    EXPECT_EQ(Color::lerp(colors::Black, colors::White, 0.5f, ColorInterpolation::OkLab), Color(99, 99, 99));
+
+    // Endpoints are preserved in every space.
+    for (auto mode : {ColorInterpolation::SRGB, ColorInterpolation::Linear, ColorInterpolation::OkLab}) {
+        EXPECT_EQ(Color::lerp(colors::Red, colors::Blue, 0.f, mode), colors::Red);
+        EXPECT_EQ(Color::lerp(colors::Red, colors::Blue, 1.f, mode), colors::Blue);
+    }
+}
+
+TEST(ColorTest, BatchKernels) {
+    std::vector<Color> from;
+    std::vector<Color> to;
+    for (int i = 0; i < 37; ++i) {
+        from.emplace_back((i * 37) % 256, (i * 91) % 256, (i * 13) % 256, (i * 53) % 256);
+        to.emplace_back((i * 71) % 256, 255 - i, (i * 29) % 256, 255 - (i * 7) % 256);
+    }
+    std::vector<Color> out(from.size());
+    for (auto mode : {ColorInterpolation::SRGB, ColorInterpolation::Linear, ColorInterpolation::OkLab}) {
+        for (float t : {0.f, 0.3f, 0.5f, 0.77f, 1.f}) {
+            Color::lerp(from, to, t, out, mode);
+            for (size_t i = 0; i < from.size(); ++i) { EXPECT_EQ(out[i], Color::lerp(from[i], to[i], t, mode)); }
+        }
+    }
+    BIX_EXPECT_NO_ALLOCATIONS(Color::lerp(from, to, 0.25f, out));
+
+    std::vector<LinearColor> linear(from.size());
+    Color::toLinear(from, linear);
+    for (size_t i = 0; i < from.size(); ++i) { EXPECT_FLOAT_EQ(linear[i].g, from[i].toLinear().g); }
+    Color::fromLinear(linear, out);
+    EXPECT_EQ(out, from);
+}
+
 /**
  * Ensure constants in bix::colors are correct.
  */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/damage_region.h>
+
+#include <gtest/gtest.h>
+
+using namespace bix;
+
+TEST(DamageRegionTest, SnapsAndIgnoresEmpty) {
+    DamageRegion region;
+    EXPECT_TRUE(region.isEmpty());
+    region.add(Rect(5, 5, 5, 10));
+    region.add(Rect(5, 5, 2, 2));
+    EXPECT_TRUE(region.isEmpty());
+
+    region.add(Rect(1.5f, 2.2f, 3.1f, 4.9f));
+    ASSERT_EQ(region.rects().size(), 1u);
+    EXPECT_EQ(region.rects()[0], Rect(1, 2, 4, 5));
+}
+
+TEST(DamageRegionTest, MergesContainedAndAdjacent) {
+    DamageRegion region;
+    region.add(Rect(0, 0, 100, 100));
+    region.add(Rect(10, 10, 20, 20));
+    EXPECT_EQ(region.rects().size(), 1u);
+
+    region.add(Rect(100, 0, 150, 100));
+    ASSERT_EQ(region.rects().size(), 1u);
+    EXPECT_EQ(region.rects()[0], Rect(0, 0, 150, 100));
+
+    // A larger rectangle swallows the existing ones.
+    region.add(Rect(-10, -10, 200, 200));
+    ASSERT_EQ(region.rects().size(), 1u);
+    EXPECT_EQ(region.bounds(), Rect(-10, -10, 200, 200));
+}
+
+TEST(DamageRegionTest, KeepsDistantRectsSeparate) {
+    DamageRegion region;
+    region.add(Rect(0, 0, 10, 10));
+    region.add(Rect(1000, 1000, 1010, 1010));
+    EXPECT_EQ(region.rects().size(), 2u);
+    EXPECT_EQ(region.bounds(), Rect(0, 0, 1010, 1010));
+
+    EXPECT_TRUE(region.intersects(Rect(5, 5, 6, 6)));
+    EXPECT_TRUE(region.intersects(Rect(1005, 990, 1020, 1001)));
+    EXPECT_FALSE(region.intersects(Rect(500, 500, 600, 600)));
+    EXPECT_FALSE(region.intersects(Rect(10, 0, 20, 10)));
+}
+
+TEST(DamageRegionTest, CapacityMergesCheapestPair) {
+    DamageRegion region(3);
+    region.add(Rect(0, 0, 10, 10));
+    region.add(Rect(12, 0, 22, 10));
+    region.add(Rect(500, 500, 510, 510));
+    region.add(Rect(1000, 0, 1010, 10));
+    ASSERT_EQ(region.rects().size(), 3u);
+
+    // The two neighbours at the origin waste the least area when merged.
+    EXPECT_TRUE(std::ranges::find(region.rects(), Rect(0, 0, 22, 10)) != region.rects().end());
+    EXPECT_FALSE(region.intersects(Rect(100, 100, 400, 400)));
+
+    DamageRegion other;
+    other.add(region);
+    EXPECT_EQ(other.bounds(), region.bounds());
+    region.clear();
+    EXPECT_TRUE(region.isEmpty());
+    EXPECT_TRUE(region.bounds().isEmpty());
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/colors.h>
+#include <bixlib/graphics/gradient.h>
+
+#include <gtest/gtest.h>
+
+using namespace bix;
+
+TEST(GradientTest, StopsAreNormalized) {
+    Gradient gradient({{1.5f, colors::Blue}, {0.5f, colors::Red}, {-1.f, colors::White}, {0.5f, colors::Black}});
+    const auto& stops = gradient.stops();
+    ASSERT_EQ(stops.size(), 4u);
+    EXPECT_EQ(stops[0], (GradientStop{0.f, colors::White}));
+    // Stops sharing an offset keep their order and form a hard edge.
+    EXPECT_EQ(stops[1].color, colors::Red);
+    EXPECT_EQ(stops[2].color, colors::Black);
+    EXPECT_EQ(stops[3], (GradientStop{1.f, colors::Blue}));
+
+    EXPECT_TRUE(Gradient().isEmpty());
+    EXPECT_FALSE(Gradient().colorAt(0.5f).isValid());
+}
+
+TEST(GradientTest, ColorAt) {
+    Gradient gradient({{0.25f, colors::Black}, {0.75f, colors::White}});
+    EXPECT_EQ(gradient.colorAt(0.f), colors::Black);
+    EXPECT_EQ(gradient.colorAt(1.f), colors::White);
+    EXPECT_NEAR(gradient.colorAt(0.5f).red(), 128, 1);
+
+    Gradient edge({{0.f, colors::Red}, {0.5f, colors::Red}, {0.5f, colors::Blue}, {1.f, colors::Blue}});
+    EXPECT_EQ(edge.colorAt(0.49f), colors::Red);
+    EXPECT_EQ(edge.colorAt(0.51f), colors::Blue);
+}
+
+TEST(GradientTest, Spread) {
+    EXPECT_FLOAT_EQ(Gradient::applySpread(1.25f, GradientSpread::Pad), 1.f);
+    EXPECT_FLOAT_EQ(Gradient::applySpread(-0.5f, GradientSpread::Pad), 0.f);
+    EXPECT_FLOAT_EQ(Gradient::applySpread(1.25f, GradientSpread::Repeat), 0.25f);
+    EXPECT_FLOAT_EQ(Gradient::applySpread(-0.25f, GradientSpread::Repeat), 0.75f);
+    EXPECT_FLOAT_EQ(Gradient::applySpread(1.25f, GradientSpread::Reflect), 0.75f);
+    EXPECT_FLOAT_EQ(Gradient::applySpread(-0.25f, GradientSpread::Reflect), 0.25f);
+    EXPECT_FLOAT_EQ(Gradient::applySpread(NAN, GradientSpread::Reflect), 0.f);
+
+    Gradient gradient({{0.f, colors::Black}, {1.f, colors::White}}, ColorInterpolation::SRGB, GradientSpread::Reflect);
+    EXPECT_EQ(gradient.colorAt(2.f), colors::Black);
+    EXPECT_EQ(gradient.colorAt(3.f), colors::White);
+}
+
+TEST(GradientTest, ValueSemantics) {
+    Gradient a({{0.f, colors::Red}, {1.f, colors::Blue}});
+    Gradient b({{1.f, colors::Blue}, {0.f, colors::Red}});
+    Gradient c({{0.f, colors::Red}, {1.f, colors::Blue}}, ColorInterpolation::OkLab);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_FALSE(a == c);
+    EXPECT_NE(a.hash(), c.hash());
+}
+
+TEST(GradientTest, Ramp) {
+    Gradient gradient({{0.f, colors::Black}, {1.f, Color(255, 255, 255, 0)}});
+    GradientRamp ramp(gradient);
+    ASSERT_EQ(ramp.size(), GradientRamp::kDefaultSize);
+    EXPECT_FALSE(ramp.isOpaque());
+    EXPECT_EQ(ramp.lookup(0.f), 0xFF000000u);
+    // Entries are premultiplied, a fully transparent end maps to zero.
+    EXPECT_EQ(ramp.lookup(1.f), 0u);
+    EXPECT_EQ(ramp.lookup(5.f), 0u);
+    EXPECT_EQ(ramp.index(0.5f), 128u);
+
+    // Stops closer than a few entries of the default size get a detailed ramp.
+    Gradient stripes({{0.f, colors::Red}, {0.5f, colors::Red}, {0.505f, colors::Blue}, {1.f, colors::Blue}});
+    EXPECT_EQ(GradientRamp::preferredSize(stripes), GradientRamp::kDetailedSize);
+    Gradient hard({{0.f, colors::Red}, {0.5f, colors::Red}, {0.5f, colors::Blue}, {1.f, colors::Blue}});
+    EXPECT_EQ(GradientRamp::preferredSize(hard), GradientRamp::kDefaultSize);
+    EXPECT_TRUE(GradientRamp(hard).isOpaque());
+
+    GradientRamp repeat(Gradient({{0.f, colors::Black}, {1.f, colors::White}}, {}, GradientSpread::Repeat), 16);
+    EXPECT_EQ(repeat.size(), 16u);
+    EXPECT_EQ(repeat.lookup(1.25f), repeat.lookup(0.25f));
+}
+
+TEST(GradientTest, RampCache) {
+    GradientRampCache cache(2);
+    Gradient a({{0.f, colors::Red}, {1.f, colors::Blue}});
+    Gradient b({{0.f, colors::Red}, {1.f, colors::Green}});
+
+    auto first = cache.obtain(a);
+    EXPECT_EQ(cache.obtain(Gradient({{0.f, colors::Red}, {1.f, colors::Blue}})), first);
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().misses, 1u);
+
+    cache.obtain(b);
+    cache.obtain(Gradient({{0.f, colors::Red}, {1.f, colors::White}}));
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.stats().evictions, 1u);
+    // An evicted ramp stays valid for its holders and is baked again on the next use.
+    EXPECT_EQ(first->lookup(0.f), 0xFF0000FFu);
+    EXPECT_NE(cache.obtain(a), first);
+}
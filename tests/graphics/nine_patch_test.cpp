@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/nine_patch.h>
+
+#include <gtest/gtest.h>
+
+using namespace bix;
+
+TEST(NinePatchTest, SlicesKeepCorners) {
+    NinePatch patch(Bitmap({12, 10}), {4, 3, 8, 7});
+    auto slices = patch.slices({40.f, 20.f});
+    ASSERT_EQ(slices.size(), 9u);
+
+    // Corners keep their size, the center takes what is left.
+    EXPECT_EQ(slices[0].src, Rect(0, 0, 4, 3));
+    EXPECT_EQ(slices[0].dst, Rect(0, 0, 4, 3));
+    EXPECT_EQ(slices[4].src, Rect(4, 3, 8, 7));
+    EXPECT_EQ(slices[4].dst, Rect(4, 3, 36, 17));
+    EXPECT_EQ(slices[8].src, Rect(8, 7, 12, 10));
+    EXPECT_EQ(slices[8].dst, Rect(36, 17, 40, 20));
+}
+
+TEST(NinePatchTest, SlicesAreCachedPerSize) {
+    NinePatch patch(Bitmap({12, 10}), {4, 3, 8, 7});
+    const NinePatch::Slice* first = patch.slices({40.f, 20.f}).data();
+    EXPECT_EQ(patch.slices({40.f, 20.f}).data(), first);
+    EXPECT_EQ(patch.slices({60.f, 20.f})[4].dst, Rect(4, 3, 56, 17));
+}
+
+TEST(NinePatchTest, SmallTargetsShrinkBorders) {
+    NinePatch patch(Bitmap({12, 10}), {4, 3, 8, 7});
+
+    // Too small for the borders, the center slices are dropped and the borders split the target.
+    auto slices = patch.slices({4.f, 3.f});
+    ASSERT_EQ(slices.size(), 4u);
+    EXPECT_EQ(slices[0].dst, Rect(0, 0, 2, 2));
+    EXPECT_EQ(slices[3].dst, Rect(2, 2, 4, 3));
+
+    EXPECT_TRUE(patch.slices({0.f, 10.f}).empty());
+    EXPECT_TRUE(NinePatch().slices({10.f, 10.f}).empty());
+}
+
+TEST(NinePatchTest, EmptyCenterStretchesWholeAxis) {
+    // A center without width stretches the whole bitmap horizontally, only rows have fixed borders.
+    NinePatch patch(Bitmap({12, 10}), {6, 3, 6, 7});
+    auto slices = patch.slices({30.f, 20.f});
+    ASSERT_EQ(slices.size(), 3u);
+    EXPECT_EQ(slices[0].src, Rect(0, 0, 12, 3));
+    EXPECT_EQ(slices[1].dst, Rect(0, 3, 30, 17));
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/path.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "graphics/scan_converter.h"
+
+using namespace bix;
+
+namespace {
+// Rasterizes a path without transform and returns the coverage of a w x h area, row major.
+std::vector<int> rasterize(const Path& path, int w, int h) {
+    std::vector<int> coverage(static_cast<size_t>(w * h), 0);
+    raster::ScanConverter scan;
+    scan.reset({0, 0, w, h});
+    const FlattenedPathPtr flat = path.flatten(1.f);
+    for (size_t i = 0; i < flat->contourEnds.size(); ++i) { scan.addPolygon(flat->contour(i)); }
+    scan.sweep(path.fillRule(), [&](int y, int x, const uint8_t* values, int count) {
+        for (int i = 0; i < count; ++i) { coverage[static_cast<size_t>(y * w + x + i)] = values[i]; }
+    });
+    return coverage;
+}
+
+int total(const std::vector<int>& coverage) {
+    int sum = 0;
+    for (const int c : coverage) { sum += c; }
+    return sum;
+}
+} // namespace
+
+TEST(PathTest, Builder) {
+    Path path;
+    EXPECT_TRUE(path.isEmpty());
+    path.moveTo({1, 1}).lineTo({5, 1}).quadTo({7, 3}, {5, 5}).close().lineTo({1, 5});
+    const std::vector<PathVerb> verbs{
+        PathVerb::Move, PathVerb::Line, PathVerb::Quad, PathVerb::Close, PathVerb::Move, PathVerb::Line
+    };
+    EXPECT_EQ(std::vector<PathVerb>(path.verbs().begin(), path.verbs().end()), verbs);
+    // A segment after close() starts at the start of the closed contour.
+    EXPECT_EQ(path.points()[4], Point(1, 1));
+    EXPECT_EQ(path.bounds(), Rect(1, 1, 7, 5));
+
+    path.reset();
+    EXPECT_TRUE(path.isEmpty());
+    EXPECT_TRUE(path.points().empty());
+}
+
+TEST(PathTest, CopiesShareGeometryUntilModified) {
+    Path a;
+    a.addRect({0, 0, 10, 10});
+    Path b = a;
+    EXPECT_EQ(a.points().data(), b.points().data());
+
+    b.lineTo({20, 20});
+    EXPECT_NE(a.points().data(), b.points().data());
+    EXPECT_EQ(a.points().size(), 4u);
+    EXPECT_EQ(b.bounds(), Rect(0, 0, 20, 20));
+}
+
+TEST(PathTest, FlatteningStaysWithinTolerance) {
+    Path path;
+    path.addEllipse(Ellipse({50, 50}, 40, 40));
+    for (const float scale : {1.f, 4.f}) {
+        const FlattenedPathPtr flat = path.flatten(scale);
+        ASSERT_EQ(flat->contourEnds.size(), 1u);
+        for (size_t i = 1; i < flat->points.size(); ++i) {
+            // The middle of every chord is within the tolerance of the circle.
+            const Point mid = (flat->points[i - 1] + flat->points[i]) * 0.5f;
+            const float error = 40.f - std::hypot(mid.x - 50.f, mid.y - 50.f);
+            EXPECT_LE(error * scale, Path::kTolerance * 1.1f);
+        }
+    }
+    // Larger scales need more segments.
+    EXPECT_GT(path.flatten(4.f)->points.size(), path.flatten(1.f)->points.size());
+    EXPECT_EQ(path.flatten(1.f)->bounds, Rect(10, 10, 90, 90));
+}
+
+TEST(PathTest, FlatteningIsCachedPerScale) {
+    Path path;
+    path.moveTo({0, 0}).cubicTo({10, 0}, {20, 10}, {20, 20}).close();
+    const FlattenedPathPtr first = path.flatten(1.f);
+    EXPECT_EQ(path.flatten(1.f), first);
+    // Scales within the same quarter octave reuse the result.
+    EXPECT_EQ(path.flatten(0.95f), first);
+    EXPECT_NE(path.flatten(2.f), first);
+
+    // The cache is shared with copies and dropped by modifications.
+    const FlattenedPathPtr scaled = path.flatten(2.f);
+    Path copy = path;
+    EXPECT_EQ(copy.flatten(2.f), scaled);
+    copy.lineTo({0, 20});
+    EXPECT_NE(copy.flatten(2.f), scaled);
+    EXPECT_EQ(path.flatten(2.f), scaled);
+}
+
+TEST(PathTest, ArcTo) {
+    Path path;
+    path.arcTo(Ellipse({10, 10}, 10, 5), 0, 90);
+    ASSERT_EQ(path.verbs().size(), 2u);
+    EXPECT_EQ(path.verbs()[0], PathVerb::Move);
+    EXPECT_TRUE(path.points().front().equals({20, 10}));
+    EXPECT_TRUE(path.points().back().equals({10, 15}));
+
+    // A full turn is split into four quarter arcs and connected to the open contour by a line.
+    Path circle;
+    circle.moveTo({0, 0}).arcTo(Ellipse({10, 10}, 5, 5), 0, 720);
+    EXPECT_EQ(circle.verbs().size(), 6u);
+    EXPECT_EQ(circle.verbs()[1], PathVerb::Line);
+}
+
+TEST(PathTest, AddRoundRect) {
+    Path path;
+    path.addRoundRect(RoundRect({2, 2, 42, 32}, CornerRadius(8, 0, 4, 30)));
+    EXPECT_TRUE(path.bounds().equals({2, 2, 42, 32}));
+    // The bottom-right radius is clamped to half of the shorter side, the top-right corner stays sharp.
+    size_t cubics = 0;
+    for (const PathVerb verb : path.verbs()) { cubics += verb == PathVerb::Cubic ? 1 : 0; }
+    EXPECT_EQ(cubics, 3u);
+
+    // Each rounded corner cuts (1 - pi / 4) r^2 off the rectangle, flattening loses up to the tolerance along arcs.
+    constexpr float pi = std::numbers::pi_v<float>;
+    const float cut = (1.f - pi / 4.f) * (8.f * 8.f + 4.f * 4.f + 15.f * 15.f);
+    const float arcLength = (8.f + 4.f + 15.f) * pi / 2.f;
+    const float area = static_cast<float>(total(rasterize(path, 48, 36))) / 255.f;
+    EXPECT_LE(area, 40.f * 30.f - cut + 0.5f);
+    EXPECT_GE(area, 40.f * 30.f - cut - arcLength * Path::kTolerance);
+}
+
+TEST(ScanConverterTest, RectCoverageIsExact) {
+    Path path;
+    path.addRect({1.5f, 1.5f, 4.5f, 3.5f});
+    const auto coverage = rasterize(path, 6, 5);
+    EXPECT_EQ(coverage[0], 0);
+    EXPECT_EQ(coverage[1 * 6 + 1], 64);
+    EXPECT_EQ(coverage[1 * 6 + 2], 128);
+    EXPECT_EQ(coverage[2 * 6 + 1], 128);
+    EXPECT_EQ(coverage[2 * 6 + 2], 255);
+    EXPECT_EQ(coverage[2 * 6 + 4], 128);
+    EXPECT_EQ(coverage[3 * 6 + 4], 64);
+    EXPECT_NEAR(total(coverage), 6 * 255, 6);
+}
+
+TEST(ScanConverterTest, CoverageMatchesPolygonArea) {
+    Path path;
+    path.addEllipse(Ellipse({16, 16}, 10.3f, 10.3f));
+    const std::span<const Point> polygon = path.flatten(1.f)->contour(0);
+    float expected = 0;
+    for (size_t i = 0; i < polygon.size(); ++i) {
+        const Point& a = polygon[i];
+        const Point& b = polygon[(i + 1) % polygon.size()];
+        expected += (a.x * b.y - b.x * a.y) * 0.5f;
+    }
+    const float area = static_cast<float>(total(rasterize(path, 32, 32))) / 255.f;
+    EXPECT_NEAR(area, std::abs(expected), 0.5f);
+    // The polygon is inscribed in the circle and loses at most the tolerance along the outline.
+    EXPECT_NEAR(area, 3.14159265f * 10.3f * 10.3f, 2.f * 3.14159265f * 10.3f * Path::kTolerance);
+}
+
+TEST(ScanConverterTest, FillRules) {
+    // Two nested squares with the same orientation.
+    Path path;
+    path.addRect({0, 0, 8, 8}).addRect({2, 2, 6, 6});
+    EXPECT_EQ(rasterize(path, 8, 8)[4 * 8 + 4], 255);
+    path.setFillRule(FillRule::EvenOdd);
+    EXPECT_EQ(rasterize(path, 8, 8)[4 * 8 + 4], 0);
+    EXPECT_EQ(rasterize(path, 8, 8)[1 * 8 + 1], 255);
+
+    // A counterclockwise inner contour cuts a hole with the non-zero rule as well.
+    Path hole;
+    const Point inner[] = {{2, 2}, {2, 6}, {6, 6}, {6, 2}};
+    hole.addRect({0, 0, 8, 8}).addPolygon(inner, true);
+    EXPECT_EQ(rasterize(hole, 8, 8)[4 * 8 + 4], 0);
+}
+
+TEST(ScanConverterTest, ClipsEdges) {
+    // A triangle reaching past both sides of the clip.
+    Path path;
+    const Point triangle[] = {{-20, 0}, {30, 0}, {-20, 10}};
+    path.addPolygon(triangle, true);
+    raster::ScanConverter scan;
+    scan.reset({0, 0, 10, 10});
+    scan.addPolygon(path.flatten(1.f)->contour(0));
+    EXPECT_EQ(scan.bounds(), RectI(0, 0, 10, 10));
+
+    std::vector<int> rows(10, 0);
+    scan.sweep(FillRule::NonZero, [&](int y, int x, const uint8_t* values, int count) {
+        EXPECT_EQ(x, 0);
+        rows[static_cast<size_t>(y)] = count;
+        EXPECT_GT(values[0], 0);
+    });
+    // The hypotenuse crosses x = 10 at y = 4 and leaves the clip at y = 6.
+    EXPECT_EQ(rows[0], 10);
+    EXPECT_EQ(rows[3], 10);
+    EXPECT_EQ(rows[5], 5);
+    EXPECT_EQ(rows[6], 0);
+}
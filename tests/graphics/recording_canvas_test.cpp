@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/colors.h>
+#include <bixlib/graphics/recording_canvas.h>
+
+#include <gtest/gtest.h>
+
+#include "alloc_budget.h"
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+void paintScene(Canvas& canvas) {
+    auto brush = canvas.createColorBrush(colors::Red);
+    canvas.fillRectangle({2, 2, 30, 20}, *brush);
+    brush->setColor(colors::Blue);
+    brush->setOpacity(0.5f);
+    canvas.fillRectangle({10.5f, 10, 40, 36}, *brush);
+
+    Pen pen(colors::Black, 2.0f);
+    canvas.pushClip(RoundRect(Rect(0, 0, 48, 48), 6));
+    canvas.drawRectangle({4, 4, 44, 44}, pen);
+    canvas.drawEllipse(Ellipse({24, 24}, 12, 8), pen);
+    canvas.popClip();
+
+    pen.setLineStyle(LineStyle::Dash);
+    const geom::Line edges[] = {{0, 46, 48, 46}, {46, 0, 46, 48}};
+    canvas.drawLines(edges, pen);
+}
+
+bool samePixels(const PixelBuffer& a, const PixelBuffer& b) {
+    if (a.width() != b.width() || a.height() != b.height()) { return false; }
+    for (int y = 0; y < a.height(); ++y) {
+        for (int x = 0; x < a.width(); ++x) {
+            if (a.pixel(x, y) != b.pixel(x, y)) { return false; }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST(RecordingCanvasTest, ReplayMatchesImmediateDrawing) {
+    SoftwareCanvas direct({48, 48});
+    direct.beginDraw();
+    direct.clear(colors::White);
+    paintScene(direct);
+
+    SoftwareCanvas replayed({48, 48});
+    DisplayList list;
+    RecordingCanvas recorder(list, replayed);
+    paintScene(recorder);
+    EXPECT_EQ(recorder.endDraw(), DrawResult::Success);
+    EXPECT_EQ(list.commandCount(), 7u);
+
+    replayed.beginDraw();
+    replayed.clear(colors::White);
+    list.replay(replayed);
+    EXPECT_TRUE(samePixels(direct.pixels(), replayed.pixels()));
+
+    // A second replay reuses the cached brush and produces the same result.
+    replayed.clear(colors::White);
+    list.replay(replayed);
+    EXPECT_TRUE(samePixels(direct.pixels(), replayed.pixels()));
+}
+
+TEST(RecordingCanvasTest, GradientsAreCapturedByValue) {
+    const Gradient gradient({{0.f, colors::Red}, {1.f, colors::Blue}}, ColorInterpolation::OkLab);
+    auto paint = [&](Canvas& canvas) {
+        auto linear = canvas.createLinearGradientBrush({0, 0}, {32, 32}, gradient);
+        canvas.fillRectangle({0, 0, 32, 16}, *linear);
+        canvas.fillRectangle({0, 16, 32, 32}, *linear);
+        auto radial = canvas.createRadialGradientBrush(Ellipse({16, 16}, 12, 8), gradient);
+        radial->setOpacity(0.5f);
+        canvas.fillRectangle({4, 4, 28, 28}, *radial);
+        // Later changes must not leak into the recorded commands.
+        radial->setEllipse(Ellipse({0, 0}, 1));
+        linear->setGradient(Gradient());
+    };
+
+    SoftwareCanvas direct({32, 32});
+    direct.beginDraw();
+    direct.clear(colors::White);
+    paint(direct);
+
+    SoftwareCanvas replayed({32, 32});
+    DisplayList list;
+    RecordingCanvas recorder(list, replayed);
+    paint(recorder);
+    EXPECT_EQ(list.commandCount(), 3u);
+
+    replayed.beginDraw();
+    for (int i = 0; i < 2; ++i) {
+        replayed.clear(colors::White);
+        list.replay(replayed);
+        EXPECT_TRUE(samePixels(direct.pixels(), replayed.pixels()));
+    }
+}
+
+TEST(RecordingCanvasTest, BitmapsShareTheirPixels) {
+    Bitmap icon({4, 4});
+    for (int y = 0; y < 4; ++y) {
+        auto* row = reinterpret_cast<uint32_t*>(icon.row(y));
+        for (int x = 0; x < 4; ++x) { row[x] = x < 2 ? 0xFF0000FFu : 0x80800000u; }
+    }
+    auto paint = [&icon](Canvas& canvas) {
+        for (int i = 0; i < 4; ++i) {
+            const auto at = static_cast<float>(i * 8);
+            canvas.drawBitmap(icon, {0, 0, 4, 4}, {at, at, at + 6, at + 6}, 0.75f, BitmapSampling::Linear);
+        }
+    };
+
+    SoftwareCanvas direct({32, 32});
+    direct.beginDraw();
+    direct.clear(colors::White);
+    paint(direct);
+
+    SoftwareCanvas replayed({32, 32});
+    DisplayList list;
+    RecordingCanvas recorder(list, replayed);
+    paint(recorder);
+    EXPECT_EQ(list.commandCount(), 4u);
+
+    replayed.beginDraw();
+    replayed.clear(colors::White);
+    list.replay(replayed);
+    EXPECT_TRUE(samePixels(direct.pixels(), replayed.pixels()));
+}
+
+TEST(RecordingCanvasTest, ReplayWithBaseTransform) {
+    SoftwareCanvas canvas({32, 32});
+    DisplayList list;
+    {
+        RecordingCanvas recorder(list, canvas);
+        auto brush = recorder.createColorBrush(colors::Black);
+        recorder.fillRectangle({0, 0, 4, 4}, *brush);
+        recorder.setTransform(Transform::fromTranslate(8, 0));
+        recorder.fillRectangle({0, 0, 4, 4}, *brush);
+    }
+
+    canvas.beginDraw();
+    canvas.clear(colors::White);
+    list.replay(canvas, Transform::fromTranslate(10, 10));
+
+    EXPECT_EQ(canvas.pixels().colorAt(10, 10), colors::Black);
+    EXPECT_EQ(canvas.pixels().colorAt(18, 10), colors::Black);
+    EXPECT_EQ(canvas.pixels().colorAt(15, 10), colors::White);
+    EXPECT_EQ(canvas.pixels().colorAt(2, 2), colors::White);
+}
+
+TEST(RecordingCanvasTest, ResetAndClipBalance) {
+    SoftwareCanvas canvas({16, 16});
+    DisplayList list;
+    RecordingCanvas recorder(list, canvas);
+
+    EXPECT_FALSE(recorder.pushClip(RoundRect(Rect(4, 4, 2, 2), 0)));
+    EXPECT_THROW(recorder.popClip(), std::runtime_error);
+    EXPECT_TRUE(recorder.pushClip(RoundRect(Rect(0, 0, 8, 8), 0)));
+    EXPECT_EQ(recorder.endDraw(), DrawResult::Error);
+
+    const Pen pen(colors::Black);
+    recorder.drawLine({0, 0, 8, 8}, pen);
+    recorder.drawLine({8, 0, 0, 8}, pen);
+    EXPECT_EQ(list.commandCount(), 3u);
+
+    recorder.beginDraw();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.byteSize(), 0u);
+    EXPECT_EQ(recorder.endDraw(), DrawResult::Success);
+}
+
+TEST(RecordingCanvasTest, BatchesReplayLikeImmediateDrawing) {
+    auto paintGrid = [](Canvas& canvas) {
+        auto brush = canvas.createColorBrush(colors::Blue);
+        brush->setOpacity(0.5f);
+        const Rect cells[] = {{0, 0, 20.5f, 10}, {20.5f, 0, 40, 10}, {0, 10, 20.5f, 20}, {20.5f, 10, 40, 20}};
+        canvas.fillRects(cells, *brush);
+        const geom::Line grid[] = {{0, 10, 40, 10}, {20.5f, 0, 20.5f, 20}};
+        canvas.drawLines(grid, Pen(colors::Black));
+        const Rect frames[] = {{2, 24, 12, 34}, {14, 24, 24, 34}};
+        canvas.drawRects(frames, Pen(colors::Red, 2.f));
+    };
+
+    SoftwareCanvas direct({48, 48});
+    direct.clear(colors::White);
+    paintGrid(direct);
+
+    SoftwareCanvas replayed({48, 48});
+    DisplayList list;
+    RecordingCanvas recorder(list, replayed);
+    paintGrid(recorder);
+    EXPECT_EQ(list.commandCount(), 3u);
+
+    replayed.clear(colors::White);
+    list.replay(replayed);
+    EXPECT_TRUE(samePixels(direct.pixels(), replayed.pixels()));
+}
+
+TEST(RecordingCanvasTest, PathsReplayLikeImmediateDrawing) {
+    Path star(FillRule::EvenOdd);
+    const Point points[] = {{24, 2}, {37, 44}, {3, 17}, {45, 17}, {11, 44}};
+    star.addPolygon(points, true);
+    auto paintStar = [&star](Canvas& canvas) {
+        auto brush = canvas.createColorBrush(colors::Blue);
+        canvas.fillPath(star, *brush);
+        auto gradient = canvas.createRadialGradientBrush(
+            Ellipse({24, 24}, 20), Gradient({{0.f, colors::Red}, {1.f, colors::Green}})
+        );
+        canvas.setTransform(Transform::fromTranslate(2, 2));
+        canvas.fillPath(star, *gradient);
+    };
+
+    SoftwareCanvas direct({48, 48});
+    direct.clear(colors::White);
+    paintStar(direct);
+
+    SoftwareCanvas replayed({48, 48});
+    DisplayList list;
+    RecordingCanvas recorder(list, replayed);
+    paintStar(recorder);
+    EXPECT_EQ(list.commandCount(), 3u);
+
+    replayed.clear(colors::White);
+    list.replay(replayed);
+    EXPECT_TRUE(samePixels(direct.pixels(), replayed.pixels()));
+    // The recorded copies share the flattened curves with the original path.
+    EXPECT_EQ(star.flatten(1.f).use_count(), 2);
+}
+
+TEST(RecordingCanvasTest, RoundShapesReplayLikeImmediateDrawing) {
+    auto paintCards = [](Canvas& canvas) {
+        auto brush = canvas.createColorBrush(colors::Blue);
+        auto gradient =
+            canvas.createLinearGradientBrush({0, 0}, {48, 0}, Gradient({{0.f, colors::Red}, {1.f, colors::Green}}));
+        canvas.fillRoundRect(RoundRect({2, 2, 30, 20}, CornerRadius(6, 6, 0, 0)), *brush);
+        canvas.fillRoundRect(RoundRect({18, 10, 46, 30}, 4), *gradient);
+        canvas.fillEllipse(Ellipse({12, 36}, 9, 7), *brush);
+        canvas.fillEllipse(Ellipse({36, 38}, 8), *gradient);
+        const Pen pen(colors::Black, 1.5f);
+        canvas.drawRoundRect(RoundRect({4.5f, 24.5f, 44.5f, 46.5f}, CornerRadius(3, 8, 8, 3)), pen);
+    };
+
+    SoftwareCanvas direct({48, 48});
+    direct.clear(colors::White);
+    paintCards(direct);
+
+    SoftwareCanvas replayed({48, 48});
+    DisplayList list;
+    RecordingCanvas recorder(list, replayed);
+    paintCards(recorder);
+    EXPECT_EQ(list.commandCount(), 5u);
+
+    replayed.clear(colors::White);
+    list.replay(replayed);
+    EXPECT_TRUE(samePixels(direct.pixels(), replayed.pixels()));
+}
+
+TEST(RecordingCanvasTest, SteadyStateFrameDoesNotAllocate) {
+    SoftwareCanvas canvas({48, 48});
+    DisplayList list;
+    {
+        RecordingCanvas recorder(list, canvas);
+        auto brush = recorder.createColorBrush(colors::Red);
+        recorder.fillRectangle({2, 2, 30, 20}, *brush);
+        Pen pen(colors::Black, 2.0f);
+        recorder.pushClip(RoundRect(Rect(0, 0, 40, 40), 0));
+        recorder.drawRectangle({4, 4, 44, 44}, pen);
+        recorder.drawEllipse(Ellipse({24, 24}, 12, 8), pen);
+        recorder.popClip();
+        recorder.pushClip(RoundRect(Rect(2, 2, 40, 40), 6));
+        recorder.fillRectangle({0, 0, 48, 48}, *brush);
+        recorder.popClip();
+        const geom::Line edges[] = {{0, 46, 48, 46}, {46, 0, 46, 48}};
+        recorder.drawLines(edges, pen);
+    }
+
+    // The first frame creates the replay brush and grows the scratch buffers of the canvas.
+    canvas.beginDraw();
+    canvas.clear(colors::White);
+    list.replay(canvas);
+    EXPECT_EQ(canvas.endDraw(), DrawResult::Success);
+
+    BIX_EXPECT_NO_ALLOCATIONS({
+        canvas.beginDraw();
+        canvas.clear(colors::White);
+        list.replay(canvas);
+        canvas.endDraw();
+    });
+}
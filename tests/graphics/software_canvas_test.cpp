@@ -0,0 +1,654 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/colors.h>
+#include <bixlib/graphics/engine.h>
+#include <bixlib/graphics/nine_patch.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+std::unique_ptr<SoftwareCanvas> makeCanvas(int w, int h) {
+    auto canvas = std::make_unique<SoftwareCanvas>(SizeI(w, h));
+    canvas->beginDraw();
+    canvas->clear(colors::White);
+    return canvas;
+}
+
+bool isWhite(const SoftwareCanvas& c, int x, int y) {
+    return c.pixels().colorAt(x, y) == colors::White;
+}
+
+// Returns how much black was blended over the white background at a pixel, in range [0, 255].
+int darkness(const SoftwareCanvas& c, int x, int y) {
+    return 255 - c.pixels().colorAt(x, y).red();
+}
+
+bool insideRoundRect(const RoundRect& r, float x, float y) {
+    if (x < r.rect.left || x > r.rect.right || y < r.rect.top || y > r.rect.bottom) { return false; }
+    const float radii[4]{r.radii.topLeft, r.radii.topRight, r.radii.bottomLeft, r.radii.bottomRight};
+    for (int i = 0; i < 4; ++i) {
+        const float cx = (i & 1) != 0 ? r.rect.right - radii[i] : r.rect.left + radii[i];
+        const float cy = (i & 2) != 0 ? r.rect.bottom - radii[i] : r.rect.top + radii[i];
+        const bool inBox = ((i & 1) != 0 ? x > cx : x < cx) && ((i & 2) != 0 ? y > cy : y < cy);
+        if (inBox && std::hypot(x - cx, y - cy) > radii[i]) { return false; }
+    }
+    return true;
+}
+
+// Coverage of a pixel in range [0, 255], sampled on a 64 x 64 grid.
+template <typename Inside>
+float sampledCoverage(int px, int py, Inside&& inside) {
+    int count = 0;
+    for (int j = 0; j < 64; ++j) {
+        for (int i = 0; i < 64; ++i) {
+            const float x = static_cast<float>(px) + (static_cast<float>(i) + 0.5f) / 64.f;
+            const float y = static_cast<float>(py) + (static_cast<float>(j) + 0.5f) / 64.f;
+            count += inside(x, y) ? 1 : 0;
+        }
+    }
+    return static_cast<float>(count) * 255.f / 4096.f;
+}
+
+// A bitmap of four opaque quadrants: red, green, blue and black.
+Bitmap quadrants(int size) {
+    Bitmap bitmap({size, size});
+    for (int y = 0; y < size; ++y) {
+        auto* row = reinterpret_cast<uint32_t*>(bitmap.row(y));
+        for (int x = 0; x < size; ++x) {
+            const bool right = x >= size / 2;
+            const bool bottom = y >= size / 2;
+            row[x] = bottom ? (right ? 0xFF000000u : 0xFFFF0000u) : (right ? 0xFF00FF00u : 0xFF0000FFu);
+        }
+    }
+    return bitmap;
+}
+} // namespace
+
+TEST(SoftwareCanvasTest, EngineCreatesOffscreenCanvas) {
+    auto* engine = RenderEngine::from(RenderEngine::Software);
+    ASSERT_NE(engine, nullptr);
+    EXPECT_EQ(engine->type(), RenderEngine::Software);
+
+    auto canvas = engine->createOffscreenCanvas({64, 32});
+    ASSERT_NE(canvas, nullptr);
+    EXPECT_EQ(canvas->size(), Size(64, 32));
+    EXPECT_EQ(engine->createOffscreenCanvas({0, 10}), nullptr);
+}
+
+TEST(SoftwareCanvasTest, FillRectangle) {
+    auto canvas = makeCanvas(20, 20);
+    auto brush = canvas->createColorBrush(colors::Red);
+    canvas->fillRectangle({2, 2, 10, 10}, *brush);
+
+    EXPECT_EQ(canvas->pixels().colorAt(2, 2), colors::Red);
+    EXPECT_EQ(canvas->pixels().colorAt(9, 9), colors::Red);
+    EXPECT_TRUE(isWhite(*canvas, 10, 10));
+    EXPECT_TRUE(isWhite(*canvas, 1, 5));
+
+    // A half covered column blends half of the source over the destination.
+    canvas->fillRectangle({12.f, 2.f, 14.5f, 4.f}, *brush);
+    EXPECT_EQ(canvas->pixels().colorAt(13, 3), colors::Red);
+    auto edge = canvas->pixels().colorAt(14, 3);
+    EXPECT_EQ(edge.red(), 255);
+    EXPECT_NEAR(edge.green(), 128, 2);
+}
+
+TEST(SoftwareCanvasTest, PremultipliedBlending) {
+    auto canvas = makeCanvas(4, 4);
+    auto brush = canvas->createColorBrush(colors::Blue);
+    brush->setOpacity(0.5f);
+    canvas->fillRectangle({0, 0, 4, 4}, *brush);
+
+    auto c = canvas->pixels().colorAt(1, 1);
+    EXPECT_NEAR(c.red(), 128, 2);
+    EXPECT_NEAR(c.green(), 128, 2);
+    EXPECT_EQ(c.blue(), 255);
+    EXPECT_EQ(c.alpha(), 255);
+
+    // Premultiplied storage keeps transparent clears from leaking color.
+    canvas->clear(Color(255, 0, 0, 0));
+    EXPECT_EQ(canvas->pixels().pixel(0, 0), 0u);
+}
+
+TEST(SoftwareCanvasTest, Transform) {
+    auto canvas = makeCanvas(40, 40);
+    auto brush = canvas->createColorBrush(colors::Black);
+    canvas->setTransform(Transform::fromTranslate(5, 5).scale(2, 2));
+    canvas->fillRectangle({0, 0, 10, 10}, *brush);
+
+    EXPECT_TRUE(isWhite(*canvas, 4, 4));
+    EXPECT_EQ(canvas->pixels().colorAt(5, 5), colors::Black);
+    EXPECT_EQ(canvas->pixels().colorAt(24, 24), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 25, 25));
+}
+
+TEST(SoftwareCanvasTest, ClipStack) {
+    auto canvas = makeCanvas(40, 40);
+    auto brush = canvas->createColorBrush(colors::Black);
+
+    ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(10, 10, 30, 30), 0)));
+    ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(0, 0, 20, 40), 0)));
+    canvas->fillRectangle({0, 0, 40, 40}, *brush);
+    canvas->popClip();
+    canvas->popClip();
+
+    EXPECT_TRUE(isWhite(*canvas, 9, 15));
+    EXPECT_EQ(canvas->pixels().colorAt(10, 15), colors::Black);
+    EXPECT_EQ(canvas->pixels().colorAt(19, 29), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 20, 15));
+    EXPECT_TRUE(isWhite(*canvas, 15, 30));
+
+    // Rounded clips cut the corners but keep the center.
+    canvas->clear(colors::White);
+    ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(0, 0, 40, 40), 10)));
+    canvas->fillRectangle({0, 0, 40, 40}, *brush);
+    canvas->popClip();
+    EXPECT_TRUE(isWhite(*canvas, 0, 0));
+    EXPECT_TRUE(isWhite(*canvas, 39, 39));
+    EXPECT_EQ(canvas->pixels().colorAt(20, 20), colors::Black);
+    EXPECT_EQ(canvas->pixels().colorAt(0, 20), colors::Black);
+
+    EXPECT_THROW(canvas->popClip(), std::runtime_error);
+    canvas->pushClip(RoundRect(Rect(0, 0, 10, 10), 0));
+    EXPECT_EQ(canvas->endDraw(), DrawResult::Error);
+}
+
+TEST(SoftwareCanvasTest, RoundedClipMasksAreCachedBySize) {
+    auto canvas = makeCanvas(120, 120);
+    auto brush = canvas->createColorBrush(colors::Black);
+    // Cards of the same size share one mask wherever they are drawn on whole pixels.
+    for (int i = 0; i < 3; ++i) {
+        const auto offset = static_cast<float>(i * 40);
+        ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(offset, offset, offset + 30, offset + 30), 8)));
+        canvas->fillRectangle({0, 0, 120, 120}, *brush);
+        // Clipping to the content area of the card is a plain rect, clipping to the card again changes nothing.
+        ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(offset + 4, offset + 8, offset + 26, offset + 22), 0)));
+        ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(offset, offset, offset + 30, offset + 30), 8)));
+        canvas->popClip();
+        canvas->popClip();
+        canvas->popClip();
+    }
+    EXPECT_EQ(canvas->clipMasks().stats().misses, 1u);
+    EXPECT_EQ(canvas->clipMasks().stats().hits, 2u);
+    EXPECT_EQ(canvas->clipStack().stats().masks, 3u);
+    EXPECT_EQ(canvas->clipStack().stats().rects, 3u);
+    EXPECT_EQ(canvas->clipStack().stats().skipped, 3u);
+    for (int y = 0; y < 30; ++y) {
+        for (int x = 0; x < 30; ++x) {
+            ASSERT_EQ(canvas->pixels().colorAt(x + 40, y + 40), canvas->pixels().colorAt(x, y)) << x << "," << y;
+            ASSERT_EQ(canvas->pixels().colorAt(x + 80, y + 80), canvas->pixels().colorAt(x, y)) << x << "," << y;
+        }
+    }
+    EXPECT_TRUE(isWhite(*canvas, 0, 0));
+    EXPECT_TRUE(isWhite(*canvas, 29, 29));
+    EXPECT_EQ(canvas->pixels().colorAt(0, 15), colors::Black);
+    EXPECT_EQ(canvas->pixels().colorAt(15, 0), colors::Black);
+
+    // Clips reaching beyond the surface and nested rounded clips get a private mask.
+    canvas->clear(colors::White);
+    ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(-20, 0, 40, 40), 10)));
+    ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(0, 20, 60, 60), 10)));
+    canvas->fillRectangle({0, 0, 120, 120}, *brush);
+    canvas->popClip();
+    canvas->popClip();
+    EXPECT_EQ(canvas->clipMasks().size(), 2u);
+    EXPECT_EQ(canvas->pixels().colorAt(20, 30), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 1, 21));
+    EXPECT_TRUE(isWhite(*canvas, 39, 39));
+    EXPECT_TRUE(isWhite(*canvas, 20, 10));
+    EXPECT_EQ(canvas->endDraw(), DrawResult::Success);
+}
+
+TEST(SoftwareCanvasTest, Strokes) {
+    auto canvas = makeCanvas(64, 64);
+    Pen pen(colors::Black, 2.0f);
+
+    canvas->drawRectangle({10, 10, 30, 30}, pen);
+    EXPECT_EQ(canvas->pixels().colorAt(9, 20), colors::Black);
+    EXPECT_EQ(canvas->pixels().colorAt(10, 20), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 11, 20));
+    EXPECT_TRUE(isWhite(*canvas, 20, 20));
+
+    canvas->clear(colors::White);
+    canvas->drawEllipse(Ellipse({32, 32}, 20), pen);
+    EXPECT_EQ(canvas->pixels().colorAt(12, 32).red(), 0);
+    EXPECT_TRUE(isWhite(*canvas, 32, 32));
+    EXPECT_TRUE(isWhite(*canvas, 2, 2));
+
+    canvas->clear(colors::White);
+    canvas->drawRoundRect({4, 4, 60, 60}, 8, 8, pen);
+    EXPECT_EQ(canvas->pixels().colorAt(32, 4).red(), 0);
+    EXPECT_TRUE(isWhite(*canvas, 4, 4));
+    EXPECT_TRUE(isWhite(*canvas, 32, 32));
+}
+
+TEST(SoftwareCanvasTest, Lines) {
+    auto canvas = makeCanvas(64, 64);
+    Pen pen(colors::Black, 2.0f);
+
+    canvas->drawLine({0, 10, 64, 10}, pen);
+    EXPECT_EQ(canvas->pixels().colorAt(30, 9), colors::Black);
+    EXPECT_EQ(canvas->pixels().colorAt(30, 10), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 30, 11));
+
+    const geom::Line diagonals[] = {{0, 0, 63, 63}, {0, 63, 63, 0}};
+    canvas->drawLines(diagonals, pen);
+    EXPECT_LT(canvas->pixels().colorAt(40, 40).red(), 64);
+    EXPECT_LT(canvas->pixels().colorAt(20, 43).red(), 64);
+    EXPECT_TRUE(isWhite(*canvas, 50, 20 + 40));
+
+    canvas->clear(colors::White);
+    pen.setLineStyle(LineStyle::Dash);
+    canvas->drawLine({0, 32, 64, 32}, pen);
+    // Dashes are twice the stroke width long, followed by a gap of the same length.
+    EXPECT_EQ(canvas->pixels().colorAt(1, 32), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 5, 32));
+    EXPECT_EQ(canvas->pixels().colorAt(9, 32), colors::Black);
+}
+
+TEST(SoftwareCanvasTest, Text) {
+    auto canvas = makeCanvas(200, 100);
+    auto paint = canvas->createTextPaint();
+    paint->setTextSize(13.f);
+    paint->setText("hello world");
+
+    TextMetrics metrics{};
+    canvas->measureText(*paint, metrics);
+    EXPECT_EQ(metrics.lineCount, 1);
+    EXPECT_EQ(metrics.width, 88); // 11 glyphs with an advance of 8px
+    EXPECT_EQ(metrics.minWidth, 40);
+    EXPECT_EQ(metrics.height, 16);
+
+    paint->setMaxWidth(50);
+    canvas->measureText(*paint, metrics);
+    EXPECT_EQ(metrics.lineCount, 2);
+    EXPECT_EQ(metrics.width, 40);
+
+    canvas->drawText({10, 10}, *paint, Pen(colors::Black));
+    int inked = 0;
+    for (int y = 0; y < 100; ++y) {
+        for (int x = 0; x < 200; ++x) {
+            if (isWhite(*canvas, x, y)) { continue; }
+            ++inked;
+            EXPECT_GE(x, 10);
+            EXPECT_LT(x, 60);
+            EXPECT_GE(y, 10);
+            EXPECT_LT(y, 42);
+        }
+    }
+    EXPECT_GT(inked, 0);
+}
+
+TEST(SoftwareCanvasTest, TextCaches) {
+    auto cache = std::make_shared<SoftTextCache>();
+    SoftwareCanvas first({100, 40}, cache);
+    SoftwareCanvas second({100, 40}, cache);
+    first.beginDraw();
+    second.beginDraw();
+    first.clear(colors::White);
+    second.clear(colors::White);
+
+    // Paints of different canvases with the same properties share one layout.
+    auto a = first.createTextPaint();
+    auto b = second.createTextPaint();
+    a->setText("cell 42");
+    b->setText("cell 42");
+    TextMetrics metrics{};
+    first.measureText(*a, metrics);
+    second.measureText(*b, metrics);
+    EXPECT_EQ(cache->layouts.size(), 1u);
+    EXPECT_EQ(cache->layouts.stats().hits, 1u);
+
+    // Each distinct glyph is rasterized once, repeated draws only read the atlas.
+    first.drawText({2, 2}, *a, Pen(colors::Black));
+    const size_t glyphs = cache->glyphs.size();
+    EXPECT_EQ(glyphs, 5u); // c, e, l, 4 and 2
+    second.drawText({2, 2}, *b, Pen(colors::Black));
+    EXPECT_EQ(cache->glyphs.size(), glyphs);
+    const auto* lhs = first.pixels().data();
+    EXPECT_TRUE(std::equal(lhs, lhs + 100 * 40, second.pixels().data()));
+}
+
+TEST(SoftwareCanvasTest, GradientFills) {
+    auto canvas = makeCanvas(64, 64);
+    const Gradient gradient({{0.f, colors::Black}, {1.f, colors::White}});
+
+    auto linear = canvas->createLinearGradientBrush({0, 0}, {64, 0}, gradient);
+    canvas->fillRectangle({0, 0, 64, 64}, *linear);
+    EXPECT_LT(canvas->pixels().colorAt(0, 10).red(), 4);
+    EXPECT_NEAR(canvas->pixels().colorAt(32, 10).red(), 129, 2);
+    EXPECT_GT(canvas->pixels().colorAt(63, 10).red(), 251);
+    EXPECT_EQ(canvas->pixels().colorAt(32, 10), canvas->pixels().colorAt(32, 50));
+
+    auto radial = canvas->createRadialGradientBrush(Ellipse({32, 32}, 16), gradient);
+    canvas->fillRectangle({0, 0, 64, 64}, *radial);
+    EXPECT_LT(canvas->pixels().colorAt(32, 32).red(), 16);
+    EXPECT_NEAR(canvas->pixels().colorAt(40, 32).red(), 128, 8);
+    EXPECT_TRUE(isWhite(*canvas, 2, 2));
+
+    // Conic gradients start at the positive x-axis and sweep clockwise in y-down space.
+    auto conic = canvas->createConicGradientBrush({32, 32}, 0.f, gradient);
+    ASSERT_NE(conic, nullptr);
+    canvas->fillRectangle({0, 0, 64, 64}, *conic);
+    EXPECT_LT(canvas->pixels().colorAt(60, 33).red(), 16);
+    EXPECT_NEAR(canvas->pixels().colorAt(32, 60).red(), 64, 8);
+    EXPECT_NEAR(canvas->pixels().colorAt(4, 32).red(), 128, 8);
+
+    // Opacity and the transform apply like for solid brushes.
+    canvas->clear(colors::White);
+    linear->setOpacity(0.5f);
+    canvas->setTransform(Transform::fromTranslate(10, 0));
+    canvas->fillRectangle({0, 0, 10, 10}, *linear);
+    EXPECT_TRUE(isWhite(*canvas, 9, 5));
+    EXPECT_NEAR(canvas->pixels().colorAt(10, 5).red(), 128, 2);
+}
+
+TEST(SoftwareCanvasTest, GradientRampsAreShared) {
+    auto* engine = RenderEngine::from(RenderEngine::Software);
+    ASSERT_NE(engine, nullptr);
+    auto first = engine->createOffscreenCanvas({8, 8});
+    auto second = engine->createOffscreenCanvas({8, 8});
+    first->beginDraw();
+    second->beginDraw();
+
+    const Gradient gradient({{0.f, colors::Red}, {1.f, colors::Blue}});
+    auto a = first->createLinearGradientBrush({0, 0}, {8, 0}, gradient);
+    auto b = second->createRadialGradientBrush(Ellipse({4, 4}, 4), gradient);
+    first->fillRectangle({0, 0, 8, 8}, *a);
+    second->fillRectangle({0, 0, 8, 8}, *b);
+
+    const auto& cache = static_cast<SoftwareCanvas&>(*first).gradientCache();
+    EXPECT_EQ(&cache, &static_cast<SoftwareCanvas&>(*second).gradientCache());
+    EXPECT_EQ(cache.stats().misses, 1u);
+    EXPECT_GE(cache.stats().hits, 1u);
+
+    // Changing the gradient picks up another ramp on the next fill.
+    a->setGradient(Gradient({{0.f, colors::Green}, {1.f, colors::Blue}}));
+    first->fillRectangle({0, 0, 8, 8}, *a);
+    EXPECT_EQ(cache.stats().misses, 2u);
+    EXPECT_GT(static_cast<SoftwareCanvas&>(*first).pixels().colorAt(0, 0).green(), 200);
+}
+
+TEST(SoftwareCanvasTest, DrawBitmap) {
+    auto canvas = makeCanvas(32, 32);
+    const Bitmap bitmap = quadrants(4);
+
+    // Unscaled draws copy the pixels.
+    canvas->drawBitmap(bitmap, {0, 0, 4, 4}, {2, 2, 6, 6}, 1.f, BitmapSampling::Nearest);
+    EXPECT_EQ(canvas->pixels().colorAt(2, 2), colors::Red);
+    EXPECT_EQ(canvas->pixels().colorAt(5, 2), colors::Green);
+    EXPECT_EQ(canvas->pixels().colorAt(2, 5), colors::Blue);
+    EXPECT_EQ(canvas->pixels().colorAt(5, 5), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 6, 6));
+
+    // Nearest sampling keeps hard edges when upscaling, linear sampling blends across them.
+    canvas->clear(colors::White);
+    canvas->drawBitmap(bitmap, {0, 0, 4, 4}, {0, 0, 16, 16}, 1.f, BitmapSampling::Nearest);
+    EXPECT_EQ(canvas->pixels().colorAt(7, 0), colors::Red);
+    EXPECT_EQ(canvas->pixels().colorAt(8, 0), colors::Green);
+    canvas->drawBitmap(bitmap, {0, 0, 4, 4}, {16, 16, 32, 32}, 1.f, BitmapSampling::Linear);
+    EXPECT_EQ(canvas->pixels().colorAt(16, 16), colors::Red);
+    const auto blended = canvas->pixels().colorAt(24, 17);
+    EXPECT_GT(blended.red(), 64);
+    EXPECT_GT(blended.green(), 64);
+
+    // Only the source region is sampled, neighbouring pixels do not bleed in. Regions past the bitmap edge shrink
+    // the destination by the same proportion.
+    canvas->clear(colors::White);
+    canvas->drawBitmap(bitmap, {2, 0, 4, 2}, {0, 0, 8, 8}, 1.f, BitmapSampling::Linear);
+    EXPECT_EQ(canvas->pixels().colorAt(0, 7), colors::Green);
+    EXPECT_EQ(canvas->pixels().colorAt(7, 7), colors::Green);
+    canvas->drawBitmap(bitmap, {2, 2, 6, 6}, {16, 16, 24, 24}, 1.f, BitmapSampling::Nearest);
+    EXPECT_EQ(canvas->pixels().colorAt(19, 19), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 20, 20));
+
+    // Opacity, the transform and clips apply like for fills.
+    canvas->clear(colors::White);
+    canvas->setTransform(Transform::fromTranslate(8, 8).scale(2, 2));
+    ASSERT_TRUE(canvas->pushClip(RoundRect(Rect(0, 0, 2, 4), 0)));
+    canvas->drawBitmap(bitmap, {0, 0, 4, 4}, {0, 0, 4, 4}, 0.5f, BitmapSampling::Nearest);
+    canvas->popClip();
+    const auto faded = canvas->pixels().colorAt(8, 8);
+    EXPECT_EQ(faded.red(), 255);
+    EXPECT_NEAR(faded.green(), 128, 2);
+    EXPECT_TRUE(isWhite(*canvas, 12, 8));
+    EXPECT_TRUE(isWhite(*canvas, 7, 8));
+}
+
+TEST(SoftwareCanvasTest, DrawBitmapConvertsFormats) {
+    auto canvas = makeCanvas(4, 4);
+    // Half transparent blue in straight RGBA and premultiplied BGRA.
+    uint8_t straight[4]{0, 0, 255, 128};
+    uint8_t bgra[4]{128, 0, 0, 128};
+    const Bitmap first = Bitmap::wrap(straight, {1, 1}, 4, PixelFormat::RGBA8);
+    const Bitmap second = Bitmap::wrap(bgra, {1, 1}, 4, PixelFormat::BGRA8Premultiplied);
+    canvas->drawBitmap(first, {0, 0, 1, 1}, {0, 0, 2, 4}, 1.f, BitmapSampling::Linear);
+    canvas->drawBitmap(second, {0, 0, 1, 1}, {2, 0, 4, 4}, 1.f, BitmapSampling::Linear);
+    EXPECT_EQ(canvas->pixels().colorAt(1, 2), canvas->pixels().colorAt(3, 2));
+    EXPECT_EQ(canvas->pixels().colorAt(1, 2).blue(), 255);
+    EXPECT_NEAR(canvas->pixels().colorAt(1, 2).red(), 127, 2);
+}
+
+TEST(SoftwareCanvasTest, DrawBitmapUsesMipLevels) {
+    // A fine checkerboard drawn at a quarter of its size averages to gray when sampled from a mip level, while
+    // sampling the full resolution would only pick pixels of one color.
+    Bitmap checker({64, 64});
+    for (int y = 0; y < 64; ++y) {
+        auto* row = reinterpret_cast<uint32_t*>(checker.row(y));
+        for (int x = 0; x < 64; ++x) { row[x] = (x + y) % 2 == 0 ? 0xFF000000u : 0xFFFFFFFFu; }
+    }
+    auto canvas = makeCanvas(16, 16);
+    canvas->drawBitmap(checker, {0, 0, 64, 64}, {0, 0, 16, 16}, 1.f, BitmapSampling::Nearest);
+    const int aliased = canvas->pixels().colorAt(5, 5).red();
+    EXPECT_TRUE(aliased == 0 || aliased == 255);
+
+    checker.setImmutable();
+    canvas->drawBitmap(checker, {0, 0, 64, 64}, {0, 0, 16, 16}, 1.f, BitmapSampling::Nearest);
+    EXPECT_NEAR(canvas->pixels().colorAt(5, 5).red(), 128, 1);
+    EXPECT_EQ(checker.mipLevel(2).width(), 16);
+}
+
+TEST(SoftwareCanvasTest, FillRectsMergesSharedEdges) {
+    // Cells meeting at a fractional edge are filled as one rect, so the seam is not blended twice.
+    auto batched = makeCanvas(24, 24);
+    auto brush = batched->createColorBrush(colors::Blue);
+    brush->setOpacity(0.5f);
+    const Rect cells[] = {{0, 0, 10.5f, 8}, {10.5f, 0, 24, 8}, {0, 8, 10.5f, 16}, {10.5f, 8, 24, 16}};
+    batched->fillRects(cells, *brush);
+
+    auto single = makeCanvas(24, 24);
+    auto other = single->createColorBrush(colors::Blue);
+    other->setOpacity(0.5f);
+    single->fillRectangle({0, 0, 24, 16}, *other);
+    EXPECT_EQ(batched->pixels().colorAt(10, 4), single->pixels().colorAt(10, 4));
+    for (int y = 0; y < 24; ++y) {
+        for (int x = 0; x < 24; ++x) { ASSERT_EQ(batched->pixels().pixel(x, y), single->pixels().pixel(x, y)); }
+    }
+
+    // Rects that only overlap or touch partially are filled one by one.
+    const Rect overlapping[] = {{0, 0, 8, 8}, {4, 4, 12, 12}};
+    batched->clear(colors::White);
+    batched->fillRects(overlapping, *brush);
+    EXPECT_NE(batched->pixels().colorAt(6, 6), batched->pixels().colorAt(2, 2));
+}
+
+TEST(SoftwareCanvasTest, BatchedLinesAndRects) {
+    const Pen pen(colors::Black, 2.0f);
+    const geom::Line grid[] = {{0, 8, 32, 8}, {0, 16, 32, 16}, {8, 0, 8, 32}, {0, 0, 32, 32}};
+    const Rect frames[] = {{4, 4, 12, 12}, {20, 20, 28, 28}};
+
+    auto batched = makeCanvas(32, 32);
+    batched->drawLines(grid, pen);
+    batched->drawRects(frames, pen);
+
+    auto single = makeCanvas(32, 32);
+    for (const auto& line : grid) { single->drawLine(line, pen); }
+    for (const auto& rect : frames) { single->drawRectangle(rect, pen); }
+    for (int y = 0; y < 32; ++y) {
+        for (int x = 0; x < 32; ++x) { ASSERT_EQ(batched->pixels().pixel(x, y), single->pixels().pixel(x, y)); }
+    }
+    EXPECT_EQ(batched->pixels().colorAt(20, 8), colors::Black);
+}
+
+TEST(SoftwareCanvasTest, DrawNinePatch) {
+    NinePatch patch(quadrants(4), {1, 1, 3, 3});
+    auto canvas = makeCanvas(20, 20);
+    canvas->clear(colors::White);
+    patch.draw(*canvas, {0, 0, 20, 20}, 1.f, BitmapSampling::Nearest);
+    EXPECT_EQ(canvas->pixels().colorAt(0, 0), colors::Red);
+    EXPECT_EQ(canvas->pixels().colorAt(19, 0), colors::Green);
+    EXPECT_EQ(canvas->pixels().colorAt(0, 19), colors::Blue);
+    EXPECT_EQ(canvas->pixels().colorAt(19, 19), colors::Black);
+
+    // The stretched center keeps the split between the quadrants in the middle.
+    EXPECT_EQ(canvas->pixels().colorAt(9, 9), colors::Red);
+    EXPECT_EQ(canvas->pixels().colorAt(10, 10), colors::Black);
+}
+
+TEST(SoftwareCanvasTest, FillPath) {
+    auto canvas = makeCanvas(40, 40);
+    auto brush = canvas->createColorBrush(colors::Black);
+    Path path;
+    path.addRect({0, 0, 10, 10});
+    canvas->setTransform(Transform::fromTranslate(5, 5).scale(2, 2));
+    canvas->fillPath(path, *brush);
+    // Pixel-aligned path edges match fillRectangle().
+    EXPECT_TRUE(isWhite(*canvas, 4, 4));
+    EXPECT_EQ(canvas->pixels().colorAt(5, 5), colors::Black);
+    EXPECT_EQ(canvas->pixels().colorAt(24, 24), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 25, 25));
+
+    // Curves are flattened for the scale of the transform and their edges are anti-aliased.
+    canvas->clear(colors::White);
+    canvas->setTransform({});
+    Path circle;
+    circle.addEllipse(Ellipse({20, 20}, 15, 15));
+    const Gradient red({{0.f, colors::Red}, {1.f, colors::Red}});
+    auto gradient = canvas->createLinearGradientBrush({0, 0}, {40, 0}, red);
+    canvas->fillPath(circle, *gradient);
+    EXPECT_EQ(canvas->pixels().colorAt(20, 20), colors::Red);
+    EXPECT_TRUE(isWhite(*canvas, 6, 6));
+    const Color edge = canvas->pixels().colorAt(30, 30);
+    EXPECT_EQ(edge.red(), 255);
+    EXPECT_GT(edge.green(), 0);
+    EXPECT_LT(edge.green(), 255);
+}
+
+TEST(SoftwareCanvasTest, FillRoundRect) {
+    auto canvas = makeCanvas(48, 40);
+    auto brush = canvas->createColorBrush(colors::Black);
+    const RoundRect shape({3.3f, 2.6f, 44.8f, 37.1f}, CornerRadius(6.5f, 0.f, 12.25f, 3.f));
+    canvas->fillRoundRect(shape, *brush);
+    for (int y = 0; y < 40; ++y) {
+        for (int x = 0; x < 48; ++x) {
+            const float expected = sampledCoverage(x, y, [&](float sx, float sy) {
+                return insideRoundRect(shape, sx, sy);
+            });
+            ASSERT_NEAR(darkness(*canvas, x, y), expected, 3.f) << "at " << x << "," << y;
+        }
+    }
+}
+
+TEST(SoftwareCanvasTest, FillEllipse) {
+    auto canvas = makeCanvas(48, 40);
+    const Gradient black({{0.f, colors::Black}, {1.f, colors::Black}});
+    auto gradient = canvas->createLinearGradientBrush({0, 0}, {48, 0}, black);
+    const Ellipse ellipse({20.4f, 18.7f}, 14.2f, 9.5f);
+    canvas->fillEllipse(ellipse, *gradient);
+    for (int y = 0; y < 40; ++y) {
+        for (int x = 0; x < 48; ++x) {
+            const float expected = sampledCoverage(x, y, [&](float sx, float sy) {
+                const float dx = (sx - ellipse.center.x) / ellipse.radiusX;
+                const float dy = (sy - ellipse.center.y) / ellipse.radiusY;
+                return dx * dx + dy * dy <= 1.f;
+            });
+            ASSERT_NEAR(darkness(*canvas, x, y), expected, 3.f) << "at " << x << "," << y;
+        }
+    }
+}
+
+TEST(SoftwareCanvasTest, StrokeRoundRect) {
+    auto canvas = makeCanvas(48, 40);
+    const RoundRect shape({6.5f, 5.25f, 41.f, 34.6f}, CornerRadius(8.f, 0.f, 2.f, 11.f));
+    canvas->drawRoundRect(shape, Pen(colors::Black, 3.f));
+
+    // The stroke is the ring between both offsets of the outline, sharp corners get round joins on the outside.
+    const float hw = 1.5f;
+    auto grow = [hw](float r) { return r > 0.f ? r + hw : hw; };
+    auto shrink = [hw](float r) { return std::max(r - hw, 0.f); };
+    const CornerRadius& r = shape.radii;
+    const RoundRect outer(
+        shape.rect.inflated(hw, hw),
+        CornerRadius(grow(r.topLeft), grow(r.topRight), grow(r.bottomLeft), grow(r.bottomRight))
+    );
+    const RoundRect inner(
+        shape.rect.inflated(-hw, -hw),
+        CornerRadius(shrink(r.topLeft), shrink(r.topRight), shrink(r.bottomLeft), shrink(r.bottomRight))
+    );
+    for (int y = 0; y < 40; ++y) {
+        for (int x = 0; x < 48; ++x) {
+            const float expected = sampledCoverage(x, y, [&](float sx, float sy) {
+                return insideRoundRect(outer, sx, sy) && !insideRoundRect(inner, sx, sy);
+            });
+            ASSERT_NEAR(darkness(*canvas, x, y), expected, 4.f) << "at " << x << "," << y;
+        }
+    }
+}
+
+TEST(SoftwareCanvasTest, CornerMasksAreCachedByRadius) {
+    auto canvas = makeCanvas(200, 200);
+    auto brush = canvas->createColorBrush(colors::Black);
+    // Cards on whole pixels share one mask for all of their corners.
+    for (int i = 0; i < 16; ++i) {
+        const auto offset = static_cast<float>(i % 4 * 50);
+        canvas->fillRoundRect(RoundRect({offset, offset, offset + 40, offset + 30}, 8), *brush);
+    }
+    EXPECT_EQ(canvas->cornerMasks().stats().misses, 1u);
+    EXPECT_EQ(canvas->cornerMasks().stats().hits, 63u);
+
+    // A half pixel offset changes the phase of the corners.
+    canvas->fillRoundRect(RoundRect({10.5f, 10, 50.5f, 40}, 8), *brush);
+    EXPECT_EQ(canvas->cornerMasks().stats().misses, 2u);
+
+    // Corners too large for the cache are rendered from their distance field instead.
+    canvas->fillRoundRect(RoundRect({0, 0, 200, 200}, 90), *brush);
+    EXPECT_EQ(canvas->cornerMasks().size(), 2u);
+    EXPECT_EQ(canvas->pixels().colorAt(100, 100), colors::Black);
+    EXPECT_TRUE(isWhite(*canvas, 1, 1));
+}
+
+TEST(SoftwareCanvasTest, PenValue) {
+    Pen a(colors::Red, 2.0f);
+    Pen b = a;
+    EXPECT_EQ(a, b);
+    EXPECT_TRUE(a.isSimpleStroke());
+
+    b.setCustomDash({1, 2});
+    EXPECT_EQ(b.lineStyle(), LineStyle::CustomDash);
+    EXPECT_FALSE(a == b);
+    EXPECT_FALSE(b.isSimpleStroke());
+
+    b.setStrokeWidth(-1.0f);
+    EXPECT_EQ(b.strokeWidth(), 0.0f);
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "graphics/software/blend-inl.h"
+#include "graphics/software/span_kernels.h"
+
+using namespace bix;
+using namespace bix::pixel;
+
+namespace {
+// Random pixels biased towards the special cases the kernels take shortcuts for.
+struct SpanData {
+    explicit SpanData(unsigned seed) : rng(seed) {}
+
+    uint32_t premultiplied() {
+        const uint32_t a = pick({0, 255}, 3);
+        return premultiplyPixel(pack(byte(), byte(), byte(), a));
+    }
+
+    uint8_t coverage() { return static_cast<uint8_t>(pick({0, 255}, 2)); }
+
+    std::vector<uint32_t> row(size_t n) {
+        std::vector<uint32_t> out(n);
+        for (auto& p : out) { p = premultiplied(); }
+        return out;
+    }
+
+    std::vector<uint8_t> mask(size_t n) {
+        std::vector<uint8_t> out(n);
+        // Runs of equal coverage exercise the all-clear and all-covered block paths.
+        for (size_t i = 0; i < n; i += 8) {
+            const uint8_t c = coverage();
+            const bool solid = (rng() & 1) != 0;
+            for (size_t k = i; k < std::min(n, i + 8); ++k) { out[k] = solid ? c : coverage(); }
+        }
+        return out;
+    }
+
+    uint32_t byte() { return rng() & 0xFF; }
+
+    uint32_t pick(std::initializer_list<uint32_t> special, uint32_t oneIn) {
+        if (rng() % oneIn != 0) { return byte(); }
+        return *(special.begin() + rng() % special.size());
+    }
+
+    std::mt19937 rng;
+};
+
+std::vector<const SpanKernels*> vectorizedKernels() {
+    std::vector<const SpanKernels*> out;
+    for (auto level : {SimdLevel::SSE2, SimdLevel::AVX2}) {
+        if (auto* kernels = spanKernels(level)) { out.push_back(kernels); }
+    }
+    return out;
+}
+} // namespace
+
+TEST(SpanKernelsTest, Dispatch) {
+    const auto& best = spanKernels();
+    EXPECT_EQ(best.level, detectSimdLevel());
+    ASSERT_NE(spanKernels(SimdLevel::Scalar), nullptr);
+    EXPECT_EQ(spanKernels(SimdLevel::Scalar)->level, SimdLevel::Scalar);
+}
+
+TEST(SpanKernelsTest, ScalarReference) {
+    // Opaque source with full coverage replaces the destination, zero coverage keeps it.
+    std::vector<uint32_t> row(5, pack(10, 20, 30, 255));
+    const uint8_t mask[5] = {255, 0, 128, 255, 0};
+    scalarSpanKernels().blendMask(row.data(), mask, 5, pack(200, 0, 0, 255));
+    EXPECT_EQ(row[0], pack(200, 0, 0, 255));
+    EXPECT_EQ(row[1], pack(10, 20, 30, 255));
+    EXPECT_EQ(row[2], srcOver(mul255(pack(200, 0, 0, 255), 128), pack(10, 20, 30, 255)));
+
+    uint32_t p = pack(255, 128, 0, 128);
+    scalarSpanKernels().premultiply(&p, 1);
+    EXPECT_EQ(p, pack(128, 64, 0, 128));
+    scalarSpanKernels().unpremultiply(&p, 1);
+    EXPECT_EQ(p, pack(255, 128, 0, 128));
+}
+
+TEST(SpanKernelsTest, VectorizedMatchScalar) {
+    const auto& scalar = scalarSpanKernels();
+    SpanData data(7);
+    for (const auto* kernels : vectorizedKernels()) {
+        SCOPED_TRACE(static_cast<int>(kernels->level));
+        for (size_t n : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 16u, 31u, 64u, 133u}) {
+            for (int round = 0; round < 20; ++round) {
+                const auto dst = data.row(n);
+                const auto src = data.row(n);
+                const auto mask = data.mask(n);
+                const uint32_t color = data.premultiplied();
+                const uint8_t coverage = data.coverage();
+                const int count = static_cast<int>(n);
+
+                auto expected = dst;
+                auto actual = dst;
+                scalar.fill(expected.data(), count, color);
+                kernels->fill(actual.data(), count, color);
+                EXPECT_EQ(actual, expected);
+
+                expected = actual = dst;
+                scalar.blendSolid(expected.data(), count, color, coverage);
+                kernels->blendSolid(actual.data(), count, color, coverage);
+                EXPECT_EQ(actual, expected);
+
+                expected = actual = dst;
+                scalar.blendMask(expected.data(), mask.data(), count, color);
+                kernels->blendMask(actual.data(), mask.data(), count, color);
+                EXPECT_EQ(actual, expected);
+
+                expected = actual = dst;
+                scalar.blendSpan(expected.data(), src.data(), count, coverage);
+                kernels->blendSpan(actual.data(), src.data(), count, coverage);
+                EXPECT_EQ(actual, expected);
+
+                expected = actual = dst;
+                scalar.multiplyOpacity(expected.data(), count, coverage);
+                kernels->multiplyOpacity(actual.data(), count, coverage);
+                EXPECT_EQ(actual, expected);
+
+                expected = actual = dst;
+                scalar.premultiply(expected.data(), count);
+                kernels->premultiply(actual.data(), count);
+                EXPECT_EQ(actual, expected);
+
+                expected = actual = dst;
+                scalar.unpremultiply(expected.data(), count);
+                kernels->unpremultiply(actual.data(), count);
+                EXPECT_EQ(actual, expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/graphics/colors.h>
+#include <bixlib/graphics/pen.h>
+
+#include <gtest/gtest.h>
+
+using namespace bix;
+
+TEST(StrokeStyleTest, ValueSemantics) {
+    StrokeStyle a(2.f);
+    StrokeStyle b = a.withWidth(2.f);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_TRUE(a.isSimple());
+
+    b.setCustomDash({2, 1});
+    EXPECT_EQ(b.lineStyle(), LineStyle::CustomDash);
+    EXPECT_FALSE(a == b);
+    EXPECT_FALSE(b.isSimple());
+
+    // Invalid values are clamped or ignored.
+    EXPECT_EQ(StrokeStyle(-1.f).width(), 0.f);
+    EXPECT_EQ(StrokeStyle(-0.f).hash(), StrokeStyle(0.f).hash());
+    a.setMiterLimit(0.5f);
+    EXPECT_EQ(a.miterLimit(), 10.f);
+}
+
+TEST(StrokeStyleTest, CacheInternsEqualStyles) {
+    StrokeStyleCache cache;
+    StrokeStyle dashed(1.f);
+    dashed.setLineStyle(LineStyle::Dash);
+
+    StrokeStyleRef first = cache.intern(dashed);
+    EXPECT_EQ(cache.intern(StrokeStyle(dashed)), first);
+    EXPECT_NE(cache.intern(dashed.withWidth(3.f)), first);
+    EXPECT_EQ(cache.size(), 2u);
+
+    // Entries only hold weak references, released styles are purged.
+    first.reset();
+    cache.purge();
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(StrokeStyleTest, PensShareInternedStrokes) {
+    Pen a(colors::Red, 2.f);
+    Pen b(colors::Blue, 2.f);
+    EXPECT_EQ(a.strokeStyleRef(), b.strokeStyleRef());
+    EXPECT_EQ(Pen().strokeStyleRef(), Pen(colors::Black).strokeStyleRef());
+
+    // Modifying a pen interns the new stroke and leaves copies untouched.
+    Pen c = a;
+    c.setLineJoin(LineJoinStyle::Round);
+    EXPECT_NE(c.strokeStyleRef(), a.strokeStyleRef());
+    EXPECT_EQ(a.lineJoin(), LineJoinStyle::Miter);
+    b.setLineJoin(LineJoinStyle::Round);
+    EXPECT_EQ(c.strokeStyleRef(), b.strokeStyleRef());
+
+    b.setColor(colors::Red);
+    EXPECT_EQ(b, c);
+}
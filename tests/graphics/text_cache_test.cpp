@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/graphics/text_cache.h>
+
+#include <gtest/gtest.h>
+
+using namespace bix;
+
+namespace {
+TextLayoutKey makeKey(const std::string& text, float size = 12.f) {
+    TextLayoutKey key;
+    key.text = text;
+    key.textSize = size;
+    return key;
+}
+
+GlyphAtlas::Key glyphKey(uint32_t glyph, float size = 12.f) {
+    return {glyph, 0, GlyphAtlas::quantize(size), GlyphAtlas::quantize(size), 0};
+}
+} // namespace
+
+TEST(TextLayoutCacheTest, KeyIdentity) {
+    EXPECT_EQ(makeKey("abc"), makeKey("abc"));
+    EXPECT_EQ(makeKey("abc").hash(), makeKey("abc").hash());
+    EXPECT_FALSE(makeKey("abc") == makeKey("abd"));
+    EXPECT_FALSE(makeKey("abc") == makeKey("abc", 13.f));
+
+    auto wrapped = makeKey("abc");
+    wrapped.maxWidth = 40;
+    EXPECT_FALSE(wrapped == makeKey("abc"));
+}
+
+TEST(TextLayoutCacheTest, EvictsLeastRecentlyUsed) {
+    TextLayoutCache<int> cache(2);
+    int created = 0;
+    auto create = [&created] { return std::make_shared<const int>(++created); };
+
+    EXPECT_EQ(*cache.obtain(makeKey("a"), create), 1);
+    EXPECT_EQ(*cache.obtain(makeKey("b"), create), 2);
+    EXPECT_EQ(*cache.obtain(makeKey("a"), create), 1);
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().misses, 2u);
+
+    // "b" is the least recently used entry and makes room for "c".
+    EXPECT_EQ(*cache.obtain(makeKey("c"), create), 3);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.stats().evictions, 1u);
+    EXPECT_NE(cache.find(makeKey("a")), nullptr);
+    EXPECT_EQ(cache.find(makeKey("b")), nullptr);
+}
+
+TEST(TextLayoutCacheTest, LayoutOutlivesEviction) {
+    TextLayoutCache<int> cache(1);
+    auto layout = cache.obtain(makeKey("a"), [] { return std::make_shared<const int>(7); });
+    cache.insert(makeKey("b"), std::make_shared<const int>(8));
+    EXPECT_EQ(cache.find(makeKey("a")), nullptr);
+    EXPECT_EQ(*layout, 7);
+}
+
+TEST(GlyphAtlasTest, StoresMasks) {
+    GlyphAtlas atlas(64, 2);
+    EXPECT_EQ(atlas.find(glyphKey('A')), nullptr);
+
+    const std::vector<uint8_t> mask = {1, 2, 3, 4, 5, 6};
+    const auto* entry = atlas.insert(glyphKey('A'), 3, 2, mask.data());
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->width, 3);
+    EXPECT_EQ(entry->height, 2);
+    EXPECT_EQ(atlas.row(*entry, 1)[2], 6);
+
+    const auto* found = atlas.find(glyphKey('A'));
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(atlas.row(*found, 0)[0], 1);
+    EXPECT_EQ(atlas.find(glyphKey('A', 13.f)), nullptr);
+    EXPECT_EQ(atlas.stats().hits, 1u);
+
+    // Masks that can never fit a page are rejected.
+    const std::vector<uint8_t> huge(static_cast<size_t>(80 * 4), 255);
+    EXPECT_EQ(atlas.insert(glyphKey('B'), 80, 4, huge.data()), nullptr);
+}
+
+TEST(GlyphAtlasTest, EvictsLeastRecentlyUsedPage) {
+    // Each 31x31 mask plus its gutter takes a quarter of a 64 px page.
+    GlyphAtlas atlas(64, 2);
+    const std::vector<uint8_t> mask(static_cast<size_t>(31 * 31), 128);
+    for (uint32_t g = 0; g < 8; ++g) { ASSERT_NE(atlas.insert(glyphKey(g), 31, 31, mask.data()), nullptr); }
+    EXPECT_EQ(atlas.pageCount(), 2);
+    EXPECT_EQ(atlas.size(), 8u);
+
+    // Touch the first page so that the second one is evicted by the next insertion.
+    ASSERT_NE(atlas.find(glyphKey(0)), nullptr);
+    const uint64_t version = atlas.pageVersion(1);
+    const auto* entry = atlas.insert(glyphKey(100), 31, 31, mask.data());
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->page, 1);
+    EXPECT_NE(atlas.pageVersion(1), version);
+    EXPECT_EQ(atlas.stats().evictions, 1u);
+    EXPECT_EQ(atlas.size(), 5u);
+    EXPECT_NE(atlas.find(glyphKey(3)), nullptr);
+    EXPECT_EQ(atlas.find(glyphKey(4)), nullptr);
+}
@@ -17,20 +17,12 @@
 
 #include "memory_sniffer.h"
 
-#include <MinHook.h>
 #include <iomanip>
 #include <ios>
 #include <sstream>
 
 namespace bix::test {
 
-typedef void*(__cdecl* MallocFuncPtr)(size_t);
-typedef void*(__cdecl* CallocFuncPtr)(size_t, size_t);
-typedef void*(__cdecl* ReallocFuncPtr)(void*, size_t);
-typedef void(__cdecl* FreeFuncPtr)(void*);
-
-static thread_local bool gIsInHook = false;
-
 std::string formatMemoryStats(const MemoryStats& stats, const std::string& tag) {
     std::stringstream ss;
     auto diff = static_cast<long long>(stats.allocCount) - static_cast<long long>(stats.freeCount);
@@ -92,68 +84,13 @@ MemoryStats MemorySniffer::getStatsSnapshot() {
             sniffer.mCurrentUsage.load(), sniffer.mPeakUsage.load()};
 }
 
-MemorySniffer::MemorySniffer() {
-    if (MH_Initialize() != MH_OK) {}
-}
-
-MemorySniffer::~MemorySniffer() {
-    removeHook();
-    MH_Uninitialize();
-}
-
 MemorySniffer& MemorySniffer::getInstance() {
     static MemorySniffer instance;
     return instance;
 }
 
-void* __cdecl MemorySniffer::hookedMalloc(size_t size) {
-    auto& sniffer = getInstance();
-    void* ptr = reinterpret_cast<MallocFuncPtr>(sniffer.mMallocTarget.origAddr)(size);
-    if (ptr && !gIsInHook && sniffer.isActive()) {
-        gIsInHook = true;
-        sniffer.recordAllocation(ptr);
-        gIsInHook = false;
-    }
-    return ptr;
-}
-
-void* __cdecl MemorySniffer::hookedCalloc(size_t count, size_t size) {
-    auto& sniffer = getInstance();
-    void* ptr = reinterpret_cast<CallocFuncPtr>(sniffer.mCallocTarget.origAddr)(count, size);
-    if (ptr && !gIsInHook && sniffer.isActive()) {
-        gIsInHook = true;
-        sniffer.recordAllocation(ptr);
-        gIsInHook = false;
-    }
-    return ptr;
-}
-
-void* __cdecl MemorySniffer::hookedRealloc(void* ptr, size_t size) {
-    // Capture old size before realloc potentially invalidates the pointer
-    size_t oldSize = ptr && !gIsInHook ? _msize(ptr) : 0;
-    auto& sniffer = getInstance();
-    void* newPtr = reinterpret_cast<ReallocFuncPtr>(sniffer.mReallocTarget.origAddr)(ptr, size);
-
-    if (newPtr && !gIsInHook && sniffer.isActive()) {
-        gIsInHook = true;
-        sniffer.recordRealloc(oldSize, newPtr);
-        gIsInHook = false;
-    }
-    return newPtr;
-}
-
-void __cdecl MemorySniffer::hookedFree(void* ptr) {
-    auto& sniffer = getInstance();
-    if (ptr && !gIsInHook && sniffer.isActive()) {
-        gIsInHook = true;
-        sniffer.recordFree(ptr);
-        gIsInHook = false;
-    }
-    reinterpret_cast<FreeFuncPtr>(sniffer.mFreeTarget.origAddr)(ptr);
-}
-
 void MemorySniffer::recordAllocation(void* ptr) {
-    size_t actualSize = _msize(ptr);
+    size_t actualSize = usableSize(ptr);
     mAllocCount.fetch_add(1);
     mTotalBytes.fetch_add(actualSize);
     size_t current = mCurrentUsage.fetch_add(actualSize) + actualSize;
@@ -162,11 +99,11 @@ void MemorySniffer::recordAllocation(void* ptr) {
 
 void MemorySniffer::recordFree(void* ptr) {
     mFreeCount.fetch_add(1);
-    mCurrentUsage.fetch_sub(_msize(ptr));
+    mCurrentUsage.fetch_sub(usableSize(ptr));
 }
 
 void MemorySniffer::recordRealloc(size_t oldSize, void* newPtr) {
-    size_t newSize = _msize(newPtr);
+    size_t newSize = usableSize(newPtr);
     mCurrentUsage.fetch_sub(oldSize);
     size_t current = mCurrentUsage.fetch_add(newSize) + newSize;
     if (newSize > oldSize)
@@ -180,68 +117,4 @@ void MemorySniffer::updatePeak(size_t current) {
         ;
 }
 
-void MemorySniffer::applyHook() {
-    std::lock_guard lock(mHookMutex);
-    if (mIsHooked) {
-        return;
-    }
-    HMODULE hMod = GetModuleHandleA("ucrtbase.dll");
-    if (!hMod) {
-        hMod = GetModuleHandleA("ucrtbased.dll");
-    }
-    if (!hMod) {
-        hMod = GetModuleHandleA("msvcrt.dll");
-    }
-    if (!hMod) {
-        return;
-    }
-
-    auto installHook = [&](const char* name, HookTarget& target, LPVOID detour) {
-        if (target.state == HookState::Enabled) {
-            return;
-        }
-        if (!target.targetAddr) {
-            target.targetAddr = reinterpret_cast<LPVOID>(GetProcAddress(hMod, name));
-            if (!target.targetAddr) {
-                return;
-            }
-        }
-        if (target.state == HookState::None) {
-            if (MH_CreateHook(target.targetAddr, detour, &target.origAddr) != MH_OK) {
-                return;
-            }
-            target.state = HookState::Created;
-        }
-        if (MH_EnableHook(target.targetAddr) == MH_OK) {
-            target.state = HookState::Enabled;
-        }
-    };
-    installHook("malloc", mMallocTarget, reinterpret_cast<LPVOID>(&hookedMalloc));
-    installHook("calloc", mCallocTarget, reinterpret_cast<LPVOID>(&hookedCalloc));
-    installHook("realloc", mReallocTarget, reinterpret_cast<LPVOID>(&hookedRealloc));
-    installHook("free", mFreeTarget, reinterpret_cast<LPVOID>(&hookedFree));
-    mIsHooked = true;
-}
-
-void MemorySniffer::removeHook() {
-    std::lock_guard lock(mHookMutex);
-    if (!mIsHooked) {
-        return;
-    }
-
-    auto disableHook = [&](HookTarget& target) {
-        if (target.state != HookState::Enabled) {
-            return;
-        }
-        if (MH_DisableHook(target.targetAddr) == MH_OK) {
-            target.state = HookState::Disabled;
-        }
-    };
-
-    disableHook(mMallocTarget);
-    disableHook(mCallocTarget);
-    disableHook(mReallocTarget);
-    disableHook(mFreeTarget);
-    mIsHooked = false;
-}
 } // namespace bix::test
@@ -17,7 +17,15 @@
 
 #pragma once
 #include <atomic>
+#include <cstddef>
 #include <mutex>
+#include <string>
+
+#ifdef _WIN32
+#define BIX_SNIFFER_CDECL __cdecl
+#else
+#define BIX_SNIFFER_CDECL
+#endif
 
 /**
  * @namespace bix::test
@@ -64,7 +72,9 @@ struct HookTarget {
 /**
  * Singleton class that hooks CRT allocation functions to monitor memory usage.
  *
- * @note This class uses MinHook to intercept ucrtbase.dll/msvcrt.dll.
+ * @note On Windows this class uses MinHook to intercept ucrtbase.dll/msvcrt.dll. On Linux the test executable
+ * interposes malloc, calloc, realloc, free and the aligned allocation functions of glibc and forwards them to the
+ * __libc_* implementations, which also covers operator new and delete.
  * @warning Do not use complex STL containers inside recording methods to avoid recursion.
  */
 class MemorySniffer {
@@ -117,6 +127,18 @@ public:
      */
     static MemoryStats getStatsSnapshot();
 
+    /** * @name Hook Entry Points
+     * Static members serve as raw function pointers for MinHook and as forwarding targets of the Linux
+     * interposers. Must use __cdecl to match CRT calling convention.
+     * @{
+     */
+    static void* BIX_SNIFFER_CDECL hookedMalloc(size_t size);
+    static void* BIX_SNIFFER_CDECL hookedCalloc(size_t count, size_t size);
+    static void* BIX_SNIFFER_CDECL hookedRealloc(void* ptr, size_t size);
+    static void* BIX_SNIFFER_CDECL hookedMemalign(size_t alignment, size_t size);
+    static void BIX_SNIFFER_CDECL hookedFree(void* ptr);
+    /** @} */
+
 private:
     std::atomic_int mRefCount{0};
     std::mutex mHookMutex;
@@ -141,16 +163,6 @@ private:
      */
     static MemorySniffer& getInstance();
 
-    /** * @name Hook Entry Points
-     * Static members serve as raw function pointers for MinHook.
-     * Must use __cdecl to match CRT calling convention.
-     * @{
-     */
-    static void* __cdecl hookedMalloc(size_t size);
-    static void* __cdecl hookedCalloc(size_t count, size_t size);
-    static void* __cdecl hookedRealloc(void* ptr, size_t size);
-    static void __cdecl hookedFree(void* ptr);
-    /** @} */
 
     /** @name Internal Recording Methods
      * Logic for updating atomic counters.
@@ -162,8 +174,36 @@ private:
     void updatePeak(size_t current);
     ///@}
 
+    /** Returns the usable size of a heap block, _msize() on Windows and malloc_usable_size() on Linux. */
+    static size_t usableSize(void* ptr);
+
     void applyHook();
     void removeHook();
 };
 
+/**
+ * Counts the allocations made between its construction and destruction.
+ *
+ * Used to put an allocation budget on hot paths, see BIX_EXPECT_ALLOCATIONS_LE in alloc_budget.h. The counters
+ * are process wide, allocations made by other threads during the scope are counted as well.
+ */
+class AllocationScope {
+public:
+    AllocationScope() : mBegin(MemorySniffer::enable()) {}
+
+    ~AllocationScope() { MemorySniffer::disable(); }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    /** Returns the number of allocations made so far within the scope. */
+    size_t allocations() const { return MemorySniffer::getStatsSnapshot().allocCount - mBegin.allocCount; }
+
+    /** Returns the number of bytes allocated so far within the scope. */
+    size_t bytes() const { return MemorySniffer::getStatsSnapshot().totalAllocated - mBegin.totalAllocated; }
+
+private:
+    MemoryStats mBegin;
+};
+
 } // namespace bix::test
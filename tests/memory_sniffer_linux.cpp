@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory_sniffer.h"
+
+#include <cerrno>
+#include <malloc.h>
+
+// The glibc implementations behind malloc and friends, exported so that interposers can forward to them without
+// dlsym(), which allocates itself.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace bix::test {
+
+static thread_local bool gIsInHook = false;
+
+MemorySniffer::MemorySniffer() = default;
+
+MemorySniffer::~MemorySniffer() {
+    removeHook();
+}
+
+void* MemorySniffer::hookedMalloc(size_t size) {
+    void* ptr = __libc_malloc(size);
+    if (ptr && !gIsInHook && isActive()) {
+        gIsInHook = true;
+        getInstance().recordAllocation(ptr);
+        gIsInHook = false;
+    }
+    return ptr;
+}
+
+void* MemorySniffer::hookedCalloc(size_t count, size_t size) {
+    void* ptr = __libc_calloc(count, size);
+    if (ptr && !gIsInHook && isActive()) {
+        gIsInHook = true;
+        getInstance().recordAllocation(ptr);
+        gIsInHook = false;
+    }
+    return ptr;
+}
+
+void* MemorySniffer::hookedRealloc(void* ptr, size_t size) {
+    // Capture old size before realloc potentially invalidates the pointer
+    size_t oldSize = ptr && !gIsInHook ? usableSize(ptr) : 0;
+    void* newPtr = __libc_realloc(ptr, size);
+    if (newPtr && !gIsInHook && isActive()) {
+        gIsInHook = true;
+        getInstance().recordRealloc(oldSize, newPtr);
+        gIsInHook = false;
+    }
+    return newPtr;
+}
+
+void* MemorySniffer::hookedMemalign(size_t alignment, size_t size) {
+    void* ptr = __libc_memalign(alignment, size);
+    if (ptr && !gIsInHook && isActive()) {
+        gIsInHook = true;
+        getInstance().recordAllocation(ptr);
+        gIsInHook = false;
+    }
+    return ptr;
+}
+
+void MemorySniffer::hookedFree(void* ptr) {
+    if (ptr && !gIsInHook && isActive()) {
+        gIsInHook = true;
+        getInstance().recordFree(ptr);
+        gIsInHook = false;
+    }
+    __libc_free(ptr);
+}
+
+size_t MemorySniffer::usableSize(void* ptr) {
+    return malloc_usable_size(ptr);
+}
+
+// The interposers below are always installed, enabling the sniffer only switches the recording on.
+void MemorySniffer::applyHook() {
+    std::lock_guard lock(mHookMutex);
+    mIsHooked = true;
+}
+
+void MemorySniffer::removeHook() {
+    std::lock_guard lock(mHookMutex);
+    mIsHooked = false;
+}
+} // namespace bix::test
+
+// Definitions in the executable take precedence over the ones in libc.so for every caller in the process,
+// including libstdc++'s operator new.
+extern "C" {
+void* malloc(size_t size) {
+    return bix::test::MemorySniffer::hookedMalloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    return bix::test::MemorySniffer::hookedCalloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    return bix::test::MemorySniffer::hookedRealloc(ptr, size);
+}
+
+void free(void* ptr) {
+    bix::test::MemorySniffer::hookedFree(ptr);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    return bix::test::MemorySniffer::hookedMemalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    return bix::test::MemorySniffer::hookedMemalign(alignment, size);
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) {
+    if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) { return EINVAL; }
+    void* ptr = bix::test::MemorySniffer::hookedMemalign(alignment, size);
+    if (!ptr) { return ENOMEM; }
+    *out = ptr;
+    return 0;
+}
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory_sniffer.h"
+
+#include <MinHook.h>
+#include <malloc.h>
+
+namespace bix::test {
+
+typedef void*(__cdecl* MallocFuncPtr)(size_t);
+typedef void*(__cdecl* CallocFuncPtr)(size_t, size_t);
+typedef void*(__cdecl* ReallocFuncPtr)(void*, size_t);
+typedef void(__cdecl* FreeFuncPtr)(void*);
+
+static thread_local bool gIsInHook = false;
+
+MemorySniffer::MemorySniffer() {
+    if (MH_Initialize() != MH_OK) {}
+}
+
+MemorySniffer::~MemorySniffer() {
+    removeHook();
+    MH_Uninitialize();
+}
+
+void* __cdecl MemorySniffer::hookedMalloc(size_t size) {
+    auto& sniffer = getInstance();
+    void* ptr = reinterpret_cast<MallocFuncPtr>(sniffer.mMallocTarget.origAddr)(size);
+    if (ptr && !gIsInHook && sniffer.isActive()) {
+        gIsInHook = true;
+        sniffer.recordAllocation(ptr);
+        gIsInHook = false;
+    }
+    return ptr;
+}
+
+void* __cdecl MemorySniffer::hookedCalloc(size_t count, size_t size) {
+    auto& sniffer = getInstance();
+    void* ptr = reinterpret_cast<CallocFuncPtr>(sniffer.mCallocTarget.origAddr)(count, size);
+    if (ptr && !gIsInHook && sniffer.isActive()) {
+        gIsInHook = true;
+        sniffer.recordAllocation(ptr);
+        gIsInHook = false;
+    }
+    return ptr;
+}
+
+void* __cdecl MemorySniffer::hookedRealloc(void* ptr, size_t size) {
+    // Capture old size before realloc potentially invalidates the pointer
+    size_t oldSize = ptr && !gIsInHook ? usableSize(ptr) : 0;
+    auto& sniffer = getInstance();
+    void* newPtr = reinterpret_cast<ReallocFuncPtr>(sniffer.mReallocTarget.origAddr)(ptr, size);
+
+    if (newPtr && !gIsInHook && sniffer.isActive()) {
+        gIsInHook = true;
+        sniffer.recordRealloc(oldSize, newPtr);
+        gIsInHook = false;
+    }
+    return newPtr;
+}
+
+void __cdecl MemorySniffer::hookedFree(void* ptr) {
+    auto& sniffer = getInstance();
+    if (ptr && !gIsInHook && sniffer.isActive()) {
+        gIsInHook = true;
+        sniffer.recordFree(ptr);
+        gIsInHook = false;
+    }
+    reinterpret_cast<FreeFuncPtr>(sniffer.mFreeTarget.origAddr)(ptr);
+}
+
+void* __cdecl MemorySniffer::hookedMemalign(size_t alignment, size_t size) {
+    // Aligned allocations go through _aligned_malloc, which is built on the hooked malloc.
+    (void)alignment;
+    return hookedMalloc(size);
+}
+
+size_t MemorySniffer::usableSize(void* ptr) {
+    return _msize(ptr);
+}
+
+void MemorySniffer::applyHook() {
+    std::lock_guard lock(mHookMutex);
+    if (mIsHooked) {
+        return;
+    }
+    HMODULE hMod = GetModuleHandleA("ucrtbase.dll");
+    if (!hMod) {
+        hMod = GetModuleHandleA("ucrtbased.dll");
+    }
+    if (!hMod) {
+        hMod = GetModuleHandleA("msvcrt.dll");
+    }
+    if (!hMod) {
+        return;
+    }
+
+    auto installHook = [&](const char* name, HookTarget& target, LPVOID detour) {
+        if (target.state == HookState::Enabled) {
+            return;
+        }
+        if (!target.targetAddr) {
+            target.targetAddr = reinterpret_cast<LPVOID>(GetProcAddress(hMod, name));
+            if (!target.targetAddr) {
+                return;
+            }
+        }
+        if (target.state == HookState::None) {
+            if (MH_CreateHook(target.targetAddr, detour, &target.origAddr) != MH_OK) {
+                return;
+            }
+            target.state = HookState::Created;
+        }
+        if (MH_EnableHook(target.targetAddr) == MH_OK) {
+            target.state = HookState::Enabled;
+        }
+    };
+    installHook("malloc", mMallocTarget, reinterpret_cast<LPVOID>(&hookedMalloc));
+    installHook("calloc", mCallocTarget, reinterpret_cast<LPVOID>(&hookedCalloc));
+    installHook("realloc", mReallocTarget, reinterpret_cast<LPVOID>(&hookedRealloc));
+    installHook("free", mFreeTarget, reinterpret_cast<LPVOID>(&hookedFree));
+    mIsHooked = true;
+}
+
+void MemorySniffer::removeHook() {
+    std::lock_guard lock(mHookMutex);
+    if (!mIsHooked) {
+        return;
+    }
+
+    auto disableHook = [&](HookTarget& target) {
+        if (target.state != HookState::Enabled) {
+            return;
+        }
+        if (MH_DisableHook(target.targetAddr) == MH_OK) {
+            target.state = HookState::Disabled;
+        }
+    };
+
+    disableHook(mMallocTarget);
+    disableHook(mCallocTarget);
+    disableHook(mReallocTarget);
+    disableHook(mFreeTarget);
+    mIsHooked = false;
+}
+} // namespace bix::test
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/parser/attribute_set.h>
+#include <bixlib/widgets/widget_defs.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include "alloc_budget.h"
+
+using namespace bix;
+
+static_assert(AttrId("width") == AttrId::fromName("width"));
+static_assert(attrs::Width != attrs::Height);
+
+TEST(AttributeSetTest, KnownIdsAreDistinct) {
+    const std::array ids{attrs::Id,      attrs::Width,      attrs::Height,     attrs::MinWidth,  attrs::MinHeight,
+                         attrs::MaxWidth, attrs::MaxHeight, attrs::Alpha,      attrs::Enable,    attrs::Visible,
+                         attrs::Lazy,     attrs::Background, attrs::Clickable, attrs::BoundsClip, attrs::Horizontal,
+                         attrs::Value};
+    for (size_t i = 0; i < ids.size(); ++i) {
+        for (size_t j = i + 1; j < ids.size(); ++j) { EXPECT_NE(ids[i], ids[j]) << i << " " << j; }
+    }
+}
+
+TEST(AttributeSetTest, TypedValues) {
+    AttributeSet set;
+    set.set("id", AttributeValue::fromString("title"));
+    set.set("width", AttributeValue::fromLength(Length::dp(12.5f)));
+    set.set("background", AttributeValue::fromColor(Color(1, 2, 3, 4)));
+    set.set("enable", AttributeValue::fromBool(false));
+    set.set("alpha", AttributeValue::fromFloat(0.25f));
+    set.set("visible", AttributeValue::fromEnum(Visibility::Collapsed));
+    EXPECT_EQ(set.size(), 6u);
+
+    std::string id;
+    EXPECT_TRUE(set.getString(attrs::Id, id));
+    EXPECT_EQ(id, "title");
+    Length width;
+    EXPECT_TRUE(set.getLength(attrs::Width, width));
+    EXPECT_TRUE(width == Length::dp(12.5f));
+    Color color;
+    EXPECT_TRUE(set.getColor(attrs::Background, color));
+    EXPECT_EQ(color, Color(1, 2, 3, 4));
+    bool enable = true;
+    EXPECT_TRUE(set.getBool(attrs::Enable, enable));
+    EXPECT_FALSE(enable);
+    float alpha = 1.f;
+    EXPECT_TRUE(set.getFloat(attrs::Alpha, alpha));
+    EXPECT_FLOAT_EQ(alpha, 0.25f);
+    auto visibility = Visibility::Visible;
+    EXPECT_TRUE(set.getEnum(attrs::Visible, visibility));
+    EXPECT_EQ(visibility, Visibility::Collapsed);
+
+    // Missing attributes and type mismatches leave the defaults untouched.
+    Length height = Length::autoSize();
+    EXPECT_FALSE(set.getLength(attrs::Height, height));
+    EXPECT_TRUE(height.isAuto());
+    EXPECT_FALSE(set.getLength(attrs::Id, height));
+    EXPECT_TRUE(height.isAuto());
+}
+
+TEST(AttributeSetTest, SortedReplaceRemove) {
+    AttributeSet set;
+    const std::array<std::string_view, 10> names{"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"};
+    for (const auto name : names) { set.set(AttrId::fromName(name), AttributeValue::fromString(name)); }
+    EXPECT_EQ(set.size(), names.size());
+    for (const auto* it = set.begin(); it + 1 < set.end(); ++it) { EXPECT_LT(it->id, (it + 1)->id); }
+
+    set.set("c", AttributeValue::fromString("replaced"));
+    EXPECT_EQ(set.size(), names.size());
+    EXPECT_EQ(set.find("c")->text, "replaced");
+
+    EXPECT_TRUE(set.remove("c"));
+    EXPECT_FALSE(set.remove("c"));
+    EXPECT_FALSE(set.contains("c"));
+    EXPECT_EQ(set.size(), names.size() - 1);
+    for (const auto name : names) {
+        if (name != "c") { EXPECT_EQ(set.find(AttrId::fromName(name))->text, name); }
+    }
+}
+
+TEST(AttributeSetTest, NoAllocations) {
+    AttributeSet set;
+    BIX_EXPECT_NO_ALLOCATIONS({
+        set.set("width", AttributeValue::fromLength(Length::px(10)));
+        set.set("height", AttributeValue::fromLength(Length::px(20)));
+        set.set("id", AttributeValue::fromString("root"));
+    });
+    std::string_view id;
+    Length width;
+    BIX_EXPECT_NO_ALLOCATIONS({
+        set.getString(attrs::Id, id);
+        set.getLength(attrs::Width, width);
+    });
+    EXPECT_EQ(id, "root");
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/errors.h>
+#include <bixlib/parser/layout_writer.h>
+#include <bixlib/widgets/widget_defs.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace bix;
+
+namespace {
+// <LinearLayout id="root" width="stretch" horizontal="true">
+//     <Label id="title" value="Hello" height="24dp" textColor="#FF000080"/>
+//     <Layout visible="gone" alpha="0.5"><Button id="ok"/></Layout>
+// </LinearLayout>
+std::vector<std::byte> compileSample() {
+    LayoutWriter writer;
+    writer.beginElement("LinearLayout");
+    writer.attribute("id", "root");
+    writer.attribute("width", "stretch");
+    writer.attribute("horizontal", "true");
+    writer.beginElement("Label");
+    writer.attribute("id", "title");
+    writer.attribute("value", "Hello");
+    writer.attribute("height", "24dp");
+    writer.attribute("textColor", "#FF000080");
+    writer.endElement();
+    writer.beginElement("Layout");
+    writer.attribute("visible", "gone");
+    writer.attribute("alpha", "0.5");
+    writer.beginElement("Button");
+    writer.attribute("id", "ok");
+    writer.endElement();
+    writer.endElement();
+    writer.endElement();
+    return writer.finish();
+}
+
+const LayoutAttribute* find(const CompiledLayout& layout, uint32_t node, std::string_view name) {
+    const auto id = layout.findString(name);
+    for (const auto& attr : layout.attributes(node)) {
+        if (attr.name == id) { return &attr; }
+    }
+    return nullptr;
+}
+} // namespace
+
+TEST(CompiledLayoutTest, RoundTrip) {
+    const CompiledLayout layout(compileSample());
+    ASSERT_EQ(layout.nodeCount(), 4u);
+    EXPECT_EQ(layout.typeName(0), "LinearLayout");
+    EXPECT_EQ(layout.typeName(1), "Label");
+    EXPECT_EQ(layout.typeName(3), "Button");
+
+    EXPECT_EQ(layout.node(0).parent, CompiledLayout::kNone);
+    EXPECT_EQ(layout.node(0).subtreeEnd, 4u);
+    EXPECT_EQ(layout.node(1).subtreeEnd, 2u);
+    EXPECT_EQ(layout.node(2).parent, 0u);
+    EXPECT_EQ(layout.node(3).parent, 2u);
+    EXPECT_EQ(layout.attributes(3).size(), 1u);
+
+    const auto* width = find(layout, 0, "width");
+    ASSERT_NE(width, nullptr);
+    EXPECT_EQ(width->type, LayoutValueType::Length);
+    EXPECT_TRUE(width->toLength().isStretch());
+    EXPECT_TRUE(find(layout, 0, "horizontal")->toBool());
+    EXPECT_TRUE(find(layout, 1, "height")->toLength() == Length::dp(24));
+    EXPECT_EQ(find(layout, 1, "textColor")->toColor(), Color(0xFF, 0, 0, 0x80));
+    EXPECT_EQ(layout.string(find(layout, 1, "value")->value), "Hello");
+    EXPECT_EQ(find(layout, 2, "visible")->toEnum<Visibility>(), Visibility::Collapsed);
+    EXPECT_FLOAT_EQ(find(layout, 2, "alpha")->toFloat(), 0.5f);
+    EXPECT_EQ(find(layout, 2, "id"), nullptr);
+}
+
+TEST(CompiledLayoutTest, InternedSortedStrings) {
+    const CompiledLayout layout(compileSample());
+    // "id" is used by three nodes and stored once.
+    uint32_t ids = 0;
+    for (uint32_t i = 0; i < layout.stringCount(); ++i) {
+        if (layout.string(i) == "id") { ++ids; }
+        if (i > 0) { EXPECT_LT(layout.string(i - 1), layout.string(i)); }
+    }
+    EXPECT_EQ(ids, 1u);
+    EXPECT_EQ(layout.findString("missing"), CompiledLayout::kNone);
+    EXPECT_EQ(layout.string(layout.findString("title")), "title");
+}
+
+TEST(CompiledLayoutTest, BorrowedData) {
+    const auto data = compileSample();
+    const CompiledLayout layout{std::span<const std::byte>(data)};
+    EXPECT_EQ(layout.data().data(), data.data());
+    EXPECT_EQ(layout.typeName(2), "Layout");
+
+    CompiledLayout owned(compileSample());
+    const auto* bytes = owned.data().data();
+    const CompiledLayout moved(std::move(owned));
+    EXPECT_EQ(moved.data().data(), bytes);
+    EXPECT_EQ(moved.typeName(1), "Label");
+}
+
+TEST(CompiledLayoutTest, RejectsInvalidData) {
+    auto data = compileSample();
+    EXPECT_THROW(CompiledLayout(std::span<const std::byte>(data).first(8)), RuntimeError);
+
+    auto badMagic = data;
+    badMagic[0] = std::byte{0};
+    EXPECT_THROW(CompiledLayout{std::move(badMagic)}, RuntimeError);
+
+    auto badVersion = data;
+    const uint16_t version = CompiledLayout::kVersion + 1;
+    std::memcpy(badVersion.data() + offsetof(LayoutFileHeader, version), &version, sizeof(version));
+    EXPECT_THROW(CompiledLayout{std::move(badVersion)}, RuntimeError);
+
+    // A node pointing past the end of the node table.
+    LayoutFileHeader header{};
+    std::memcpy(&header, data.data(), sizeof(header));
+    auto badNode = data;
+    const uint32_t end = header.nodeCount + 1;
+    std::memcpy(badNode.data() + header.nodeOffset + offsetof(LayoutNode, subtreeEnd), &end, sizeof(end));
+    EXPECT_THROW(CompiledLayout{std::move(badNode)}, RuntimeError);
+}
+
+TEST(CompiledLayoutTest, WriterErrors) {
+    LayoutWriter writer;
+    EXPECT_THROW(writer.attribute("id", "x"), LogicError);
+    EXPECT_THROW(writer.endElement(), LogicError);
+    EXPECT_THROW(writer.finish(), LogicError);
+
+    writer.beginElement("Layout");
+    EXPECT_THROW(writer.attribute("width", "wide"), RuntimeError);
+    EXPECT_THROW(writer.attribute("enable", "yes"), RuntimeError);
+    EXPECT_THROW(writer.attribute("visible", "hidden"), RuntimeError);
+    EXPECT_THROW(writer.attribute("alpha", "0.5f"), RuntimeError);
+    EXPECT_THROW(writer.attribute("background", "red"), RuntimeError);
+    writer.attribute("width", "0px");
+    writer.beginElement("Label");
+    writer.endElement();
+    EXPECT_THROW(writer.attribute("height", "auto"), LogicError);
+    EXPECT_THROW(writer.finish(), LogicError);
+    writer.endElement();
+    EXPECT_THROW(writer.beginElement("Layout"), LogicError);
+    EXPECT_EQ(CompiledLayout(writer.finish()).nodeCount(), 2u);
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/errors.h>
+#include <bixlib/parser/xml_sax.h>
+
+#include <gtest/gtest.h>
+
+#include "alloc_budget.h"
+
+using namespace bix;
+
+namespace {
+// Records the events as "<name a=v>", "text" and "</name>" strings, skipping the content of elements named in skip.
+class RecordingHandler : public XmlHandler {
+public:
+    std::vector<std::string> events;
+    std::vector<std::string> sources;
+    std::string_view skip;
+
+    bool startElement(std::string_view name, std::span<const XmlAttribute> attributes) override {
+        std::string event = "<" + std::string(name);
+        for (const auto& a : attributes) { event += " " + std::string(a.name) + "=" + std::string(a.value); }
+        events.push_back(event + ">");
+        return name != skip;
+    }
+
+    void endElement(std::string_view name, std::string_view source) override {
+        events.push_back("</" + std::string(name) + ">");
+        sources.emplace_back(source);
+    }
+
+    void characters(std::string_view text) override {
+        if (text.find_first_not_of(" \n") != std::string_view::npos) { events.emplace_back(text); }
+    }
+};
+
+std::vector<std::string> parse(std::string_view xml, std::string_view skip = {}) {
+    RecordingHandler handler;
+    handler.skip = skip;
+    XmlSaxParser(xml).parse(handler);
+    return handler.events;
+}
+
+// Counts elements without keeping anything.
+class CountingHandler : public XmlHandler {
+public:
+    int elements = 0;
+
+    bool startElement(std::string_view, std::span<const XmlAttribute>) override {
+        ++elements;
+        return true;
+    }
+
+    void endElement(std::string_view, std::string_view) override {}
+};
+} // namespace
+
+TEST(XmlSaxParserTest, Events) {
+    const auto events = parse(R"(<?xml version="1.0"?>
+<!-- layout -->
+<LinearLayout width="stretch" horizontal='true'>
+    <Label value="a &lt; b &#x41;&#66;"/>
+    <Button>Text &amp; more<![CDATA[<raw>]]></Button>
+</LinearLayout>
+)");
+    const std::vector<std::string> expected{
+        "<LinearLayout width=stretch horizontal=true>",
+        "<Label value=a < b AB>",
+        "</Label>",
+        "<Button>",
+        "Text & more",
+        "<raw>",
+        "</Button>",
+        "</LinearLayout>",
+    };
+    EXPECT_EQ(events, expected);
+}
+
+TEST(XmlSaxParserTest, ElementSource) {
+    RecordingHandler handler;
+    XmlSaxParser(R"(<a><b x="1"/><c>t</c></a>)").parse(handler);
+    ASSERT_EQ(handler.sources.size(), 3u);
+    EXPECT_EQ(handler.sources[0], R"(<b x="1"/>)");
+    EXPECT_EQ(handler.sources[1], "<c>t</c>");
+    EXPECT_EQ(handler.sources[2], R"(<a><b x="1"/><c>t</c></a>)");
+}
+
+TEST(XmlSaxParserTest, SkipContent) {
+    const auto events = parse("<a><tab><b><c/></b>text<tab/></tab><d/></a>", "tab");
+    const std::vector<std::string> expected{"<a>", "<tab>", "</tab>", "<d>", "</d>", "</a>"};
+    EXPECT_EQ(events, expected);
+
+    // Skipped content is still checked to be well-formed.
+    EXPECT_THROW(parse("<a><tab><b></tab></a>", "tab"), RuntimeError);
+}
+
+TEST(XmlSaxParserTest, Malformed) {
+    EXPECT_THROW(parse(""), RuntimeError);
+    EXPECT_THROW(parse("<a>"), RuntimeError);
+    EXPECT_THROW(parse("<a></b>"), RuntimeError);
+    EXPECT_THROW(parse("<a/><b/>"), RuntimeError);
+    EXPECT_THROW(parse("text<a/>"), RuntimeError);
+    EXPECT_THROW(parse("<a x=1/>"), RuntimeError);
+    EXPECT_THROW(parse(R"(<a x="1"y="2"/>)"), RuntimeError);
+    EXPECT_THROW(parse(R"(<a x="&unknown;"/>)"), RuntimeError);
+    EXPECT_THROW(parse("<a><!-- unterminated </a>"), RuntimeError);
+
+    try {
+        parse("<a>\n<b>\n</a>");
+        FAIL();
+    } catch (const RuntimeError& e) {
+        EXPECT_STREQ(e.what(), "xml:3: mismatched end tag");
+    }
+}
+
+TEST(XmlSaxParserTest, ParseDoesNotAllocate) {
+    const std::string_view xml = R"(<a w="1"><b x="1" y="2"/><b x="3" y="4"/><b x="5" y="6"/></a>)";
+    CountingHandler handler;
+    XmlSaxParser parser(xml);
+    parser.parse(handler); // grows the buffers
+    BIX_EXPECT_NO_ALLOCATIONS(parser.parse(handler));
+    EXPECT_EQ(handler.elements, 8);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/utils/arena.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef HAS_MEMORY_SNIFFER
+#include "memory_sniffer.h"
+#endif
+
+using namespace bix;
+
+namespace {
+struct Node {
+    explicit Node(int v) : value(v) { ++alive; }
+    ~Node() { --alive; }
+
+    Node(const Node&) = delete;
+    Node& operator=(const Node&) = delete;
+
+    int value;
+    Node* next = nullptr;
+    static inline int alive = 0;
+};
+
+struct alignas(64) Wide {
+    char data[64];
+};
+} // namespace
+
+TEST(ArenaTest, CreateAndDestroy) {
+    MonotonicArena arena(1024);
+    Node* first = arena.create<Node>(1);
+    Node* second = arena.create<Node>(2);
+    EXPECT_EQ(Node::alive, 2);
+    EXPECT_EQ(arena.liveCount(), 2u);
+    EXPECT_EQ(arena.blockCount(), 1u);
+    EXPECT_EQ(first->value, 1);
+    EXPECT_EQ(second->value, 2);
+
+    arena.destroy(first);
+    arena.destroy(second);
+    EXPECT_EQ(Node::alive, 0);
+    EXPECT_EQ(arena.liveCount(), 0u);
+}
+
+TEST(ArenaTest, Alignment) {
+    MonotonicArena arena(256);
+    arena.allocate(3, 1);
+    auto* wide = arena.create<Wide>();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(wide) % 64, 0u);
+    // Requests larger than a block get a block of their own.
+    void* big = arena.allocate(4096, 128);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(big) % 128, 0u);
+    EXPECT_GE(arena.blockCount(), 2u);
+    arena.destroy(wide);
+}
+
+TEST(ArenaTest, ResetKeepsFirstBlock) {
+    MonotonicArena arena(512);
+    void* first = arena.allocate(16);
+    for (int i = 0; i < 100; ++i) { arena.allocate(64); }
+    EXPECT_GT(arena.blockCount(), 1u);
+
+    arena.reset();
+    EXPECT_EQ(arena.blockCount(), 1u);
+    EXPECT_EQ(arena.bytesUsed(), 0u);
+    EXPECT_EQ(arena.liveCount(), 0u);
+    // The rewound arena hands out the memory of its first block again.
+    EXPECT_EQ(arena.allocate(16), first);
+}
+
+TEST(ArenaTest, AllocatorBalancesLiveCount) {
+    MonotonicArena arena(1024);
+    {
+        std::vector<int, ArenaAllocator<int>> values{ArenaAllocator<int>(&arena)};
+        for (int i = 0; i < 100; ++i) { values.push_back(i); }
+        EXPECT_EQ(values.back(), 99);
+        // Every reallocation released the previous buffer, only the current one is live.
+        EXPECT_EQ(arena.liveCount(), 1u);
+    }
+    EXPECT_EQ(arena.liveCount(), 0u);
+
+    // Without an arena the allocator falls back to the heap.
+    std::vector<int, ArenaAllocator<int>> heap;
+    heap.assign(10, 1);
+    EXPECT_EQ(arena.liveCount(), 0u);
+}
+
+#ifdef HAS_MEMORY_SNIFFER
+TEST(ArenaTest, AllocatorOwnedByArenaObject) {
+    struct Owner {
+        explicit Owner(MonotonicArena* arena) : children(ArenaAllocator<std::unique_ptr<int>>(arena)) {}
+
+        std::vector<std::unique_ptr<int>, ArenaAllocator<std::unique_ptr<int>>> children;
+    };
+
+    MonotonicArena arena(64 * 1024);
+    Owner* owner = arena.create<Owner>(&arena);
+    test::MemorySniffer::reset();
+    const auto before = test::MemorySniffer::enable();
+    for (int i = 0; i < 100; ++i) { owner->children.emplace_back(); }
+    const auto built = test::MemorySniffer::getStatsSnapshot();
+    // The object and the storage of its vector share the block, growing the vector does not touch the heap.
+    EXPECT_EQ(built.allocCount - before.allocCount, 0u);
+
+    arena.destroy(owner);
+    EXPECT_EQ(arena.liveCount(), 0u);
+    arena.reset();
+    const auto after = test::MemorySniffer::disable();
+    EXPECT_EQ(after.freeCount - built.freeCount, 0u);
+    EXPECT_EQ(arena.blockCount(), 1u);
+}
+
+TEST(ArenaTest, AllocationCount) {
+    MonotonicArena arena(64 * 1024);
+    test::MemorySniffer::reset();
+    const auto before = test::MemorySniffer::enable();
+    Node* head = nullptr;
+    for (int i = 0; i < 1000; ++i) {
+        Node* n = arena.create<Node>(i);
+        n->next = head;
+        head = n;
+    }
+    const auto built = test::MemorySniffer::getStatsSnapshot();
+    // A thousand nodes of a few bytes each fit into one block.
+    EXPECT_LE(built.allocCount - before.allocCount, 1u);
+
+    while (head) {
+        Node* next = head->next;
+        arena.destroy(head);
+        head = next;
+    }
+    arena.reset();
+    const auto after = test::MemorySniffer::disable();
+    EXPECT_EQ(after.freeCount - built.freeCount, 0u);
+}
+#endif
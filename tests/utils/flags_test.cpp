@@ -31,6 +31,15 @@ enum class TestFlag : uint32_t {
 BIX_DECLARE_ENUM_FLAGS(TestFlag)
 
 using TestFlags = bix::Flags<TestFlag>;
+
+enum class SmallFlag : uint8_t {
+    A = 1 << 0,
+    B = 1 << 7,
+};
+
+BIX_DECLARE_ENUM_FLAGS(SmallFlag)
+
+using SmallFlags = bix::Flags<SmallFlag>;
 } // namespace
 
 using namespace bix;
@@ -91,4 +100,13 @@ TEST_F(FlagsTest, ZeroBehavior) {
 
     TestFlags some(TestFlag::Read);
     EXPECT_FALSE(some.testFlags(TestFlag::None));
-}
\ No newline at end of file
+}
+
+TEST_F(FlagsTest, NarrowUnderlyingType) {
+    // Bitwise operators promote uint8_t to int, the result must still convert back into the flags.
+    SmallFlags fs = SmallFlag::A | SmallFlag::B;
+    EXPECT_EQ(fs.value(), 0x81);
+    EXPECT_EQ((fs & SmallFlags(SmallFlag::B)).value(), 0x80);
+    EXPECT_EQ((~fs).value(), 0x7E);
+    EXPECT_EQ((fs ^ SmallFlags(SmallFlag::A)).value(), 0x80);
+}
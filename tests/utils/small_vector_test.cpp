@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/utils/small_vector.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "alloc_budget.h"
+
+using namespace bix;
+
+namespace {
+std::vector<int> toStd(const SmallVector<int, 4>& v) {
+    return {v.begin(), v.end()};
+}
+} // namespace
+
+TEST(SmallVectorTest, InlineUntilFull) {
+    SmallVector<int, 4> v;
+    BIX_EXPECT_NO_ALLOCATIONS(for (int i = 0; i < 4; ++i) { v.push_back(i); });
+    EXPECT_TRUE(v.isInline());
+    EXPECT_EQ(v.capacity(), 4u);
+
+    v.push_back(4);
+    EXPECT_FALSE(v.isInline());
+    EXPECT_EQ(toStd(v), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    // The heap storage is kept for reuse.
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    BIX_EXPECT_NO_ALLOCATIONS(for (int i = 0; i < 8; ++i) { v.push_back(i); });
+}
+
+TEST(SmallVectorTest, InsertErase) {
+    SmallVector<int, 4> v;
+    v.push_back(1);
+    v.push_back(3);
+    v.insert(v.begin() + 1, 2);
+    v.insert(v.begin(), 0);
+    v.insert(v.end(), 4); // grows while inserting
+    EXPECT_EQ(toStd(v), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    v.insert(v.begin(), v[4]); // a reference into the vector itself
+    EXPECT_EQ(v[0], 4);
+    v.erase(v.begin());
+    v.erase(v.begin() + 2);
+    EXPECT_EQ(toStd(v), (std::vector<int>{0, 1, 3, 4}));
+    v.erase(v.end() - 1);
+    EXPECT_EQ(toStd(v), (std::vector<int>{0, 1, 3}));
+}
+
+TEST(SmallVectorTest, CopyAndMove) {
+    SmallVector<int, 4> small;
+    small.push_back(7);
+    SmallVector<int, 4> large;
+    for (int i = 0; i < 6; ++i) { large.push_back(i); }
+
+    auto smallCopy = small;
+    auto largeCopy = large;
+    EXPECT_TRUE(smallCopy.isInline());
+    EXPECT_EQ(toStd(largeCopy), toStd(large));
+    EXPECT_NE(largeCopy.data(), large.data());
+
+    const auto* heap = large.data();
+    SmallVector<int, 4> moved(std::move(large));
+    EXPECT_EQ(moved.data(), heap);
+    EXPECT_TRUE(large.empty()); // moved-from vectors are empty and inline
+    EXPECT_TRUE(large.isInline());
+
+    SmallVector<int, 4> movedSmall(std::move(small));
+    EXPECT_TRUE(movedSmall.isInline());
+    EXPECT_EQ(toStd(movedSmall), (std::vector<int>{7}));
+
+    largeCopy = smallCopy;
+    EXPECT_EQ(toStd(largeCopy), (std::vector<int>{7}));
+    smallCopy = std::move(moved);
+    EXPECT_EQ(smallCopy.size(), 6u);
+    EXPECT_EQ(smallCopy.data(), heap);
+}
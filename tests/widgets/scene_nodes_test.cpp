@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/scene.h>
+#include <bixlib/graphics/colors.h>
+#include <bixlib/widgets/container.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+
+class Box : public LeafWidget {
+public:
+    BIX_WIDGET_DECLARE(Box)
+
+    Size size{20, 20};
+    int paints = 0;
+
+    void onPaint(Canvas& canvas) override {
+        BIX_UNUSED(canvas)
+        ++paints;
+    }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        BIX_UNUSED(canvas)
+        BIX_UNUSED(available)
+        BIX_UNUSED(max)
+        setMeasuredSize(size);
+    }
+};
+
+/** Places each child at the position of the same index, taking a fixed size. */
+class Stack : public Container {
+public:
+    BIX_WIDGET_DECLARE(Stack)
+
+    Size size{200, 200};
+    std::vector<Point> positions;
+
+    void onPaint(Canvas& canvas) override { BIX_UNUSED(canvas) }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        for (const auto& child : mChildren) { child->measure(canvas, available, max); }
+        setMeasuredSize(size);
+    }
+
+    void onLayout(const Rect& rect) override {
+        BIX_UNUSED(rect)
+        for (size_t i = 0; i < mChildren.size(); ++i) {
+            const Point p = i < positions.size() ? positions[i] : Point();
+            mChildren[i]->layout({p.x, p.y, mChildren[i]->measuredSize()});
+        }
+    }
+};
+
+class NullHost : public WidgetHost {
+public:
+    void scheduleFrame(const Rect& dirtyRect) override { BIX_UNUSED(dirtyRect) }
+
+    void requestLayout() override {}
+
+    void captureFocus(Widget* widget) override { BIX_UNUSED(widget) }
+};
+
+//  root stack (200x200)
+//  +- panel stack (20,20 100x100)
+//  |  +- a (0,0)
+//  |  +- b (50,0)
+//  +- c (150,150)
+struct SceneFixture {
+    SceneFixture() : scene(&host), canvas(SizeI{200, 200}) {
+        auto owner = std::make_unique<Stack>();
+        root = owner.get();
+        panel = root->addChild<Stack>();
+        panel->size = {100, 100};
+        a = panel->addChild<Box>();
+        b = panel->addChild<Box>();
+        c = root->addChild<Box>();
+        root->positions = {{20, 20}, {150, 150}};
+        panel->positions = {{0, 0}, {50, 0}};
+        scene.setRoot(std::move(owner));
+        scene.resize({200, 200});
+        layoutAndPaint();
+    }
+
+    void layoutAndPaint() {
+        scene.performLayout(canvas);
+        scene.paint(canvas);
+    }
+
+    NullHost host;
+    Scene scene;
+    SoftwareCanvas canvas;
+    Stack* root = nullptr;
+    Stack* panel = nullptr;
+    Box* a = nullptr;
+    Box* b = nullptr;
+    Box* c = nullptr;
+};
+} // namespace
+
+TEST(SceneNodesTest, MovedWidgetIsPatchedInPlace) {
+    SceneFixture f;
+    const auto& nodes = f.scene.nodes();
+    ASSERT_EQ(nodes.size(), 5u);
+    ASSERT_EQ(nodes.widget(3), f.b);
+
+    f.panel->positions[1] = {60, 30};
+    f.panel->requestLayout();
+    ASSERT_TRUE(f.scene.performLayout(f.canvas));
+
+    ASSERT_EQ(nodes.size(), 5u);
+    EXPECT_EQ(nodes.widget(3), f.b);
+    EXPECT_EQ(nodes.bounds(3), Rect(80, 50, 100, 70));
+    EXPECT_EQ(nodes.bounds(2), Rect(20, 20, 40, 40));
+    EXPECT_EQ(f.scene.hitTest({90, 60}), f.b);
+    EXPECT_EQ(f.scene.hitTest({75, 25}), f.panel);
+}
+
+TEST(SceneNodesTest, MovedContainerMovesItsSubtree) {
+    SceneFixture f;
+    const auto& nodes = f.scene.nodes();
+
+    f.root->positions[0] = {40, 40};
+    f.root->requestLayout();
+    ASSERT_TRUE(f.scene.performLayout(f.canvas));
+
+    EXPECT_EQ(nodes.bounds(1), Rect(40, 40, 140, 140));
+    EXPECT_EQ(nodes.bounds(2), Rect(40, 40, 60, 60));
+    EXPECT_EQ(nodes.bounds(3), Rect(90, 40, 110, 60));
+    EXPECT_EQ(f.scene.hitTest({95, 45}), f.b);
+}
+
+TEST(SceneNodesTest, StructureChangeRebuildsTheStore) {
+    SceneFixture f;
+    const auto& nodes = f.scene.nodes();
+
+    auto* d = f.panel->addChild<Box>();
+    f.panel->positions.push_back({0, 50});
+    ASSERT_TRUE(f.scene.performLayout(f.canvas));
+    ASSERT_EQ(nodes.size(), 6u);
+    EXPECT_EQ(nodes.widget(4), d);
+    EXPECT_EQ(nodes.widget(5), f.c);
+    EXPECT_EQ(f.scene.hitTest({25, 75}), d);
+
+    f.panel->removeChild(f.a);
+    f.panel->positions.erase(f.panel->positions.begin());
+    ASSERT_TRUE(f.scene.performLayout(f.canvas));
+    ASSERT_EQ(nodes.size(), 5u);
+    EXPECT_EQ(nodes.widget(2), f.b);
+    EXPECT_EQ(nodes.widget(3), d);
+}
+
+TEST(SceneNodesTest, HiddenWidgetLeavesTheVisibleNodes) {
+    SceneFixture f;
+    f.b->setVisibility(Visibility::Invisible);
+    ASSERT_TRUE(f.scene.performLayout(f.canvas));
+    EXPECT_EQ(f.scene.hitTest({75, 25}), f.panel);
+
+    f.b->setVisibility(Visibility::Visible);
+    ASSERT_TRUE(f.scene.performLayout(f.canvas));
+    EXPECT_EQ(f.scene.hitTest({75, 25}), f.b);
+}
+
+TEST(SceneNodesTest, PaintClipsToTheClippingAncestors) {
+    SceneFixture f;
+    f.b->setBackground(colors::Red);
+    // Half of the box overflows the panel, which clips it.
+    f.panel->positions[1] = {90, 0};
+    f.panel->requestLayout();
+    f.layoutAndPaint();
+
+    const auto& pixels = f.canvas.pixels();
+    EXPECT_EQ(pixels.colorAt(115, 25), colors::Red);
+    EXPECT_NE(pixels.colorAt(125, 25), colors::Red);
+}
+
+TEST(SceneNodesTest, TransparentContainerPaintsNoChildren) {
+    SceneFixture f;
+    f.b->setBackground(colors::Red);
+    f.panel->setOpacity(0.f);
+    f.layoutAndPaint();
+    EXPECT_NE(f.canvas.pixels().colorAt(75, 25), colors::Red);
+
+    f.panel->setOpacity(1.f);
+    f.layoutAndPaint();
+    EXPECT_EQ(f.canvas.pixels().colorAt(75, 25), colors::Red);
+}
+
+TEST(SceneNodesTest, PaintOnlyRecordsTheDamagedWidgets) {
+    SceneFixture f;
+    const int paintsA = f.a->paints;
+    const int paintsB = f.b->paints;
+
+    f.a->invalidate();
+    f.scene.paint(f.canvas);
+    EXPECT_EQ(f.a->paints, paintsA + 1);
+    EXPECT_EQ(f.b->paints, paintsB);
+    EXPECT_TRUE(f.scene.damage().isEmpty());
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/scene.h>
+#include <bixlib/widgets/container.h>
+
+#include <gtest/gtest.h>
+
+#ifdef HAS_MEMORY_SNIFFER
+#include "memory_sniffer.h"
+#endif
+
+using namespace bix;
+
+namespace {
+
+class Box : public LeafWidget {
+public:
+    BIX_WIDGET_DECLARE(Box)
+
+    Box() { ++alive; }
+    ~Box() override { --alive; }
+
+    static inline int alive = 0;
+
+    void onPaint(Canvas& canvas) override { BIX_UNUSED(canvas) }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        BIX_UNUSED(canvas)
+        BIX_UNUSED(max)
+        setMeasuredSize(available);
+    }
+};
+
+class Panel : public Container {
+public:
+    BIX_WIDGET_DECLARE(Panel)
+
+    Panel() { ++alive; }
+    ~Panel() override { --alive; }
+
+    static inline int alive = 0;
+
+    void onPaint(Canvas& canvas) override { BIX_UNUSED(canvas) }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        for (const auto& child : mChildren) { child->measure(canvas, available, max); }
+        setMeasuredSize(available);
+    }
+
+    void onLayout(const Rect& rect) override {
+        for (const auto& child : mChildren) { child->layout(rect); }
+    }
+};
+
+class NullHost : public WidgetHost {
+public:
+    void scheduleFrame(const Rect& dirtyRect) override { BIX_UNUSED(dirtyRect) }
+
+    void requestLayout() override {}
+
+    void captureFocus(Widget* widget) override { BIX_UNUSED(widget) }
+};
+
+constexpr int kPanels = 2;
+constexpr int kBoxesPerPanel = 3;
+
+// The whole subtree, child lists included, has to fit into the first block of the scene arena.
+static_assert((1 + kPanels * (1 + kBoxesPerPanel)) * 2 * sizeof(Panel) < MonotonicArena::kDefaultBlockSize);
+
+void buildSubtree(Panel& root) {
+    for (int i = 0; i < kPanels; ++i) {
+        auto* panel = root.addChild<Panel>();
+        for (int j = 0; j < kBoxesPerPanel; ++j) { panel->addChild<Box>(); }
+    }
+}
+} // namespace
+
+TEST(WidgetArenaTest, SubtreeSharesTheSceneArena) {
+    NullHost host;
+    Scene scene(&host);
+    MonotonicArena* arena = scene.arena();
+
+    auto root = makeWidget<Panel>(arena);
+    buildSubtree(*root);
+    ASSERT_EQ(root->childCount(), static_cast<size_t>(kPanels));
+    for (int i = 0; i < kPanels; ++i) {
+        auto* panel = dynamic_cast<Panel*>(root->childAt(i));
+        ASSERT_NE(panel, nullptr);
+        EXPECT_EQ(panel->arena(), arena);
+        EXPECT_EQ(panel->childCount(), static_cast<size_t>(kBoxesPerPanel));
+        EXPECT_EQ(panel->childAt(0)->parent(), panel);
+    }
+    EXPECT_EQ(Panel::alive, 1 + kPanels);
+    EXPECT_EQ(Box::alive, kPanels * kBoxesPerPanel);
+    scene.setRoot(std::move(root));
+    EXPECT_GT(arena->liveCount(), 0u);
+
+    const void* first = scene.root();
+    scene.setRoot(nullptr);
+    EXPECT_EQ(Panel::alive, 0);
+    EXPECT_EQ(Box::alive, 0);
+    // Widgets and child lists released everything they took, so dropping the root rewound the arena.
+    EXPECT_EQ(arena->liveCount(), 0u);
+    EXPECT_EQ(arena->bytesUsed(), 0u);
+    EXPECT_EQ(arena->blockCount(), 1u);
+    EXPECT_EQ(static_cast<const void*>(makeWidget<Panel>(arena).get()), first);
+}
+
+#ifdef HAS_MEMORY_SNIFFER
+TEST(WidgetArenaTest, BuildingSubtreeDoesNotAllocate) {
+    NullHost host;
+    Scene scene(&host);
+    // The root takes the first block of the arena, everything after it is bump allocated.
+    auto root = makeWidget<Panel>(scene.arena());
+
+    test::MemorySniffer::reset();
+    const auto before = test::MemorySniffer::enable();
+    buildSubtree(*root);
+    const auto built = test::MemorySniffer::disable();
+    EXPECT_EQ(built.allocCount - before.allocCount, 0u);
+    EXPECT_EQ(Box::alive, kPanels * kBoxesPerPanel);
+
+    scene.setRoot(std::move(root));
+    scene.setRoot(nullptr);
+    EXPECT_EQ(Panel::alive, 0);
+    EXPECT_EQ(Box::alive, 0);
+    EXPECT_EQ(scene.arena()->liveCount(), 0u);
+    EXPECT_EQ(scene.arena()->blockCount(), 1u);
+}
+#endif
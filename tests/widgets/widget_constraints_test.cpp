@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bixlib/core/layout_types.h>
+#include <bixlib/parser/attribute_set.h>
+#include <bixlib/widgets/widget.h>
+#include <bixlib/widgets/widget_macros.h>
+
+#include <gtest/gtest.h>
+
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+
+/** Measures to a settable content size and remembers the limit it was measured with. */
+class Box : public LeafWidget {
+public:
+    BIX_WIDGET_DECLARE(Box)
+
+    Size content{20, 10};
+    Size lastMax{};
+
+    void onPaint(Canvas& canvas) override { BIX_UNUSED(canvas) }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        BIX_UNUSED(canvas)
+        BIX_UNUSED(available)
+        lastMax = max;
+        setMeasuredSize(content);
+    }
+};
+
+struct ConstraintsFixture {
+    SoftwareCanvas canvas{SizeI{100, 100}};
+    Box box;
+
+    Size measure(const Size& available = {200, 100}, const Size& max = {-1, -1}) {
+        box.measure(canvas, available, max);
+        return box.measuredSize();
+    }
+};
+} // namespace
+
+TEST(WidgetConstraintsTest, MinimumSizeEnlargesTheContent) {
+    ConstraintsFixture f;
+    f.box.setMinimumSize(Length::px(50), Length::px(30));
+    EXPECT_EQ(f.measure(), Size(50, 30));
+    EXPECT_EQ(f.box.constraints().minWidth, Length::px(50));
+}
+
+TEST(WidgetConstraintsTest, MaximumSizeLimitsTheContent) {
+    ConstraintsFixture f;
+    f.box.content = {100, 80};
+    // An unset length keeps the limit of that axis.
+    f.box.setMaximumSize(Length::px(40), Length());
+    EXPECT_EQ(f.measure(), Size(40, 80));
+    // The content is measured within the maximum, a looser parent limit is tightened.
+    EXPECT_EQ(f.box.lastMax, Size(40, -1));
+    f.measure({200, 100}, {30, 60});
+    EXPECT_EQ(f.box.lastMax, Size(30, 60));
+}
+
+TEST(WidgetConstraintsTest, MinimumWinsOverMaximum) {
+    ConstraintsFixture f;
+    f.box.setMaximumSize(Length::px(10), Length::px(10));
+    f.box.setMinimumSize(Length::px(30), Length::px(5));
+    EXPECT_EQ(f.measure(), Size(30, 10));
+}
+
+TEST(WidgetConstraintsTest, ChangedConstraintsMissTheMeasureCache) {
+    ConstraintsFixture f;
+    EXPECT_EQ(f.measure(), Size(20, 10));
+    f.box.setMinimumSize(Length::px(60), Length());
+    EXPECT_EQ(f.measure(), Size(60, 10));
+}
+
+TEST(WidgetConstraintsTest, AttributesSetTheConstraints) {
+    ConstraintsFixture f;
+    f.box.content = {10, 90};
+    AttributeSet attributes;
+    attributes.set(attrs::MinWidth, AttributeValue::fromLength(Length::px(60)));
+    attributes.set(attrs::MaxHeight, AttributeValue::fromLength(Length::percent(50)));
+    f.box.applyAttributes(attributes);
+
+    // Relative lengths resolve against the available size.
+    EXPECT_EQ(f.measure({200, 100}), Size(60, 50));
+    EXPECT_EQ(f.box.constraints().minHeight, Length::px(0));
+}
+
+TEST(WidgetMeasureCacheTest, RepeatedMeasureIsAnsweredFromTheCache) {
+    ConstraintsFixture f;
+    LayoutStats stats;
+    LayoutPass pass(stats);
+
+    f.measure();
+    f.box.content = {90, 90};
+    // Same constraints and a clean layout, the content is not asked again.
+    EXPECT_EQ(f.measure(), Size(20, 10));
+    EXPECT_EQ(stats.measured, 1);
+    EXPECT_EQ(stats.cached, 1);
+
+    f.measure({150, 100});
+    EXPECT_EQ(stats.measured, 2);
+    EXPECT_EQ(f.box.measuredSize(), Size(90, 90));
+}
+
+TEST(WidgetMeasureCacheTest, RequestLayoutInvalidatesTheCache) {
+    ConstraintsFixture f;
+    LayoutStats stats;
+    LayoutPass pass(stats);
+
+    f.measure();
+    f.box.content = {90, 90};
+    f.box.requestLayout();
+    EXPECT_EQ(f.measure(), Size(90, 90));
+    EXPECT_EQ(stats.measured, 2);
+    EXPECT_EQ(stats.cached, 0);
+}
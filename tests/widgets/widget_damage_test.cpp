@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <bixlib/core/scene.h>
+#include <bixlib/widgets/container.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "graphics/software/soft_canvas.h"
+
+using namespace bix;
+
+namespace {
+
+class Box : public LeafWidget {
+public:
+    BIX_WIDGET_DECLARE(Box)
+
+    Size size{20, 10};
+    int paints = 0;
+    bool invalidateWhilePainting = false;
+
+    void onPaint(Canvas& canvas) override {
+        BIX_UNUSED(canvas)
+        ++paints;
+        if (invalidateWhilePainting) {
+            invalidateWhilePainting = false;
+            invalidate();
+        }
+    }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        BIX_UNUSED(canvas)
+        BIX_UNUSED(available)
+        BIX_UNUSED(max)
+        setMeasuredSize(size);
+    }
+};
+
+/** Fills the window and places its only child at a settable position. */
+class Frame : public Container {
+public:
+    BIX_WIDGET_DECLARE(Frame)
+
+    float childX = 10;
+    float childY = 10;
+    Size size{}; // fills the available space while empty
+
+    void onPaint(Canvas& canvas) override { BIX_UNUSED(canvas) }
+
+    void onMeasure(Canvas& canvas, const Size& available, const Size& max) override {
+        for (const auto& child : mChildren) { child->measure(canvas, available, max); }
+        setMeasuredSize(size.isEmpty() ? available : size);
+    }
+
+    void onLayout(const Rect& rect) override {
+        BIX_UNUSED(rect)
+        for (const auto& child : mChildren) { child->layout({childX, childY, child->measuredSize()}); }
+    }
+};
+
+class NullHost : public WidgetHost {
+public:
+    void scheduleFrame(const Rect& dirtyRect) override { BIX_UNUSED(dirtyRect) }
+
+    void requestLayout() override {}
+
+    void captureFocus(Widget* widget) override { BIX_UNUSED(widget) }
+};
+
+bool covers(const DamageRegion& damage, const Rect& rect) {
+    return std::any_of(damage.rects().begin(), damage.rects().end(), [&rect](const Rect& r) {
+        return r.contains(rect);
+    });
+}
+
+struct SceneFixture {
+    SceneFixture() : scene(&host), canvas({200, 200}) {
+        auto root = std::make_unique<Frame>();
+        frame = root.get();
+        box = frame->addChild<Box>();
+        scene.setRoot(std::move(root));
+        scene.resize({200, 200});
+        scene.performLayout(canvas);
+        scene.paint(canvas);
+    }
+
+    NullHost host;
+    Scene scene;
+    SoftwareCanvas canvas;
+    Frame* frame = nullptr;
+    Box* box = nullptr;
+};
+} // namespace
+
+TEST(WidgetDamageTest, MovedAndResizedWidgetDamagesOldAndNewBounds) {
+    SceneFixture f;
+    ASSERT_TRUE(f.scene.damage().isEmpty());
+
+    f.box->size = {40, 20};
+    f.box->requestLayout();
+    f.frame->childX = 100;
+    f.frame->childY = 120;
+    ASSERT_TRUE(f.scene.performLayout(f.canvas));
+
+    EXPECT_TRUE(covers(f.scene.damage(), Rect(10, 10, 30, 20)));
+    EXPECT_TRUE(covers(f.scene.damage(), Rect(100, 120, 140, 140)));
+    // The rects are far apart and stay separate instead of repainting everything in between.
+    EXPECT_FALSE(covers(f.scene.damage(), Rect(10, 10, 140, 140)));
+}
+
+TEST(WidgetDamageTest, InvalidateWhilePaintingIsKeptForTheNextFrame) {
+    SceneFixture f;
+    const int paints = f.box->paints;
+
+    f.box->invalidateWhilePainting = true;
+    f.box->invalidate();
+    f.scene.paint(f.canvas);
+    EXPECT_EQ(f.box->paints, paints + 1);
+    EXPECT_TRUE(covers(f.scene.damage(), Rect(10, 10, 30, 20)));
+
+    f.scene.paint(f.canvas);
+    EXPECT_EQ(f.box->paints, paints + 2);
+    EXPECT_TRUE(f.scene.damage().isEmpty());
+}
+
+TEST(WidgetDamageTest, OverflowingChildOfUnclippedContainerIsRepainted) {
+    NullHost host;
+    Scene scene(&host);
+    SoftwareCanvas canvas({200, 200});
+    auto root = std::make_unique<Frame>();
+    auto* inner = root->addChild<Frame>();
+    inner->size = {20, 20};
+    inner->childX = 100;
+    inner->childY = 100;
+    inner->setBoundsClip(false);
+    auto* box = inner->addChild<Box>();
+    scene.setRoot(std::move(root));
+    scene.resize({200, 200});
+    scene.performLayout(canvas);
+    scene.paint(canvas);
+    const int paints = box->paints;
+
+    // The box lies outside of its parent, which does not clip it. The damage misses the parent but not the box.
+    box->invalidate();
+    EXPECT_TRUE(covers(scene.damage(), Rect(110, 110, 130, 120)));
+    scene.paint(canvas);
+    EXPECT_EQ(box->paints, paints + 1);
+}
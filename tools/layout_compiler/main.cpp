@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025-2026 Lynn <lynnplus90@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compiles an XML layout into the binary form read by bix::CompiledLayout.
+//
+// Usage: bix_layout_compiler <input.xml> <output.bxl>
+
+#include <bixlib/errors.h>
+#include <bixlib/parser/layout_writer.h>
+
+#include <tinyxml2.h>
+
+#include <fstream>
+#include <iostream>
+
+using namespace bix;
+
+namespace {
+void writeElement(LayoutWriter& writer, const tinyxml2::XMLElement& element) {
+    writer.beginElement(element.Name());
+    for (const auto* attr = element.FirstAttribute(); attr; attr = attr->Next()) {
+        writer.attribute(attr->Name(), attr->Value());
+    }
+    for (const auto* child = element.FirstChildElement(); child; child = child->NextSiblingElement()) {
+        writeElement(writer, *child);
+    }
+    writer.endElement();
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "usage: bix_layout_compiler <input.xml> <output.bxl>\n";
+        return 2;
+    }
+    const char* input = argv[1];
+    const char* output = argv[2];
+
+    tinyxml2::XMLDocument doc;
+    if (doc.LoadFile(input) != tinyxml2::XML_SUCCESS) {
+        std::cerr << input << ": " << doc.ErrorStr() << '\n';
+        return 1;
+    }
+    const auto* root = doc.RootElement();
+    if (!root) {
+        std::cerr << input << ": no root element\n";
+        return 1;
+    }
+
+    std::vector<std::byte> data;
+    try {
+        LayoutWriter writer;
+        writeElement(writer, *root);
+        data = writer.finish();
+    } catch (const Error& e) {
+        std::cerr << input << ": " << e.what() << '\n';
+        return 1;
+    }
+
+    std::ofstream file(output, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!file) {
+        std::cerr << output << ": write failed\n";
+        return 1;
+    }
+    return 0;
+}